@@ -269,6 +269,25 @@ sub trim
 	return $value;
 }
 
+=item C<getNativeProgram>
+Arguments: program-name
+Returns the path of a compiled fraTools program (see src/) in PATH, undef if not installed
+=cut
+sub getNativeProgram
+{
+	my $program = shift;
+	
+	for my $dir (split(':', $ENV{PATH}))
+	{
+		if (-f "$dir/$program" && -x "$dir/$program")
+		{
+			return "$dir/$program";
+		}
+	}
+	
+	return undef;
+}
+
 sub getTopBotStrandFromFlanks
 {
 	my $flanks = shift;
@@ -393,8 +412,31 @@ sub getAffyRefOppStrandFromFlanks
 	}
 }
 
+#the Affymetrix exception class SNPs are listed at the end of this file,
+#they are read on the first lookup rather than by every script using fralib
+my %AFFYMETRIX_EXCEPTION_CLASS;
+
+sub isInAffymetrixExceptionClass
+{
+    my $snp = shift;
+    
+    if (!%AFFYMETRIX_EXCEPTION_CLASS)
+    {
+        while (my $exceptionSNP = <AffymetrixExceptionClass::DATA>)
+        {
+            $exceptionSNP =~ s/\r?\n?$//;
+            $AFFYMETRIX_EXCEPTION_CLASS{$exceptionSNP}++;
+        }
+        close(AffymetrixExceptionClass::DATA);
+    }
+    
+    return exists($AFFYMETRIX_EXCEPTION_CLASS{$snp});
+}
+return 1;
+
 #list of snps
-my $affymetrixExceptionClassSNPs = <<EXCEPTION_CLASS_SNPS;
+package AffymetrixExceptionClass;
+__DATA__
 SNP_A-1780733
 SNP_A-1782432
 SNP_A-1784336
@@ -12024,15 +12066,3 @@ SNP_A-4262419
 SNP_A-4262518
 SNP_A-4263726
 SNP_A-4272372
-EXCEPTION_CLASS_SNPS
-
-my %AFFYMETRIX_EXCEPTION_CLASS;
-
-map {$AFFYMETRIX_EXCEPTION_CLASS{$_}++} (split(/\n/, $affymetrixExceptionClassSNPs));
-
-sub isInAffymetrixExceptionClass
-{
-    my $snp = shift;
-    return exists($AFFYMETRIX_EXCEPTION_CLASS{$snp});
-}
-return 1;
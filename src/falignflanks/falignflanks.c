@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fralib.h>
+
+static void flushbatch(FLANK_ALIGNMENT *pairs, char **keys, int pairNo, int threadNo)
+{
+    int k;
+
+    alignflanksbatch(pairs, pairNo, threadNo);
+
+    for (k=0; k<pairNo; k++)
+    {
+        printf("%s\t%d\t%d\t%s\t%s\n", keys[k], pairs[k].concordance, pairs[k].total,
+               pairs[k].aligned1, pairs[k].aligned2);
+        free(keys[k]);
+        free(pairs[k].flanks1);
+        free(pairs[k].flanks2);
+        free(pairs[k].aligned1);
+        free(pairs[k].aligned2);
+    }
+
+    fflush(stdout);
+}
+
+int main(int argc, char **argv)
+{
+    int i, pairNo = 0, lineNo = 0;
+    int threadNo = 0;
+    int batchSize = 100000;
+    char *INFILE = "-";
+    char *line = NULL;
+    char *fields[3];
+    char **keys;
+    size_t cap = 0;
+    FLANK_ALIGNMENT *pairs;
+    FILE *fp;
+
+    if(argc==2 && strcmp(argv[1], "-h")==0)
+    {
+        printf("usage: falignflanks [options] [flank-pairs-file]\n");
+        printf("\n");
+        printf("       -t       number of threads (default: number of processors)\n");
+        printf("       -b       pairs aligned per batch (default 100000)\n");
+        printf("       flank-pairs-file\n");
+        printf("                tab separated key, flanks-1, flanks-2 without a header,\n");
+        printf("                read from standard input if not given\n");
+        printf("\n");
+        printf("       example: falignflanks pairs.txt\n");
+        printf("\n");
+        printf("       Aligns the 5' and 3' arms of each pair of flanks as fannotatestrands'\n");
+        printf("       getAlignedFlanksSimilarity does and prints, in input order, the key,\n");
+        printf("       the concordant and total aligned non-gap positions and the 2 aligned\n");
+        printf("       flanks.  The similarity is concordant/total (0 if total is 0).\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"t:b:")) != -1)
+    {
+        switch(i)
+        {
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case 'b':
+                batchSize = atoi(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (optind < argc-1 || batchSize < 1)
+    {
+        fprintf(stderr, "At most 1 non-option argument expected: flank-pairs-file\n");
+        exit(1);
+    }
+
+    if (optind == argc-1)
+    {
+        INFILE = argv[optind];
+    }
+
+    threadNo = threadNo > 0 ? threadNo : getcpuno();
+    FRALLOC(pairs, batchSize, FLANK_ALIGNMENT);
+    FRALLOC(keys, batchSize, char *);
+
+    fp = xopen(INFILE, "r");
+    while (readline(fp, &line, &cap) != -1)
+    {
+        ++lineNo;
+        if (splitline(line, fields, 3, '\t') != 3)
+        {
+            fatal("%s: line %d does not have 3 columns\n", INFILE, lineNo);
+        }
+
+        keys[pairNo] = strdup(fields[0]);
+        pairs[pairNo].flanks1 = strdup(fields[1]);
+        pairs[pairNo].flanks2 = strdup(fields[2]);
+
+        if (++pairNo == batchSize)
+        {
+            flushbatch(pairs, keys, pairNo, threadNo);
+            pairNo = 0;
+        }
+    }
+    flushbatch(pairs, keys, pairNo, threadNo);
+
+    if (fp != stdin)
+    {
+        fclose(fp);
+    }
+    free(line);
+    free(pairs);
+    free(keys);
+
+    return 0;
+}
@@ -0,0 +1,864 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <fralib.h>
+
+/* words of a column block and sample pairs between flushes of the vertical counters */
+#define COLUMN_BLOCK 8
+#define FLUSH_PAIRS 255
+
+/* matrix rows computed together, and the words of a block they share */
+#define MATRIX_ROWS 64
+#define MATRIX_WORDS 512
+
+/* genotypes 0, 1, 2 and -1 in the report order */
+#define GENOTYPE_NO 4
+static char *genotypeLabels[GENOTYPE_NO] = {"0", "1", "2", "-1"};
+
+/*
+ * the row and column ids of a genotype file, an id repeated in the file
+ * stands for its last row or column as in fcmp.
+ */
+typedef struct
+{
+    char *file;
+    int tg;
+    char *label;
+    int colNo;
+    uint32_t *colKeys;
+    KEY_TABLE cols;
+    int32_t *lastCols;
+    long rowNo;
+    long rowCap;
+    uint32_t *rowKeys;
+    KEY_TABLE rows;
+    long *lastRows;
+} GENO_INDEX;
+
+typedef struct
+{
+    uint32_t transitions[GENOTYPE_NO][GENOTYPE_NO];
+} CONCORDANCE;
+
+/* bit-sliced counters of the transitions of 64 columns */
+typedef uint64_t COUNTER_PLANES[GENOTYPE_NO][GENOTYPE_NO][8];
+
+typedef struct
+{
+    uint32_t a;
+    uint32_t b;
+    char *labelA;
+    char *labelB;
+} PAIR;
+
+typedef struct
+{
+    GENOTYPES *a;
+    GENOTYPES *b;
+    PAIR *pairs;
+    long pairNo;
+    CONCORDANCE *pairStats;
+    CONCORDANCE *vectorStats;
+    uint64_t lastLive;
+
+    long matrixFirst;
+    long matrixRows;
+    uint32_t *concordant;
+    uint32_t *valid;
+} COMPARISON;
+
+typedef struct
+{
+    COMPARISON *cmp;
+    pthread_t thread;
+    long first;
+    long last;
+} WORKER;
+
+static void indexgenofile(GENO_INDEX *gi, char *file)
+{
+    FILE *fp;
+    char *line = NULL, *s, *t;
+    size_t cap = 0;
+    uint32_t k;
+    int c;
+
+    memset(gi, 0, sizeof(GENO_INDEX));
+    gi->file = file;
+
+    fp = zopen(file);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", file);
+    }
+
+    gi->colNo = countfields(line, '\t') - 1;
+    FRALLOC(gi->colKeys, MAX(gi->colNo, 1), uint32_t);
+    FRALLOC(gi->lastCols, MAX(gi->colNo, 1), int32_t);
+    s = strchr(line, '\t');
+    gi->label = strndup(line, s == NULL ? strlen(line) : (size_t) (s - line));
+    if (strcmp(gi->label, "sample-id") == 0)
+    {
+        gi->tg = 0;
+    }
+    else if (strcmp(gi->label, "snp-id") == 0 || strcmp(gi->label, "marker-id") == 0)
+    {
+        gi->tg = 1;
+    }
+    else
+    {
+        fatal("%s not a gt or tg file\n", file);
+    }
+
+    for (c=0; c<gi->colNo; c++)
+    {
+        t = strchr(++s, '\t');
+        k = keytableget(&gi->cols, s, t == NULL ? strlen(s) : (size_t) (t - s));
+        gi->colKeys[c] = k;
+        gi->lastCols[k] = c;
+        s = t;
+    }
+
+    while (readline(fp, &line, &cap) != -1)
+    {
+        if (gi->rowNo == gi->rowCap)
+        {
+            gi->rowCap = gi->rowCap ? 2*gi->rowCap : 65536;
+            gi->rowKeys = (uint32_t *) xrealloc(gi->rowKeys, gi->rowCap*sizeof(uint32_t));
+            gi->lastRows = (long *) xrealloc(gi->lastRows, gi->rowCap*sizeof(long));
+        }
+
+        s = strchr(line, '\t');
+        k = keytableget(&gi->rows, line, s == NULL ? strlen(line) : (size_t) (s - line));
+        gi->rowKeys[gi->rowNo] = k;
+        gi->lastRows[k] = gi->rowNo++;
+    }
+    zclose(fp, file);
+    free(line);
+}
+
+/*
+ * packs the elements, rows or columns, numbered by elementKeys as bit
+ * vectors over the other ids, numbered by vectorKeys.  -1 leaves an id out.
+ */
+static GENOTYPES *packgenofile(GENO_INDEX *gi, int byRows, int32_t *elementKeys, int elementNo, int32_t *vectorKeys, int vectorNo)
+{
+    GENOTYPES *gt;
+    FILE *fp;
+    char *line = NULL, *s;
+    size_t cap = 0;
+    long len, r = 0;
+    int32_t *elementOf, *vectorOf, e, k;
+    unsigned char *codes;
+    uint64_t bit;
+    int c;
+
+    FRALLOC(gt, 1, GENOTYPES);
+    gt->sampleNo = elementNo;
+    gt->snpNo = vectorNo;
+    gt->wordNo = MAX((vectorNo + 63) / 64, 1);
+    FRALLOC(gt->geno, ((size_t) MAX(elementNo, 1))*gt->wordNo*2, uint64_t);
+
+    /* only the last row or column of an id is packed */
+    FRALLOC(elementOf, MAX(byRows ? gi->rowNo : gi->colNo, 1), int32_t);
+    FRALLOC(vectorOf, MAX(byRows ? gi->colNo : gi->rowNo, 1), int32_t);
+    for (r=0; r<gi->rowNo; r++)
+    {
+        k = gi->lastRows[gi->rowKeys[r]] == r ? gi->rowKeys[r] : -1;
+        (byRows ? elementOf : vectorOf)[r] = k == -1 ? -1 : (byRows ? elementKeys : vectorKeys)[k];
+    }
+    for (c=0; c<gi->colNo; c++)
+    {
+        k = gi->lastCols[gi->colKeys[c]] == c ? gi->colKeys[c] : -1;
+        (byRows ? vectorOf : elementOf)[c] = k == -1 ? -1 : (byRows ? vectorKeys : elementKeys)[k];
+    }
+
+    FRALLOC(codes, MAX(gi->colNo, 1), unsigned char);
+    fp = zopen(gi->file);
+    readline(fp, &line, &cap);
+    for (r=0; (len = readline(fp, &line, &cap)) != -1; r++)
+    {
+        if (byRows ? elementOf[r] == -1 : vectorOf[r] == -1)
+        {
+            continue;
+        }
+
+        s = strchr(line, '\t');
+        if (gi->colNo > 0 && (s == NULL || decodebedcodes(s + 1, line + len, gi->colNo, codes) == NULL))
+        {
+            fatal("%s: row %ld does not have %d genotypes\n", gi->file, r+2, gi->colNo);
+        }
+
+        /* the .bed codes of the decoder carry the planes, p in the high and q in the low bit */
+        for (c=0; c<gi->colNo; c++)
+        {
+            e = byRows ? elementOf[r] : elementOf[c];
+            k = byRows ? vectorOf[c] : vectorOf[r];
+            if (e != -1 && k != -1)
+            {
+                bit = 1ULL << (k & 63);
+                GENO_P(gt, e, k >> 6) |= (codes[c] >> 1) ? bit : 0;
+                GENO_Q(gt, e, k >> 6) |= (codes[c] & 1) ? bit : 0;
+            }
+        }
+    }
+    zclose(fp, gi->file);
+
+    free(line);
+    free(codes);
+    free(elementOf);
+    free(vectorOf);
+
+    return gt;
+}
+
+/* the genotype masks of a word, the padding is excluded from the 0 and -1 masks */
+static inline void genotypemasks(uint64_t p, uint64_t q, uint64_t live, uint64_t *m)
+{
+    m[0] = ~p & ~q & live;
+    m[1] = p & ~q;
+    m[2] = p & q;
+    m[3] = ~p & q & live;
+}
+
+static void *pairworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    COMPARISON *cmp = w->cmp;
+    CONCORDANCE *stats;
+    uint64_t ma[GENOTYPE_NO], mb[GENOTYPE_NO], live;
+    long i;
+    int word, x, y;
+
+    for (i=w->first; i<w->last; i++)
+    {
+        stats = &cmp->pairStats[i];
+        for (word=0; word<cmp->a->wordNo; word++)
+        {
+            live = word == cmp->a->wordNo-1 ? cmp->lastLive : ~0ULL;
+            genotypemasks(GENO_P(cmp->a, cmp->pairs[i].a, word), GENO_Q(cmp->a, cmp->pairs[i].a, word), live, ma);
+            genotypemasks(GENO_P(cmp->b, cmp->pairs[i].b, word), GENO_Q(cmp->b, cmp->pairs[i].b, word), live, mb);
+            for (x=0; x<GENOTYPE_NO; x++)
+            {
+                for (y=0; y<GENOTYPE_NO; y++)
+                {
+                    stats->transitions[x][y] += __builtin_popcountll(ma[x] & mb[y]);
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* adds a mask to bit-sliced counters of up to 255 */
+static inline void addmask(uint64_t *planes, uint64_t m)
+{
+    uint64_t carry;
+    int i;
+
+    for (i=0; m && i<8; i++)
+    {
+        carry = planes[i] & m;
+        planes[i] ^= m;
+        m = carry;
+    }
+}
+
+static void flushplanes(COUNTER_PLANES *planes, int wordNo, CONCORDANCE *stats)
+{
+    int word, x, y, b, i;
+    uint32_t n;
+
+    for (word=0; word<wordNo; word++)
+    {
+        for (x=0; x<GENOTYPE_NO; x++)
+        {
+            for (y=0; y<GENOTYPE_NO; y++)
+            {
+                for (b=0; b<64; b++)
+                {
+                    for (n=0, i=0; i<8; i++)
+                    {
+                        n |= ((planes[word][x][y][i] >> b) & 1) << i;
+                    }
+                    stats[word*64 + b].transitions[x][y] += n;
+                }
+            }
+        }
+    }
+    memset(planes, 0, wordNo*sizeof(COUNTER_PLANES));
+}
+
+/* the compared columns over all pairs, a block of words at a time */
+static void *vectorworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    COMPARISON *cmp = w->cmp;
+    COUNTER_PLANES *planes;
+    uint64_t ma[GENOTYPE_NO], mb[GENOTYPE_NO], live;
+    long i, word, from, to;
+    int x, y;
+
+    FRALLOC(planes, COLUMN_BLOCK, COUNTER_PLANES);
+    for (from=w->first; from<w->last; from=to)
+    {
+        to = MIN(from + COLUMN_BLOCK, w->last);
+        for (i=0; i<cmp->pairNo; i++)
+        {
+            for (word=from; word<to; word++)
+            {
+                live = word == cmp->a->wordNo-1 ? cmp->lastLive : ~0ULL;
+                genotypemasks(GENO_P(cmp->a, cmp->pairs[i].a, word), GENO_Q(cmp->a, cmp->pairs[i].a, word), live, ma);
+                genotypemasks(GENO_P(cmp->b, cmp->pairs[i].b, word), GENO_Q(cmp->b, cmp->pairs[i].b, word), live, mb);
+                for (x=0; x<GENOTYPE_NO; x++)
+                {
+                    for (y=0; y<GENOTYPE_NO; y++)
+                    {
+                        addmask(planes[word-from][x][y], ma[x] & mb[y]);
+                    }
+                }
+            }
+
+            if (i % FLUSH_PAIRS == FLUSH_PAIRS-1)
+            {
+                flushplanes(planes, to - from, cmp->vectorStats + from*64);
+            }
+        }
+        flushplanes(planes, to - from, cmp->vectorStats + from*64);
+    }
+    free(planes);
+
+    return NULL;
+}
+
+/* concordant calls are those with neither call missing and no bit of the planes differing */
+static void *matrixworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    COMPARISON *cmp = w->cmp;
+    uint64_t pa, qa, pb, qb, called, live;
+    uint32_t *concordant, *valid;
+    long i, j, word, from, to;
+
+    for (from=0; from<cmp->a->wordNo; from=to)
+    {
+        to = MIN(from + MATRIX_WORDS, cmp->a->wordNo);
+        for (j=w->first; j<w->last; j++)
+        {
+            for (i=0; i<cmp->matrixRows; i++)
+            {
+                concordant = &cmp->concordant[i*cmp->b->sampleNo + j];
+                valid = &cmp->valid[i*cmp->b->sampleNo + j];
+                for (word=from; word<to; word++)
+                {
+                    live = word == cmp->a->wordNo-1 ? cmp->lastLive : ~0ULL;
+                    pa = GENO_P(cmp->a, cmp->matrixFirst + i, word);
+                    qa = GENO_Q(cmp->a, cmp->matrixFirst + i, word);
+                    pb = GENO_P(cmp->b, j, word);
+                    qb = GENO_Q(cmp->b, j, word);
+                    called = ~(~pa & qa) & ~(~pb & qb) & live;
+                    *valid += __builtin_popcountll(called);
+                    *concordant += __builtin_popcountll(~((pa ^ pb) | (qa ^ qb)) & called);
+                }
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void runworkers(WORKER *workers, int threadNo, long n, void *(*worker)(void *))
+{
+    int t;
+
+    for (t=0; t<threadNo; t++)
+    {
+        workers[t].first = n*t/threadNo;
+        workers[t].last = n*(t+1)/threadNo;
+        if (pthread_create(&workers[t].thread, NULL, worker, &workers[t]))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (t=0; t<threadNo; t++)
+    {
+        pthread_join(workers[t].thread, NULL);
+    }
+}
+
+/* a row of the fcmp report */
+static void printconcordance(FILE *fp, char *labelA, char *labelB, CONCORDANCE *stats)
+{
+    long similarity = 0, valid = 0, countA[GENOTYPE_NO], countB[GENOTYPE_NO];
+    int x, y;
+
+    memset(countA, 0, sizeof(countA));
+    memset(countB, 0, sizeof(countB));
+    for (x=0; x<GENOTYPE_NO; x++)
+    {
+        for (y=0; y<GENOTYPE_NO; y++)
+        {
+            countA[x] += stats->transitions[x][y];
+            countB[y] += stats->transitions[x][y];
+            valid += x < 3 && y < 3 ? stats->transitions[x][y] : 0;
+        }
+        similarity += x < 3 ? stats->transitions[x][x] : 0;
+    }
+
+    fprintf(fp, "%s", labelA);
+    if (labelB != NULL)
+    {
+        fprintf(fp, "\t%s", labelB);
+    }
+    if (valid != 0)
+    {
+        fprintf(fp, "\t%f\t%ld", (double) similarity/valid, valid);
+    }
+    else
+    {
+        fprintf(fp, "\tn/a\t%ld", valid);
+    }
+    for (x=0; x<GENOTYPE_NO; x++)
+    {
+        fprintf(fp, "\t%ld", countA[x]);
+    }
+    for (x=0; x<GENOTYPE_NO; x++)
+    {
+        fprintf(fp, "\t%ld", countB[x]);
+    }
+    for (x=0; x<GENOTYPE_NO; x++)
+    {
+        for (y=0; y<GENOTYPE_NO; y++)
+        {
+            fprintf(fp, "\t%u", stats->transitions[x][y]);
+        }
+    }
+    fprintf(fp, "\n");
+}
+
+static void printheader(FILE *fp, char *label, int duplicate)
+{
+    int x, y;
+
+    fprintf(fp, "%s", label);
+    if (duplicate)
+    {
+        fprintf(fp, "\tduplicate-%s", label);
+    }
+    fprintf(fp, "\tsimilarity\tN\t0A\t1A\t2A\t-1A\t0B\t1B\t2B\t-1B");
+    for (x=0; x<GENOTYPE_NO; x++)
+    {
+        for (y=0; y<GENOTYPE_NO; y++)
+        {
+            fprintf(fp, "\t%s->%s", genotypeLabels[x], genotypeLabels[y]);
+        }
+    }
+    fprintf(fp, "\n");
+}
+
+/* numbers the ids of one dimension of A that are also in B, in A order */
+static int commonkeys(KEY_TABLE *a, KEY_TABLE *b, int32_t *keysA, int32_t *keysB, uint32_t **ids)
+{
+    uint32_t k;
+    long kb;
+    int n = 0;
+
+    FRALLOC(*ids, MAX(a->n, 1), uint32_t);
+    for (k=0; k<b->n; k++)
+    {
+        keysB[k] = -1;
+    }
+    for (k=0; k<a->n; k++)
+    {
+        keysA[k] = -1;
+        if ((kb = keytablefind(b, keytablekey(a, k), a->entries[k].keyLength, a->entries[k].hash)) != -1)
+        {
+            keysA[k] = keysB[kb] = n;
+            (*ids)[n++] = k;
+        }
+    }
+
+    return n;
+}
+
+int main(int argc, char **argv)
+{
+    int i, t, fieldNo, colA = -1, colB = -1, threadNo = 0, vectorNo, elementNoA = 0, elementNoB = 0, sameFile;
+    char *COMPAREFILE = NULL, *OUTFILE = NULL, *VECTORFILE = NULL, *MATRIXFILE = NULL, *line = NULL, **fields, *name, *s;
+    char *labelA, *labelB;
+    size_t cap = 0;
+    long k, ka, kb, pairCap = 0, lineNo, similarity, valid;
+    int x, y;
+    int32_t *vectorKeysA, *vectorKeysB, *elementKeysA, *elementKeysB;
+    uint32_t *vectorIDs, *elementIDsA, *elementIDsB;
+    GENO_INDEX indexA, indexB, *ga, *gb;
+    KEY_TABLE *vectorsA, *vectorsB, *elementsA, *elementsB;
+    COMPARISON cmp;
+    CONCORDANCE *stats;
+    WORKER *workers;
+    FILE *fp, *out;
+
+    if(argc==1)
+    {
+        printf("usage: fconcord [options] <genotype-file-a> [genotype-file-b]\n");
+        printf("\n");
+        printf("       -c       compare list of pairs in 1 genotype file\n");
+        printf("                a)sample-id-a, b)sample-id-b for a gt file\n");
+        printf("                a)snp-id-a, b)snp-id-b for a tg file\n");
+        printf("       -o       output file of the compared rows\n");
+        printf("       -r       output file of the compared columns, over all compared rows\n");
+        printf("       -m       all-vs-all sample concordance matrix file, the samples\n");
+        printf("                of a against those of b (or of a against a)\n");
+        printf("       -t       number of threads (default: number of processors)\n");
+        printf("\n");
+        printf("       example: fconcord -o pscalare-paltum.txt pscalare.gt paltum.gt\n");
+        printf("                fconcord -c pscalare-compare.txt pscalare.gt\n");
+        printf("                fconcord -m pscalare-paltum-matrix.txt pscalare.tg paltum.tg\n");
+        printf("\n");
+        printf("       The concordance engine of fcmp.  Rows common to both files (or the\n");
+        printf("       listed pairs) are compared over the common columns, writing the\n");
+        printf("       report of fcmp.  The genotypes are packed 2 bits to a call once\n");
+        printf("       the ids of both files are aligned, and compared over whole words.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"c:o:r:m:t:")) != -1)
+    {
+        switch(i)
+        {
+            case 'c':
+                COMPAREFILE = optarg;
+                break;
+            case 'o':
+                OUTFILE = optarg;
+                break;
+            case 'r':
+                VECTORFILE = optarg;
+                break;
+            case 'm':
+                MATRIXFILE = optarg;
+                break;
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if ((COMPAREFILE != NULL && optind != argc-1) || (COMPAREFILE == NULL && MATRIXFILE == NULL && optind != argc-2) ||
+        (MATRIXFILE != NULL && (COMPAREFILE != NULL || VECTORFILE != NULL || optind < argc-2 || optind > argc-1)))
+    {
+        fprintf(stderr, "1 genotype file with a compare list, 2 genotype files, or 1 or 2 genotype files for a matrix expected\n");
+        exit(1);
+    }
+
+    threadNo = threadNo > 0 ? threadNo : getcpuno();
+    FRALLOC(workers, threadNo, WORKER);
+    memset(&cmp, 0, sizeof(COMPARISON));
+    for (t=0; t<threadNo; t++)
+    {
+        workers[t].cmp = &cmp;
+    }
+
+    ga = &indexA;
+    gb = optind == argc-1 ? &indexA : &indexB;
+    sameFile = ga == gb;
+    indexgenofile(ga, argv[optind]);
+    if (!sameFile)
+    {
+        indexgenofile(gb, argv[optind+1]);
+        if (ga->tg != gb->tg)
+        {
+            fatal("Input files should be genotype files in the same orientation.\n");
+        }
+    }
+
+    /* the matrix compares samples, the columns of tg files */
+    if (MATRIXFILE != NULL && ga->tg)
+    {
+        vectorsA = &ga->rows;
+        vectorsB = &gb->rows;
+        elementsA = &ga->cols;
+        elementsB = &gb->cols;
+    }
+    else
+    {
+        vectorsA = &ga->cols;
+        vectorsB = &gb->cols;
+        elementsA = &ga->rows;
+        elementsB = &gb->rows;
+    }
+
+    FRALLOC(vectorKeysA, MAX(vectorsA->n, 1), int32_t);
+    FRALLOC(vectorKeysB, MAX(vectorsB->n, 1), int32_t);
+    vectorNo = commonkeys(vectorsA, vectorsB, vectorKeysA, vectorKeysB, &vectorIDs);
+    cmp.lastLive = vectorNo % 64 ? (1ULL << (vectorNo % 64)) - 1 : ~0ULL;
+
+    FRALLOC(elementKeysA, MAX(elementsA->n, 1), int32_t);
+    FRALLOC(elementKeysB, MAX(elementsB->n, 1), int32_t);
+    FRALLOC(elementIDsA, MAX(elementsA->n, 1), uint32_t);
+    FRALLOC(elementIDsB, MAX(elementsB->n, 1), uint32_t);
+    for (k=0; k<elementsA->n; k++)
+    {
+        elementKeysA[k] = -1;
+    }
+    for (k=0; k<elementsB->n; k++)
+    {
+        elementKeysB[k] = -1;
+    }
+
+    if (MATRIXFILE != NULL)
+    {
+        for (k=0; k<elementsA->n; k++)
+        {
+            elementIDsA[elementNoA] = k;
+            elementKeysA[k] = elementNoA++;
+        }
+        for (k=0; k<elementsB->n; k++)
+        {
+            elementIDsB[elementNoB] = k;
+            elementKeysB[k] = elementNoB++;
+        }
+    }
+    else
+    {
+        /* the pairs, in compare list order or in the row order of b */
+        if (COMPAREFILE != NULL)
+        {
+            fp = zopen(COMPAREFILE);
+            if (readline(fp, &line, &cap) == -1)
+            {
+                fatal("%s is empty\n", COMPAREFILE);
+            }
+            fieldNo = countfields(line, '\t');
+            FRALLOC(fields, fieldNo, char *);
+            splitline(line, fields, fieldNo, '\t');
+            for (i=0; i<fieldNo; i++)
+            {
+                if (strcmp(fields[i], ga->tg ? "snp-id-a" : "sample-id-a") == 0)
+                {
+                    colA = i;
+                }
+                else if (strcmp(fields[i], ga->tg ? "snp-id-b" : "sample-id-b") == 0)
+                {
+                    colB = i;
+                }
+            }
+            if (colA == -1 || colB == -1)
+            {
+                fatal("Compare list is expected to have either (sample-id-a, sample-id-b) for a gt-file or (snp-id-a, snp-id-b) for a tg-file\n");
+            }
+
+            for (lineNo=2; readline(fp, &line, &cap) != -1; lineNo++)
+            {
+                if (splitline(line, fields, fieldNo, '\t') <= MAX(colA, colB))
+                {
+                    fatal("Compare list not correctly defined\n");
+                }
+
+                ka = keytablefind(elementsA, fields[colA], strlen(fields[colA]), hashbytes(fields[colA], strlen(fields[colA])));
+                kb = keytablefind(elementsB, fields[colB], strlen(fields[colB]), hashbytes(fields[colB], strlen(fields[colB])));
+                if (ka == -1 || kb == -1)
+                {
+                    fprintf(stderr, "%s not in %s, (%s, %s) pair discarded\n", ka == -1 ? fields[colA] : fields[colB],
+                            ka == -1 ? ga->file : gb->file, fields[colA], fields[colB]);
+                    continue;
+                }
+
+                if (cmp.pairNo == pairCap)
+                {
+                    pairCap = pairCap ? 2*pairCap : 1024;
+                    cmp.pairs = (PAIR *) xrealloc(cmp.pairs, pairCap*sizeof(PAIR));
+                }
+                cmp.pairs[cmp.pairNo].a = ka;
+                cmp.pairs[cmp.pairNo].b = kb;
+                cmp.pairs[cmp.pairNo].labelA = keytablekey(elementsA, ka);
+                cmp.pairs[cmp.pairNo++].labelB = keytablekey(elementsB, kb);
+            }
+            zclose(fp, COMPAREFILE);
+            free(fields);
+        }
+        else
+        {
+            for (k=0; k<gb->rowNo; k++)
+            {
+                kb = gb->rowKeys[k];
+                if ((ka = keytablefind(elementsA, keytablekey(elementsB, kb), elementsB->entries[kb].keyLength, elementsB->entries[kb].hash)) == -1)
+                {
+                    continue;
+                }
+
+                if (cmp.pairNo == pairCap)
+                {
+                    pairCap = pairCap ? 2*pairCap : 1024;
+                    cmp.pairs = (PAIR *) xrealloc(cmp.pairs, pairCap*sizeof(PAIR));
+                }
+                cmp.pairs[cmp.pairNo].a = ka;
+                cmp.pairs[cmp.pairNo].b = kb;
+                cmp.pairs[cmp.pairNo].labelA = keytablekey(elementsA, ka);
+                cmp.pairs[cmp.pairNo++].labelB = NULL;
+            }
+
+            if (vectorNo == 0 || cmp.pairNo == 0)
+            {
+                fatal("There are no common elements to compare in %s and %s\n", ga->file, gb->file);
+            }
+        }
+
+        /* only the rows of the pairs are packed */
+        for (k=0; k<cmp.pairNo; k++)
+        {
+            if (elementKeysA[cmp.pairs[k].a] == -1)
+            {
+                elementIDsA[elementNoA] = cmp.pairs[k].a;
+                elementKeysA[cmp.pairs[k].a] = elementNoA++;
+            }
+            if (sameFile)
+            {
+                if (elementKeysA[cmp.pairs[k].b] == -1)
+                {
+                    elementIDsA[elementNoA] = cmp.pairs[k].b;
+                    elementKeysA[cmp.pairs[k].b] = elementNoA++;
+                }
+            }
+            else if (elementKeysB[cmp.pairs[k].b] == -1)
+            {
+                elementIDsB[elementNoB] = cmp.pairs[k].b;
+                elementKeysB[cmp.pairs[k].b] = elementNoB++;
+            }
+        }
+        for (k=0; k<cmp.pairNo; k++)
+        {
+            cmp.pairs[k].a = elementKeysA[cmp.pairs[k].a];
+            cmp.pairs[k].b = sameFile ? elementKeysA[cmp.pairs[k].b] : elementKeysB[cmp.pairs[k].b];
+        }
+    }
+
+    cmp.a = packgenofile(ga, !(MATRIXFILE != NULL && ga->tg), elementKeysA, elementNoA, vectorKeysA, vectorNo);
+    cmp.b = sameFile ? cmp.a : packgenofile(gb, !(MATRIXFILE != NULL && gb->tg), elementKeysB, elementNoB, vectorKeysB, vectorNo);
+    if (sameFile && MATRIXFILE != NULL)
+    {
+        elementIDsB = elementIDsA;
+    }
+
+    if (MATRIXFILE != NULL)
+    {
+        out = xopen(MATRIXFILE, "w");
+        fprintf(out, "sample-id");
+        for (k=0; k<cmp.b->sampleNo; k++)
+        {
+            fprintf(out, "\t%s", keytablekey(elementsB, elementIDsB[k]));
+        }
+        fprintf(out, "\n");
+
+        FRALLOC(cmp.concordant, ((size_t) MATRIX_ROWS)*MAX(cmp.b->sampleNo, 1), uint32_t);
+        FRALLOC(cmp.valid, ((size_t) MATRIX_ROWS)*MAX(cmp.b->sampleNo, 1), uint32_t);
+        for (cmp.matrixFirst=0; cmp.matrixFirst<cmp.a->sampleNo; cmp.matrixFirst+=MATRIX_ROWS)
+        {
+            cmp.matrixRows = MIN(MATRIX_ROWS, cmp.a->sampleNo - cmp.matrixFirst);
+            memset(cmp.concordant, 0, ((size_t) MATRIX_ROWS)*cmp.b->sampleNo*sizeof(uint32_t));
+            memset(cmp.valid, 0, ((size_t) MATRIX_ROWS)*cmp.b->sampleNo*sizeof(uint32_t));
+            runworkers(workers, MAX(1, MIN(threadNo, cmp.b->sampleNo)), cmp.b->sampleNo, matrixworker);
+
+            for (i=0; i<cmp.matrixRows; i++)
+            {
+                fprintf(out, "%s", keytablekey(elementsA, elementIDsA[cmp.matrixFirst + i]));
+                for (k=0; k<cmp.b->sampleNo; k++)
+                {
+                    if (cmp.valid[i*cmp.b->sampleNo + k])
+                    {
+                        fprintf(out, "\t%f", (double) cmp.concordant[i*cmp.b->sampleNo + k]/cmp.valid[i*cmp.b->sampleNo + k]);
+                    }
+                    else
+                    {
+                        fprintf(out, "\tn/a");
+                    }
+                }
+                fprintf(out, "\n");
+            }
+        }
+        fclose(out);
+
+        return 0;
+    }
+
+    FRALLOC(cmp.pairStats, MAX(cmp.pairNo, 1), CONCORDANCE);
+    runworkers(workers, MAX(1, MIN(threadNo, cmp.pairNo)), cmp.pairNo, pairworker);
+
+    if (OUTFILE == NULL)
+    {
+        name = (s = strrchr(ga->file, '/')) == NULL ? strdup(ga->file) : strdup(s + 1);
+        if ((s = strchr(name, '.')) != NULL)
+        {
+            *s = '\0';
+        }
+        labelA = name;
+        name = (s = strrchr(gb->file, '/')) == NULL ? strdup(gb->file) : strdup(s + 1);
+        if ((s = strchr(name, '.')) != NULL)
+        {
+            *s = '\0';
+        }
+        labelB = name;
+        FRALLOC(OUTFILE, strlen(labelA) + strlen(labelB) + 32, char);
+        if (COMPAREFILE != NULL)
+        {
+            sprintf(OUTFILE, "%s-call-comparison.txt", labelA);
+        }
+        else
+        {
+            sprintf(OUTFILE, "%s-%s-call-comparison.txt", labelA, labelB);
+        }
+    }
+
+    out = xopen(OUTFILE, "w");
+    printheader(out, ga->label, COMPAREFILE != NULL);
+    for (k=0; k<cmp.pairNo; k++)
+    {
+        stats = &cmp.pairStats[k];
+        similarity = stats->transitions[0][0] + stats->transitions[1][1] + stats->transitions[2][2];
+        valid = 0;
+        for (x=0; x<3; x++)
+        {
+            for (y=0; y<3; y++)
+            {
+                valid += stats->transitions[x][y];
+            }
+        }
+        if (valid != 0)
+        {
+            printf(" %ld/%ld = %f - total: %u\n", similarity, valid, (double) similarity/valid, ga->cols.n);
+        }
+        else
+        {
+            printf(" n/a, no known genotype to compare\n");
+        }
+
+        printconcordance(out, cmp.pairs[k].labelA, cmp.pairs[k].labelB, stats);
+    }
+    fclose(out);
+
+    /* the compared columns, SNPs of gt files and samples of tg files */
+    if (VECTORFILE != NULL)
+    {
+        FRALLOC(cmp.vectorStats, ((size_t) cmp.a->wordNo)*64, CONCORDANCE);
+        runworkers(workers, MAX(1, MIN(threadNo, cmp.a->wordNo)), cmp.a->wordNo, vectorworker);
+
+        out = xopen(VECTORFILE, "w");
+        printheader(out, ga->tg ? "sample-id" : "snp-id", 0);
+        for (k=0; k<vectorNo; k++)
+        {
+            printconcordance(out, keytablekey(vectorsA, vectorIDs[k]), NULL, &cmp.vectorStats[k]);
+        }
+        fclose(out);
+    }
+
+    return 0;
+}
@@ -0,0 +1,268 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <fralib.h>
+
+#define LOOKUP_BATCH 65536
+
+/* the populations in the order fannotatesnps joins their HapMap tables */
+static char *populations[DBSNP_POPULATION_NO] = {"CHB", "JPT", "CEU", "YRI"};
+
+static void printsummary(DBSNP_INDEX *di)
+{
+    DBSNP_INDEX_HEADER *h = di->header;
+    int p;
+
+    printf("Summary for %s\n\n", di->file);
+    printf("Build: %s\n", h->build);
+    printf("rs Count: %u\n", h->keyNo);
+    printf("Location Count: %u\n", h->locationNo);
+    printf("HapMap Count: %u\n", h->hapmapNo);
+    printf("HapMap Populations:");
+    for (p=0; p<DBSNP_POPULATION_NO; p++)
+    {
+        printf(" %s", h->populations[p]);
+    }
+    printf("\n\n");
+}
+
+/* the HapMap row of a population, or \N when the rs number was not genotyped */
+static void printhapmap(DBSNP_INDEX *di, DBSNP_RECORD *record, int p, uint32_t row)
+{
+    DBSNP_HAPMAP *h;
+
+    if (record == NULL || record->hapmapNo[p] == 0)
+    {
+        printf("\t\\N\t\\N\t\\N\t\\N\t\\N\t\\N\t\\N");
+    }
+    else
+    {
+        h = &di->hapmaps[record->hapmap[p] - 1 + row];
+        printf("\t%c\t%s\t%c\t%u\t%c\t%u\t%u", h->strand, di->strings + h->observed, h->allele1,
+               h->homoCount1, h->allele2, h->homoCount2, h->heteroCount);
+    }
+}
+
+/*
+ * missing values are printed as \N, as mysql dumps NULLs, and a location is
+ * repeated for every combination of HapMap rows as the left joins return it
+ */
+static void printrows(DBSNP_INDEX *di, char *rsID, DBSNP_RECORD *record, int hapmap)
+{
+    DBSNP_LOCATION *l;
+    uint32_t i, rows[DBSNP_POPULATION_NO], rowNos[DBSNP_POPULATION_NO];
+    int p;
+
+    for (p=0; p<DBSNP_POPULATION_NO; p++)
+    {
+        rowNos[p] = hapmap && record != NULL ? MAX(record->hapmapNo[p], 1) : 1;
+    }
+
+    for (i=0; i<(record == NULL ? 1 : MAX(record->locationNo, 1)); i++)
+    {
+        memset(rows, 0, sizeof(rows));
+        do
+        {
+            if (record == NULL || record->locationNo == 0)
+            {
+                printf("%s\t\\N\t\\N\t\\N\t\\N\t\\N\t\\N", rsID);
+            }
+            else
+            {
+                l = &di->locations[record->firstLocation + i];
+                printf("%s\t%s\t%u\t%c\t%s\t%s\t%s", rsID, di->strings + l->chromosome, l->position,
+                       l->strand, di->strings + l->observed, di->strings + l->snpClass, di->strings + l->function);
+            }
+
+            for (p=0; hapmap && p<DBSNP_POPULATION_NO; p++)
+            {
+                printhapmap(di, record, p, rows[p]);
+            }
+            printf("\n");
+
+            /* the last population varies fastest */
+            for (p=DBSNP_POPULATION_NO-1; p>=0 && ++rows[p]==rowNos[p]; p--)
+            {
+                rows[p] = 0;
+            }
+        }
+        while (p >= 0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int i, p, fieldNo, rsIDCol, hapmap = 0, printSummary = 0, snpNo = 0, snpCap = 0;
+    char *SNPFILE = NULL, *BUILD = NULL, *OUTFILE = NULL, *INDEXFILE = NULL, *MKFILE;
+    char *hapmapFiles[DBSNP_POPULATION_NO] = {NULL, NULL, NULL, NULL};
+    char *line = NULL, **fields, **rsIDs = NULL, *s;
+    size_t cap = 0;
+    uint32_t *rs = NULL;
+    DBSNP_RECORD **records;
+    DBSNP_INDEX *di;
+    FILE *fp;
+
+    if(argc==1)
+    {
+        printf("usage: fdbsnp [options] -x <dbsnp-index> <mk-file>\n");
+        printf("       fdbsnp -c <snp-table> -b <build> [-H population=hapmap-table] -o <dbsnp-index>\n");
+        printf("\n");
+        printf("       -c       compile a dbSNP index from a UCSC snp table dump (e.g. snp126.txt.gz)\n");
+        printf("       -b       build version recorded in the dbSNP index (db125|db126)\n");
+        printf("       -H       UCSC hapmapSnps dump of a population (CHB|JPT|CEU|YRI),\n");
+        printf("                may be repeated\n");
+        printf("       -o       dbSNP index file to write\n");
+        printf("       -x       dbSNP index\n");
+        printf("       -p       print summary of the dbSNP index\n");
+        printf("       -g       print HapMap genotype counts\n");
+        printf("       mk-file  mk file\n");
+        printf("                a)rs-id\n");
+        printf("\n");
+        printf("       example: fdbsnp -c snp126.txt.gz -b db126 -H CEU=hapmapSnpsCEU.txt.gz -o db126.didx\n");
+        printf("                fdbsnp -x db126.didx -g pscalare.mk\n");
+        printf("\n");
+        printf("       Looks up the rs-ids of the mk file in a memory mapped dbSNP index and\n");
+        printf("       prints, in mk file order, one row per mapped location, and with -g per\n");
+        printf("       combination of HapMap rows, with the columns fannotatesnps selects from\n");
+        printf("       the database.  Unmapped rs-ids get one row and missing values are\n");
+        printf("       printed as \\N.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"c:b:H:o:x:pg")) != -1)
+    {
+        switch(i)
+        {
+            case 'c':
+                SNPFILE = optarg;
+                break;
+            case 'b':
+                BUILD = optarg;
+                break;
+            case 'H':
+                if ((s = strchr(optarg, '=')) == NULL)
+                {
+                    fatal("population=hapmap-table expected: %s\n", optarg);
+                }
+                *s = '\0';
+                for (p=0; p<DBSNP_POPULATION_NO && strcmp(populations[p], optarg)!=0; p++);
+                if (p == DBSNP_POPULATION_NO)
+                {
+                    fatal("Unrecognized population: %s\n", optarg);
+                }
+                hapmapFiles[p] = s + 1;
+                break;
+            case 'o':
+                OUTFILE = optarg;
+                break;
+            case 'x':
+                INDEXFILE = optarg;
+                break;
+            case 'p':
+                printSummary = 1;
+                break;
+            case 'g':
+                hapmap = 1;
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (SNPFILE != NULL)
+    {
+        if (BUILD == NULL || OUTFILE == NULL || optind != argc)
+        {
+            fprintf(stderr, "snp table, build and output file expected\n");
+            exit(1);
+        }
+
+        di = builddbsnpindex(SNPFILE, hapmapFiles, populations, BUILD);
+        writedbsnpindex(di, OUTFILE);
+        dbsnpindexclose(di);
+
+        return 0;
+    }
+
+    if (INDEXFILE == NULL || optind < argc-1)
+    {
+        fprintf(stderr, "dbSNP index and at most 1 mk file expected\n");
+        exit(1);
+    }
+
+    di = dbsnpindexopen(INDEXFILE);
+
+    if (printSummary)
+    {
+        printsummary(di);
+    }
+
+    if (optind == argc)
+    {
+        dbsnpindexclose(di);
+        return 0;
+    }
+
+    MKFILE = argv[optind];
+    fp = zopen(MKFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", MKFILE);
+    }
+
+    fieldNo = countfields(line, '\t');
+    FRALLOC(fields, fieldNo, char *);
+    splitline(line, fields, fieldNo, '\t');
+    rsIDCol = getlabel(fields, fieldNo, "rs-id", MKFILE);
+
+    while (readline(fp, &line, &cap) != -1)
+    {
+        if (splitline(line, fields, fieldNo, '\t') != fieldNo)
+        {
+            fatal("%s: row %d does not have %d columns\n", MKFILE, snpNo+2, fieldNo);
+        }
+
+        if (snpNo == snpCap)
+        {
+            snpCap = snpCap ? 2*snpCap : 65536;
+            rsIDs = (char **) xrealloc(rsIDs, snpCap*sizeof(char *));
+            rs = (uint32_t *) xrealloc(rs, snpCap*sizeof(uint32_t));
+        }
+        rsIDs[snpNo] = strdup(fields[rsIDCol]);
+        rs[snpNo++] = parsers(fields[rsIDCol]);
+    }
+    zclose(fp, MKFILE);
+
+    printf("rsid\tchrom\tchromStart\tstrand\tobserved\tclass\tfunc");
+    for (p=0; hapmap && p<DBSNP_POPULATION_NO; p++)
+    {
+        s = di->header->populations[p];
+        printf("\t%s_strand\t%s_observed\t%s_allele1\t%s_homoCount1\t%s_allele2\t%s_homoCount2\t%s_heteroCount",
+               s, s, s, s, s, s, s);
+    }
+    printf("\n");
+
+    FRALLOC(records, LOOKUP_BATCH, DBSNP_RECORD *);
+    for (i=0; i<snpNo; i+=LOOKUP_BATCH)
+    {
+        dbsnpfindbatch(di, rs + i, MIN(LOOKUP_BATCH, snpNo - i), records);
+        for (p=0; p<MIN(LOOKUP_BATCH, snpNo - i); p++)
+        {
+            printrows(di, rsIDs[i+p], records[p], hapmap);
+            free(rsIDs[i+p]);
+        }
+    }
+
+    free(records);
+    free(rsIDs);
+    free(rs);
+    free(fields);
+    free(line);
+    dbsnpindexclose(di);
+
+    return 0;
+}
@@ -0,0 +1,310 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <fralib.h>
+
+static void printsummary(GENE_INDEX *gi)
+{
+    GENE_INDEX_HEADER *h = gi->header;
+    uint32_t i;
+
+    printf("Summary for %s\n\n", gi->file);
+    printf("Build: %s\n", h->build);
+    printf("Chromosome Count: %u\n", h->chromosomeNo);
+    printf("Gene Count: %u\n", h->geneNo);
+    printf("Exon Count: %u\n", h->exonNo);
+    printf("Annotation: %s\n\n", h->annotationNo ? gi->strings + h->annotationLabels : "n/a");
+
+    for (i=0; i<h->chromosomeNo; i++)
+    {
+        printf("%s\t%u\n", gi->chromosomes[i].chromosome, gi->chromosomes[i].geneNo);
+    }
+}
+
+/* n/a for each annotation column of a gene without one */
+static void printannotation(GENE_INDEX *gi, GENE_RECORD *g)
+{
+    char *s = gi->strings + g->annotation;
+    uint32_t i;
+
+    if (*s != '\0')
+    {
+        printf("\t%s", s);
+        return;
+    }
+
+    for (i=0; i<gi->header->annotationNo; i++)
+    {
+        printf("\tn/a");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int i, n, fieldNo, snpIDCol, chromosomeCol, positionCol, isVCF, chromosome, annotated;
+    int windowSize = 10000;
+    int printSummary = 0, exonsOnly = 0, filter = 0, mask = 0;
+    long position, recordNo = 0, annotationNo = 0;
+    int64_t start, end;
+    char *UCSCFILE = NULL, *ANNOTATIONFILE = NULL, *BUILD = NULL, *OUTFILE = NULL, *INDEXFILE = NULL;
+    char *INFILE, *line = NULL, *record = NULL, *snpID, **fields;
+    char lastChromosome[64] = "";
+    size_t cap = 0, recordCap = 0;
+    long length;
+    GENE_INDEX *gi;
+    GENE_SWEEP sw;
+    GENE_RECORD *g;
+    FILE *fp;
+
+    if(argc==1)
+    {
+        printf("usage: fgeneindex [options] -x <gene-index> <mk-file|vcf-file>\n");
+        printf("       fgeneindex -c <ucsc-file> -b <build> [-a annotation-file] -o <gene-index>\n");
+        printf("\n");
+        printf("       -c       compile a gene index from a UCSC knownGene or refGene dump\n");
+        printf("       -b       build version recorded in the gene index (hg17|hg18)\n");
+        printf("       -a       gene annotation to carry in the gene index, tab separated with\n");
+        printf("                a header and keyed by the gene name in its first column\n");
+        printf("       -o       gene index file to write\n");
+        printf("       -x       gene index, a UCSC dump is indexed in memory\n");
+        printf("       -p       print summary of the gene index\n");
+        printf("       -w       window size (10000 default) [0,1M]\n");
+        printf("       -e       only annotate SNPs within the window of an exon\n");
+        printf("       -f       print the records with annotations instead of the annotations\n");
+        printf("       -m       mask unannotated SNPs\n");
+        printf("       mk-file  mk file, .gz files are read through gunzip\n");
+        printf("                a)snp-id\n");
+        printf("                b)chromosome\n");
+        printf("                c)position\n");
+        printf("       vcf-file VCF file\n");
+        printf("\n");
+        printf("       example: fgeneindex -c hg18_knownGene.txt.gz -a hg18-genes.txt -b hg18 -o hg18-knownGene.gidx\n");
+        printf("                fgeneindex -x hg18-knownGene.gidx -w 10000 pscalare.mk\n");
+        printf("\n");
+        printf("       Annotates SNPs with the genes whose transcripts, extended by the window\n");
+        printf("       on each side, cover them and prints snp-id, chromosome, position,\n");
+        printf("       gene-id, gene-strand, tx-start, tx-end and consequence followed by the\n");
+        printf("       annotation columns of the gene index.  A stream sorted by position\n");
+        printf("       within chromosomes is annotated in one sweep through the index, other\n");
+        printf("       records are looked up in the interval tree of the index.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"c:b:a:o:x:pw:efm")) != -1)
+    {
+        switch(i)
+        {
+            case 'c':
+                UCSCFILE = optarg;
+                break;
+            case 'b':
+                BUILD = optarg;
+                break;
+            case 'a':
+                ANNOTATIONFILE = optarg;
+                break;
+            case 'o':
+                OUTFILE = optarg;
+                break;
+            case 'x':
+                INDEXFILE = optarg;
+                break;
+            case 'p':
+                printSummary = 1;
+                break;
+            case 'w':
+                windowSize = atoi(optarg);
+                break;
+            case 'e':
+                exonsOnly = 1;
+                break;
+            case 'f':
+                filter = 1;
+                break;
+            case 'm':
+                mask = 1;
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (UCSCFILE != NULL)
+    {
+        if (BUILD == NULL || OUTFILE == NULL || optind != argc)
+        {
+            fprintf(stderr, "ucsc file, build and output file expected\n");
+            exit(1);
+        }
+
+        gi = buildgeneindex(UCSCFILE, ANNOTATIONFILE, BUILD);
+        writegeneindex(gi, OUTFILE);
+        geneindexclose(gi);
+
+        return 0;
+    }
+
+    if (INDEXFILE == NULL || optind < argc-1 || windowSize < 0 || windowSize > 1000000)
+    {
+        fprintf(stderr, "gene index and at most 1 mk or vcf file expected\n");
+        exit(1);
+    }
+
+    gi = geneindexopen(INDEXFILE);
+
+    if (printSummary)
+    {
+        printsummary(gi);
+    }
+
+    if (optind == argc)
+    {
+        geneindexclose(gi);
+        return 0;
+    }
+
+    INFILE = argv[optind];
+    fp = zopen(INFILE);
+
+    /* VCF meta lines are passed through when filtering */
+    isVCF = 0;
+    while ((length = readline(fp, &line, &cap)) != -1 && strncmp(line, "##", 2) == 0)
+    {
+        isVCF = 1;
+        if (filter)
+        {
+            printf("%s\n", line);
+        }
+    }
+    if (length == -1)
+    {
+        fatal("%s is empty\n", INFILE);
+    }
+
+    if (filter)
+    {
+        printf("%s\n", line);
+    }
+
+    fieldNo = countfields(line, '\t');
+    FRALLOC(fields, fieldNo, char *);
+    if (isVCF || strncmp(line, "#CHROM", 6) == 0)
+    {
+        isVCF = 1;
+        chromosomeCol = 0;
+        positionCol = 1;
+        snpIDCol = 2;
+    }
+    else
+    {
+        splitline(line, fields, fieldNo, '\t');
+        snpIDCol = getlabel(fields, fieldNo, "snp-id", INFILE);
+        chromosomeCol = getlabel(fields, fieldNo, "chromosome", INFILE);
+        positionCol = getlabel(fields, fieldNo, "position", INFILE);
+    }
+
+    if (!filter)
+    {
+        printf("snp-id\tchromosome\tposition\tgene-id\tgene-strand\ttx-start\ttx-end\tconsequence");
+        if (gi->header->annotationNo)
+        {
+            printf("\t%s", gi->strings + gi->header->annotationLabels);
+        }
+        printf("\n");
+    }
+
+    genesweepinit(&sw, gi);
+    chromosome = -1;
+    while ((length = readline(fp, &line, &cap)) != -1)
+    {
+        ++recordNo;
+        if (filter)
+        {
+            if (recordCap < (size_t) length + 1)
+            {
+                recordCap = length + 1;
+                record = (char *) xrealloc(record, recordCap);
+            }
+            memcpy(record, line, length + 1);
+        }
+
+        if ((n = splitline(line, fields, fieldNo, '\t')) != fieldNo)
+        {
+            fatal("%s: record %ld does not have %d columns\n", INFILE, recordNo, fieldNo);
+        }
+
+        if (strcmp(fields[chromosomeCol], lastChromosome) != 0)
+        {
+            snprintf(lastChromosome, sizeof(lastChromosome), "%s", fields[chromosomeCol]);
+            chromosome = geneindexfind(gi, lastChromosome);
+        }
+
+        annotated = 0;
+        snpID = fields[snpIDCol];
+        if (isdigit(fields[positionCol][0]))
+        {
+            /* 1-based position within the window of [txStart+1, txEnd] */
+            position = atol(fields[positionCol]);
+            start = position - 1 - windowSize;
+            end = position + windowSize;
+            n = genesweep(&sw, chromosome, start, end);
+
+            for (i=0; i<n; i++)
+            {
+                g = &gi->genes[sw.active[i]];
+                if (exonsOnly && !geneexonoverlaps(gi, sw.active[i], start, end))
+                {
+                    continue;
+                }
+
+                annotated = 1;
+                if (filter)
+                {
+                    break;
+                }
+
+                printf("%s\t%s\t%ld\t%s\t%c\t%d\t%d\t%s", snpID, fields[chromosomeCol], position,
+                       gi->strings + g->name, g->strand, g->start + 1, g->end,
+                       position <= g->start ? (g->strand == '+' ? "upstream" : "downstream") :
+                       position <= g->end ? "within-transcript" : (g->strand == '+' ? "downstream" : "upstream"));
+                printannotation(gi, g);
+                printf("\n");
+                ++annotationNo;
+            }
+        }
+
+        if (filter)
+        {
+            if (annotated)
+            {
+                printf("%s\n", record);
+                ++annotationNo;
+            }
+        }
+        else if (!annotated && !mask)
+        {
+            printf("%s\t%s\t%s", snpID, fields[chromosomeCol], fields[positionCol]);
+            for (i=0; i<5+(int)gi->header->annotationNo; i++)
+            {
+                printf("\tn/a");
+            }
+            printf("\n");
+        }
+    }
+    zclose(fp, INFILE);
+
+    fprintf(stderr, "%ld annotations for %ld SNPs\n", annotationNo, recordNo);
+
+    genesweepfree(&sw);
+    free(fields);
+    free(record);
+    free(line);
+    geneindexclose(gi);
+
+    return 0;
+}
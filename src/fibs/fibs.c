@@ -0,0 +1,484 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <float.h>
+#include <math.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <fralib.h>
+
+/* samples per tile and 64-SNP words per block, a block pair of tiles stays in L2 */
+#define TILE_SAMPLES 64
+#define BLOCK_WORDS 128
+
+typedef struct
+{
+    char *buffer;
+    size_t length;
+    size_t cap;
+    int done;
+} TILE_OUTPUT;
+
+/* expected IBS given IBD, averaged over SNPs */
+typedef struct
+{
+    double e00;
+    double e10;
+    double e20;
+    double e11;
+    double e21;
+} IBD_PRIOR;
+
+/* relationships as fitted by plinkgenome2sar */
+static char *relationships[] = {"MZ", "PO", "FS", "AV_HS", "CO_GG", "UN", "R1", "R2", "R3"};
+static double E_Z[][3] = {{0, 0, 1},
+                          {0, 1, 0},
+                          {0.25, 0.5, 0.25},
+                          {0.5, 0.5, 0},
+                          {0.75, 0.25, 0},
+                          {1, 0, 0},
+                          {0, 0.5, 0.5},
+                          {0, 0.75, 0.25},
+                          {0.125, 0.75, 0.125}};
+#define RELATIONSHIP_NO 9
+
+GENOTYPES *gt;
+IBD_PRIOR prior;
+double ibdProportionCutoff = 0.0;
+int tileNo, tilePairNo;
+int nextTilePair = 0, nextWrittenTilePair = 0;
+TILE_OUTPUT *outputs;
+FILE *fpsar;
+pthread_mutex_t tileLock = PTHREAD_MUTEX_INITIALIZER;
+
+/* probability of drawing a B and b A alleles in a given order without replacement */
+static double fdraw(int x, int y, int a, int b)
+{
+    int n = x + y;
+    int k = 0;
+    double f = 1;
+
+    while (a--)
+    {
+        f *= (double)(x--) / (double)(n - k++);
+    }
+    while (b--)
+    {
+        f *= (double)(y--) / (double)(n - k++);
+    }
+
+    return f;
+}
+
+/* allele counts from the bit planes, then PLINK's finite-sample IBS|IBD expectations */
+static void computeprior()
+{
+    int *alleleB, *alleleCount;
+    int s, w, snp, x, y, usedSNPs = 0;
+    uint64_t p, q, bits;
+
+    FRALLOC(alleleB, gt->wordNo*64, int);
+    FRALLOC(alleleCount, gt->wordNo*64, int);
+
+    for (s=0; s<gt->sampleNo; s++)
+    {
+        for (w=0; w<gt->wordNo; w++)
+        {
+            p = GENO_P(gt, s, w);
+            q = GENO_Q(gt, s, w);
+
+            for (bits = p | ~q; bits; bits &= bits - 1)
+            {
+                alleleCount[w*64 + __builtin_ctzll(bits)] += 2;
+            }
+            for (bits = p; bits; bits &= bits - 1)
+            {
+                ++alleleB[w*64 + __builtin_ctzll(bits)];
+            }
+            for (bits = p & q; bits; bits &= bits - 1)
+            {
+                ++alleleB[w*64 + __builtin_ctzll(bits)];
+            }
+        }
+    }
+
+    memset(&prior, 0, sizeof(prior));
+    for (snp=0; snp<gt->snpNo; snp++)
+    {
+        x = alleleB[snp];
+        y = alleleCount[snp] - x;
+
+        if (x + y < 4)
+        {
+            continue;
+        }
+
+        prior.e00 += 2*fdraw(x, y, 2, 2);
+        prior.e10 += 4*fdraw(x, y, 3, 1) + 4*fdraw(x, y, 1, 3);
+        prior.e20 += fdraw(x, y, 4, 0) + fdraw(x, y, 0, 4) + 4*fdraw(x, y, 2, 2);
+        prior.e11 += 2*fdraw(x, y, 2, 1) + 2*fdraw(x, y, 1, 2);
+        prior.e21 += fdraw(x, y, 3, 0) + fdraw(x, y, 0, 3) + fdraw(x, y, 2, 1) + fdraw(x, y, 1, 2);
+        ++usedSNPs;
+    }
+
+    if (usedSNPs == 0)
+    {
+        fatal("No SNPs with at least 2 genotyped samples\n");
+    }
+
+    prior.e00 /= usedSNPs;
+    prior.e10 /= usedSNPs;
+    prior.e20 /= usedSNPs;
+    prior.e11 /= usedSNPs;
+    prior.e21 /= usedSNPs;
+
+    fprintf(stderr, "  SNPs used for IBD priors = %d\n", usedSNPs);
+
+    free(alleleB);
+    free(alleleCount);
+}
+
+/* method of moments estimate as in plink --genome, bounded to [0,1] */
+static void estimateibd(uint32_t ibs0, uint32_t ibs1, uint32_t ibs2, double *z)
+{
+    double n = (double) ibs0 + ibs1 + ibs2;
+    double s, pihat;
+
+    z[0] = prior.e00 > 0 ? (ibs0/n) / prior.e00 : 0;
+    z[1] = prior.e11 > 0 ? (ibs1/n - z[0]*prior.e10) / prior.e11 : 0;
+    z[2] = ibs2/n - z[0]*prior.e20 - z[1]*prior.e21;
+
+    if (z[0] > 1) { z[0] = 1; z[1] = 0; z[2] = 0; }
+    if (z[1] > 1) { z[1] = 1; z[0] = 0; z[2] = 0; }
+    if (z[2] > 1) { z[2] = 1; z[0] = 0; z[1] = 0; }
+    if (z[0] < 0) { s = z[1] + z[2]; z[1] /= s; z[2] /= s; z[0] = 0; }
+    if (z[1] < 0) { s = z[0] + z[2]; z[0] /= s; z[2] /= s; z[1] = 0; }
+    if (z[2] < 0) { s = z[0] + z[1]; z[0] /= s; z[1] /= s; z[2] = 0; }
+
+    /* z2 cannot exceed what a pair sharing pihat of its genome would show */
+    pihat = z[1]/2 + z[2];
+    if (pihat*pihat < z[2])
+    {
+        z[0] = (1-pihat)*(1-pihat);
+        z[1] = 2*pihat*(1-pihat);
+        z[2] = pihat*pihat;
+    }
+}
+
+static void appendf(TILE_OUTPUT *out, char *fmt, ...)
+{
+    va_list args;
+    int n;
+
+    while (1)
+    {
+        va_start(args, fmt);
+        n = vsnprintf(out->buffer + out->length, out->cap - out->length, fmt, args);
+        va_end(args);
+
+        if (n >= 0 && out->length + n < out->cap)
+        {
+            out->length += n;
+            return;
+        }
+
+        out->cap = out->cap ? 2*out->cap + n : 65536;
+        out->buffer = (char *) xrealloc(out->buffer, out->cap);
+    }
+}
+
+static void printpair(TILE_OUTPUT *out, int i, int j, uint32_t ibs0, uint32_t ibs1, uint32_t ibs2)
+{
+    char *sample1ID = gt->sampleIDs[i];
+    char *sample2ID = gt->sampleIDs[j];
+    char zStr[3][32];
+    double z[3], ibdProportion, rss, smallestRSS, mean, variance, n;
+    int k, r, mostProbableRelationship = 5;
+
+    n = (double) ibs0 + ibs1 + ibs2;
+    if (n == 0)
+    {
+        return;
+    }
+
+    /* the sar values are computed from the printed estimates, as plinkgenome2sar does */
+    estimateibd(ibs0, ibs1, ibs2, z);
+    for (k=0; k<3; k++)
+    {
+        snprintf(zStr[k], sizeof(zStr[k]), "%.4f", z[k]);
+        z[k] = atof(zStr[k]);
+    }
+
+    ibdProportion = z[2] + z[1]/2;
+    if (ibdProportion < ibdProportionCutoff)
+    {
+        return;
+    }
+
+    smallestRSS = FLT_MAX;
+    for (r=0; r<RELATIONSHIP_NO; r++)
+    {
+        rss = (z[0]-E_Z[r][0])*(z[0]-E_Z[r][0]) +
+              (z[1]-E_Z[r][1])*(z[1]-E_Z[r][1]) +
+              (z[2]-E_Z[r][2])*(z[2]-E_Z[r][2]);
+
+        if (rss < smallestRSS)
+        {
+            smallestRSS = rss;
+            mostProbableRelationship = r;
+        }
+    }
+
+    mean = (ibs1 + 2.0*ibs2) / n;
+
+    appendf(out, "%s/%s\t%s\t%s\t%u\t%u\t%u\t%s\t%s\t%s\t%.15g\t%s\t%.6f\t%.15g\t",
+            strcmp(sample1ID, sample2ID) <= 0 ? sample1ID : sample2ID,
+            strcmp(sample1ID, sample2ID) <= 0 ? sample2ID : sample1ID,
+            sample1ID, sample2ID, ibs0, ibs1, ibs2, zStr[0], zStr[1], zStr[2],
+            ibdProportion, relationships[mostProbableRelationship],
+            (ibs2 + 0.5*ibs1) / n, mean);
+
+    if (n > 1)
+    {
+        variance = ((0-mean)*(0-mean)*ibs0 + (1-mean)*(1-mean)*ibs1 + (2-mean)*(2-mean)*ibs2) / (n-1);
+        appendf(out, "%.15g\t%.15g\n", sqrt(variance), smallestRSS);
+    }
+    else
+    {
+        appendf(out, "n/a\t%.15g\n", smallestRSS);
+    }
+}
+
+/* tile pairs are enumerated row by row over the upper triangle */
+static void tilepair(int index, int *a, int *b)
+{
+    int row = 0;
+
+    while (index >= tileNo - row)
+    {
+        index -= tileNo - row;
+        ++row;
+    }
+
+    *a = row;
+    *b = row + index;
+}
+
+static void computetile(int a, int b, uint32_t *ibs0, uint32_t *ibs1, uint32_t *ibs2)
+{
+    int i, j, jStart, iEnd, jEnd, w, wEnd, block;
+    uint32_t c0, c2, cv;
+    uint64_t p1, q1, p2, q2, z1, h1, v;
+    uint64_t *g1, *g2;
+
+    iEnd = MIN((a+1)*TILE_SAMPLES, gt->sampleNo);
+    jEnd = MIN((b+1)*TILE_SAMPLES, gt->sampleNo);
+
+    memset(ibs0, 0, TILE_SAMPLES*TILE_SAMPLES*sizeof(uint32_t));
+    memset(ibs1, 0, TILE_SAMPLES*TILE_SAMPLES*sizeof(uint32_t));
+    memset(ibs2, 0, TILE_SAMPLES*TILE_SAMPLES*sizeof(uint32_t));
+
+    for (block=0; block<gt->wordNo; block+=BLOCK_WORDS)
+    {
+        wEnd = MIN(block+BLOCK_WORDS, gt->wordNo);
+
+        for (i=a*TILE_SAMPLES; i<iEnd; i++)
+        {
+            g1 = &GENO_P(gt, i, 0);
+            jStart = a == b ? i+1 : b*TILE_SAMPLES;
+
+            for (j=jStart; j<jEnd; j++)
+            {
+                g2 = &GENO_P(gt, j, 0);
+                c0 = c2 = cv = 0;
+
+                for (w=block; w<wEnd; w++)
+                {
+                    p1 = g1[2*w];
+                    q1 = g1[2*w+1];
+                    p2 = g2[2*w];
+                    q2 = g2[2*w+1];
+
+                    /* z: homozygous AA, h: homozygous BB, v: both called */
+                    z1 = ~(p1 | q1);
+                    h1 = p1 & q1;
+                    v = (p1 | ~q1) & (p2 | ~q2);
+
+                    c0 += __builtin_popcountll((z1 & p2 & q2) | (h1 & ~(p2 | q2)));
+                    c2 += __builtin_popcountll(v & ~((p1 ^ p2) | (q1 ^ q2)));
+                    cv += __builtin_popcountll(v);
+                }
+
+                ibs0[(i%TILE_SAMPLES)*TILE_SAMPLES + j%TILE_SAMPLES] += c0;
+                ibs2[(i%TILE_SAMPLES)*TILE_SAMPLES + j%TILE_SAMPLES] += c2;
+                ibs1[(i%TILE_SAMPLES)*TILE_SAMPLES + j%TILE_SAMPLES] += cv - c0 - c2;
+            }
+        }
+    }
+}
+
+static void *worker(void *arg)
+{
+    uint32_t *ibs0, *ibs1, *ibs2;
+    int index, a, b, i, j, jStart, iEnd, jEnd, k;
+    TILE_OUTPUT *out;
+
+    FRALLOC(ibs0, TILE_SAMPLES*TILE_SAMPLES, uint32_t);
+    FRALLOC(ibs1, TILE_SAMPLES*TILE_SAMPLES, uint32_t);
+    FRALLOC(ibs2, TILE_SAMPLES*TILE_SAMPLES, uint32_t);
+
+    while (1)
+    {
+        pthread_mutex_lock(&tileLock);
+        index = nextTilePair++;
+        pthread_mutex_unlock(&tileLock);
+
+        if (index >= tilePairNo)
+        {
+            break;
+        }
+
+        tilepair(index, &a, &b);
+        computetile(a, b, ibs0, ibs1, ibs2);
+
+        out = &outputs[index];
+        iEnd = MIN((a+1)*TILE_SAMPLES, gt->sampleNo);
+        jEnd = MIN((b+1)*TILE_SAMPLES, gt->sampleNo);
+        for (i=a*TILE_SAMPLES; i<iEnd; i++)
+        {
+            jStart = a == b ? i+1 : b*TILE_SAMPLES;
+            for (j=jStart; j<jEnd; j++)
+            {
+                k = (i%TILE_SAMPLES)*TILE_SAMPLES + j%TILE_SAMPLES;
+                printpair(out, i, j, ibs0[k], ibs1[k], ibs2[k]);
+            }
+        }
+
+        /* write out every completed tile that is next in line */
+        pthread_mutex_lock(&tileLock);
+        out->done = 1;
+        while (nextWrittenTilePair < tilePairNo && outputs[nextWrittenTilePair].done)
+        {
+            out = &outputs[nextWrittenTilePair++];
+            fwrite(out->buffer, 1, out->length, fpsar);
+            free(out->buffer);
+            out->buffer = NULL;
+        }
+        pthread_mutex_unlock(&tileLock);
+    }
+
+    free(ibs0);
+    free(ibs1);
+    free(ibs2);
+
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    int i, threadNo = 0;
+    char *INFILE = NULL;
+    char *SARFILE = NULL;
+    pthread_t *threads;
+
+    if(argc==1)
+    {
+        printf("usage: fibs [options] <gt-file|tg-file>\n");
+        printf("\n");
+        printf("       -c       ibd proportion cutoff [>=] (default: 0.00)\n");
+        printf("       -t       number of threads (default: number of processors)\n");
+        printf("       -o       output sar file (default: <gt-file|tg-file prefix>.sar)\n");
+        printf("       gt-file  Samples x SNPs genotype file\n");
+        printf("       tg-file  SNPs x Samples genotype file\n");
+        printf("\n");
+        printf("       example: fibs -c 0.1 pscalare.tg\n");
+        printf("\n");
+        printf("       Computes IBS0, IBS1 and IBS2 counts for all sample pairs and the method\n");
+        printf("       of moments estimates of Z0, Z1 and Z2 as in plink --genome.  Each pair\n");
+        printf("       with an ibd proportion above the cutoff is annotated with the\n");
+        printf("       relationship fitted by plinkgenome2sar and written to a sar file.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"c:t:o:")) != -1)
+    {
+        switch(i)
+        {
+            case 'c':
+                ibdProportionCutoff = atof(optarg);
+                break;
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case 'o':
+                SARFILE = optarg;
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (optind != argc-1)
+    {
+        fprintf(stderr, "1 non-option argument expected: gt-file or tg-file\n");
+        exit(1);
+    }
+
+    if (ibdProportionCutoff < 0 || ibdProportionCutoff > 1)
+    {
+        fprintf(stderr, "ibd proportion cutoff must be between 0 and 1\n");
+        exit(1);
+    }
+
+    INFILE = argv[optind];
+    if (SARFILE == NULL)
+    {
+        SARFILE = fileprefix(INFILE);
+        SARFILE = (char *) xrealloc(SARFILE, strlen(SARFILE)+5);
+        strcat(SARFILE, ".sar");
+    }
+
+    threadNo = threadNo > 0 ? threadNo : getcpuno();
+
+    fprintf(stderr, "Reading genotypes");
+    gt = readgenotypes(INFILE);
+    fprintf(stderr, " ... completed\n");
+    fprintf(stderr, "  No. of samples = %d\n", gt->sampleNo);
+    fprintf(stderr, "  No. of SNPs = %d\n", gt->snpNo);
+
+    fprintf(stderr, "Computing IBD priors\n");
+    computeprior();
+
+    fpsar = xopen(SARFILE, "w");
+    fprintf(fpsar, "sample-pair-id\tsample-id-1\tsample-id-2\tibs0\tibs1\tibs2\tz0\tz1\tz2\tibd-proportion\trelationship\tsimilarity\tibs-mean\tibs-stdev\trss\n");
+
+    tileNo = (gt->sampleNo + TILE_SAMPLES - 1) / TILE_SAMPLES;
+    tilePairNo = tileNo*(tileNo+1)/2;
+    FRALLOC(outputs, MAX(tilePairNo, 1), TILE_OUTPUT);
+
+    fprintf(stderr, "Computing pairwise IBS with %d thread(s)", threadNo);
+    FRALLOC(threads, threadNo, pthread_t);
+    for (i=0; i<threadNo; i++)
+    {
+        if (pthread_create(&threads[i], NULL, worker, NULL))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (i=0; i<threadNo; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    fprintf(stderr, " ... completed\n");
+
+    fclose(fpsar);
+    free(threads);
+    free(outputs);
+    freegenotypes(gt);
+
+    return 0;
+}
@@ -0,0 +1,464 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <fralib.h>
+
+#define BLOCK_SIZE (16*1024*1024)
+
+/* the r square cutoffs of the L columns */
+#define CUTOFF_NO 11
+static double cutoffs[CUTOFF_NO] = {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
+static char *cutoffLabels[CUTOFF_NO] = {"0.0", "0.1", "0.2", "0.3", "0.4", "0.5", "0.6", "0.7", "0.8", "0.9", "1.0"};
+
+/* number of SNPs found on each chromosome, src: dbSNP125 */
+typedef struct
+{
+    char *chromosome;
+    long snpNo;
+} GENOME_SNPS;
+
+static GENOME_SNPS genomeSnps[] = {
+    {"1", 751709}, {"2", 720429}, {"3", 593937}, {"4", 626066}, {"5", 555675}, {"6", 631748},
+    {"7", 517752}, {"8", 466619}, {"9", 462733}, {"10", 489372}, {"11", 485392}, {"12", 448870},
+    {"13", 350176}, {"14", 278854}, {"15", 266559}, {"16", 305235}, {"17", 238589}, {"18", 254717},
+    {"19", 200441}, {"20", 264461}, {"21", 142382}, {"22", 174748}, {"X", 381595}
+};
+
+/* the typed SNPs of the mk file on a chromosome, shared by the LD files of that chromosome */
+typedef struct
+{
+    char *chromosome;
+    KEY_TABLE snps;
+} TYPED;
+
+/* the coverage of an LD file */
+typedef struct
+{
+    char *file;
+    char *chromosome;
+    char *population;
+    long G;
+    TYPED *typed;
+    long D;
+    long T;
+    long R;
+    long L[CUTOFF_NO];
+} COVERAGE;
+
+typedef struct
+{
+    COVERAGE *coverages;
+    int fileNo;
+    int next;
+    pthread_mutex_t lock;
+} COVERAGE_BATCH;
+
+static inline int isldspace(char c)
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v';
+}
+
+/* ld_chr<chromosome>_<population>, the chromosome upper cased as in fcoverage */
+static void parseldfile(COVERAGE *c)
+{
+    char *name = fileprefix(c->file), *s, *t;
+
+    if ((s = strstr(name, "ld_chr")) == NULL || (t = strrchr(s + 6, '_')) == NULL)
+    {
+        fatal("%s: not a HapMap LD file, ld_chr<chromosome>_<population> expected\n", c->file);
+    }
+
+    *t = '\0';
+    c->chromosome = strdup(s + 6);
+    c->population = strdup(t + 1);
+    for (s=c->chromosome; *s; s++)
+    {
+        *s = toupper((unsigned char) *s);
+    }
+    free(name);
+}
+
+/*
+ * a single pass over an LD file.  Typed SNPs are marked when they are in
+ * LD with another SNP, and each untyped SNP keeps its best r square with a
+ * typed SNP, counted against all the cutoffs at the end.
+ */
+static void computecoverage(COVERAGE *c)
+{
+    BUFFER block = {NULL, 0, 0};
+    KEY_TABLE *typed = &c->typed->snps, untyped;
+    char *line, *next, *end, *s, *fields[7];
+    uint32_t fieldLengths[7], u, untypedCap = 0;
+    uint8_t *seen, *tagged;
+    double *bestRsquare = NULL, rsquare;
+    long a, b;
+    size_t m, used;
+    int fieldNo, eof = 0, i;
+    FILE *fp;
+
+    memset(&untyped, 0, sizeof(KEY_TABLE));
+    FRALLOC(seen, MAX(typed->n, 1), uint8_t);
+    FRALLOC(tagged, MAX(typed->n, 1), uint8_t);
+
+    fp = zopen(c->file);
+    while (!eof)
+    {
+        if (block.cap - block.size < BLOCK_SIZE/2)
+        {
+            block.cap = block.size + BLOCK_SIZE;
+            block.data = (char *) xrealloc(block.data, block.cap);
+        }
+
+        m = fread(block.data + block.size, 1, block.cap - block.size - 1, fp);
+        eof = m < block.cap - block.size - 1;
+        block.size += m;
+        if (eof && block.size && block.data[block.size-1] != '\n')
+        {
+            block.data[block.size++] = '\n';
+        }
+
+        for (end=block.data + block.size; end>block.data && end[-1]!='\n'; --end);
+        if (end == block.data)
+        {
+            continue;
+        }
+        used = end - block.data;
+
+        for (line=block.data; line<block.data + used; line=next+1)
+        {
+            next = memchr(line, '\n', block.data + used - line);
+
+            /* 72434 78032 CHB rs4030303 rs940550 1.0 0.0 0.0 0 */
+            for (s=line, fieldNo=0; fieldNo<7; fieldNo++)
+            {
+                for (; s<next && isldspace(*s); s++);
+                if (s == next)
+                {
+                    break;
+                }
+                fields[fieldNo] = s;
+                for (; s<next && !isldspace(*s); s++);
+                fieldLengths[fieldNo] = s - fields[fieldNo];
+            }
+            if (fieldNo < 5)
+            {
+                continue;
+            }
+            rsquare = fieldNo == 7 ? strtod(fields[6], NULL) : 0;
+
+            a = keytablefind(typed, fields[3], fieldLengths[3], hashbytes(fields[3], fieldLengths[3]));
+            b = keytablefind(typed, fields[4], fieldLengths[4], hashbytes(fields[4], fieldLengths[4]));
+            if (a >= 0 && b >= 0)
+            {
+                seen[a] = seen[b] = tagged[a] = tagged[b] = 1;
+                continue;
+            }
+            if (a < 0 && b < 0)
+            {
+                keytableget(&untyped, fields[3], fieldLengths[3]);
+                keytableget(&untyped, fields[4], fieldLengths[4]);
+                continue;
+            }
+
+            /* 1 typed SNP, the untyped one in LD with it */
+            i = a >= 0 ? 4 : 3;
+            a = a >= 0 ? a : b;
+            seen[a] = 1;
+            u = keytableget(&untyped, fields[i], fieldLengths[i]);
+            if (untyped.n > untypedCap)
+            {
+                bestRsquare = (double *) xrealloc(bestRsquare, 2*untyped.n*sizeof(double));
+                for (; untypedCap<2*untyped.n; untypedCap++)
+                {
+                    bestRsquare[untypedCap] = -1;
+                }
+            }
+            if (rsquare >= cutoffs[0])
+            {
+                tagged[a] = 1;
+                bestRsquare[u] = MAX(bestRsquare[u], rsquare);
+            }
+        }
+
+        memmove(block.data, block.data + used, block.size - used);
+        block.size -= used;
+    }
+    zclose(fp, c->file);
+
+    for (u=0; u<typed->n; u++)
+    {
+        c->T += tagged[u];
+        c->R += seen[u];
+    }
+    c->D = typed->n - c->T;
+    c->R += untyped.n;
+    for (u=0; u<untyped.n && u<untypedCap; u++)
+    {
+        for (i=0; i<CUTOFF_NO && bestRsquare[u] >= cutoffs[i]; i++)
+        {
+            c->L[i]++;
+        }
+    }
+
+    keytablefree(&untyped);
+    free(bestRsquare);
+    free(seen);
+    free(tagged);
+    free(block.data);
+}
+
+/* LD files go to the threads as they ask, 1 file at a time */
+static void *coverageworker(void *arg)
+{
+    COVERAGE_BATCH *batch = (COVERAGE_BATCH *) arg;
+    int f;
+
+    while (1)
+    {
+        pthread_mutex_lock(&batch->lock);
+        f = batch->next++;
+        pthread_mutex_unlock(&batch->lock);
+
+        if (f >= batch->fileNo)
+        {
+            break;
+        }
+
+        computecoverage(&batch->coverages[f]);
+
+        pthread_mutex_lock(&batch->lock);
+        printf("processing %s ... done\n", batch->coverages[f].file);
+        fflush(stdout);
+        pthread_mutex_unlock(&batch->lock);
+    }
+
+    return NULL;
+}
+
+/* the chromosome order of fcoverage, numeric when both are numbers */
+static int chromosomecmp(const void *a, const void *b)
+{
+    char *x = (*(COVERAGE **) a)->chromosome, *y = (*(COVERAGE **) b)->chromosome;
+    double diff;
+
+    if (x[strspn(x, "0123456789")] || y[strspn(y, "0123456789")])
+    {
+        return strcmp(x, y);
+    }
+
+    diff = atof(x) - atof(y);
+    return diff < 0 ? -1 : diff > 0;
+}
+
+static void printcoverage(COVERAGE **table, int chromosomeNo)
+{
+    long totalD = 0, totalT = 0, totalR = 0, totalG = 0, totalL[CUTOFF_NO], D, T, R, G, L;
+    COVERAGE *c;
+    int k, i;
+
+    memset(totalL, 0, sizeof(totalL));
+    printf("chromosome\tG\tFd\tFt\tFtotal\tD\tT\tR");
+    for (i=0; i<CUTOFF_NO; i++)
+    {
+        printf("\tL:%s", cutoffLabels[i]);
+    }
+    printf("\n");
+
+    for (k=0; k<chromosomeNo; k++)
+    {
+        c = table[k];
+        D = c->D;
+        T = c->T;
+        R = c->R;
+        G = c->G;
+        totalD += D;
+        totalT += T;
+        totalR += R;
+        totalG += G;
+
+        printf("%s\t%ld\t%.4f\t%.4f\t%.4f\t%ld\t%ld\t%ld", c->chromosome, G, (double) D/G, (double) T/G, (double) (D+T)/G, D, T, R);
+        for (i=0; i<CUTOFF_NO; i++)
+        {
+            L = c->L[i];
+            totalL[i] += L;
+            printf("\t%ld(%.4f)", L, (((double) L/(R-T))*(G-T) + T + D) / G);
+        }
+        printf("\n");
+    }
+
+    printf("genome\t%ld\t%.4f\t%.4f\t%.4f\t%ld\t%ld\t%ld", totalG, (double) totalD/totalG, (double) totalT/totalG,
+           (double) (totalD+totalT)/totalG, totalD, totalT, totalR);
+    for (i=0; i<CUTOFF_NO; i++)
+    {
+        printf("\t%ld(%.4f)", totalL[i], (((double) totalL[i]/(totalR-totalT))*(totalG-totalT) + totalT + totalD) / totalG);
+    }
+    printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+    char *MKFILE = NULL;
+    char *line = NULL, **fields = NULL;
+    size_t cap = 0;
+    int i, f, k, t, colNo, snpCol, chromosomeCol, threadNo = 0, fileNo, typedNo = 0, chromosomeNo;
+    KEY_TABLE chromosomes, populations;
+    COVERAGE_BATCH batch;
+    COVERAGE *c, **table;
+    TYPED *typed;
+    pthread_t *threads;
+    long j;
+    FILE *fp;
+
+    if(argc==1)
+    {
+        printf("usage: fldcoverage [options] <hapmap-ld-file>...\n");
+        printf("\n");
+        printf("       -m       mk-file\n");
+        printf("                a)snp-id\n");
+        printf("                b)chromosome\n");
+        printf("       -t       number of threads (default: number of processors)\n");
+        printf("\n");
+        printf("       example: fldcoverage -m pscalare.mk ld_chr1_CHB.txt.gz ld_chr2_CHB.txt.gz\n");
+        printf("\n");
+        printf("       The coverage engine of fcoverage.  The mk file is read once into\n");
+        printf("       hash sets of the typed SNPs of each chromosome, and the HapMap\n");
+        printf("       ld_chr<chromosome>_<population> files are read in parallel, 1 file\n");
+        printf("       to a thread, counting all the r square cutoffs in a single pass.\n");
+        printf("       A table is written for each population in the format of fcoverage.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"m:t:")) != -1)
+    {
+        switch(i)
+        {
+            case 'm':
+                MKFILE = optarg;
+                break;
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (MKFILE == NULL || optind == argc)
+    {
+        fprintf(stderr, "mk file and at least 1 HapMap LD file expected\n");
+        exit(1);
+    }
+
+    /* the chromosomes and populations of the LD files */
+    fileNo = argc - optind;
+    FRALLOC(batch.coverages, fileNo, COVERAGE);
+    FRALLOC(typed, fileNo, TYPED);
+    memset(&chromosomes, 0, sizeof(KEY_TABLE));
+    memset(&populations, 0, sizeof(KEY_TABLE));
+    for (f=0; f<fileNo; f++)
+    {
+        c = &batch.coverages[f];
+        c->file = argv[optind+f];
+        parseldfile(c);
+
+        for (k=0; k<(int) (sizeof(genomeSnps)/sizeof(GENOME_SNPS)) && strcmp(genomeSnps[k].chromosome, c->chromosome); k++);
+        if (k == sizeof(genomeSnps)/sizeof(GENOME_SNPS))
+        {
+            fatal("%s: no dbSNP SNP count for chromosome %s\n", c->file, c->chromosome);
+        }
+        c->G = genomeSnps[k].snpNo;
+
+        k = keytableget(&chromosomes, c->chromosome, strlen(c->chromosome));
+        if (k == typedNo)
+        {
+            typed[typedNo++].chromosome = c->chromosome;
+        }
+        c->typed = &typed[k];
+        keytableget(&populations, c->population, strlen(c->population));
+    }
+
+    /* the typed SNPs of those chromosomes */
+    fp = zopen(MKFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", MKFILE);
+    }
+    colNo = countfields(line, '\t');
+    fields = (char **) xrealloc(NULL, colNo*sizeof(char *));
+    splitline(line, fields, colNo, '\t');
+    snpCol = getlabel(fields, colNo, "snp-id", MKFILE);
+    chromosomeCol = getlabel(fields, colNo, "chromosome", MKFILE);
+
+    while (readline(fp, &line, &cap) != -1)
+    {
+        if (splitline(line, fields, colNo, '\t') <= MAX(snpCol, chromosomeCol))
+        {
+            continue;
+        }
+        if ((j = keytablefind(&chromosomes, fields[chromosomeCol], strlen(fields[chromosomeCol]),
+                              hashbytes(fields[chromosomeCol], strlen(fields[chromosomeCol])))) == -1)
+        {
+            continue;
+        }
+
+        k = typed[j].snps.n;
+        if (keytableget(&typed[j].snps, fields[snpCol], strlen(fields[snpCol])) != (uint32_t) k)
+        {
+            fprintf(stderr, "duplicate rsID : %s\n", fields[snpCol]);
+        }
+    }
+    zclose(fp, MKFILE);
+
+    /* 1 LD file to a thread at a time */
+    threadNo = MAX(1, MIN(threadNo > 0 ? threadNo : getcpuno(), fileNo));
+    batch.fileNo = fileNo;
+    batch.next = 0;
+    pthread_mutex_init(&batch.lock, NULL);
+    FRALLOC(threads, threadNo, pthread_t);
+    for (t=0; t<threadNo; t++)
+    {
+        if (pthread_create(&threads[t], NULL, coverageworker, &batch))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (t=0; t<threadNo; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+    pthread_mutex_destroy(&batch.lock);
+
+    /* a table for each population, a later file of a chromosome replacing an earlier one as in fcoverage */
+    FRALLOC(table, fileNo, COVERAGE *);
+    for (k=0; k<(int) populations.n; k++)
+    {
+        chromosomeNo = 0;
+        for (f=0; f<fileNo; f++)
+        {
+            c = &batch.coverages[f];
+            if (strcmp(c->population, keytablekey(&populations, k)))
+            {
+                continue;
+            }
+            for (i=0; i<chromosomeNo && strcmp(table[i]->chromosome, c->chromosome); i++);
+            table[i] = c;
+            chromosomeNo = MAX(chromosomeNo, i+1);
+        }
+        qsort(table, chromosomeNo, sizeof(COVERAGE *), chromosomecmp);
+
+        if (populations.n > 1)
+        {
+            printf("%spopulation\t%s\n", k ? "\n" : "", keytablekey(&populations, k));
+        }
+        printcoverage(table, chromosomeNo);
+    }
+
+    return 0;
+}
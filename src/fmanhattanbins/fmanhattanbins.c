@@ -0,0 +1,293 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <unistd.h>
+#include <fralib.h>
+
+/* the chromosomes of the plot, as in the R script of fplotmanhattan */
+#define CHROMOSOME_NO 26
+
+typedef struct
+{
+    long snpNo;
+    double minimum;
+    double maximum;
+    double offset;
+    long pointNo;
+    double yMinimum;
+    double yMaximum;
+} CHROMOSOME_AXIS;
+
+/* a row of the mk file, y is -log(p) as plotted, NAN when it is not plotted */
+typedef struct
+{
+    char *snp;
+    char *chromosomeField;
+    char *positionField;
+    char *pValueField;
+    int chromosome;
+    double position;
+    double y;
+} POINT;
+
+typedef struct
+{
+    FILE *fp;
+    char *file;
+    char *line;
+    size_t cap;
+    char **fields;
+    int colNo;
+    int snpCol;
+    int chromosomeCol;
+    int positionCol;
+    int pValueCol;
+} MK_READER;
+
+static void openmk(MK_READER *mk, char *file)
+{
+    mk->fp = zopen(file);
+    mk->file = file;
+    if (readline(mk->fp, &mk->line, &mk->cap) == -1)
+    {
+        fatal("%s is empty\n", file);
+    }
+
+    mk->colNo = countfields(mk->line, '\t');
+    mk->fields = (char **) xrealloc(mk->fields, mk->colNo*sizeof(char *));
+    splitline(mk->line, mk->fields, mk->colNo, '\t');
+    mk->snpCol = getlabel(mk->fields, mk->colNo, "snp-id", file);
+    mk->chromosomeCol = getlabel(mk->fields, mk->colNo, "chromosome", file);
+    mk->positionCol = getlabel(mk->fields, mk->colNo, "position", file);
+    mk->pValueCol = getlabel(mk->fields, mk->colNo, "p-value", file);
+}
+
+/* the next row on the axis, chromosomes outside 1..26 and unreadable positions are skipped as R leaves them out */
+static int readpoint(MK_READER *mk, POINT *p)
+{
+    char *end;
+    double pValue;
+    long chromosome;
+
+    while (readline(mk->fp, &mk->line, &mk->cap) != -1)
+    {
+        if (splitline(mk->line, mk->fields, mk->colNo, '\t') != mk->colNo)
+        {
+            continue;
+        }
+
+        p->snp = mk->fields[mk->snpCol];
+        p->chromosomeField = mk->fields[mk->chromosomeCol];
+        p->positionField = mk->fields[mk->positionCol];
+        p->pValueField = mk->fields[mk->pValueCol];
+
+        chromosome = strtol(p->chromosomeField, &end, 10);
+        if (end == p->chromosomeField || *end || chromosome < 1 || chromosome > CHROMOSOME_NO)
+        {
+            continue;
+        }
+        p->chromosome = chromosome;
+
+        p->position = strtod(p->positionField, &end);
+        if (end == p->positionField || *end || !isfinite(p->position))
+        {
+            continue;
+        }
+
+        /* + 0.0 writes the -0 of a p-value of 1 as 0 */
+        pValue = strtod(p->pValueField, &end);
+        p->y = end == p->pValueField || *end ? NAN : -log(pValue) + 0.0;
+        if (!isfinite(p->y))
+        {
+            p->y = NAN;
+        }
+
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    char *POINTFILE = NULL;
+    char *AXISFILE = NULL;
+    int i, c, columnNo = 1024, rowNo = 1024;
+    double threshold = 1e-5, yThreshold, xMinimum = INFINITY, xMaximum = -INFINITY, yMinimum = INFINITY, yMaximum = -INFINITY, x;
+    long keptNo = 0, significantNo = 0, snpNo = 0, column, row;
+    CHROMOSOME_AXIS axes[CHROMOSOME_NO+1], *a;
+    MK_READER mk;
+    POINT p;
+    uint8_t *cells;
+    FILE *ofp;
+
+    if(argc==1)
+    {
+        printf("usage: fmanhattanbins [options] <mk-file>\n");
+        printf("\n");
+        printf("       -o       output file of the points to plot\n");
+        printf("       -a       output file of the chromosome axis\n");
+        printf("       -x       columns of the plot (default: 1024)\n");
+        printf("       -y       rows of the plot (default: 1024)\n");
+        printf("       -s       p-value at and below which every point is kept (default: 1e-5)\n");
+        printf("       mk-file  a)snp-id\n");
+        printf("                b)chromosome\n");
+        printf("                c)position\n");
+        printf("                d)p-value\n");
+        printf("\n");
+        printf("       example: fmanhattanbins -o pscalare.points -a pscalare.axis pscalare.txt\n");
+        printf("\n");
+        printf("       The pre-aggregation stage of fplotmanhattan.  The chromosomes are\n");
+        printf("       laid end to end on a genome axis as in its R script, and the plot is\n");
+        printf("       divided into cells of columns by -log(p) rows.  Significant points\n");
+        printf("       are all kept, other points only when they are the first of their\n");
+        printf("       chromosome in a cell, in the order of the mk file.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"o:a:x:y:s:")) != -1)
+    {
+        switch(i)
+        {
+            case 'o':
+                POINTFILE = optarg;
+                break;
+            case 'a':
+                AXISFILE = optarg;
+                break;
+            case 'x':
+                columnNo = atoi(optarg);
+                break;
+            case 'y':
+                rowNo = atoi(optarg);
+                break;
+            case 's':
+                threshold = atof(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (POINTFILE == NULL || AXISFILE == NULL || optind != argc-1)
+    {
+        fprintf(stderr, "point and axis output files and 1 mk file expected\n");
+        exit(1);
+    }
+    if (columnNo < 1 || rowNo < 1 || threshold <= 0)
+    {
+        fprintf(stderr, "positive columns, rows and p-value threshold expected\n");
+        exit(1);
+    }
+
+    /* the range of each chromosome, unplotted p-values included as R does */
+    for (c=0; c<=CHROMOSOME_NO; c++)
+    {
+        axes[c].snpNo = axes[c].pointNo = 0;
+        axes[c].minimum = axes[c].yMinimum = INFINITY;
+        axes[c].maximum = axes[c].yMaximum = -INFINITY;
+    }
+
+    memset(&mk, 0, sizeof(MK_READER));
+    openmk(&mk, argv[optind]);
+    while (readpoint(&mk, &p))
+    {
+        a = &axes[p.chromosome];
+        a->snpNo++;
+        a->minimum = MIN(a->minimum, p.position);
+        a->maximum = MAX(a->maximum, p.position);
+        if (!isnan(p.y))
+        {
+            a->pointNo++;
+            a->yMinimum = MIN(a->yMinimum, p.y);
+            a->yMaximum = MAX(a->yMaximum, p.y);
+        }
+    }
+    zclose(mk.fp, mk.file);
+
+    /* chromosomes end to end, an empty chromosome spanning 0..0 */
+    for (c=1; c<=CHROMOSOME_NO; c++)
+    {
+        if (!axes[c].snpNo)
+        {
+            axes[c].minimum = axes[c].maximum = 0;
+        }
+        axes[c].offset = c == 1 ? -axes[c].minimum : axes[c-1].offset + axes[c-1].maximum - axes[c].minimum;
+
+        if (axes[c].snpNo)
+        {
+            xMinimum = MIN(xMinimum, axes[c].minimum + axes[c].offset);
+            xMaximum = MAX(xMaximum, axes[c].maximum + axes[c].offset);
+        }
+        if (axes[c].pointNo)
+        {
+            yMinimum = MIN(yMinimum, axes[c].yMinimum);
+            yMaximum = MAX(yMaximum, axes[c].yMaximum);
+        }
+    }
+
+    ofp = xopen(AXISFILE, "w");
+    fprintf(ofp, "chromosome\tsnp-no\tminimum\tmaximum\toffset\ty-minimum\ty-maximum\n");
+    for (c=1; c<=CHROMOSOME_NO; c++)
+    {
+        fprintf(ofp, "%d\t%ld\t%.15g\t%.15g\t%.15g", c, axes[c].snpNo, axes[c].minimum, axes[c].maximum, axes[c].offset);
+        if (axes[c].pointNo)
+        {
+            fprintf(ofp, "\t%.15g\t%.15g\n", axes[c].yMinimum, axes[c].yMaximum);
+        }
+        else
+        {
+            fprintf(ofp, "\tNA\tNA\n");
+        }
+    }
+    fclose(ofp);
+
+    /* the cells hold the chromosome of their point */
+    FRALLOC(cells, (size_t) columnNo*rowNo, uint8_t);
+    yThreshold = -log(threshold);
+
+    ofp = xopen(POINTFILE, "w");
+    fprintf(ofp, "snp-id\tchromosome\tposition\tp-value\n");
+    openmk(&mk, argv[optind]);
+    while (readpoint(&mk, &p))
+    {
+        if (isnan(p.y))
+        {
+            continue;
+        }
+        ++snpNo;
+
+        if (p.y >= yThreshold)
+        {
+            ++significantNo;
+        }
+        else
+        {
+            x = p.position + axes[p.chromosome].offset;
+            column = xMaximum > xMinimum ? (long) ((x - xMinimum) / (xMaximum - xMinimum) * columnNo) : 0;
+            row = yMaximum > yMinimum ? (long) ((p.y - yMinimum) / (yMaximum - yMinimum) * rowNo) : 0;
+            column = MAX(0, MIN(column, columnNo-1));
+            row = MAX(0, MIN(row, rowNo-1));
+
+            if (cells[column*rowNo + row] == p.chromosome)
+            {
+                continue;
+            }
+            cells[column*rowNo + row] = p.chromosome;
+        }
+
+        fprintf(ofp, "%s\t%s\t%s\t%s\n", p.snp, p.chromosomeField, p.positionField, p.pValueField);
+        ++keptNo;
+    }
+    zclose(mk.fp, mk.file);
+    fclose(ofp);
+
+    fprintf(stderr, "%ld of %ld points kept, %ld significant\n", keptNo, snpNo, significantNo);
+
+    return 0;
+}
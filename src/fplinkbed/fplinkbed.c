@@ -0,0 +1,776 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <fralib.h>
+
+#define BLOCK_SIZE (16*1024*1024)
+
+/* gt rows are transposed a group at a time, a multiple of 4 samples */
+#define SAMPLE_GROUP 128
+
+typedef struct
+{
+    int32_t chromosome;
+    int64_t position;
+    char *positionText;
+    char *alleleA;
+    char *alleleB;
+    int32_t rank;
+} BED_SNP;
+
+typedef struct
+{
+    int sex;
+    int affection;
+} BED_SAMPLE;
+
+/*
+ * the .bed file is mapped with a record for every SNP the mk file places,
+ * in chromosome and position order.  Records of SNPs missing from the
+ * genotype file are dropped when the file is compacted.
+ */
+typedef struct
+{
+    KEY_TABLE *snpIDs;
+    BED_SNP *snps;
+    uint32_t *rankSNPs;
+    uint32_t rankNo;
+    unsigned char *present;
+    unsigned char *swapped;
+    unsigned char *bed;
+    size_t bedSize;
+    size_t stride;
+    int keepAlleles;
+
+    char *file;
+    char *mkFile;
+    int columnNo;
+    int sampleNo;
+    int *sampleColumns;
+    int32_t *columnRanks;
+    unsigned char *groupCodes;
+    char **groupRows;
+} EXPORT;
+
+typedef struct
+{
+    EXPORT *ex;
+    pthread_t thread;
+    char *from;
+    char *to;
+    long first;
+    long last;
+    size_t groupByte;
+    unsigned char *codes;
+    unsigned char *gathered;
+} WORKER;
+
+static BED_SNP *sortsnps;
+static KEY_TABLE *sortchromosomes;
+
+/* chromosomes as gt2plink sorts them, numerically if both are numbers */
+static int comparechromosomes(char *s1, char *s2)
+{
+    char *s;
+
+    for (s=s1; isdigit(*s); s++);
+    if (*s == '\0' && s != s1)
+    {
+        for (s=s2; isdigit(*s); s++);
+        if (*s == '\0' && s != s2)
+        {
+            return atol(s1) < atol(s2) ? -1 : (atol(s1) > atol(s2));
+        }
+    }
+
+    return strcmp(s1, s2);
+}
+
+/* by chromosome, then position, then mk file order */
+static int comparesnps(const void *a, const void *b)
+{
+    BED_SNP *s1 = &sortsnps[*(uint32_t *) a];
+    BED_SNP *s2 = &sortsnps[*(uint32_t *) b];
+    int c;
+
+    if (s1->chromosome != s2->chromosome &&
+        (c = comparechromosomes(keytablekey(sortchromosomes, s1->chromosome), keytablekey(sortchromosomes, s2->chromosome))) != 0)
+    {
+        return c;
+    }
+    if (s1->position != s2->position)
+    {
+        return s1->position < s2->position ? -1 : 1;
+    }
+
+    return *(uint32_t *) a < *(uint32_t *) b ? -1 : 1;
+}
+
+static void runworkers(WORKER *workers, int threadNo, void *(*worker)(void *))
+{
+    int t;
+
+    for (t=0; t<threadNo; t++)
+    {
+        if (pthread_create(&workers[t].thread, NULL, worker, &workers[t]))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (t=0; t<threadNo; t++)
+    {
+        pthread_join(workers[t].thread, NULL);
+    }
+}
+
+/* tg rows are SNP records, each decoded, gathered and packed into its place */
+static void *tgworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    EXPORT *ex = w->ex;
+    char *line, *next, *s;
+    unsigned char *codes;
+    long snp;
+    int32_t rank;
+    int i;
+
+    for (line=w->from; line<w->to; line=next+1)
+    {
+        next = memchr(line, '\n', w->to - line);
+        if ((s = memchr(line, '\t', next - line)) == NULL)
+        {
+            continue;
+        }
+
+        snp = keytablefind(ex->snpIDs, line, s - line, hashbytes(line, s - line));
+        if (snp == -1)
+        {
+            fprintf(stderr, "%.*s exists in %s but not in %s\n", (int) (s - line), line, ex->file, ex->mkFile);
+            continue;
+        }
+        if ((rank = ex->snps[snp].rank) == -1)
+        {
+            continue;
+        }
+
+        if (decodebedcodes(s + 1, next, ex->columnNo, w->codes) == NULL)
+        {
+            fatal("%s: %.*s does not have %d genotypes\n", ex->file, (int) (s - line), line, ex->columnNo);
+        }
+
+        codes = w->codes;
+        if (ex->sampleColumns != NULL)
+        {
+            for (i=0; i<ex->sampleNo; i++)
+            {
+                w->gathered[i] = w->codes[ex->sampleColumns[i]];
+            }
+            codes = w->gathered;
+        }
+
+        packbedcodes(codes, ex->sampleNo, ex->bed + BED_MAGIC_SIZE + rank*ex->stride);
+        ex->present[rank] = 1;
+    }
+
+    return NULL;
+}
+
+static void *gtdecodeworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    EXPORT *ex = w->ex;
+    char *s;
+    long r;
+
+    for (r=w->first; r<w->last; r++)
+    {
+        s = strchr(ex->groupRows[r], '\t');
+        if (s == NULL || decodebedcodes(s + 1, s + strlen(s), ex->columnNo, ex->groupCodes + r*ex->columnNo) == NULL)
+        {
+            fatal("%s: sample %s does not have %d genotypes\n", ex->file, ex->groupRows[r], ex->columnNo);
+        }
+    }
+
+    return NULL;
+}
+
+/* 4 sample rows of codes make a byte of each SNP record */
+static void *gtpackworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    EXPORT *ex = w->ex;
+    unsigned char *r0, *r1, *r2, *r3, *packed = w->gathered;
+    long c, k;
+
+    for (k=0; k<SAMPLE_GROUP/4 && w->groupByte+k<ex->stride; k++)
+    {
+        r0 = ex->groupCodes + (4*k)*ex->columnNo;
+        r1 = r0 + ex->columnNo;
+        r2 = r1 + ex->columnNo;
+        r3 = r2 + ex->columnNo;
+        for (c=w->first; c<w->last; c++)
+        {
+            packed[c - w->first] = r0[c] | (r1[c] << 2) | (r2[c] << 4) | (r3[c] << 6);
+        }
+        for (c=w->first; c<w->last; c++)
+        {
+            if (ex->columnRanks[c] != -1)
+            {
+                ex->bed[BED_MAGIC_SIZE + ex->columnRanks[c]*ex->stride + w->groupByte + k] = packed[c - w->first];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* A1 is the minor allele, as PLINK makes it when it converts a ped file */
+static void *allelesworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    EXPORT *ex = w->ex;
+    unsigned char *record;
+    long r, a1, a2;
+
+    for (r=w->first; r<w->last; r++)
+    {
+        if (ex->present[r])
+        {
+            record = ex->bed + BED_MAGIC_SIZE + r*ex->stride;
+            countbedalleles(record, ex->sampleNo, &a1, &a2);
+            if (a1 > a2)
+            {
+                swapbedalleles(record, ex->sampleNo);
+                ex->swapped[r] = 1;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+static void mapbed(EXPORT *ex, char *file, int sampleCap)
+{
+    int fd;
+
+    ex->stride = BED_RECORD_SIZE(sampleCap);
+    ex->bedSize = BED_MAGIC_SIZE + ex->rankNo*ex->stride;
+    if ((fd = open(file, O_RDWR | O_CREAT | O_TRUNC, 0644)) == -1 || ftruncate(fd, ex->bedSize) == -1 ||
+        (ex->bed = (unsigned char *) mmap(NULL, ex->bedSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0)) == MAP_FAILED)
+    {
+        fatal("Cannot open %s\n", file);
+    }
+    close(fd);
+
+    memcpy(ex->bed, bedMagic, BED_MAGIC_SIZE);
+}
+
+/* drops the records of absent SNPs and the unused sample capacity */
+static size_t compactbed(EXPORT *ex)
+{
+    size_t recordSize = BED_RECORD_SIZE(ex->sampleNo), n = 0;
+    uint32_t r;
+
+    for (r=0; r<ex->rankNo; r++)
+    {
+        if (ex->present[r])
+        {
+            if (n != r || recordSize != ex->stride)
+            {
+                memmove(ex->bed + BED_MAGIC_SIZE + n*recordSize, ex->bed + BED_MAGIC_SIZE + r*ex->stride, recordSize);
+            }
+            ++n;
+        }
+    }
+
+    return BED_MAGIC_SIZE + n*recordSize;
+}
+
+int main(int argc, char **argv)
+{
+    int i, t, n, fieldNo, col1, col2, col3, col4, threadNo = 0, keepAlleles = 0, eof = 0;
+    char *SAFILE = NULL, *MKFILE = NULL, *GENOFILE, *OUTPREFIX = NULL, *line = NULL, **fields, *s, *name;
+    char file[4096];
+    size_t cap = 0, used;
+    long lineNo, k, sampleIndex, groupNo, groupStart;
+    uint32_t snpNo = 0, snpCap = 0, r, first;
+    int tgFile;
+    KEY_TABLE snpIDs, chromosomes, samples;
+    BED_SNP *snps = NULL, *snp;
+    BED_SAMPLE *sampleInfo = NULL;
+    long *outSamples = NULL;
+    EXPORT ex;
+    WORKER *workers;
+    BUFFER block = {NULL, 0, 0}, group = {NULL, 0, 0};
+    FILE *fp, *out;
+
+    if(argc==1)
+    {
+        printf("usage: fplinkbed [options] -s <sa-file> -m <mk-file> <gt-file|tg-file>\n");
+        printf("\n");
+        printf("       -s       sa file\n");
+        printf("                a)sample-id\n");
+        printf("                b)affection (optional)\n");
+        printf("                c)sex (optional)\n");
+        printf("       -m       mk file\n");
+        printf("                a)snp-id\n");
+        printf("                b)chromosome (1-22,X,Y,XY,MT)\n");
+        printf("                c)position\n");
+        printf("                d)alleles\n");
+        printf("       -o       output prefix (default: the genotype file name)\n");
+        printf("       -k       keep the mk allele order, A1 is allele A\n");
+        printf("       -t       number of threads (default: number of processors)\n");
+        printf("\n");
+        printf("       example: fplinkbed -s pscalare.sa -m pscalare.mk pscalare.gt\n");
+        printf("\n");
+        printf("       Writes the PLINK binary files <prefix>.bed, .bim and .fam from a gt or tg\n");
+        printf("       file with the SNPs and samples gt2plink writes to a ped file.  A1 is the\n");
+        printf("       minor allele, as PLINK makes it from a ped file.  The genotypes are packed\n");
+        printf("       into SNP-major records of a memory mapped .bed file by the threads.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"s:m:o:kt:")) != -1)
+    {
+        switch(i)
+        {
+            case 's':
+                SAFILE = optarg;
+                break;
+            case 'm':
+                MKFILE = optarg;
+                break;
+            case 'o':
+                OUTPREFIX = optarg;
+                break;
+            case 'k':
+                keepAlleles = 1;
+                break;
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (SAFILE == NULL || MKFILE == NULL || optind != argc-1)
+    {
+        fprintf(stderr, "sa file, mk file and 1 genotype file expected\n");
+        exit(1);
+    }
+
+    memset(&ex, 0, sizeof(EXPORT));
+    ex.keepAlleles = keepAlleles;
+    GENOFILE = argv[optind];
+    threadNo = threadNo > 0 ? threadNo : getcpuno();
+    memset(&snpIDs, 0, sizeof(KEY_TABLE));
+    memset(&chromosomes, 0, sizeof(KEY_TABLE));
+    memset(&samples, 0, sizeof(KEY_TABLE));
+
+    /* samples, missing annotations are coded 0 */
+    fp = zopen(SAFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", SAFILE);
+    }
+    fieldNo = countfields(line, '\t');
+    FRALLOC(fields, MAX(fieldNo, 4), char *);
+    splitline(line, fields, fieldNo, '\t');
+    col1 = getlabel(fields, fieldNo, "sample-id", SAFILE);
+    for (col2=0; col2<fieldNo && strcmp(fields[col2], "affection")!=0; col2++);
+    for (col3=0; col3<fieldNo && strcmp(fields[col3], "sex")!=0; col3++);
+
+    for (lineNo=2; readline(fp, &line, &cap) != -1; lineNo++)
+    {
+        if (splitline(line, fields, fieldNo, '\t') != fieldNo)
+        {
+            fatal("%s: row %ld does not have %d columns\n", SAFILE, lineNo, fieldNo);
+        }
+
+        k = keytableget(&samples, fields[col1], strlen(fields[col1]));
+        if (k == samples.n - 1)
+        {
+            sampleInfo = (BED_SAMPLE *) xrealloc(sampleInfo, samples.cap*sizeof(BED_SAMPLE));
+        }
+
+        if (col2 == fieldNo || strcmp(fields[col2], "n/a") == 0)
+        {
+            sampleInfo[k].affection = 0;
+        }
+        else if (strcmp(fields[col2], "control") == 0)
+        {
+            sampleInfo[k].affection = 1;
+        }
+        else if (strcmp(fields[col2], "case") == 0)
+        {
+            sampleInfo[k].affection = 2;
+        }
+        else
+        {
+            fatal("Unrecognised value in affection column: %s\n", fields[col2]);
+        }
+
+        if (col3 == fieldNo || strcmp(fields[col3], "n/a") == 0)
+        {
+            sampleInfo[k].sex = 0;
+        }
+        else if (strcmp(fields[col3], "male") == 0)
+        {
+            sampleInfo[k].sex = 1;
+        }
+        else if (strcmp(fields[col3], "female") == 0)
+        {
+            sampleInfo[k].sex = 2;
+        }
+        else
+        {
+            fatal("Unrecognised value in sex column: %s\n", fields[col3]);
+        }
+    }
+    zclose(fp, SAFILE);
+    free(fields);
+
+    /* SNPs, the first SNP mk file order at a location is kept */
+    fp = zopen(MKFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", MKFILE);
+    }
+    fieldNo = countfields(line, '\t');
+    FRALLOC(fields, fieldNo, char *);
+    splitline(line, fields, fieldNo, '\t');
+    col1 = getlabel(fields, fieldNo, "snp-id", MKFILE);
+    col2 = getlabel(fields, fieldNo, "chromosome", MKFILE);
+    col3 = getlabel(fields, fieldNo, "position", MKFILE);
+    col4 = getlabel(fields, fieldNo, "alleles", MKFILE);
+
+    for (lineNo=2; readline(fp, &line, &cap) != -1; lineNo++)
+    {
+        if (splitline(line, fields, fieldNo, '\t') != fieldNo)
+        {
+            fatal("%s: row %ld does not have %d columns\n", MKFILE, lineNo, fieldNo);
+        }
+
+        k = keytableget(&snpIDs, fields[col1], strlen(fields[col1]));
+        if (k == snpNo)
+        {
+            if (snpNo == snpCap)
+            {
+                snpCap = snpCap ? 2*snpCap : 65536;
+                snps = (BED_SNP *) xrealloc(snps, snpCap*sizeof(BED_SNP));
+            }
+            ++snpNo;
+        }
+        else
+        {
+            free(snps[k].positionText);
+            free(snps[k].alleleA);
+        }
+
+        snp = &snps[k];
+        snp->rank = -1;
+        snp->chromosome = -1;
+        snp->positionText = strdup(fields[col3]);
+        snp->alleleA = strdup(fields[col4]);
+        snp->alleleB = (s = strchr(snp->alleleA, '/')) == NULL ? "0" : s + 1;
+        if (s != NULL)
+        {
+            *s = '\0';
+            if ((s = strchr(snp->alleleB, '/')) != NULL)
+            {
+                *s = '\0';
+            }
+        }
+
+        if (strcmp(fields[col2], "n/a") != 0 && strcmp(fields[col3], "n/a") != 0)
+        {
+            snp->chromosome = keytableget(&chromosomes, fields[col2], strlen(fields[col2]));
+            snp->position = atoll(fields[col3]);
+        }
+        else
+        {
+            fprintf(stderr, "SNP without location: %s dropped\n", fields[col1]);
+        }
+    }
+    zclose(fp, MKFILE);
+    free(fields);
+
+    FRALLOC(ex.rankSNPs, MAX(snpNo, 1), uint32_t);
+    for (k=0; k<snpNo; k++)
+    {
+        if (snps[k].chromosome != -1)
+        {
+            ex.rankSNPs[ex.rankNo++] = k;
+        }
+    }
+    sortsnps = snps;
+    sortchromosomes = &chromosomes;
+    qsort(ex.rankSNPs, ex.rankNo, sizeof(uint32_t), comparesnps);
+
+    for (first=0, n=0, r=0; r<ex.rankNo; r++)
+    {
+        snp = &snps[ex.rankSNPs[r]];
+        if (r > 0 && snp->chromosome == snps[ex.rankSNPs[first]].chromosome && snp->position == snps[ex.rankSNPs[first]].position)
+        {
+            fprintf(stderr, "Multiple SNPs with the same location: %s, %s, %s with %s dropped\n", keytablekey(&snpIDs, ex.rankSNPs[r]),
+                    keytablekey(&chromosomes, snp->chromosome), snp->positionText, keytablekey(&snpIDs, ex.rankSNPs[first]));
+            continue;
+        }
+        first = r;
+        snp->rank = n;
+        ex.rankSNPs[n++] = ex.rankSNPs[r];
+    }
+    ex.rankNo = n;
+    ex.snpIDs = &snpIDs;
+    ex.snps = snps;
+    ex.file = GENOFILE;
+    ex.mkFile = MKFILE;
+    FRALLOC(ex.present, MAX(ex.rankNo, 1), unsigned char);
+    FRALLOC(ex.swapped, MAX(ex.rankNo, 1), unsigned char);
+
+    if (OUTPREFIX == NULL)
+    {
+        name = (s = strrchr(GENOFILE, '/')) == NULL ? strdup(GENOFILE) : strdup(s + 1);
+        if ((s = strchr(name, '.')) != NULL)
+        {
+            *s = '\0';
+        }
+        OUTPREFIX = name;
+    }
+    snprintf(file, sizeof(file), "%s.bed", OUTPREFIX);
+
+    FRALLOC(workers, threadNo, WORKER);
+    for (t=0; t<threadNo; t++)
+    {
+        workers[t].ex = &ex;
+    }
+
+    fp = zopen(GENOFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", GENOFILE);
+    }
+    ex.columnNo = countfields(line, '\t') - 1;
+    FRALLOC(fields, ex.columnNo + 1, char *);
+    splitline(line, fields, ex.columnNo + 1, '\t');
+
+    /* the header tells the file apart, compressed files included */
+    if (strcmp(fields[0], "snp-id") == 0 || strcmp(fields[0], "marker-id") == 0)
+    {
+        tgFile = 1;
+    }
+    else if (strcmp(fields[0], "sample-id") == 0)
+    {
+        tgFile = 0;
+    }
+    else
+    {
+        fatal("%s not a gt or tg file\n", GENOFILE);
+    }
+
+    if (tgFile)
+    {
+        /* the samples are the columns, those in the sa file are exported */
+        FRALLOC(ex.sampleColumns, MAX(ex.columnNo, 1), int);
+        FRALLOC(outSamples, MAX(ex.columnNo, 1), long);
+        for (i=0; i<ex.columnNo; i++)
+        {
+            if ((k = keytablefind(&samples, fields[i+1], strlen(fields[i+1]), hashbytes(fields[i+1], strlen(fields[i+1])))) == -1)
+            {
+                fprintf(stderr, "%s exists in %s but not in %s\n", fields[i+1], GENOFILE, SAFILE);
+                continue;
+            }
+            outSamples[ex.sampleNo] = k;
+            ex.sampleColumns[ex.sampleNo++] = i;
+        }
+        if (ex.sampleNo == ex.columnNo)
+        {
+            free(ex.sampleColumns);
+            ex.sampleColumns = NULL;
+        }
+
+        mapbed(&ex, file, ex.sampleNo);
+        for (t=0; t<threadNo; t++)
+        {
+            FRALLOC(workers[t].codes, MAX(ex.columnNo, 1), unsigned char);
+            FRALLOC(workers[t].gathered, MAX(ex.sampleNo, 1), unsigned char);
+        }
+
+        /* blocks of rows are split between the threads at line ends */
+        while (!eof)
+        {
+            if (block.cap - block.size < BLOCK_SIZE/2)
+            {
+                block.cap = block.size + BLOCK_SIZE;
+                block.data = (char *) xrealloc(block.data, block.cap);
+            }
+
+            used = fread(block.data + block.size, 1, block.cap - block.size - 1, fp);
+            eof = used < block.cap - block.size - 1;
+            block.size += used;
+            if (eof && block.size && block.data[block.size-1] != '\n')
+            {
+                block.data[block.size++] = '\n';
+            }
+
+            for (s=block.data + block.size; s>block.data && s[-1]!='\n'; --s);
+            if (s == block.data)
+            {
+                continue;
+            }
+            used = s - block.data;
+
+            for (t=0; t<threadNo; t++)
+            {
+                s = block.data + used*t/threadNo;
+                if (t > 0)
+                {
+                    s = memchr(s, '\n', block.data + used - s) + 1;
+                }
+                workers[t].from = MAX(s, t > 0 ? workers[t-1].from : block.data);
+                if (t > 0)
+                {
+                    workers[t-1].to = workers[t].from;
+                }
+            }
+            workers[threadNo-1].to = block.data + used;
+            runworkers(workers, threadNo, tgworker);
+
+            memmove(block.data, block.data + used, block.size - used);
+            block.size -= used;
+        }
+    }
+    else
+    {
+        /* the SNPs are the columns, the samples are transposed a group at a time */
+        FRALLOC(ex.columnRanks, MAX(ex.columnNo, 1), int32_t);
+        for (i=0; i<ex.columnNo; i++)
+        {
+            ex.columnRanks[i] = -1;
+            if ((k = keytablefind(&snpIDs, fields[i+1], strlen(fields[i+1]), hashbytes(fields[i+1], strlen(fields[i+1])))) == -1)
+            {
+                fprintf(stderr, "%s exists in %s but not in %s\n", fields[i+1], GENOFILE, MKFILE);
+            }
+            else if (snps[k].rank != -1)
+            {
+                ex.columnRanks[i] = snps[k].rank;
+                ex.present[snps[k].rank] = 1;
+            }
+        }
+
+        mapbed(&ex, file, samples.n);
+        FRALLOC(outSamples, MAX(samples.n, 1), long);
+        FRALLOC(ex.groupCodes, ((size_t) SAMPLE_GROUP)*MAX(ex.columnNo, 1), unsigned char);
+        FRALLOC(ex.groupRows, SAMPLE_GROUP, char *);
+        for (t=0; t<threadNo; t++)
+        {
+            FRALLOC(workers[t].gathered, ex.columnNo/threadNo + 1, unsigned char);
+        }
+
+        groupNo = 0;
+        groupStart = 0;
+        while (!eof)
+        {
+            if (readline(fp, &line, &cap) != -1)
+            {
+                if ((s = strchr(line, '\t')) == NULL || (sampleIndex = keytablefind(&samples, line, s - line, hashbytes(line, s - line))) == -1)
+                {
+                    fprintf(stderr, "%.*s exists in %s but not in %s\n", s == NULL ? (int) strlen(line) : (int) (s - line), line, GENOFILE, SAFILE);
+                    continue;
+                }
+                if (ex.sampleNo == samples.n)
+                {
+                    fatal("%s has more samples of %s than there are\n", GENOFILE, SAFILE);
+                }
+
+                outSamples[ex.sampleNo++] = sampleIndex;
+                bufferappend(&group, line, strlen(line) + 1);
+                ++groupNo;
+            }
+            else
+            {
+                eof = 1;
+            }
+
+            if (groupNo == SAMPLE_GROUP || (eof && groupNo > 0))
+            {
+                for (s=group.data, k=0; k<groupNo; k++, s+=strlen(s)+1)
+                {
+                    ex.groupRows[k] = s;
+                }
+                memset(ex.groupCodes + groupNo*ex.columnNo, BED_HOM_A1, (SAMPLE_GROUP - groupNo)*ex.columnNo);
+
+                for (t=0; t<threadNo; t++)
+                {
+                    workers[t].first = groupNo*t/threadNo;
+                    workers[t].last = groupNo*(t+1)/threadNo;
+                }
+                runworkers(workers, threadNo, gtdecodeworker);
+
+                for (t=0; t<threadNo; t++)
+                {
+                    workers[t].first = ((long) ex.columnNo)*t/threadNo;
+                    workers[t].last = ((long) ex.columnNo)*(t+1)/threadNo;
+                    workers[t].groupByte = groupStart/4;
+                }
+                runworkers(workers, threadNo, gtpackworker);
+
+                groupStart += SAMPLE_GROUP;
+                groupNo = 0;
+                group.size = 0;
+            }
+        }
+    }
+    zclose(fp, GENOFILE);
+
+    if (!ex.keepAlleles)
+    {
+        for (t=0; t<threadNo; t++)
+        {
+            workers[t].first = ((long) ex.rankNo)*t/threadNo;
+            workers[t].last = ((long) ex.rankNo)*(t+1)/threadNo;
+        }
+        runworkers(workers, threadNo, allelesworker);
+    }
+
+    used = compactbed(&ex);
+    munmap(ex.bed, ex.bedSize);
+    if (truncate(file, used) == -1)
+    {
+        fatal("Cannot truncate %s\n", file);
+    }
+
+    snprintf(file, sizeof(file), "%s.bim", OUTPREFIX);
+    out = xopen(file, "w");
+    for (r=0; r<ex.rankNo; r++)
+    {
+        if (ex.present[r])
+        {
+            snp = &snps[ex.rankSNPs[r]];
+            fprintf(out, "%s\t%s\t0\t%s\t%s\t%s\n", keytablekey(&chromosomes, snp->chromosome), keytablekey(&snpIDs, ex.rankSNPs[r]),
+                    snp->positionText, ex.swapped[r] ? snp->alleleB : snp->alleleA, ex.swapped[r] ? snp->alleleA : snp->alleleB);
+        }
+    }
+    fclose(out);
+
+    snprintf(file, sizeof(file), "%s.fam", OUTPREFIX);
+    out = xopen(file, "w");
+    for (k=0; k<ex.sampleNo; k++)
+    {
+        s = keytablekey(&samples, outSamples[k]);
+        fprintf(out, "FAM%s\t%s\t0\t0\t%d\t%d\n", s, s, sampleInfo[outSamples[k]].sex, sampleInfo[outSamples[k]].affection);
+    }
+    fclose(out);
+
+    return 0;
+}
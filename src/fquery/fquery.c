@@ -0,0 +1,1051 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <fralib.h>
+
+#define BLOCK_SIZE (64*1024*1024)
+#define MAX_CONDITIONS 64
+#define NO_ROW 0xFFFFFFFF
+
+enum {NONE, COUNT, MIN, MAX, SUM};
+enum {INNER_JOIN, LEFT_JOIN, OUTER_JOIN};
+
+static char *functions[] = {"", "count", "min", "max", "sum"};
+
+typedef struct
+{
+    char *file;
+    FILE *fp;
+    char *header;
+    char **labels;
+    int colNo;
+    int maxCol;
+    int *slotOf;
+    int slotNo;
+    int keyCols[MAX_CONDITIONS];
+    int filterCols[MAX_CONDITIONS];
+    char *filterValues[MAX_CONDITIONS];
+    int filterNo;
+} TABLE;
+
+typedef struct
+{
+    int table;
+    int col;
+} COLUMN;
+
+typedef struct
+{
+    int function;
+    COLUMN column;
+    int arg;
+} SELECTED;
+
+typedef struct
+{
+    long count;
+    double value;
+} AGGREGATE;
+
+typedef struct
+{
+    TABLE tables[2];
+    int tableNo;
+    int build;
+    int probe;
+    int joinType;
+    int keyNo;
+    char delim;
+
+    /* the columns written for each joined row */
+    COLUMN *emits;
+    int emitNo;
+    char separator;
+
+    /* the projected rows of the hash table side */
+    KEY_TABLE keys;
+    uint32_t *firstRows;
+    uint32_t *lastRows;
+    BUFFER rows;
+    size_t *rowValues;
+    uint32_t *rowNext;
+    uint32_t rowNo;
+    uint32_t rowCap;
+    unsigned char *matched;
+
+    /* grouped aggregates */
+    SELECTED *selects;
+    int selectNo;
+    COLUMN *groups;
+    int groupNo;
+    int aggregating;
+    KEY_TABLE groupKeys;
+    AGGREGATE *aggregates;
+} QUERY;
+
+typedef struct
+{
+    QUERY *q;
+    char *start;
+    char *end;
+    BUFFER out;
+    BUFFER key;
+    char **fields;
+    int *lengths;
+} WORKER;
+
+/*
+ * finds the columns of a line up to maxCol without copying them, the last
+ * column of the header takes the rest of the line as Perl's split does
+ */
+static int tokenize(TABLE *t, char *line, char *end, char delim, char **fields, int *lengths)
+{
+    int n = 0;
+    char *s;
+
+    while (n <= t->maxCol)
+    {
+        fields[n] = line;
+        if (n == t->colNo - 1 || (s = memchr(line, delim, end - line)) == NULL)
+        {
+            lengths[n++] = end - line;
+            break;
+        }
+        lengths[n++] = s - line;
+        line = s + 1;
+    }
+
+    return n;
+}
+
+static int passesfilters(TABLE *t, char **fields, int *lengths)
+{
+    int i, col;
+
+    for (i=0; i<t->filterNo; i++)
+    {
+        col = t->filterCols[i];
+        if ((size_t) lengths[col] != strlen(t->filterValues[i]) ||
+            memcmp(fields[col], t->filterValues[i], lengths[col]) != 0)
+        {
+            return 0;
+        }
+    }
+
+    return 1;
+}
+
+/* join keys are the key columns separated by \0 */
+static void makekey(TABLE *t, int keyNo, char **fields, int *lengths, BUFFER *key)
+{
+    int k;
+
+    key->size = 0;
+    for (k=0; k<keyNo; k++)
+    {
+        if (k)
+        {
+            bufferappendchar(key, '\0');
+        }
+        bufferappend(key, fields[t->keyCols[k]], lengths[t->keyCols[k]]);
+    }
+}
+
+static char *rowvalue(QUERY *q, uint32_t row, int slot)
+{
+    char *s = q->rows.data + q->rowValues[row];
+
+    while (slot--)
+    {
+        s += strlen(s) + 1;
+    }
+
+    return s;
+}
+
+static int keyindex(TABLE *t, int keyNo, int col)
+{
+    int k;
+
+    for (k=0; k<keyNo; k++)
+    {
+        if (t->keyCols[k] == col)
+        {
+            return k;
+        }
+    }
+
+    return -1;
+}
+
+/*
+ * writes the emitted columns of a probe row joined with a hash table row,
+ * fields is NULL for a hash table row without a match and row is NO_ROW for
+ * a probe row without one.  Missing columns are n/a, except that the key
+ * columns of a missing file a take the key values of file b.
+ */
+static void emitrow(QUERY *q, BUFFER *out, char **fields, int *lengths, uint32_t row)
+{
+    TABLE *t;
+    int i, k, col, table, present;
+    char *s;
+
+    for (i=0; i<q->emitNo; i++)
+    {
+        if (i)
+        {
+            bufferappendchar(out, q->separator);
+        }
+
+        table = q->emits[i].table;
+        col = q->emits[i].col;
+        present = table == q->probe ? fields != NULL : row != NO_ROW;
+
+        if (!present && table == 0 && q->joinType == OUTER_JOIN && (k = keyindex(&q->tables[0], q->keyNo, col)) != -1)
+        {
+            table = 1;
+            col = q->tables[1].keyCols[k];
+            present = 1;
+        }
+
+        if (!present)
+        {
+            bufferappend(out, "n/a", 3);
+        }
+        else if (table == q->probe)
+        {
+            bufferappend(out, fields[col], lengths[col]);
+        }
+        else
+        {
+            t = &q->tables[table];
+            s = rowvalue(q, row, t->slotOf[col]);
+            bufferappend(out, s, strlen(s));
+        }
+    }
+    bufferappendchar(out, '\n');
+}
+
+static void *probeworker(void *arg)
+{
+    WORKER *w = (WORKER *) arg;
+    QUERY *q = w->q;
+    TABLE *t = &q->tables[q->probe];
+    char *line, *next, *end;
+    long key;
+    uint32_t row;
+    int emitUnmatched = q->joinType != INNER_JOIN;
+
+    for (line=w->start; line<w->end; line=next+1)
+    {
+        next = memchr(line, '\n', w->end - line);
+        end = next > line && next[-1] == '\r' ? next - 1 : next;
+        if (end == line)
+        {
+            continue;
+        }
+
+        if (tokenize(t, line, end, q->delim, w->fields, w->lengths) <= t->maxCol)
+        {
+            *end = '\0';
+            fatal("%s: fewer than %d columns in %s\n", t->file, t->maxCol + 1, line);
+        }
+
+        if (!passesfilters(t, w->fields, w->lengths))
+        {
+            continue;
+        }
+
+        if (q->build == -1)
+        {
+            emitrow(q, &w->out, w->fields, w->lengths, NO_ROW);
+            continue;
+        }
+
+        makekey(t, q->keyNo, w->fields, w->lengths, &w->key);
+        key = keytablefind(&q->keys, w->key.data, w->key.size, hashbytes(w->key.data, w->key.size));
+        if (key != -1)
+        {
+            if (q->joinType != INNER_JOIN)
+            {
+                __atomic_store_n(&q->matched[key], 1, __ATOMIC_RELAXED);
+            }
+            for (row=q->firstRows[key]; row!=NO_ROW; row=q->rowNext[row])
+            {
+                emitrow(q, &w->out, w->fields, w->lengths, row);
+            }
+        }
+        else if (emitUnmatched)
+        {
+            emitrow(q, &w->out, w->fields, w->lengths, NO_ROW);
+        }
+    }
+
+    return NULL;
+}
+
+static int isnumber(char *s, double *value)
+{
+    char *end;
+
+    *value = strtod(s, &end);
+
+    return end != s && *end == '\0';
+}
+
+/* folds emitted rows, the group columns followed by the aggregate arguments, into their groups */
+static void aggregate(QUERY *q, BUFFER *b)
+{
+    char *line, *next, *s, **values;
+    uint32_t keyLength = 0;
+    long g;
+    int i, v;
+    double x;
+    AGGREGATE *a;
+
+    FRALLOC(values, q->emitNo + 1, char *);
+    for (line=b->data; line<b->data + b->size; line=next+1)
+    {
+        next = memchr(line, '\n', b->data + b->size - line);
+        *next = '\0';
+
+        /* the group key is the \0 separated prefix of the group columns */
+        for (s=line, i=0; i<q->emitNo; i++)
+        {
+            values[i] = s;
+            s += strlen(s) + 1;
+            if (i == q->groupNo - 1)
+            {
+                keyLength = s - 1 - line;
+            }
+        }
+
+        if ((g = keytablefind(&q->groupKeys, line, keyLength, hashbytes(line, keyLength))) == -1)
+        {
+            g = keytableadd(&q->groupKeys, line, keyLength, hashbytes(line, keyLength));
+            q->aggregates = (AGGREGATE *) xrealloc(q->aggregates, q->groupKeys.cap*q->selectNo*sizeof(AGGREGATE));
+            memset(&q->aggregates[g*q->selectNo], 0, q->selectNo*sizeof(AGGREGATE));
+        }
+
+        for (i=0; i<q->selectNo; i++)
+        {
+            a = &q->aggregates[g*q->selectNo + i];
+            v = q->selects[i].arg;
+            if (q->selects[i].function == NONE)
+            {
+                continue;
+            }
+            else if (q->selects[i].function == COUNT)
+            {
+                a->count += v == -1 || strcmp(values[v], "n/a") != 0;
+            }
+            else if (isnumber(values[v], &x))
+            {
+                a->value = a->count == 0 ? x :
+                           q->selects[i].function == MIN ? MIN(a->value, x) :
+                           q->selects[i].function == MAX ? MAX(a->value, x) : a->value + x;
+                ++a->count;
+            }
+        }
+    }
+
+    free(values);
+    b->size = 0;
+}
+
+static void flush(QUERY *q, BUFFER *b)
+{
+    if (q->aggregating)
+    {
+        aggregate(q, b);
+        return;
+    }
+
+    fwrite(b->data, 1, b->size, stdout);
+    b->size = 0;
+}
+
+static void runworkers(WORKER *workers, int threadNo)
+{
+    pthread_t *threads;
+    int t;
+
+    if (threadNo == 1)
+    {
+        probeworker(&workers[0]);
+        return;
+    }
+
+    FRALLOC(threads, threadNo, pthread_t);
+    for (t=0; t<threadNo; t++)
+    {
+        if (pthread_create(&threads[t], NULL, probeworker, &workers[t]))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (t=0; t<threadNo; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+    free(threads);
+}
+
+/* streams the probe file in blocks of whole lines, each split among the workers */
+static void probe(QUERY *q, int threadNo)
+{
+    TABLE *t = &q->tables[q->probe];
+    WORKER *workers;
+    BUFFER block = {NULL, 0, 0};
+    char *end, *s;
+    size_t n, used;
+    int i, eof = 0;
+
+    FRALLOC(workers, threadNo, WORKER);
+    for (i=0; i<threadNo; i++)
+    {
+        workers[i].q = q;
+        FRALLOC(workers[i].fields, t->maxCol + 1, char *);
+        FRALLOC(workers[i].lengths, t->maxCol + 1, int);
+    }
+
+    while (!eof)
+    {
+        if (block.cap - block.size < BLOCK_SIZE/2)
+        {
+            block.cap = block.size + BLOCK_SIZE;
+            block.data = (char *) xrealloc(block.data, block.cap);
+        }
+
+        n = fread(block.data + block.size, 1, block.cap - block.size - 1, t->fp);
+        eof = n < block.cap - block.size - 1;
+        block.size += n;
+        if (eof && block.size && block.data[block.size-1] != '\n')
+        {
+            block.data[block.size++] = '\n';
+        }
+
+        /* a line longer than the block is read on */
+        for (end=block.data + block.size; end>block.data && end[-1]!='\n'; --end);
+        if (end == block.data)
+        {
+            continue;
+        }
+        used = end - block.data;
+
+        for (i=0, s=block.data; i<threadNo; i++)
+        {
+            workers[i].start = s;
+            if (i == threadNo - 1)
+            {
+                s = end;
+            }
+            else
+            {
+                s = MAX(s, block.data + used/threadNo*(i+1));
+                while (s < end && s[-1] != '\n')
+                {
+                    ++s;
+                }
+            }
+            workers[i].end = s;
+        }
+
+        runworkers(workers, threadNo);
+        for (i=0; i<threadNo; i++)
+        {
+            flush(q, &workers[i].out);
+        }
+
+        memmove(block.data, end, block.size - used);
+        block.size -= used;
+    }
+
+    for (i=0; i<threadNo; i++)
+    {
+        free(workers[i].out.data);
+        free(workers[i].key.data);
+        free(workers[i].fields);
+        free(workers[i].lengths);
+    }
+    free(workers);
+    free(block.data);
+}
+
+/* reads the hash table file, keeping only its projected columns */
+static void build(QUERY *q)
+{
+    TABLE *t = &q->tables[q->build];
+    BUFFER key = {NULL, 0, 0};
+    char *line = NULL, **fields;
+    int *lengths, *slotCols, i;
+    uint32_t keyCap = 0;
+    long length, k;
+    size_t cap = 0;
+
+    FRALLOC(fields, t->maxCol + 1, char *);
+    FRALLOC(lengths, t->maxCol + 1, int);
+    FRALLOC(slotCols, t->slotNo + 1, int);
+    for (i=0; i<t->colNo; i++)
+    {
+        if (t->slotOf[i] != -1)
+        {
+            slotCols[t->slotOf[i]] = i;
+        }
+    }
+
+    while ((length = readline(t->fp, &line, &cap)) != -1)
+    {
+        if (length == 0)
+        {
+            continue;
+        }
+
+        if (tokenize(t, line, line + length, q->delim, fields, lengths) <= t->maxCol)
+        {
+            fatal("%s: fewer than %d columns in %s\n", t->file, t->maxCol + 1, line);
+        }
+
+        if (!passesfilters(t, fields, lengths))
+        {
+            continue;
+        }
+
+        makekey(t, q->keyNo, fields, lengths, &key);
+        if ((k = keytablefind(&q->keys, key.data, key.size, hashbytes(key.data, key.size))) == -1)
+        {
+            k = keytableadd(&q->keys, key.data, key.size, hashbytes(key.data, key.size));
+            if (k == keyCap)
+            {
+                keyCap = keyCap ? 2*keyCap : 65536;
+                q->firstRows = (uint32_t *) xrealloc(q->firstRows, keyCap*sizeof(uint32_t));
+                q->lastRows = (uint32_t *) xrealloc(q->lastRows, keyCap*sizeof(uint32_t));
+            }
+            q->firstRows[k] = NO_ROW;
+        }
+
+        if (q->rowNo == q->rowCap)
+        {
+            q->rowCap = q->rowCap ? 2*q->rowCap : 65536;
+            q->rowValues = (size_t *) xrealloc(q->rowValues, q->rowCap*sizeof(size_t));
+            q->rowNext = (uint32_t *) xrealloc(q->rowNext, q->rowCap*sizeof(uint32_t));
+        }
+
+        /* rows of a key are chained in file order */
+        if (q->firstRows[k] == NO_ROW)
+        {
+            q->firstRows[k] = q->rowNo;
+        }
+        else
+        {
+            q->rowNext[q->lastRows[k]] = q->rowNo;
+        }
+        q->lastRows[k] = q->rowNo;
+        q->rowNext[q->rowNo] = NO_ROW;
+
+        q->rowValues[q->rowNo] = q->rows.size;
+        for (i=0; i<t->slotNo; i++)
+        {
+            bufferappend(&q->rows, fields[slotCols[i]], lengths[slotCols[i]]);
+            bufferappendchar(&q->rows, '\0');
+        }
+
+        if (++q->rowNo == NO_ROW)
+        {
+            fatal("%s: too many rows\n", t->file);
+        }
+    }
+
+    FRALLOC(q->matched, MAX(q->keys.n, 1), unsigned char);
+
+    free(key.data);
+    free(fields);
+    free(lengths);
+    free(slotCols);
+    free(line);
+}
+
+/* rows of the hash table file without a match, for left and outer joins */
+static void emitunmatched(QUERY *q)
+{
+    BUFFER out = {NULL, 0, 0};
+    uint32_t k, row;
+
+    for (k=0; k<q->keys.n; k++)
+    {
+        if (q->matched[k])
+        {
+            continue;
+        }
+
+        for (row=q->firstRows[k]; row!=NO_ROW; row=q->rowNext[row])
+        {
+            emitrow(q, &out, NULL, NULL, row);
+            if (out.size > BLOCK_SIZE)
+            {
+                flush(q, &out);
+            }
+        }
+    }
+
+    flush(q, &out);
+    free(out.data);
+}
+
+static void printaggregates(QUERY *q)
+{
+    AGGREGATE *a;
+    TABLE *t;
+    KEY_ENTRY *e;
+    BUFFER key = {NULL, 0, 0};
+    char **values;
+    uint32_t g;
+    int i, j;
+
+    for (i=0; i<q->selectNo; i++)
+    {
+        t = &q->tables[q->selects[i].column.table];
+        if (q->selects[i].function == NONE)
+        {
+            printf("%s%s", i ? "\t" : "", t->labels[q->selects[i].column.col]);
+        }
+        else if (q->selects[i].column.col == -1)
+        {
+            printf("%s%s", i ? "\t" : "", functions[q->selects[i].function]);
+        }
+        else
+        {
+            printf("%s%s-%s", i ? "\t" : "", functions[q->selects[i].function], t->labels[q->selects[i].column.col]);
+        }
+    }
+    printf("\n");
+
+    /* without groups there is always the one group of all rows */
+    if (q->groupNo == 0 && q->groupKeys.n == 0)
+    {
+        keytableadd(&q->groupKeys, "", 0, hashbytes("", 0));
+        FRALLOC(q->aggregates, q->selectNo, AGGREGATE);
+    }
+
+    FRALLOC(values, q->groupNo + 1, char *);
+    for (g=0; g<q->groupKeys.n; g++)
+    {
+        /* the group columns are the \0 separated parts of the key */
+        e = &q->groupKeys.entries[g];
+        key.size = 0;
+        bufferappend(&key, q->groupKeys.keys.data + e->key, e->keyLength);
+        bufferappendchar(&key, '\0');
+        values[0] = key.data;
+        for (j=1; j<q->groupNo; j++)
+        {
+            values[j] = values[j-1] + strlen(values[j-1]) + 1;
+        }
+
+        for (i=0; i<q->selectNo; i++)
+        {
+            a = &q->aggregates[g*q->selectNo + i];
+            if (i)
+            {
+                printf("\t");
+            }
+
+            if (q->selects[i].function == NONE)
+            {
+                printf("%s", values[q->selects[i].arg]);
+            }
+            else if (q->selects[i].function == COUNT)
+            {
+                printf("%ld", a->count);
+            }
+            else if (a->count == 0)
+            {
+                printf("n/a");
+            }
+            else
+            {
+                printf("%.15g", a->value);
+            }
+        }
+        printf("\n");
+    }
+
+    free(values);
+    free(key.data);
+}
+
+static void opentable(TABLE *t, char *file, char delim)
+{
+    size_t cap = 0;
+    int i, j;
+
+    t->file = file;
+    t->fp = zopen(file);
+    if (readline(t->fp, &t->header, &cap) == -1)
+    {
+        fatal("%s is empty\n", file);
+    }
+
+    t->colNo = countfields(t->header, delim);
+    FRALLOC(t->labels, t->colNo, char *);
+    splitline(t->header, t->labels, t->colNo, delim);
+    for (i=0; i<t->colNo; i++)
+    {
+        for (j=0; j<i; j++)
+        {
+            if (strcmp(t->labels[i], t->labels[j]) == 0)
+            {
+                fatal("'%s' field not unique in %s\n", t->labels[i], file);
+            }
+        }
+    }
+
+    FRALLOC(t->slotOf, MAX(t->colNo, 1), int);
+    for (i=0; i<t->colNo; i++)
+    {
+        t->slotOf[i] = -1;
+    }
+    t->maxCol = 0;
+}
+
+/* a.label or b.label */
+static COLUMN parsecolumn(QUERY *q, char *s)
+{
+    COLUMN c;
+
+    if ((s[0] != 'a' && s[0] != 'b') || s[1] != '.' || s[0] - 'a' >= q->tableNo)
+    {
+        fatal("Column of file a or b expected: %s\n", s);
+    }
+
+    c.table = s[0] - 'a';
+    c.col = getlabel(q->tables[c.table].labels, q->tables[c.table].colNo, s + 2, q->tables[c.table].file);
+
+    return c;
+}
+
+static void usecolumn(QUERY *q, COLUMN c, int projected)
+{
+    TABLE *t = &q->tables[c.table];
+
+    t->maxCol = MAX(t->maxCol, c.col);
+    if (projected && t->slotOf[c.col] == -1)
+    {
+        t->slotOf[c.col] = t->slotNo++;
+    }
+}
+
+static void addemit(QUERY *q, COLUMN c)
+{
+    q->emits = (COLUMN *) xrealloc(q->emits, (q->emitNo + 1)*sizeof(COLUMN));
+    q->emits[q->emitNo++] = c;
+    usecolumn(q, c, 1);
+}
+
+static void parseselects(QUERY *q, char *list)
+{
+    char *item, *save = NULL;
+    int f, t, col;
+    SELECTED *sel;
+
+    for (item=strtok_r(list, ",", &save); item!=NULL; item=strtok_r(NULL, ",", &save))
+    {
+        /* room for the columns of a.+ */
+        q->selects = (SELECTED *) xrealloc(q->selects, (q->selectNo + q->tables[0].colNo + q->tables[1].colNo + 1)*sizeof(SELECTED));
+        sel = &q->selects[q->selectNo];
+        sel->function = NONE;
+        sel->arg = -1;
+        sel->column.col = -1;
+
+        for (f=COUNT; f<=SUM; f++)
+        {
+            if (strncmp(item, functions[f], strlen(functions[f])) == 0 && item[strlen(functions[f])] == '(' &&
+                item[strlen(item) - 1] == ')')
+            {
+                sel->function = f;
+                item += strlen(functions[f]) + 1;
+                item[strlen(item) - 1] = '\0';
+                q->aggregating = 1;
+                break;
+            }
+        }
+
+        if (sel->function == COUNT && strcmp(item, "*") == 0)
+        {
+            sel->column.table = 0;
+            ++q->selectNo;
+        }
+        else if (strlen(item) == 3 && item[1] == '.' && item[2] == '+' && sel->function == NONE)
+        {
+            /* a.+ selects every column of the file */
+            t = item[0] - 'a';
+            if (t < 0 || t >= q->tableNo)
+            {
+                fatal("Column of file a or b expected: %s\n", item);
+            }
+            for (col=0; col<q->tables[t].colNo; col++)
+            {
+                q->selects[q->selectNo].function = NONE;
+                q->selects[q->selectNo].arg = -1;
+                q->selects[q->selectNo].column.table = t;
+                q->selects[q->selectNo++].column.col = col;
+            }
+        }
+        else
+        {
+            sel->column = parsecolumn(q, item);
+            ++q->selectNo;
+        }
+    }
+
+    if (q->selectNo == 0)
+    {
+        fatal("No selected fields\n");
+    }
+}
+
+static void parseconditions(QUERY *q, char **conditions, int conditionNo)
+{
+    char *s, *value;
+    COLUMN l, r;
+    TABLE *t;
+    int i;
+
+    for (i=0; i<conditionNo; i++)
+    {
+        if ((s = strchr(conditions[i], '=')) == NULL)
+        {
+            fatal("Condition x.column=y.column or x.column='value' expected: %s\n", conditions[i]);
+        }
+        *s++ = '\0';
+        l = parsecolumn(q, conditions[i]);
+        usecolumn(q, l, 0);
+
+        if (s[0] == '\'' && strlen(s) > 1 && s[strlen(s) - 1] == '\'')
+        {
+            /* a constant filters the rows of its file */
+            value = strdup(s + 1);
+            value[strlen(value) - 1] = '\0';
+            t = &q->tables[l.table];
+            t->filterCols[t->filterNo] = l.col;
+            t->filterValues[t->filterNo++] = value;
+        }
+        else
+        {
+            r = parsecolumn(q, s);
+            if (r.table == l.table)
+            {
+                fatal("Condition between columns of the same file: %s=%s\n", conditions[i], s);
+            }
+            usecolumn(q, r, q->joinType == OUTER_JOIN && r.table == 1);
+            usecolumn(q, l, q->joinType == OUTER_JOIN && l.table == 1);
+            q->tables[l.table].keyCols[q->keyNo] = l.col;
+            q->tables[r.table].keyCols[q->keyNo++] = r.col;
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    QUERY query, *q = &query;
+    char *SELECTS = NULL, *GROUPS = NULL, *DELIM = "tab", *JOIN = "inner", *conditions[MAX_CONDITIONS];
+    char *item, *save = NULL;
+    int i, j, conditionNo = 0, threadNo = 0;
+
+    if(argc==1)
+    {
+        printf("usage: fquery [options] -s <columns> <file-a> [file-b]\n");
+        printf("\n");
+        printf("       -s       selected columns, comma separated: a.column, b.column,\n");
+        printf("                a.+ for all columns of a file, count(*), count(a.column),\n");
+        printf("                min(a.column), max(a.column) and sum(a.column)\n");
+        printf("       -c       condition a.column=b.column joining the 2 files or\n");
+        printf("                a.column='value' filtering a file, may be repeated\n");
+        printf("       -g       group by columns, comma separated\n");
+        printf("       -j       join type (inner|left|outer), inner default\n");
+        printf("       -d       delimiter (tab|comma|space), tab default\n");
+        printf("       -t       number of threads (default: number of processors)\n");
+        printf("       file-a   annotation file with a header, .gz files are read through gunzip\n");
+        printf("       file-b   annotation file with a header\n");
+        printf("\n");
+        printf("       example: fquery -s a.snp-id,b.ethnicity -c a.snp-id=b.snp-id -j left pscalare.mk paltum.mk\n");
+        printf("                fquery -s a.chromosome,count(*) -g a.chromosome -c a.class='single' pscalare.mk\n");
+        printf("\n");
+        printf("       The query engine of fselect.  File b of a join is read into a hash\n");
+        printf("       table on its joining columns, keeping only the columns selected from\n");
+        printf("       it; file a is streamed in blocks probed by all threads.  Rows come in\n");
+        printf("       the order of file a, unmatched rows included for left and outer joins,\n");
+        printf("       then the unmatched rows of file b for outer joins, as fselect writes\n");
+        printf("       them.  Aggregates skip n/a and, for min, max and sum, non numeric\n");
+        printf("       values; selected columns are a columns followed by b columns, or in\n");
+        printf("       select order with aggregates.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"s:c:g:j:d:t:")) != -1)
+    {
+        switch(i)
+        {
+            case 's':
+                SELECTS = optarg;
+                break;
+            case 'c':
+                if (conditionNo == MAX_CONDITIONS)
+                {
+                    fatal("At most %d conditions\n", MAX_CONDITIONS);
+                }
+                conditions[conditionNo++] = optarg;
+                break;
+            case 'g':
+                GROUPS = optarg;
+                break;
+            case 'j':
+                JOIN = optarg;
+                break;
+            case 'd':
+                DELIM = optarg;
+                break;
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (SELECTS == NULL || optind == argc || optind < argc-2)
+    {
+        fprintf(stderr, "selected columns and 1 or 2 files expected\n");
+        exit(1);
+    }
+
+    memset(q, 0, sizeof(QUERY));
+    q->build = -1;
+    q->probe = 0;
+    q->separator = '\t';
+
+    q->delim = strcmp(DELIM, "tab") == 0 ? '\t' : strcmp(DELIM, "comma") == 0 ? ',' : strcmp(DELIM, "space") == 0 ? ' ' : 0;
+    if (q->delim == 0)
+    {
+        fatal("%s not recognized\n", DELIM);
+    }
+
+    q->joinType = strcmp(JOIN, "inner") == 0 ? INNER_JOIN : strcmp(JOIN, "left") == 0 ? LEFT_JOIN :
+                  strcmp(JOIN, "outer") == 0 ? OUTER_JOIN : -1;
+    if (q->joinType == -1)
+    {
+        fatal("Join type %s not recognized\n", JOIN);
+    }
+
+    q->tableNo = argc - optind;
+    for (i=0; i<q->tableNo; i++)
+    {
+        opentable(&q->tables[i], argv[optind+i], q->delim);
+    }
+
+    parseconditions(q, conditions, conditionNo);
+    if (q->tableNo == 2 && q->keyNo == 0)
+    {
+        fatal("A join needs a condition a.column=b.column\n");
+    }
+
+    parseselects(q, SELECTS);
+    for (save=NULL, item=GROUPS ? strtok_r(GROUPS, ",", &save) : NULL; item!=NULL; item=strtok_r(NULL, ",", &save))
+    {
+        if (q->groupNo == MAX_CONDITIONS)
+        {
+            fatal("At most %d group by columns\n", MAX_CONDITIONS);
+        }
+        q->groups = (COLUMN *) xrealloc(q->groups, (q->groupNo + 1)*sizeof(COLUMN));
+        q->groups[q->groupNo++] = parsecolumn(q, item);
+    }
+    if (q->groupNo && !q->aggregating)
+    {
+        fatal("group by without an aggregate\n");
+    }
+
+    if (q->aggregating)
+    {
+        /* rows are emitted as the group columns and aggregate arguments, \0 separated */
+        q->separator = '\0';
+        for (j=0; j<q->groupNo; j++)
+        {
+            addemit(q, q->groups[j]);
+        }
+
+        for (i=0; i<q->selectNo; i++)
+        {
+            if (q->selects[i].function == NONE)
+            {
+                for (j=0; j<q->groupNo && (q->groups[j].table != q->selects[i].column.table ||
+                                          q->groups[j].col != q->selects[i].column.col); j++);
+                if (j == q->groupNo)
+                {
+                    fatal("%c.%s is selected but not grouped by\n", 'a' + q->selects[i].column.table,
+                          q->tables[q->selects[i].column.table].labels[q->selects[i].column.col]);
+                }
+                q->selects[i].arg = j;
+            }
+            else if (q->selects[i].column.col != -1)
+            {
+                q->selects[i].arg = q->emitNo;
+                addemit(q, q->selects[i].column);
+            }
+        }
+    }
+    else
+    {
+        /* columns of file a come before those of file b */
+        for (j=0; j<q->tableNo; j++)
+        {
+            for (i=0; i<q->selectNo; i++)
+            {
+                if (q->selects[i].column.table == j)
+                {
+                    addemit(q, q->selects[i].column);
+                }
+            }
+        }
+
+        for (i=0; i<q->emitNo; i++)
+        {
+            printf("%s%s", i ? "\t" : "", q->tables[q->emits[i].table].labels[q->emits[i].col]);
+        }
+        printf("\n");
+    }
+
+    /* the hash table is built on file b so that rows come in the order of file a */
+    if (q->tableNo == 2)
+    {
+        q->build = 1;
+        q->probe = 0;
+
+        build(q);
+        fprintf(stderr, "Hash table on %s: %u rows, %u keys\n", q->tables[q->build].file, q->rowNo, q->keys.n);
+    }
+
+    threadNo = threadNo > 0 ? threadNo : getcpuno();
+    probe(q, threadNo);
+
+    if (q->joinType == OUTER_JOIN)
+    {
+        emitunmatched(q);
+    }
+
+    if (q->aggregating)
+    {
+        printaggregates(q);
+    }
+
+    for (i=0; i<q->tableNo; i++)
+    {
+        zclose(q->tables[i].fp, q->tables[i].file);
+    }
+
+    return 0;
+}
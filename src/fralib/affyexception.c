@@ -0,0 +1,14794 @@
+/* generated by affyexception.pl from the list at the end of fralib.pm, do not edit */
+#include <stdint.h>
+#include <stddef.h>
+
+const uint32_t affyExceptionBucketNo = 2908;
+const uint32_t affyExceptionSlotNo = 14537;
+
+const uint16_t affyExceptionDisplacements[] =
+{
+    19, 1, 4, 37, 8, 5, 7, 5, 7, 7, 10, 7,
+    1, 25, 3, 15, 13, 24, 4, 1, 2, 19, 3, 33,
+    2, 1, 16, 12, 0, 8, 7, 1, 1, 7, 12, 8,
+    82, 16, 3, 1, 6, 6, 1, 11, 5, 1, 4, 1,
+    1, 1, 6, 1, 3, 7, 4, 2, 11, 2, 29, 12,
+    4, 1, 2, 2, 5, 8, 4, 19, 18, 1, 6, 1,
+    3, 6, 1, 1, 1, 1, 2, 11, 3, 4, 1, 2,
+    14, 2, 1, 4, 7, 1, 1, 19, 22, 8, 2, 1,
+    3, 2, 11, 2, 1, 9, 6, 5, 3, 62, 8, 1,
+    4, 2, 20, 7, 13, 8, 7, 10, 6, 6, 19, 2,
+    2, 17, 9, 40, 2, 17, 2, 13, 4, 2, 2, 29,
+    6, 4, 5, 2, 6, 10, 1, 3, 7, 1, 1, 3,
+    4, 2, 1, 1, 20, 11, 1, 1, 15, 7, 3, 6,
+    3, 1, 2, 0, 1, 17, 44, 13, 2, 7, 1, 24,
+    2, 2, 1, 28, 4, 9, 3, 5, 1, 8, 8, 3,
+    3, 2, 2, 6, 4, 2, 8, 28, 1, 30, 32, 7,
+    5, 4, 3, 11, 13, 0, 1, 36, 1, 4, 1, 1,
+    4, 60, 10, 50, 3, 25, 29, 10, 14, 0, 12, 4,
+    1, 4, 16, 1, 8, 17, 11, 6, 5, 20, 10, 5,
+    2, 3, 1, 1, 6, 2, 5, 1, 5, 1, 8, 5,
+    6, 1, 3, 7, 93, 2, 3, 49, 1, 3, 23, 45,
+    2, 16, 6, 7, 2, 18, 22, 4, 4, 19, 15, 15,
+    21, 1, 3, 17, 7, 5, 17, 3, 14, 4, 0, 12,
+    3, 3, 7, 4, 2, 20, 19, 3, 4, 6, 6, 13,
+    1, 10, 21, 2, 2, 3, 23, 38, 5, 11, 11, 10,
+    3, 24, 9, 8, 2, 1, 3, 4, 1, 1, 3, 5,
+    4, 14, 20, 6, 10, 7, 19, 11, 1, 15, 37, 42,
+    1, 12, 9, 4, 6, 3, 25, 1, 1, 9, 5, 40,
+    15, 2, 7, 2, 10, 52, 2, 34, 7, 23, 4, 1,
+    1, 9, 12, 1, 8, 17, 12, 6, 12, 2, 2, 3,
+    10, 7, 10, 20, 2, 9, 9, 1, 2, 2, 5, 6,
+    6, 6, 1, 3, 14, 4, 11, 5, 7, 0, 1, 11,
+    16, 1, 4, 3, 3, 6, 19, 4, 5, 1, 18, 1,
+    16, 111, 1, 2, 1, 1, 2, 7, 19, 1, 51, 5,
+    1, 4, 3, 5, 1, 3, 2, 8, 17, 35, 5, 5,
+    26, 3, 1, 15, 2, 16, 8, 9, 16, 1, 2, 5,
+    2, 13, 1, 7, 22, 8, 26, 6, 4, 3, 2, 4,
+    2, 16, 4, 37, 0, 3, 16, 4, 35, 2, 13, 4,
+    18, 19, 10, 6, 3, 22, 23, 9, 7, 8, 20, 11,
+    1, 1, 1, 1, 2, 31, 1, 58, 40, 2, 4, 5,
+    20, 1, 36, 11, 4, 40, 1, 47, 1, 8, 13, 2,
+    23, 9, 17, 16, 24, 2, 10, 6, 0, 16, 1, 2,
+    8, 15, 3, 1, 17, 4, 9, 9, 3, 4, 2, 33,
+    20, 13, 11, 11, 10, 6, 15, 10, 2, 5, 10, 1,
+    44, 5, 4, 35, 6, 8, 35, 1, 3, 15, 1, 17,
+    4, 6, 1, 23, 2, 5, 6, 2, 23, 5, 13, 4,
+    7, 17, 7, 4, 71, 3, 5, 4, 6, 30, 7, 2,
+    8, 6, 4, 2, 128, 28, 21, 4, 15, 1, 2, 9,
+    2, 1, 1, 20, 22, 2, 24, 5, 1, 39, 6, 18,
+    5, 8, 0, 41, 10, 25, 7, 3, 2, 2, 32, 2,
+    1, 10, 18, 1, 32, 24, 11, 1, 1, 1, 2, 4,
+    12, 7, 1, 4, 19, 5, 32, 2, 10, 5, 12, 20,
+    13, 5, 1, 6, 12, 3, 1, 7, 3, 6, 25, 9,
+    3, 21, 35, 1, 1, 5, 2, 23, 1, 1, 31, 0,
+    2, 6, 14, 14, 2, 3, 23, 3, 7, 1, 6, 9,
+    3, 1, 11, 7, 3, 1, 3, 4, 23, 14, 2, 6,
+    1, 15, 1, 10, 4, 13, 4, 13, 34, 1, 1, 2,
+    8, 2, 3, 5, 4, 4, 45, 0, 1, 27, 3, 12,
+    5, 2, 9, 3, 64, 21, 2, 23, 1, 1, 7, 14,
+    21, 1, 3, 63, 2, 1, 12, 30, 1, 9, 2, 1,
+    2, 3, 9, 34, 22, 2, 5, 1, 9, 16, 1, 5,
+    8, 22, 2, 14, 7, 10, 42, 2, 6, 1, 0, 11,
+    14, 4, 28, 5, 21, 10, 5, 5, 1, 13, 13, 22,
+    12, 5, 1, 17, 3, 4, 19, 20, 3, 9, 9, 2,
+    33, 3, 6, 1, 13, 9, 15, 1, 6, 4, 4, 6,
+    1, 1, 3, 1, 3, 29, 10, 1, 11, 8, 8, 4,
+    12, 5, 3, 8, 16, 27, 2, 3, 1, 13, 8, 3,
+    25, 6, 29, 1, 2, 6, 3, 4, 6, 5, 11, 6,
+    3, 9, 1, 4, 25, 2, 1, 11, 12, 23, 59, 1,
+    8, 6, 22, 1, 6, 1, 20, 1, 5, 14, 1, 58,
+    59, 2, 12, 0, 3, 7, 3, 21, 1, 5, 36, 2,
+    2, 31, 1, 5, 9, 20, 3, 1, 7, 1, 1, 4,
+    1, 47, 65, 118, 3, 16, 3, 3, 2, 14, 1, 4,
+    4, 4, 9, 2, 1, 1, 4, 5, 2, 13, 3, 1,
+    8, 10, 1, 25, 24, 35, 26, 3, 2, 2, 3, 32,
+    13, 10, 15, 1, 1, 7, 5, 1, 5, 5, 1, 1,
+    7, 9, 2, 1, 16, 7, 8, 13, 1, 31, 11, 2,
+    5, 7, 1, 5, 21, 16, 23, 29, 6, 10, 12, 22,
+    29, 39, 16, 3, 11, 3, 8, 8, 2, 1, 12, 0,
+    18, 41, 48, 4, 73, 21, 19, 8, 15, 1, 2, 1,
+    14, 9, 1, 3, 20, 2, 2, 1, 1, 3, 28, 18,
+    2, 5, 8, 5, 2, 1, 1, 17, 8, 6, 1, 1,
+    9, 4, 9, 2, 12, 10, 4, 1, 61, 2, 5, 12,
+    1, 3, 21, 7, 2, 23, 31, 50, 15, 5, 17, 10,
+    43, 2, 7, 10, 3, 6, 9, 5, 1, 3, 0, 3,
+    5, 65, 5, 6, 3, 2, 37, 66, 11, 5, 3, 2,
+    36, 3, 14, 6, 16, 2, 17, 30, 4, 6, 4, 5,
+    2, 1, 25, 7, 2, 9, 4, 3, 1, 2, 1, 8,
+    17, 12, 13, 31, 2, 12, 19, 6, 1, 24, 6, 29,
+    34, 13, 10, 1, 8, 15, 39, 13, 30, 3, 9, 3,
+    1, 6, 9, 1, 2, 6, 12, 3, 4, 3, 5, 2,
+    2, 61, 2, 2, 5, 9, 1, 1, 1, 15, 21, 1,
+    16, 4, 1, 7, 4, 5, 12, 21, 2, 8, 1, 6,
+    8, 4, 40, 3, 1, 18, 1, 4, 5, 20, 6, 1,
+    9, 1, 6, 14, 4, 8, 14, 2, 13, 8, 9, 53,
+    0, 5, 0, 1, 3, 12, 0, 3, 11, 14, 4, 61,
+    8, 2, 6, 8, 79, 16, 2, 3, 35, 2, 37, 4,
+    2, 4, 12, 2, 13, 17, 3, 30, 13, 1, 7, 26,
+    4, 16, 4, 8, 68, 31, 7, 14, 5, 1, 3, 5,
+    4, 11, 17, 9, 2, 3, 7, 16, 2, 10, 1, 8,
+    3, 103, 1, 6, 1, 2, 12, 1, 29, 5, 5, 1,
+    2, 27, 1, 13, 13, 2, 1, 1, 4, 101, 4, 2,
+    9, 5, 65, 4, 18, 6, 16, 13, 12, 0, 13, 12,
+    23, 5, 27, 3, 4, 10, 2, 4, 5, 1, 2, 13,
+    3, 21, 20, 14, 15, 59, 5, 5, 5, 5, 5, 16,
+    32, 49, 5, 17, 48, 35, 15, 3, 2, 1, 58, 3,
+    1, 1, 17, 65, 3, 5, 1, 2, 25, 10, 12, 20,
+    20, 1, 7, 31, 21, 7, 6, 5, 7, 6, 37, 1,
+    2, 4, 2, 1, 42, 18, 6, 15, 3, 4, 2, 11,
+    3, 30, 29, 4, 5, 59, 3, 1, 2, 67, 5, 12,
+    4, 6, 5, 1, 17, 3, 5, 1, 1, 2, 13, 1,
+    43, 8, 1, 8, 17, 9, 11, 2, 16, 28, 6, 54,
+    29, 28, 45, 17, 3, 4, 26, 2, 11, 8, 15, 2,
+    9, 18, 13, 3, 13, 7, 14, 2, 3, 4, 3, 1,
+    42, 41, 1, 5, 6, 4, 2, 12, 3, 14, 4, 3,
+    13, 13, 21, 12, 33, 2, 1, 2, 3, 4, 8, 7,
+    35, 0, 11, 22, 30, 4, 16, 3, 8, 16, 26, 58,
+    4, 20, 44, 19, 7, 11, 3, 8, 22, 8, 11, 20,
+    11, 1, 61, 5, 2, 4, 11, 4, 1, 54, 42, 36,
+    5, 34, 1, 84, 7, 28, 8, 21, 48, 6, 2, 6,
+    9, 22, 5, 5, 3, 12, 12, 11, 1, 4, 1, 5,
+    4, 5, 1, 13, 50, 2, 5, 23, 25, 2, 1, 3,
+    4, 28, 8, 9, 1, 7, 1, 10, 8, 12, 15, 2,
+    2, 24, 38, 1, 1, 2, 8, 1, 2, 3, 4, 10,
+    8, 5, 21, 5, 3, 11, 14, 1, 3, 34, 11, 27,
+    32, 7, 19, 104, 79, 7, 8, 2, 1, 1, 5, 25,
+    76, 1, 22, 1, 21, 13, 7, 85, 9, 10, 4, 15,
+    18, 3, 2, 2, 4, 52, 51, 1, 18, 22, 5, 38,
+    25, 31, 7, 3, 30, 5, 20, 2, 1, 15, 45, 24,
+    2, 7, 5, 16, 15, 28, 11, 12, 27, 28, 21, 9,
+    1, 30, 24, 2, 2, 19, 33, 1, 8, 6, 6, 11,
+    6, 14, 6, 65, 10, 29, 1, 17, 10, 5, 6, 1,
+    4, 10, 1, 16, 18, 37, 2, 23, 1, 2, 8, 2,
+    75, 31, 1, 9, 1, 42, 3, 3, 5, 6, 9, 15,
+    36, 14, 1, 0, 2, 4, 5, 1, 3, 2, 10, 37,
+    2, 1, 3, 10, 4, 4, 4, 54, 14, 45, 1, 15,
+    8, 13, 6, 44, 17, 7, 1, 3, 30, 1, 11, 10,
+    4, 32, 78, 10, 47, 6, 19, 3, 1, 3, 28, 56,
+    5, 1, 22, 37, 3, 9, 1, 70, 5, 8, 10, 3,
+    37, 3, 2, 4, 82, 7, 21, 1, 32, 17, 7, 10,
+    7, 9, 41, 2, 6, 7, 42, 7, 7, 5, 70, 4,
+    3, 0, 9, 17, 5, 64, 15, 10, 4, 7, 7, 3,
+    19, 4, 30, 51, 2, 1, 25, 1, 75, 50, 4, 2,
+    5, 4, 55, 41, 29, 22, 42, 6, 12, 13, 1, 3,
+    7, 2, 7, 10, 29, 26, 30, 25, 2, 2, 12, 7,
+    0, 18, 2, 11, 8, 16, 2, 26, 30, 13, 2, 7,
+    18, 16, 5, 9, 8, 7, 9, 40, 2, 22, 1, 14,
+    11, 8, 59, 7, 16, 7, 2, 5, 1, 25, 40, 62,
+    2, 23, 6, 9, 65, 1, 70, 17, 28, 9, 5, 1,
+    11, 46, 23, 3, 18, 26, 15, 12, 3, 4, 8, 3,
+    28, 5, 9, 47, 3, 10, 1, 15, 1, 3, 20, 47,
+    26, 12, 1, 7, 91, 1, 7, 42, 56, 53, 34, 25,
+    2, 4, 1, 3, 11, 29, 22, 7, 6, 90, 5, 20,
+    5, 17, 46, 27, 3, 34, 2, 8, 2, 1, 1, 2,
+    33, 2, 26, 2, 17, 11, 1, 12, 6, 1, 55, 1,
+    31, 1, 25, 92, 9, 2, 2, 7, 1, 20, 2, 2,
+    5, 44, 29, 2, 2, 13, 9, 2, 3, 8, 5, 41,
+    1, 41, 7, 30, 26, 19, 61, 86, 29, 13, 1, 31,
+    39, 2, 2, 7, 10, 7, 1, 13, 21, 4, 66, 12,
+    8, 1, 0, 1, 4, 12, 12, 14, 6, 4, 12, 2,
+    31, 1, 3, 3, 18, 43, 4, 2, 7, 5, 29, 1,
+    13, 2, 6, 8, 80, 15, 52, 23, 45, 10, 7, 4,
+    1, 29, 1, 39, 5, 40, 8, 62, 33, 1, 0, 21,
+    1, 26, 1, 52, 1, 62, 14, 4, 1, 22, 7, 1,
+    2, 12, 19, 0, 13, 62, 6, 7, 62, 314, 1, 3,
+    2, 1, 14, 23, 5, 27, 8, 25, 1, 25, 7, 71,
+    1, 12, 10, 5, 38, 8, 9, 8, 21, 27, 94, 10,
+    14, 20, 55, 5, 3, 9, 50, 11, 46, 5, 20, 18,
+    39, 6, 22, 3, 1, 9, 5, 25, 11, 22, 11, 3,
+    17, 4, 111, 1, 1, 40, 8, 13, 0, 2, 6, 3,
+    20, 22, 13, 1, 33, 0, 28, 12, 60, 2, 72, 16,
+    30, 3, 44, 0, 2, 0, 4, 1, 3, 16, 1, 28,
+    8, 4, 8, 33, 14, 1, 1, 28, 1, 2, 9, 2,
+    52, 31, 34, 2, 4, 71, 15, 3, 45, 5, 40, 1,
+    10, 1, 19, 43, 12, 5, 8, 27, 17, 40, 28, 3,
+    21, 4, 1, 34, 10, 13, 36, 26, 3, 1, 2, 16,
+    5, 8, 13, 3, 91, 65, 34, 12, 26, 3, 18, 57,
+    1, 102, 3, 17, 2, 68, 57, 30, 1, 3, 20, 3,
+    18, 20, 70, 32, 2, 12, 64, 3, 5, 6, 48, 44,
+    22, 18, 1, 2, 16, 20, 28, 31, 28, 24, 11, 16,
+    7, 5, 87, 13, 125, 45, 8, 4, 1, 26, 8, 43,
+    19, 65, 32, 3, 59, 10, 4, 6, 11, 7, 4, 1,
+    126, 8, 2, 128, 5, 4, 3, 3, 5, 81, 14, 0,
+    14, 23, 61, 20, 0, 23, 48, 17, 7, 3, 0, 10,
+    4, 1, 7, 0, 0, 1, 1, 8, 7, 154, 5, 20,
+    17, 1, 19, 19, 2, 18, 1, 20, 68, 65, 16, 8,
+    142, 47, 23, 1, 32, 3, 9, 55, 36, 6, 14, 6,
+    5, 7, 4, 5, 4, 48, 7, 25, 16, 82, 16, 1,
+    1, 2, 2, 21, 82, 8, 1, 16, 11, 7, 1, 10,
+    17, 51, 20, 1, 38, 26, 1, 11, 14, 4, 1, 8,
+    12, 57, 31, 21, 1, 3, 60, 5, 16, 5, 11, 14,
+    27, 1, 17, 35, 124, 41, 66, 6, 7, 6, 62, 2,
+    18, 8, 42, 86, 44, 12, 81, 10, 12, 22, 1, 2,
+    7, 16, 21, 24, 1, 3, 3, 48, 1, 0, 55, 11,
+    127, 1, 52, 6, 12, 28, 1, 1, 13, 1, 12, 31,
+    18, 6, 8, 11, 38, 5, 3, 6, 40, 42, 1, 26,
+    5, 50, 47, 8, 12, 18, 32, 22, 36, 4, 13, 2,
+    5, 16, 4, 4, 4, 4, 37, 15, 166, 125, 93, 59,
+    70, 5, 60, 0, 1, 1, 4, 50, 41, 161, 48, 13,
+    16, 4, 35, 3, 10, 134, 9, 5, 46, 11, 20, 2,
+    45, 8, 19, 11, 10, 42, 19, 6, 8, 8, 47, 1,
+    137, 35, 13, 1, 3, 1, 72, 6, 34, 43, 0, 9,
+    13, 7, 64, 32, 26, 5, 10, 1, 36, 15, 28, 2,
+    1, 9, 18, 30, 3, 28, 1, 37, 33, 67, 28, 3,
+    6, 6, 25, 10, 1, 3, 15, 71, 8, 36, 1, 3,
+    1, 19, 6, 14, 26, 3, 5, 1, 7, 78, 10, 14,
+    8, 18, 11, 0, 57, 1, 123, 65, 1, 48, 1, 31,
+    128, 77, 5, 14, 17, 12, 3, 2, 28, 8, 2, 31,
+    14, 12, 4, 10, 4, 2, 10, 5, 1, 14, 29, 1,
+    1, 9, 124, 8, 56, 4, 15, 2, 8, 4, 2, 1,
+    156, 7, 6, 4, 22, 1, 52, 21, 31, 10, 2, 4,
+    1, 18, 5, 53, 8, 13, 68, 12, 39, 4, 45, 12,
+    28, 60, 9, 103, 3, 46, 1, 6, 2, 3, 1, 7,
+    3, 17, 58, 2, 8, 2, 17, 2, 13, 11, 19, 13,
+    1, 1, 1, 1, 3, 9, 6, 4, 57, 40, 28, 12,
+    1, 14, 46, 1, 12, 21, 2, 2, 4, 47, 14, 7,
+    1, 5, 49, 26, 4, 35, 5, 1, 22, 2, 2, 1,
+    83, 2, 10, 4, 1, 8, 73, 46, 58, 24, 10, 1,
+    3, 57, 0, 55, 2, 8, 17, 7, 1, 3, 28, 106,
+    18, 1, 4, 40, 1, 48, 91, 12, 7, 111, 3, 5,
+    2, 7, 21, 53, 2, 15, 10, 2, 3, 11, 3, 21,
+    98, 6, 31, 2, 4, 2, 12, 57, 1, 28, 136, 54,
+    63, 18, 3, 100, 215, 96, 21, 0, 10, 70, 2, 1,
+    1, 13, 13, 100, 4, 5, 51, 10, 6, 6, 9, 19,
+    55, 77, 9, 29, 2, 26, 32, 3, 15, 7, 50, 23,
+    1, 36, 9, 0, 7, 5, 7, 84, 2, 1, 1, 17,
+    35, 4, 1, 11, 4, 26, 2, 11, 77, 4, 57, 3,
+    17, 136, 2, 1, 90, 19, 3, 153, 0, 11, 6, 18,
+    3, 2, 28, 1, 4, 1, 2, 18, 82, 5, 2, 13,
+    42, 1, 12, 17, 28, 86, 0, 3, 14, 10, 21, 21,
+    45, 17, 7, 48, 33, 46, 5, 9, 27, 8, 24, 6,
+    24, 39, 4, 6, 39, 76, 22, 2, 1, 1, 11, 3,
+    124, 67, 1, 32, 41, 84, 40, 17, 2, 30, 2, 76,
+    3, 49, 61, 3, 30, 3, 10, 16, 26, 36, 11, 16,
+    33, 1, 7, 2, 19, 10, 1, 1, 7, 12, 26, 2,
+    80, 43, 76, 1, 11, 93, 37, 8, 1, 22, 107, 10,
+    2, 5, 20, 34, 42, 53, 4, 7, 37, 69, 8, 39,
+    23, 5, 12, 7, 48, 9, 47, 4, 120, 50, 50, 2,
+    1, 122, 13, 5, 30, 28, 35, 5, 17, 1, 2, 21,
+    3, 10, 9, 1, 3, 30, 4, 52, 254, 2, 46, 34,
+    6, 19, 1, 41, 69, 1, 18, 22, 2, 26, 43, 26,
+    18, 57, 42, 0, 47, 6, 18, 4, 1, 30, 62, 2,
+    13, 6, 121, 55
+};
+
+const char *affyExceptionSlots[] =
+{
+    "SNP_A-1659144",
+    "SNP_A-1660801",
+    NULL,
+    "SNP_A-8285287",
+    "SNP_A-1513277",
+    "SNP_A-1738118",
+    "SNP_A-1514702",
+    "SNP_A-8581795",
+    NULL,
+    "SNP_A-8668450",
+    "SNP_A-1643842",
+    "SNP_A-1676684",
+    "SNP_A-4267363",
+    "SNP_A-1519238",
+    "SNP_A-1514002",
+    "SNP_A-8341729",
+    NULL,
+    "SNP_A-2061710",
+    "SNP_A-1518005",
+    NULL,
+    "SNP_A-1516575",
+    NULL,
+    "SNP_A-1517637",
+    "SNP_A-1514956",
+    "SNP_A-1515107",
+    "SNP_A-1973275",
+    "SNP_A-1512594",
+    NULL,
+    "SNP_A-1511814",
+    "SNP_A-1732085",
+    NULL,
+    "SNP_A-1701403",
+    "SNP_A-1646110",
+    "SNP_A-1512736",
+    "SNP_A-1739733",
+    NULL,
+    "SNP_A-1509017",
+    "SNP_A-2014865",
+    "SNP_A-1510404",
+    "SNP_A-2298778",
+    NULL,
+    "SNP_A-1704047",
+    "SNP_A-1515555",
+    "SNP_A-1647026",
+    "SNP_A-1511211",
+    "SNP_A-2249131",
+    NULL,
+    "SNP_A-1515200",
+    "SNP_A-1508254",
+    "SNP_A-1707741",
+    NULL,
+    "SNP_A-1510058",
+    NULL,
+    "SNP_A-1515505",
+    "SNP_A-1518493",
+    "SNP_A-1512297",
+    "SNP_A-1692790",
+    "SNP_A-8670290",
+    NULL,
+    "SNP_A-1509266",
+    "SNP_A-1662068",
+    "SNP_A-1748515",
+    "SNP_A-8605768",
+    "SNP_A-1679014",
+    "SNP_A-1512269",
+    "SNP_A-1714831",
+    "SNP_A-8280321",
+    "SNP_A-1990979",
+    "SNP_A-1519015",
+    "SNP_A-1511487",
+    "SNP_A-1514231",
+    "SNP_A-1746150",
+    NULL,
+    "SNP_A-1827907",
+    "SNP_A-1512504",
+    NULL,
+    "SNP_A-1509895",
+    "SNP_A-1746719",
+    "SNP_A-4296796",
+    "SNP_A-1691529",
+    "SNP_A-1659578",
+    "SNP_A-1511411",
+    NULL,
+    "SNP_A-1517746",
+    NULL,
+    "SNP_A-1513706",
+    NULL,
+    "SNP_A-1509043",
+    "SNP_A-1753803",
+    NULL,
+    "SNP_A-1746090",
+    "SNP_A-1736977",
+    "SNP_A-4265462",
+    "SNP_A-1712829",
+    "SNP_A-1730877",
+    NULL,
+    "SNP_A-1643524",
+    NULL,
+    "SNP_A-8663655",
+    "SNP_A-1736085",
+    "SNP_A-4269817",
+    "SNP_A-1510970",
+    NULL,
+    "SNP_A-1513424",
+    "SNP_A-1689006",
+    "SNP_A-1753709",
+    NULL,
+    "SNP_A-1721754",
+    NULL,
+    "SNP_A-1721349",
+    NULL,
+    "SNP_A-1730156",
+    "SNP_A-1511714",
+    "SNP_A-1515472",
+    "SNP_A-1701477",
+    "SNP_A-1994069",
+    NULL,
+    "SNP_A-1510293",
+    "SNP_A-1515840",
+    "SNP_A-1512758",
+    "SNP_A-1693180",
+    "SNP_A-1716111",
+    "SNP_A-1513839",
+    NULL,
+    NULL,
+    "SNP_A-1511083",
+    "SNP_A-1511846",
+    "SNP_A-1513311",
+    "SNP_A-8668501",
+    "SNP_A-1511785",
+    "SNP_A-1747141",
+    "SNP_A-1509473",
+    "SNP_A-1510136",
+    "SNP_A-1512470",
+    "SNP_A-1519009",
+    "SNP_A-1679078",
+    NULL,
+    "SNP_A-1703165",
+    "SNP_A-1970483",
+    NULL,
+    "SNP_A-1693084",
+    "SNP_A-4263095",
+    "SNP_A-1511810",
+    "SNP_A-1509893",
+    "SNP_A-1510711",
+    "SNP_A-1717803",
+    NULL,
+    "SNP_A-1965625",
+    "SNP_A-1869312",
+    "SNP_A-8607089",
+    "SNP_A-1650076",
+    "SNP_A-1653258",
+    "SNP_A-1512430",
+    "SNP_A-1509936",
+    "SNP_A-1517734",
+    "SNP_A-1694535",
+    "SNP_A-2007864",
+    "SNP_A-4267886",
+    NULL,
+    "SNP_A-1512656",
+    NULL,
+    NULL,
+    "SNP_A-1511203",
+    "SNP_A-1705379",
+    "SNP_A-1515254",
+    NULL,
+    NULL,
+    "SNP_A-1988476",
+    "SNP_A-1642829",
+    NULL,
+    "SNP_A-1510747",
+    "SNP_A-1509139",
+    "SNP_A-1519050",
+    NULL,
+    "SNP_A-4212578",
+    "SNP_A-1517825",
+    NULL,
+    "SNP_A-1512492",
+    "SNP_A-1510938",
+    "SNP_A-1509750",
+    NULL,
+    "SNP_A-1513695",
+    "SNP_A-1513254",
+    NULL,
+    "SNP_A-1512766",
+    NULL,
+    "SNP_A-1663666",
+    "SNP_A-1517744",
+    "SNP_A-1516162",
+    "SNP_A-2206362",
+    "SNP_A-1693200",
+    "SNP_A-1729424",
+    "SNP_A-1682602",
+    "SNP_A-2020867",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1507550",
+    "SNP_A-8554569",
+    "SNP_A-1513703",
+    "SNP_A-1699223",
+    "SNP_A-1647748",
+    NULL,
+    "SNP_A-2169991",
+    "SNP_A-1514216",
+    "SNP_A-1509493",
+    "SNP_A-1511529",
+    "SNP_A-1516405",
+    "SNP_A-1512540",
+    "SNP_A-1508765",
+    "SNP_A-1517339",
+    "SNP_A-1507459",
+    "SNP_A-1507992",
+    "SNP_A-4213296",
+    "SNP_A-1507551",
+    "SNP_A-1513209",
+    "SNP_A-1649658",
+    "SNP_A-1513411",
+    NULL,
+    "SNP_A-1663616",
+    NULL,
+    "SNP_A-1660017",
+    NULL,
+    "SNP_A-1517983",
+    "SNP_A-1512596",
+    NULL,
+    "SNP_A-8286065",
+    "SNP_A-1730310",
+    "SNP_A-1507531",
+    NULL,
+    "SNP_A-4165914",
+    "SNP_A-1678088",
+    "SNP_A-8284246",
+    "SNP_A-1511356",
+    "SNP_A-1995038",
+    "SNP_A-1517478",
+    "SNP_A-1995931",
+    "SNP_A-1518109",
+    "SNP_A-1738106",
+    "SNP_A-4263625",
+    "SNP_A-4210435",
+    "SNP_A-1646322",
+    "SNP_A-1517000",
+    NULL,
+    "SNP_A-1519585",
+    "SNP_A-1511394",
+    "SNP_A-1509678",
+    "SNP_A-1510043",
+    "SNP_A-1696868",
+    "SNP_A-1507831",
+    "SNP_A-1722698",
+    "SNP_A-1514388",
+    "SNP_A-1513569",
+    "SNP_A-1716917",
+    "SNP_A-1507824",
+    NULL,
+    "SNP_A-1519497",
+    "SNP_A-1518497",
+    NULL,
+    "SNP_A-1728269",
+    "SNP_A-1512986",
+    NULL,
+    "SNP_A-4264343",
+    NULL,
+    "SNP_A-1517592",
+    "SNP_A-4212949",
+    "SNP_A-1507519",
+    "SNP_A-1677426",
+    NULL,
+    NULL,
+    "SNP_A-1743901",
+    NULL,
+    "SNP_A-1740603",
+    NULL,
+    "SNP_A-1515693",
+    "SNP_A-1985775",
+    "SNP_A-1677836",
+    "SNP_A-1512120",
+    "SNP_A-1511068",
+    "SNP_A-1703543",
+    "SNP_A-2020982",
+    "SNP_A-1508902",
+    "SNP_A-1512863",
+    "SNP_A-1689366",
+    "SNP_A-1667176",
+    "SNP_A-1660795",
+    "SNP_A-1511452",
+    "SNP_A-1512159",
+    "SNP_A-1519186",
+    "SNP_A-1513614",
+    "SNP_A-1514811",
+    "SNP_A-1700596",
+    "SNP_A-1712043",
+    "SNP_A-1745732",
+    "SNP_A-1518521",
+    "SNP_A-1514916",
+    NULL,
+    "SNP_A-1974740",
+    "SNP_A-1508444",
+    "SNP_A-1756168",
+    "SNP_A-4261832",
+    NULL,
+    NULL,
+    "SNP_A-1512808",
+    "SNP_A-1518198",
+    "SNP_A-1714785",
+    "SNP_A-1512261",
+    "SNP_A-1667974",
+    "SNP_A-8280456",
+    "SNP_A-1518083",
+    "SNP_A-1723150",
+    "SNP_A-1512096",
+    "SNP_A-8287952",
+    "SNP_A-1517784",
+    "SNP_A-1517558",
+    "SNP_A-1510415",
+    "SNP_A-1515715",
+    NULL,
+    "SNP_A-1650010",
+    NULL,
+    "SNP_A-1517257",
+    "SNP_A-1510500",
+    "SNP_A-1513138",
+    "SNP_A-1655215",
+    "SNP_A-8499434",
+    NULL,
+    "SNP_A-1519511",
+    "SNP_A-1515726",
+    "SNP_A-1684398",
+    NULL,
+    "SNP_A-1519030",
+    "SNP_A-1675960",
+    "SNP_A-1509961",
+    NULL,
+    "SNP_A-4268324",
+    NULL,
+    "SNP_A-1511241",
+    NULL,
+    "SNP_A-1508543",
+    "SNP_A-1703553",
+    "SNP_A-1515808",
+    NULL,
+    "SNP_A-1740021",
+    "SNP_A-1744643",
+    NULL,
+    "SNP_A-1665840",
+    "SNP_A-1509096",
+    "SNP_A-8577441",
+    NULL,
+    "SNP_A-1970544",
+    "SNP_A-1517039",
+    NULL,
+    "SNP_A-1512725",
+    "SNP_A-1512436",
+    "SNP_A-1722388",
+    NULL,
+    "SNP_A-1738421",
+    "SNP_A-1511995",
+    "SNP_A-1745780",
+    "SNP_A-1669479",
+    "SNP_A-1508630",
+    "SNP_A-1516826",
+    "SNP_A-1515425",
+    "SNP_A-1514085",
+    "SNP_A-1515210",
+    "SNP_A-1513143",
+    "SNP_A-1519634",
+    "SNP_A-1676342",
+    "SNP_A-1515659",
+    "SNP_A-4214069",
+    "SNP_A-1518197",
+    "SNP_A-1510811",
+    "SNP_A-1508892",
+    "SNP_A-1507625",
+    "SNP_A-8503830",
+    "SNP_A-1517495",
+    "SNP_A-8290849",
+    "SNP_A-1697519",
+    "SNP_A-1651094",
+    NULL,
+    "SNP_A-1742135",
+    "SNP_A-1963250",
+    "SNP_A-1710872",
+    "SNP_A-1517514",
+    "SNP_A-1515490",
+    NULL,
+    NULL,
+    "SNP_A-1508015",
+    "SNP_A-1518422",
+    NULL,
+    "SNP_A-4229612",
+    "SNP_A-1518871",
+    NULL,
+    "SNP_A-1683622",
+    "SNP_A-1508559",
+    "SNP_A-1518114",
+    NULL,
+    "SNP_A-1708923",
+    "SNP_A-1517569",
+    NULL,
+    "SNP_A-1514201",
+    "SNP_A-1684648",
+    NULL,
+    "SNP_A-1519706",
+    "SNP_A-1997785",
+    "SNP_A-1517074",
+    NULL,
+    "SNP_A-1514844",
+    "SNP_A-1711606",
+    NULL,
+    NULL,
+    "SNP_A-1695667",
+    "SNP_A-8280301",
+    NULL,
+    "SNP_A-1507388",
+    "SNP_A-1507468",
+    NULL,
+    "SNP_A-1510227",
+    "SNP_A-8671423",
+    "SNP_A-1709189",
+    NULL,
+    "SNP_A-1510799",
+    NULL,
+    "SNP_A-1706309",
+    "SNP_A-1510977",
+    "SNP_A-1514523",
+    "SNP_A-1511834",
+    "SNP_A-1519205",
+    "SNP_A-1515452",
+    "SNP_A-1507732",
+    "SNP_A-1517673",
+    "SNP_A-1745934",
+    "SNP_A-4267612",
+    "SNP_A-1509863",
+    "SNP_A-2310558",
+    NULL,
+    "SNP_A-1742879",
+    NULL,
+    "SNP_A-1649146",
+    "SNP_A-1517686",
+    NULL,
+    "SNP_A-1641943",
+    "SNP_A-1519382",
+    NULL,
+    "SNP_A-8620929",
+    NULL,
+    NULL,
+    "SNP_A-8617121",
+    "SNP_A-1518222",
+    "SNP_A-4197937",
+    "SNP_A-1516143",
+    "SNP_A-1507811",
+    "SNP_A-1511891",
+    "SNP_A-1653866",
+    "SNP_A-1508869",
+    "SNP_A-4221754",
+    "SNP_A-1513280",
+    "SNP_A-1516830",
+    "SNP_A-8618091",
+    "SNP_A-1518706",
+    "SNP_A-1509954",
+    "SNP_A-2002662",
+    "SNP_A-1715431",
+    NULL,
+    "SNP_A-1512555",
+    "SNP_A-1648082",
+    "SNP_A-8664057",
+    "SNP_A-1726976",
+    "SNP_A-1702415",
+    NULL,
+    "SNP_A-1518163",
+    "SNP_A-8574460",
+    "SNP_A-1516000",
+    "SNP_A-1512698",
+    "SNP_A-1647564",
+    "SNP_A-1511316",
+    "SNP_A-1518398",
+    "SNP_A-1507365",
+    "SNP_A-1513413",
+    "SNP_A-1683842",
+    "SNP_A-1675868",
+    "SNP_A-1683070",
+    "SNP_A-1712181",
+    "SNP_A-1507457",
+    NULL,
+    "SNP_A-1507336",
+    "SNP_A-1709325",
+    "SNP_A-1678408",
+    "SNP_A-8291764",
+    "SNP_A-1514275",
+    "SNP_A-1732307",
+    "SNP_A-1513519",
+    NULL,
+    "SNP_A-8668609",
+    "SNP_A-1516680",
+    "SNP_A-1708815",
+    "SNP_A-1508780",
+    "SNP_A-1516868",
+    NULL,
+    "SNP_A-1513552",
+    NULL,
+    NULL,
+    "SNP_A-1516404",
+    NULL,
+    "SNP_A-1518504",
+    "SNP_A-8573774",
+    NULL,
+    "SNP_A-1509105",
+    NULL,
+    "SNP_A-8335209",
+    "SNP_A-1748569",
+    "SNP_A-4235520",
+    NULL,
+    "SNP_A-1961995",
+    "SNP_A-1754380",
+    "SNP_A-1518085",
+    "SNP_A-1998581",
+    NULL,
+    "SNP_A-1509623",
+    NULL,
+    "SNP_A-1729676",
+    "SNP_A-1518727",
+    NULL,
+    NULL,
+    "SNP_A-1709907",
+    "SNP_A-1719447",
+    "SNP_A-1515481",
+    NULL,
+    "SNP_A-1686510",
+    "SNP_A-1517185",
+    "SNP_A-1509087",
+    "SNP_A-1511376",
+    "SNP_A-1516009",
+    "SNP_A-1518756",
+    NULL,
+    NULL,
+    "SNP_A-1513580",
+    "SNP_A-1731309",
+    "SNP_A-1750163",
+    "SNP_A-1511022",
+    "SNP_A-1507564",
+    "SNP_A-2228047",
+    "SNP_A-8577329",
+    "SNP_A-1715499",
+    "SNP_A-1512175",
+    "SNP_A-1517256",
+    "SNP_A-1736257",
+    "SNP_A-1507647",
+    "SNP_A-1727545",
+    "SNP_A-1516115",
+    NULL,
+    "SNP_A-1659828",
+    NULL,
+    "SNP_A-1515920",
+    "SNP_A-1513200",
+    "SNP_A-1507384",
+    "SNP_A-8578390",
+    "SNP_A-8664728",
+    "SNP_A-1669129",
+    "SNP_A-1649770",
+    "SNP_A-1518364",
+    NULL,
+    "SNP_A-1519645",
+    "SNP_A-1509501",
+    "SNP_A-8663236",
+    "SNP_A-1677392",
+    NULL,
+    "SNP_A-1509207",
+    "SNP_A-1671468",
+    NULL,
+    "SNP_A-1673366",
+    "SNP_A-1706135",
+    "SNP_A-8668825",
+    "SNP_A-1746705",
+    "SNP_A-1986486",
+    "SNP_A-1515026",
+    "SNP_A-1510687",
+    "SNP_A-1509670",
+    "SNP_A-1700552",
+    "SNP_A-1670604",
+    "SNP_A-1716619",
+    "SNP_A-1606286",
+    "SNP_A-1518886",
+    "SNP_A-8621462",
+    "SNP_A-1657888",
+    "SNP_A-1512453",
+    "SNP_A-1752267",
+    "SNP_A-1685022",
+    "SNP_A-1508622",
+    "SNP_A-1514042",
+    "SNP_A-1515946",
+    "SNP_A-1515991",
+    NULL,
+    "SNP_A-1673862",
+    "SNP_A-1516213",
+    "SNP_A-1649328",
+    "SNP_A-1514934",
+    "SNP_A-1732133",
+    "SNP_A-4211448",
+    "SNP_A-1515648",
+    "SNP_A-1755910",
+    NULL,
+    "SNP_A-1516955",
+    "SNP_A-1517542",
+    NULL,
+    NULL,
+    "SNP_A-1643824",
+    NULL,
+    "SNP_A-1606326",
+    NULL,
+    "SNP_A-1750685",
+    "SNP_A-1720635",
+    NULL,
+    "SNP_A-2144295",
+    "SNP_A-1511149",
+    "SNP_A-1515070",
+    NULL,
+    NULL,
+    "SNP_A-1517016",
+    NULL,
+    "SNP_A-1507942",
+    NULL,
+    "SNP_A-1516910",
+    "SNP_A-1517977",
+    NULL,
+    "SNP_A-1709579",
+    "SNP_A-1652778",
+    "SNP_A-1516255",
+    "SNP_A-1668130",
+    "SNP_A-8621037",
+    "SNP_A-8468165",
+    "SNP_A-1736143",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1517057",
+    NULL,
+    "SNP_A-1664904",
+    NULL,
+    "SNP_A-1669943",
+    "SNP_A-1517335",
+    NULL,
+    "SNP_A-1738002",
+    NULL,
+    "SNP_A-1512211",
+    "SNP_A-1697511",
+    "SNP_A-1663824",
+    "SNP_A-1509173",
+    "SNP_A-1508366",
+    "SNP_A-1732257",
+    "SNP_A-1512522",
+    "SNP_A-1700534",
+    "SNP_A-1517936",
+    NULL,
+    "SNP_A-1675860",
+    "SNP_A-8620861",
+    "SNP_A-1516237",
+    "SNP_A-1724144",
+    "SNP_A-1513451",
+    "SNP_A-1780733",
+    "SNP_A-1508682",
+    "SNP_A-1518028",
+    "SNP_A-1517869",
+    "SNP_A-4256699",
+    "SNP_A-1513276",
+    "SNP_A-1695831",
+    "SNP_A-1967423",
+    NULL,
+    "SNP_A-1510194",
+    "SNP_A-1719501",
+    "SNP_A-1697012",
+    NULL,
+    "SNP_A-1704773",
+    "SNP_A-1512978",
+    "SNP_A-1517846",
+    NULL,
+    "SNP_A-1509930",
+    "SNP_A-1519519",
+    "SNP_A-1728301",
+    "SNP_A-1744079",
+    NULL,
+    "SNP_A-1512727",
+    NULL,
+    "SNP_A-1754684",
+    "SNP_A-1690679",
+    "SNP_A-1516561",
+    NULL,
+    "SNP_A-1687958",
+    "SNP_A-1518231",
+    "SNP_A-1511399",
+    "SNP_A-1513990",
+    "SNP_A-1519629",
+    NULL,
+    "SNP_A-1509665",
+    NULL,
+    "SNP_A-1513598",
+    "SNP_A-1510135",
+    "SNP_A-1509606",
+    "SNP_A-1517874",
+    NULL,
+    NULL,
+    "SNP_A-1509662",
+    "SNP_A-1510437",
+    "SNP_A-1512759",
+    "SNP_A-1516884",
+    "SNP_A-1692922",
+    "SNP_A-1514096",
+    "SNP_A-1518453",
+    "SNP_A-1517946",
+    "SNP_A-1518951",
+    "SNP_A-1963688",
+    "SNP_A-1517464",
+    "SNP_A-1517263",
+    "SNP_A-1714621",
+    "SNP_A-4209429",
+    "SNP_A-1510482",
+    "SNP_A-8338422",
+    "SNP_A-1645904",
+    "SNP_A-1513661",
+    "SNP_A-1511670",
+    "SNP_A-8282296",
+    "SNP_A-1509571",
+    "SNP_A-1509336",
+    NULL,
+    "SNP_A-1699047",
+    "SNP_A-1518291",
+    "SNP_A-1718905",
+    "SNP_A-1735604",
+    "SNP_A-1514819",
+    "SNP_A-1660515",
+    "SNP_A-2139400",
+    "SNP_A-1644712",
+    "SNP_A-1902385",
+    NULL,
+    "SNP_A-1517760",
+    "SNP_A-1507687",
+    "SNP_A-1513844",
+    NULL,
+    "SNP_A-1740567",
+    NULL,
+    "SNP_A-1606353",
+    "SNP_A-1991110",
+    "SNP_A-1670157",
+    "SNP_A-1507903",
+    NULL,
+    "SNP_A-4213409",
+    "SNP_A-8349055",
+    "SNP_A-1670199",
+    "SNP_A-8520888",
+    "SNP_A-1700099",
+    NULL,
+    "SNP_A-1646686",
+    "SNP_A-1510284",
+    "SNP_A-1744795",
+    "SNP_A-1515756",
+    "SNP_A-4208278",
+    "SNP_A-1507964",
+    "SNP_A-1665480",
+    NULL,
+    "SNP_A-1729596",
+    NULL,
+    "SNP_A-1510370",
+    NULL,
+    "SNP_A-8618923",
+    "SNP_A-1519508",
+    "SNP_A-1512894",
+    "SNP_A-1515911",
+    "SNP_A-1518612",
+    "SNP_A-1984568",
+    "SNP_A-1517513",
+    NULL,
+    "SNP_A-1517262",
+    "SNP_A-1510753",
+    "SNP_A-1693140",
+    "SNP_A-4194076",
+    "SNP_A-1988007",
+    "SNP_A-1511869",
+    NULL,
+    "SNP_A-1508775",
+    NULL,
+    "SNP_A-1722194",
+    "SNP_A-1606362",
+    "SNP_A-1693927",
+    "SNP_A-1517003",
+    "SNP_A-1511642",
+    "SNP_A-1511434",
+    "SNP_A-1507626",
+    "SNP_A-8577762",
+    NULL,
+    "SNP_A-1519540",
+    "SNP_A-1519517",
+    "SNP_A-1516844",
+    "SNP_A-1755246",
+    "SNP_A-1648378",
+    "SNP_A-1515198",
+    "SNP_A-1513682",
+    NULL,
+    "SNP_A-1985367",
+    NULL,
+    "SNP_A-1751783",
+    NULL,
+    NULL,
+    "SNP_A-1701267",
+    "SNP_A-1992685",
+    NULL,
+    NULL,
+    "SNP_A-1519482",
+    NULL,
+    "SNP_A-1510228",
+    "SNP_A-1758646",
+    "SNP_A-1718365",
+    "SNP_A-1654395",
+    "SNP_A-1517780",
+    "SNP_A-1513295",
+    "SNP_A-1507812",
+    NULL,
+    "SNP_A-1512254",
+    NULL,
+    "SNP_A-1508300",
+    "SNP_A-1993909",
+    "SNP_A-1695001",
+    "SNP_A-1606260",
+    "SNP_A-1513899",
+    "SNP_A-1687382",
+    "SNP_A-1512696",
+    "SNP_A-1513967",
+    "SNP_A-1737475",
+    "SNP_A-1742283",
+    "SNP_A-1518402",
+    "SNP_A-1715633",
+    NULL,
+    NULL,
+    "SNP_A-4265014",
+    "SNP_A-1972193",
+    "SNP_A-1753105",
+    "SNP_A-1519674",
+    "SNP_A-1514145",
+    "SNP_A-1508489",
+    "SNP_A-1515170",
+    "SNP_A-1512984",
+    "SNP_A-1508208",
+    "SNP_A-1731929",
+    "SNP_A-1703209",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1740565",
+    NULL,
+    "SNP_A-1507515",
+    "SNP_A-1736013",
+    "SNP_A-1706637",
+    "SNP_A-1681902",
+    "SNP_A-1508729",
+    "SNP_A-1730797",
+    NULL,
+    "SNP_A-1676086",
+    "SNP_A-1691724",
+    "SNP_A-1643259",
+    "SNP_A-1518399",
+    NULL,
+    "SNP_A-1606302",
+    "SNP_A-8628831",
+    "SNP_A-1699915",
+    "SNP_A-1510112",
+    "SNP_A-1691128",
+    "SNP_A-1514318",
+    "SNP_A-1519366",
+    "SNP_A-1516589",
+    "SNP_A-1511258",
+    "SNP_A-1651260",
+    "SNP_A-1507611",
+    "SNP_A-1719959",
+    NULL,
+    "SNP_A-1517713",
+    "SNP_A-1512734",
+    "SNP_A-4265288",
+    "SNP_A-1511379",
+    "SNP_A-1518019",
+    "SNP_A-1732720",
+    NULL,
+    NULL,
+    "SNP_A-2245722",
+    "SNP_A-1517283",
+    "SNP_A-1659494",
+    NULL,
+    "SNP_A-1513025",
+    "SNP_A-1513113",
+    "SNP_A-1508438",
+    "SNP_A-1690779",
+    "SNP_A-1517829",
+    "SNP_A-1511948",
+    "SNP_A-1693052",
+    "SNP_A-1742097",
+    "SNP_A-1518849",
+    "SNP_A-1511740",
+    NULL,
+    NULL,
+    "SNP_A-1732566",
+    "SNP_A-1675135",
+    "SNP_A-1508610",
+    "SNP_A-1519060",
+    NULL,
+    "SNP_A-1508672",
+    "SNP_A-1515569",
+    NULL,
+    "SNP_A-1517301",
+    "SNP_A-1513929",
+    "SNP_A-1644086",
+    "SNP_A-1517222",
+    "SNP_A-1686908",
+    NULL,
+    NULL,
+    "SNP_A-1697743",
+    "SNP_A-4208558",
+    "SNP_A-1515249",
+    "SNP_A-4207833",
+    "SNP_A-1711456",
+    "SNP_A-1717189",
+    "SNP_A-1515383",
+    "SNP_A-1508010",
+    "SNP_A-1665554",
+    "SNP_A-1519173",
+    "SNP_A-1694819",
+    "SNP_A-1675147",
+    "SNP_A-2308449",
+    NULL,
+    "SNP_A-1512693",
+    "SNP_A-1727098",
+    NULL,
+    NULL,
+    "SNP_A-1647530",
+    NULL,
+    "SNP_A-1741993",
+    "SNP_A-8283630",
+    "SNP_A-1510325",
+    NULL,
+    "SNP_A-1511975",
+    "SNP_A-1508982",
+    "SNP_A-1678114",
+    "SNP_A-1667240",
+    "SNP_A-1652332",
+    "SNP_A-1512872",
+    "SNP_A-1657768",
+    "SNP_A-1517750",
+    "SNP_A-1513890",
+    "SNP_A-4202087",
+    "SNP_A-1689991",
+    "SNP_A-1965515",
+    "SNP_A-1737784",
+    "SNP_A-1511024",
+    "SNP_A-1713742",
+    NULL,
+    "SNP_A-1756202",
+    "SNP_A-1699475",
+    "SNP_A-1517794",
+    "SNP_A-1672500",
+    "SNP_A-1724030",
+    "SNP_A-1515817",
+    NULL,
+    "SNP_A-1666836",
+    "SNP_A-4269807",
+    "SNP_A-1510875",
+    "SNP_A-1718117",
+    "SNP_A-1673570",
+    "SNP_A-1715357",
+    "SNP_A-1513035",
+    "SNP_A-1671104",
+    "SNP_A-1997521",
+    "SNP_A-1693220",
+    "SNP_A-1669825",
+    "SNP_A-1513739",
+    "SNP_A-2157939",
+    NULL,
+    "SNP_A-1739589",
+    "SNP_A-1668246",
+    "SNP_A-1714055",
+    "SNP_A-4265128",
+    "SNP_A-1666760",
+    "SNP_A-1680604",
+    NULL,
+    "SNP_A-1511921",
+    "SNP_A-1645120",
+    "SNP_A-1711062",
+    "SNP_A-1507883",
+    "SNP_A-1685178",
+    NULL,
+    "SNP_A-1515591",
+    "SNP_A-1644542",
+    "SNP_A-1756917",
+    "SNP_A-1743789",
+    "SNP_A-1514245",
+    "SNP_A-1517360",
+    NULL,
+    "SNP_A-4266240",
+    "SNP_A-4209532",
+    "SNP_A-1758786",
+    "SNP_A-8635362",
+    "SNP_A-1511271",
+    "SNP_A-1658036",
+    "SNP_A-1510679",
+    "SNP_A-1758676",
+    "SNP_A-1507377",
+    "SNP_A-2089744",
+    "SNP_A-1692944",
+    "SNP_A-1652234",
+    "SNP_A-1658202",
+    "SNP_A-1509261",
+    "SNP_A-1755850",
+    NULL,
+    "SNP_A-1511807",
+    "SNP_A-1676264",
+    "SNP_A-1516512",
+    "SNP_A-1516202",
+    "SNP_A-1517299",
+    "SNP_A-1509836",
+    "SNP_A-1643025",
+    "SNP_A-1512514",
+    "SNP_A-1514010",
+    NULL,
+    "SNP_A-1711774",
+    "SNP_A-4214240",
+    "SNP_A-1688680",
+    "SNP_A-1661428",
+    "SNP_A-1748707",
+    "SNP_A-1732998",
+    "SNP_A-1515244",
+    "SNP_A-1703635",
+    "SNP_A-1510421",
+    "SNP_A-8670318",
+    "SNP_A-4266868",
+    "SNP_A-1517815",
+    "SNP_A-4267317",
+    "SNP_A-1517921",
+    "SNP_A-1509298",
+    NULL,
+    "SNP_A-1698735",
+    "SNP_A-1514894",
+    "SNP_A-1728027",
+    NULL,
+    "SNP_A-1509327",
+    NULL,
+    "SNP_A-1737826",
+    "SNP_A-1508381",
+    "SNP_A-1700576",
+    "SNP_A-1651874",
+    "SNP_A-1508709",
+    "SNP_A-1519303",
+    "SNP_A-1518127",
+    NULL,
+    NULL,
+    "SNP_A-8572996",
+    "SNP_A-1511451",
+    "SNP_A-1643223",
+    "SNP_A-1513680",
+    "SNP_A-1988308",
+    NULL,
+    "SNP_A-1754087",
+    "SNP_A-4266921",
+    "SNP_A-1515316",
+    "SNP_A-1518865",
+    NULL,
+    NULL,
+    "SNP_A-1708785",
+    "SNP_A-1511375",
+    NULL,
+    "SNP_A-1711562",
+    "SNP_A-1663660",
+    "SNP_A-1517292",
+    "SNP_A-1515169",
+    "SNP_A-8280549",
+    "SNP_A-1717331",
+    "SNP_A-1507534",
+    "SNP_A-1515404",
+    "SNP_A-1508603",
+    "SNP_A-1513653",
+    "SNP_A-1512109",
+    "SNP_A-1647584",
+    "SNP_A-1518899",
+    "SNP_A-1518409",
+    "SNP_A-1883892",
+    "SNP_A-1991642",
+    "SNP_A-1517079",
+    "SNP_A-1516450",
+    "SNP_A-1518253",
+    "SNP_A-1512875",
+    "SNP_A-1683726",
+    "SNP_A-4250706",
+    "SNP_A-1510084",
+    "SNP_A-1697847",
+    "SNP_A-1696894",
+    "SNP_A-1510419",
+    "SNP_A-1512319",
+    "SNP_A-1704593",
+    "SNP_A-1514843",
+    "SNP_A-1654759",
+    "SNP_A-1508388",
+    "SNP_A-1517769",
+    "SNP_A-1511266",
+    NULL,
+    "SNP_A-1666720",
+    "SNP_A-1513294",
+    "SNP_A-1518836",
+    "SNP_A-1691466",
+    "SNP_A-1758962",
+    "SNP_A-1718533",
+    "SNP_A-1514612",
+    "SNP_A-1508532",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-2193210",
+    "SNP_A-1519675",
+    "SNP_A-1748827",
+    "SNP_A-1723948",
+    "SNP_A-1518828",
+    NULL,
+    "SNP_A-1519685",
+    "SNP_A-1510646",
+    "SNP_A-4181217",
+    "SNP_A-1513386",
+    "SNP_A-1985626",
+    "SNP_A-1514057",
+    "SNP_A-1515997",
+    NULL,
+    NULL,
+    "SNP_A-1515519",
+    "SNP_A-1510067",
+    "SNP_A-1995680",
+    "SNP_A-1512299",
+    "SNP_A-1507723",
+    "SNP_A-1711234",
+    "SNP_A-1690523",
+    "SNP_A-1511944",
+    "SNP_A-1711909",
+    "SNP_A-1507793",
+    "SNP_A-8644923",
+    "SNP_A-1517943",
+    "SNP_A-1515652",
+    "SNP_A-1836942",
+    "SNP_A-1648274",
+    "SNP_A-1508062",
+    "SNP_A-1702701",
+    "SNP_A-1689436",
+    NULL,
+    "SNP_A-1516671",
+    NULL,
+    "SNP_A-1694713",
+    "SNP_A-1511710",
+    NULL,
+    "SNP_A-8664607",
+    "SNP_A-1515273",
+    "SNP_A-1756164",
+    "SNP_A-1726700",
+    "SNP_A-1745832",
+    "SNP_A-1518809",
+    "SNP_A-1726574",
+    "SNP_A-1695041",
+    "SNP_A-1690611",
+    NULL,
+    "SNP_A-1744137",
+    NULL,
+    NULL,
+    "SNP_A-1517446",
+    "SNP_A-1509913",
+    "SNP_A-4209163",
+    "SNP_A-4208988",
+    "SNP_A-8572686",
+    "SNP_A-1511664",
+    "SNP_A-1514143",
+    "SNP_A-1515104",
+    NULL,
+    "SNP_A-8620859",
+    NULL,
+    "SNP_A-1510837",
+    "SNP_A-1514671",
+    "SNP_A-1756268",
+    "SNP_A-8664768",
+    "SNP_A-1509482",
+    "SNP_A-1514841",
+    "SNP_A-1732762",
+    "SNP_A-1513042",
+    "SNP_A-1710479",
+    "SNP_A-1715067",
+    "SNP_A-1508649",
+    "SNP_A-1511060",
+    "SNP_A-4267727",
+    "SNP_A-1678418",
+    "SNP_A-1744059",
+    NULL,
+    "SNP_A-1723988",
+    "SNP_A-1648080",
+    "SNP_A-1914110",
+    NULL,
+    "SNP_A-1686850",
+    "SNP_A-1515005",
+    "SNP_A-1516062",
+    "SNP_A-1516170",
+    "SNP_A-8664564",
+    "SNP_A-1512457",
+    "SNP_A-1508820",
+    "SNP_A-1756919",
+    "SNP_A-8526858",
+    "SNP_A-1518888",
+    "SNP_A-1972457",
+    "SNP_A-1516379",
+    NULL,
+    "SNP_A-1510334",
+    "SNP_A-1509722",
+    "SNP_A-1515606",
+    "SNP_A-1517286",
+    "SNP_A-8291446",
+    NULL,
+    "SNP_A-1509667",
+    "SNP_A-1513048",
+    "SNP_A-1518171",
+    "SNP_A-1510823",
+    NULL,
+    "SNP_A-1510511",
+    "SNP_A-1511502",
+    "SNP_A-1725520",
+    "SNP_A-1518527",
+    "SNP_A-1755002",
+    "SNP_A-1516651",
+    NULL,
+    "SNP_A-1643255",
+    "SNP_A-1512283",
+    "SNP_A-1514148",
+    "SNP_A-1739457",
+    "SNP_A-1517650",
+    "SNP_A-1710289",
+    "SNP_A-2154181",
+    "SNP_A-1518014",
+    "SNP_A-1661504",
+    "SNP_A-1672892",
+    NULL,
+    NULL,
+    "SNP_A-8618669",
+    NULL,
+    "SNP_A-1713654",
+    NULL,
+    "SNP_A-1687832",
+    "SNP_A-4170846",
+    "SNP_A-1977531",
+    "SNP_A-1740291",
+    "SNP_A-8473001",
+    "SNP_A-1738363",
+    "SNP_A-1516825",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1696750",
+    "SNP_A-1511688",
+    "SNP_A-1740145",
+    "SNP_A-1663506",
+    "SNP_A-1516227",
+    "SNP_A-4269228",
+    "SNP_A-8284230",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1686024",
+    "SNP_A-1516566",
+    NULL,
+    "SNP_A-1519004",
+    "SNP_A-1510340",
+    NULL,
+    "SNP_A-1510182",
+    "SNP_A-1512871",
+    "SNP_A-1698507",
+    "SNP_A-1516388",
+    "SNP_A-1666574",
+    "SNP_A-1662630",
+    "SNP_A-1514970",
+    "SNP_A-1518491",
+    NULL,
+    NULL,
+    "SNP_A-1516529",
+    "SNP_A-1515677",
+    NULL,
+    "SNP_A-1512311",
+    NULL,
+    NULL,
+    "SNP_A-1509908",
+    "SNP_A-1737557",
+    NULL,
+    "SNP_A-8620127",
+    "SNP_A-1691992",
+    "SNP_A-1515349",
+    NULL,
+    "SNP_A-1662292",
+    "SNP_A-1664106",
+    NULL,
+    "SNP_A-1519752",
+    NULL,
+    "SNP_A-1712703",
+    NULL,
+    NULL,
+    "SNP_A-8418467",
+    "SNP_A-1646728",
+    "SNP_A-1669095",
+    "SNP_A-8290800",
+    "SNP_A-1509376",
+    "SNP_A-1508998",
+    "SNP_A-1510050",
+    "SNP_A-1513462",
+    "SNP_A-1519106",
+    "SNP_A-1726662",
+    NULL,
+    "SNP_A-1516036",
+    "SNP_A-1516565",
+    "SNP_A-1683646",
+    "SNP_A-1514219",
+    "SNP_A-1511447",
+    "SNP_A-1681310",
+    "SNP_A-1721724",
+    "SNP_A-1646080",
+    "SNP_A-1508150",
+    "SNP_A-1517181",
+    "SNP_A-2172132",
+    NULL,
+    "SNP_A-1517426",
+    "SNP_A-1508558",
+    NULL,
+    "SNP_A-1705243",
+    "SNP_A-1735981",
+    "SNP_A-1731597",
+    "SNP_A-1511318",
+    "SNP_A-1514566",
+    "SNP_A-1516740",
+    "SNP_A-1515847",
+    "SNP_A-1519079",
+    "SNP_A-1517698",
+    "SNP_A-1606308",
+    "SNP_A-1731585",
+    "SNP_A-1965294",
+    "SNP_A-1510283",
+    "SNP_A-1728971",
+    "SNP_A-1747031",
+    NULL,
+    "SNP_A-1516608",
+    NULL,
+    "SNP_A-1512217",
+    "SNP_A-8665327",
+    "SNP_A-1727303",
+    "SNP_A-1694475",
+    NULL,
+    "SNP_A-1512490",
+    "SNP_A-1513361",
+    "SNP_A-1517855",
+    "SNP_A-1511116",
+    "SNP_A-1693132",
+    NULL,
+    "SNP_A-8285310",
+    "SNP_A-1646134",
+    "SNP_A-1514715",
+    "SNP_A-2001564",
+    "SNP_A-1512240",
+    "SNP_A-1674355",
+    "SNP_A-1517625",
+    "SNP_A-1692026",
+    "SNP_A-1511742",
+    "SNP_A-1676855",
+    "SNP_A-1727945",
+    NULL,
+    "SNP_A-1516752",
+    "SNP_A-1511261",
+    "SNP_A-8397309",
+    "SNP_A-1724728",
+    "SNP_A-8620783",
+    NULL,
+    "SNP_A-1741099",
+    "SNP_A-4269388",
+    "SNP_A-1516704",
+    "SNP_A-1509569",
+    "SNP_A-1515319",
+    "SNP_A-1664950",
+    "SNP_A-1984754",
+    "SNP_A-1509457",
+    "SNP_A-1508023",
+    "SNP_A-1516444",
+    "SNP_A-1731271",
+    "SNP_A-1839565",
+    "SNP_A-1517877",
+    "SNP_A-1670223",
+    "SNP_A-1516627",
+    "SNP_A-1685984",
+    "SNP_A-1667470",
+    "SNP_A-1697324",
+    "SNP_A-1507461",
+    "SNP_A-1519573",
+    "SNP_A-1516142",
+    "SNP_A-8578316",
+    "SNP_A-1755680",
+    NULL,
+    "SNP_A-1515646",
+    "SNP_A-1664870",
+    "SNP_A-1507934",
+    "SNP_A-1695257",
+    NULL,
+    "SNP_A-1688818",
+    NULL,
+    "SNP_A-1515656",
+    "SNP_A-4256879",
+    "SNP_A-4212756",
+    "SNP_A-2066822",
+    "SNP_A-1734328",
+    "SNP_A-1724490",
+    "SNP_A-1510491",
+    "SNP_A-1518058",
+    NULL,
+    NULL,
+    "SNP_A-1691324",
+    "SNP_A-1745996",
+    "SNP_A-1712481",
+    "SNP_A-1644988",
+    "SNP_A-1693807",
+    "SNP_A-1986011",
+    "SNP_A-1685848",
+    "SNP_A-1518740",
+    "SNP_A-1968721",
+    "SNP_A-1509746",
+    "SNP_A-1653694",
+    "SNP_A-1745003",
+    "SNP_A-1831157",
+    "SNP_A-4210266",
+    NULL,
+    "SNP_A-1508396",
+    "SNP_A-1672610",
+    "SNP_A-1510202",
+    "SNP_A-1519380",
+    "SNP_A-1515731",
+    "SNP_A-1508909",
+    "SNP_A-1757989",
+    "SNP_A-1756689",
+    "SNP_A-1517546",
+    "SNP_A-1697901",
+    "SNP_A-1706723",
+    "SNP_A-1755458",
+    "SNP_A-8671293",
+    "SNP_A-1696420",
+    NULL,
+    "SNP_A-1519032",
+    "SNP_A-1507970",
+    "SNP_A-1515596",
+    NULL,
+    NULL,
+    "SNP_A-1509229",
+    NULL,
+    "SNP_A-1514290",
+    "SNP_A-1728085",
+    "SNP_A-1511600",
+    "SNP_A-1513228",
+    "SNP_A-1511717",
+    "SNP_A-1713910",
+    NULL,
+    "SNP_A-1998064",
+    "SNP_A-1747087",
+    "SNP_A-1512895",
+    "SNP_A-1978021",
+    "SNP_A-1722978",
+    "SNP_A-1510816",
+    "SNP_A-1516288",
+    "SNP_A-1517739",
+    "SNP_A-1676236",
+    "SNP_A-1516861",
+    NULL,
+    "SNP_A-4262518",
+    "SNP_A-1517872",
+    "SNP_A-1725706",
+    NULL,
+    "SNP_A-1690483",
+    "SNP_A-1519400",
+    "SNP_A-1676420",
+    "SNP_A-1510526",
+    "SNP_A-1514870",
+    "SNP_A-1517820",
+    "SNP_A-1719073",
+    "SNP_A-1758273",
+    "SNP_A-4209605",
+    NULL,
+    "SNP_A-1512102",
+    "SNP_A-1703845",
+    "SNP_A-1511911",
+    NULL,
+    "SNP_A-1507838",
+    NULL,
+    "SNP_A-1641767",
+    NULL,
+    "SNP_A-1729736",
+    "SNP_A-1511852",
+    NULL,
+    NULL,
+    "SNP_A-1511967",
+    "SNP_A-1710313",
+    "SNP_A-1516855",
+    "SNP_A-1511697",
+    "SNP_A-1700977",
+    "SNP_A-1510163",
+    "SNP_A-1513866",
+    "SNP_A-1746799",
+    "SNP_A-1661406",
+    "SNP_A-1519115",
+    "SNP_A-1725254",
+    "SNP_A-1519216",
+    "SNP_A-1508519",
+    "SNP_A-1732117",
+    NULL,
+    "SNP_A-1508413",
+    "SNP_A-1738683",
+    "SNP_A-1644420",
+    "SNP_A-1516082",
+    NULL,
+    "SNP_A-1519393",
+    "SNP_A-1509542",
+    "SNP_A-4152075",
+    "SNP_A-1519301",
+    "SNP_A-1511615",
+    NULL,
+    "SNP_A-1971999",
+    NULL,
+    "SNP_A-1514897",
+    "SNP_A-1511741",
+    "SNP_A-1510907",
+    "SNP_A-1517160",
+    NULL,
+    "SNP_A-1512428",
+    "SNP_A-1680908",
+    "SNP_A-1981970",
+    "SNP_A-1750003",
+    NULL,
+    "SNP_A-8619653",
+    "SNP_A-1708943",
+    "SNP_A-1511221",
+    "SNP_A-1512152",
+    "SNP_A-1986607",
+    "SNP_A-1696494",
+    NULL,
+    "SNP_A-2171950",
+    "SNP_A-4213628",
+    "SNP_A-1748345",
+    "SNP_A-1513918",
+    "SNP_A-1758348",
+    "SNP_A-1726780",
+    "SNP_A-1515151",
+    "SNP_A-1518797",
+    "SNP_A-1677818",
+    "SNP_A-1515578",
+    NULL,
+    "SNP_A-1679418",
+    "SNP_A-8670265",
+    "SNP_A-1517370",
+    "SNP_A-2105559",
+    NULL,
+    "SNP_A-1756337",
+    "SNP_A-1517654",
+    "SNP_A-1518299",
+    NULL,
+    "SNP_A-1519255",
+    "SNP_A-1744343",
+    "SNP_A-1517814",
+    NULL,
+    "SNP_A-1706532",
+    NULL,
+    "SNP_A-1653030",
+    "SNP_A-1713724",
+    "SNP_A-8579291",
+    "SNP_A-1508705",
+    "SNP_A-1641959",
+    "SNP_A-1965682",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1517193",
+    "SNP_A-1512623",
+    "SNP_A-1999694",
+    "SNP_A-1731279",
+    NULL,
+    "SNP_A-1694781",
+    "SNP_A-1510036",
+    "SNP_A-8664140",
+    "SNP_A-1977815",
+    "SNP_A-4264892",
+    "SNP_A-1994816",
+    NULL,
+    "SNP_A-1687470",
+    "SNP_A-1510672",
+    "SNP_A-8611322",
+    "SNP_A-1721528",
+    "SNP_A-1507789",
+    "SNP_A-1518136",
+    "SNP_A-1511154",
+    NULL,
+    "SNP_A-1718837",
+    NULL,
+    "SNP_A-1745660",
+    "SNP_A-1970989",
+    "SNP_A-1509102",
+    "SNP_A-1518648",
+    "SNP_A-1516779",
+    "SNP_A-1513542",
+    NULL,
+    "SNP_A-1512190",
+    "SNP_A-8581973",
+    "SNP_A-1659852",
+    "SNP_A-1515295",
+    "SNP_A-1751087",
+    "SNP_A-1510493",
+    NULL,
+    "SNP_A-1514528",
+    "SNP_A-1511351",
+    "SNP_A-1516149",
+    "SNP_A-1510892",
+    "SNP_A-8665457",
+    "SNP_A-1517597",
+    "SNP_A-1720517",
+    "SNP_A-1518889",
+    "SNP_A-1509574",
+    "SNP_A-1753823",
+    "SNP_A-1515411",
+    "SNP_A-1713051",
+    NULL,
+    "SNP_A-1513878",
+    NULL,
+    "SNP_A-1509247",
+    "SNP_A-1751129",
+    "SNP_A-1507592",
+    "SNP_A-1510356",
+    "SNP_A-1725060",
+    "SNP_A-1513216",
+    "SNP_A-1512883",
+    "SNP_A-2006596",
+    "SNP_A-8667964",
+    "SNP_A-1510436",
+    "SNP_A-1704171",
+    "SNP_A-1517259",
+    "SNP_A-1514362",
+    "SNP_A-1512997",
+    NULL,
+    "SNP_A-2006647",
+    "SNP_A-1514714",
+    "SNP_A-1508014",
+    NULL,
+    NULL,
+    "SNP_A-1518097",
+    "SNP_A-1736507",
+    "SNP_A-1508135",
+    "SNP_A-1509533",
+    "SNP_A-1708308",
+    NULL,
+    NULL,
+    "SNP_A-1696725",
+    "SNP_A-1642023",
+    "SNP_A-1753671",
+    "SNP_A-1511635",
+    "SNP_A-1666194",
+    NULL,
+    "SNP_A-1514292",
+    "SNP_A-1516111",
+    "SNP_A-1651692",
+    NULL,
+    "SNP_A-1731343",
+    "SNP_A-1510096",
+    "SNP_A-1875498",
+    "SNP_A-1716815",
+    "SNP_A-2004313",
+    "SNP_A-1721946",
+    NULL,
+    "SNP_A-1507363",
+    "SNP_A-1517725",
+    NULL,
+    "SNP_A-1663304",
+    "SNP_A-1513310",
+    NULL,
+    NULL,
+    "SNP_A-1514385",
+    "SNP_A-8432512",
+    "SNP_A-1681766",
+    NULL,
+    "SNP_A-1510110",
+    NULL,
+    "SNP_A-1665890",
+    NULL,
+    NULL,
+    "SNP_A-1670257",
+    "SNP_A-1751351",
+    NULL,
+    NULL,
+    "SNP_A-1711862",
+    "SNP_A-1511987",
+    "SNP_A-1514640",
+    "SNP_A-1685684",
+    "SNP_A-1507689",
+    "SNP_A-1988295",
+    "SNP_A-1754628",
+    "SNP_A-8671606",
+    "SNP_A-1734764",
+    "SNP_A-1517250",
+    "SNP_A-1509426",
+    "SNP_A-1735705",
+    "SNP_A-1984071",
+    "SNP_A-8281222",
+    "SNP_A-1512025",
+    "SNP_A-4267621",
+    "SNP_A-1507711",
+    "SNP_A-1513911",
+    NULL,
+    "SNP_A-1516984",
+    "SNP_A-1517472",
+    "SNP_A-1509108",
+    "SNP_A-1745484",
+    "SNP_A-1739263",
+    "SNP_A-1515520",
+    NULL,
+    NULL,
+    "SNP_A-4258683",
+    "SNP_A-1511160",
+    "SNP_A-1519662",
+    "SNP_A-1727637",
+    "SNP_A-1508639",
+    NULL,
+    NULL,
+    "SNP_A-1515484",
+    "SNP_A-1514534",
+    "SNP_A-1511683",
+    "SNP_A-2172527",
+    "SNP_A-1660911",
+    "SNP_A-1661109",
+    "SNP_A-1982419",
+    "SNP_A-1676802",
+    "SNP_A-1512768",
+    "SNP_A-1684504",
+    "SNP_A-1516030",
+    "SNP_A-1972074",
+    "SNP_A-1510524",
+    "SNP_A-1516530",
+    "SNP_A-1517108",
+    "SNP_A-1509055",
+    "SNP_A-1511883",
+    "SNP_A-1515674",
+    "SNP_A-4215470",
+    "SNP_A-1670037",
+    "SNP_A-4261839",
+    "SNP_A-1516481",
+    "SNP_A-1653246",
+    "SNP_A-8665589",
+    NULL,
+    "SNP_A-1606338",
+    "SNP_A-1519167",
+    "SNP_A-8284640",
+    "SNP_A-1515097",
+    "SNP_A-1722414",
+    "SNP_A-1684352",
+    "SNP_A-1698931",
+    "SNP_A-4151112",
+    "SNP_A-1738593",
+    "SNP_A-1513501",
+    "SNP_A-1711947",
+    "SNP_A-1990405",
+    "SNP_A-1514832",
+    "SNP_A-1512829",
+    NULL,
+    "SNP_A-1742221",
+    "SNP_A-1516918",
+    "SNP_A-1513273",
+    "SNP_A-1507985",
+    "SNP_A-1683652",
+    "SNP_A-1516806",
+    "SNP_A-1518186",
+    "SNP_A-1509805",
+    "SNP_A-1512541",
+    NULL,
+    "SNP_A-1513136",
+    "SNP_A-1511703",
+    "SNP_A-1518552",
+    "SNP_A-8668658",
+    "SNP_A-4292189",
+    "SNP_A-1690585",
+    NULL,
+    "SNP_A-1704745",
+    "SNP_A-1513349",
+    "SNP_A-4263521",
+    "SNP_A-8621418",
+    "SNP_A-1510908",
+    "SNP_A-1963132",
+    "SNP_A-1515875",
+    "SNP_A-8344121",
+    "SNP_A-1512117",
+    NULL,
+    "SNP_A-8339971",
+    "SNP_A-1512113",
+    "SNP_A-1513991",
+    "SNP_A-2106776",
+    "SNP_A-8669998",
+    NULL,
+    "SNP_A-1757919",
+    NULL,
+    "SNP_A-1677074",
+    "SNP_A-1510779",
+    "SNP_A-1508605",
+    "SNP_A-1714841",
+    "SNP_A-1962582",
+    "SNP_A-1517264",
+    "SNP_A-1667230",
+    "SNP_A-1705233",
+    NULL,
+    "SNP_A-1972299",
+    "SNP_A-1516311",
+    "SNP_A-1664140",
+    "SNP_A-1519311",
+    "SNP_A-2007722",
+    "SNP_A-1510398",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1680404",
+    "SNP_A-4192956",
+    "SNP_A-1516206",
+    "SNP_A-1518525",
+    "SNP_A-1509190",
+    "SNP_A-1713976",
+    "SNP_A-1514419",
+    NULL,
+    "SNP_A-1670434",
+    "SNP_A-1686144",
+    NULL,
+    "SNP_A-8285584",
+    "SNP_A-1513408",
+    NULL,
+    "SNP_A-1660499",
+    NULL,
+    "SNP_A-1508896",
+    "SNP_A-1708675",
+    "SNP_A-1714433",
+    "SNP_A-1515660",
+    "SNP_A-8619681",
+    "SNP_A-1679300",
+    NULL,
+    "SNP_A-1519363",
+    "SNP_A-1670602",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516426",
+    "SNP_A-1513394",
+    "SNP_A-1518677",
+    "SNP_A-1707317",
+    "SNP_A-1899987",
+    NULL,
+    "SNP_A-1507956",
+    "SNP_A-1509161",
+    NULL,
+    "SNP_A-1516491",
+    "SNP_A-1750917",
+    NULL,
+    "SNP_A-1512925",
+    NULL,
+    NULL,
+    "SNP_A-1720885",
+    "SNP_A-1513660",
+    NULL,
+    "SNP_A-1508937",
+    "SNP_A-1511482",
+    "SNP_A-8665144",
+    NULL,
+    "SNP_A-1508081",
+    "SNP_A-8335237",
+    "SNP_A-1653404",
+    "SNP_A-1737894",
+    "SNP_A-1734512",
+    "SNP_A-1694893",
+    "SNP_A-1728511",
+    "SNP_A-1648426",
+    "SNP_A-1510685",
+    "SNP_A-1714699",
+    "SNP_A-1702835",
+    "SNP_A-1715851",
+    "SNP_A-1518598",
+    "SNP_A-1518430",
+    "SNP_A-1508686",
+    "SNP_A-1515762",
+    NULL,
+    "SNP_A-1661518",
+    "SNP_A-1645122",
+    "SNP_A-1516873",
+    "SNP_A-4264660",
+    "SNP_A-1697382",
+    "SNP_A-2228714",
+    "SNP_A-4215028",
+    NULL,
+    NULL,
+    "SNP_A-1514928",
+    "SNP_A-1517898",
+    "SNP_A-1509735",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1757840",
+    NULL,
+    "SNP_A-8316414",
+    "SNP_A-1691350",
+    "SNP_A-1680792",
+    "SNP_A-1641832",
+    "SNP_A-1643325",
+    "SNP_A-1678254",
+    "SNP_A-1714208",
+    "SNP_A-1507495",
+    NULL,
+    NULL,
+    "SNP_A-8545114",
+    "SNP_A-2004535",
+    NULL,
+    "SNP_A-1512957",
+    NULL,
+    "SNP_A-1517864",
+    "SNP_A-1723558",
+    "SNP_A-1517661",
+    "SNP_A-1515549",
+    "SNP_A-1922370",
+    "SNP_A-1510195",
+    "SNP_A-1993687",
+    NULL,
+    "SNP_A-1672772",
+    NULL,
+    "SNP_A-1513379",
+    NULL,
+    "SNP_A-1994920",
+    "SNP_A-1965185",
+    "SNP_A-1513321",
+    "SNP_A-1665826",
+    "SNP_A-4265928",
+    "SNP_A-1515470",
+    "SNP_A-1514396",
+    "SNP_A-1509942",
+    NULL,
+    "SNP_A-1512607",
+    "SNP_A-1977261",
+    "SNP_A-1514282",
+    "SNP_A-1516074",
+    NULL,
+    "SNP_A-8618458",
+    "SNP_A-1519269",
+    "SNP_A-1514142",
+    "SNP_A-1655585",
+    "SNP_A-1756282",
+    "SNP_A-1515092",
+    NULL,
+    "SNP_A-1667238",
+    "SNP_A-1756096",
+    "SNP_A-1516735",
+    "SNP_A-1513009",
+    NULL,
+    "SNP_A-8578662",
+    NULL,
+    "SNP_A-8489428",
+    NULL,
+    "SNP_A-1732794",
+    "SNP_A-1974223",
+    "SNP_A-1673052",
+    "SNP_A-1512968",
+    "SNP_A-1517462",
+    "SNP_A-1650686",
+    "SNP_A-1507422",
+    "SNP_A-1606320",
+    "SNP_A-1510201",
+    "SNP_A-1511212",
+    "SNP_A-1509980",
+    "SNP_A-1663400",
+    "SNP_A-1507703",
+    NULL,
+    "SNP_A-1645788",
+    NULL,
+    NULL,
+    "SNP_A-1647422",
+    "SNP_A-1510388",
+    NULL,
+    "SNP_A-1681950",
+    "SNP_A-1741585",
+    NULL,
+    "SNP_A-8281446",
+    "SNP_A-1756841",
+    "SNP_A-1508154",
+    NULL,
+    "SNP_A-1715637",
+    "SNP_A-1676156",
+    NULL,
+    "SNP_A-1509255",
+    NULL,
+    "SNP_A-1519152",
+    NULL,
+    "SNP_A-1517411",
+    "SNP_A-1518730",
+    "SNP_A-1510927",
+    NULL,
+    "SNP_A-1515532",
+    "SNP_A-1715997",
+    "SNP_A-1516976",
+    "SNP_A-4209208",
+    "SNP_A-4210673",
+    "SNP_A-1510005",
+    NULL,
+    NULL,
+    "SNP_A-1515540",
+    "SNP_A-1511012",
+    "SNP_A-1517747",
+    "SNP_A-1517296",
+    "SNP_A-1518269",
+    "SNP_A-1518408",
+    "SNP_A-8668903",
+    "SNP_A-1515605",
+    "SNP_A-4262624",
+    "SNP_A-2299632",
+    "SNP_A-1514836",
+    "SNP_A-1753043",
+    "SNP_A-1508039",
+    "SNP_A-1519071",
+    "SNP_A-1513638",
+    "SNP_A-8669263",
+    "SNP_A-1514172",
+    "SNP_A-1728489",
+    "SNP_A-2082017",
+    "SNP_A-1757293",
+    NULL,
+    "SNP_A-1511150",
+    NULL,
+    "SNP_A-1511141",
+    "SNP_A-8390433",
+    "SNP_A-1514139",
+    "SNP_A-1510754",
+    "SNP_A-1509538",
+    "SNP_A-1733156",
+    "SNP_A-1510316",
+    NULL,
+    "SNP_A-1514962",
+    "SNP_A-1511329",
+    "SNP_A-8670434",
+    "SNP_A-1509920",
+    "SNP_A-4208937",
+    NULL,
+    NULL,
+    "SNP_A-1518949",
+    "SNP_A-1517865",
+    NULL,
+    NULL,
+    "SNP_A-1507842",
+    "SNP_A-1719163",
+    "SNP_A-1517493",
+    "SNP_A-1511847",
+    NULL,
+    "SNP_A-1518283",
+    "SNP_A-1684038",
+    "SNP_A-1512486",
+    "SNP_A-1509472",
+    "SNP_A-2107448",
+    "SNP_A-1516901",
+    NULL,
+    NULL,
+    "SNP_A-1743853",
+    NULL,
+    "SNP_A-8577885",
+    "SNP_A-1701145",
+    NULL,
+    NULL,
+    "SNP_A-1514765",
+    "SNP_A-1508743",
+    "SNP_A-1516597",
+    NULL,
+    NULL,
+    "SNP_A-1665874",
+    "SNP_A-1516051",
+    NULL,
+    "SNP_A-1727232",
+    "SNP_A-1517616",
+    "SNP_A-1648394",
+    "SNP_A-1664032",
+    "SNP_A-1695943",
+    "SNP_A-1516089",
+    "SNP_A-1745738",
+    "SNP_A-1702279",
+    "SNP_A-1509878",
+    NULL,
+    "SNP_A-8280763",
+    "SNP_A-1519612",
+    "SNP_A-1515975",
+    "SNP_A-1606274",
+    "SNP_A-1508718",
+    "SNP_A-1510140",
+    "SNP_A-1516801",
+    "SNP_A-1996085",
+    "SNP_A-1514790",
+    "SNP_A-1729768",
+    "SNP_A-1752601",
+    "SNP_A-1510157",
+    "SNP_A-1704771",
+    "SNP_A-1519557",
+    "SNP_A-1645850",
+    "SNP_A-1511677",
+    "SNP_A-1739217",
+    "SNP_A-1666472",
+    "SNP_A-1518030",
+    "SNP_A-1757141",
+    "SNP_A-1510868",
+    "SNP_A-1510190",
+    "SNP_A-1511573",
+    NULL,
+    "SNP_A-1514964",
+    "SNP_A-1705467",
+    "SNP_A-1518067",
+    "SNP_A-1741561",
+    "SNP_A-1703481",
+    "SNP_A-1643800",
+    "SNP_A-1680608",
+    "SNP_A-1511264",
+    "SNP_A-1672558",
+    "SNP_A-1671034",
+    "SNP_A-1968096",
+    "SNP_A-1671612",
+    "SNP_A-1704069",
+    "SNP_A-1513725",
+    "SNP_A-1726450",
+    NULL,
+    "SNP_A-1514464",
+    "SNP_A-1741419",
+    "SNP_A-1712127",
+    NULL,
+    "SNP_A-1519713",
+    "SNP_A-1515784",
+    "SNP_A-1515438",
+    NULL,
+    "SNP_A-8576777",
+    NULL,
+    "SNP_A-8687702",
+    "SNP_A-1680482",
+    "SNP_A-1719191",
+    "SNP_A-1513778",
+    "SNP_A-1967293",
+    "SNP_A-1509847",
+    "SNP_A-1713071",
+    "SNP_A-8663816",
+    NULL,
+    "SNP_A-1513429",
+    "SNP_A-1732466",
+    NULL,
+    "SNP_A-1744141",
+    "SNP_A-1667218",
+    "SNP_A-1514317",
+    "SNP_A-1743375",
+    "SNP_A-1757565",
+    "SNP_A-4261507",
+    "SNP_A-1509495",
+    "SNP_A-1742369",
+    NULL,
+    "SNP_A-1726548",
+    "SNP_A-1510078",
+    "SNP_A-1513111",
+    "SNP_A-1704683",
+    "SNP_A-1669949",
+    "SNP_A-4213760",
+    NULL,
+    "SNP_A-1512116",
+    NULL,
+    NULL,
+    "SNP_A-1688786",
+    "SNP_A-1705149",
+    "SNP_A-2073665",
+    "SNP_A-1512317",
+    "SNP_A-1517151",
+    "SNP_A-1509679",
+    "SNP_A-1507630",
+    "SNP_A-1508719",
+    "SNP_A-1509361",
+    "SNP_A-1509695",
+    NULL,
+    NULL,
+    "SNP_A-1688258",
+    "SNP_A-1737351",
+    "SNP_A-8577769",
+    "SNP_A-1652312",
+    "SNP_A-1516005",
+    "SNP_A-1673800",
+    "SNP_A-1517069",
+    "SNP_A-1516860",
+    NULL,
+    "SNP_A-4220055",
+    "SNP_A-1758090",
+    NULL,
+    "SNP_A-1517428",
+    "SNP_A-1743487",
+    "SNP_A-1966327",
+    "SNP_A-1663290",
+    NULL,
+    "SNP_A-1744089",
+    "SNP_A-1751253",
+    "SNP_A-1517239",
+    "SNP_A-1649990",
+    "SNP_A-1686978",
+    NULL,
+    NULL,
+    "SNP_A-1515557",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514235",
+    "SNP_A-1508457",
+    "SNP_A-1509561",
+    "SNP_A-8606928",
+    "SNP_A-1511669",
+    "SNP_A-1655411",
+    "SNP_A-1515884",
+    "SNP_A-1962585",
+    NULL,
+    NULL,
+    "SNP_A-1648672",
+    "SNP_A-8574395",
+    "SNP_A-1513107",
+    "SNP_A-1518817",
+    "SNP_A-1687530",
+    "SNP_A-1741827",
+    NULL,
+    "SNP_A-1515809",
+    "SNP_A-8572819",
+    "SNP_A-1745624",
+    "SNP_A-1975914",
+    "SNP_A-1510680",
+    "SNP_A-1514184",
+    NULL,
+    NULL,
+    "SNP_A-1515469",
+    "SNP_A-1689426",
+    "SNP_A-1642393",
+    "SNP_A-1509870",
+    "SNP_A-1508249",
+    "SNP_A-1736099",
+    "SNP_A-1518286",
+    "SNP_A-1513377",
+    "SNP_A-1512234",
+    "SNP_A-1510095",
+    "SNP_A-1509440",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1976292",
+    "SNP_A-8668576",
+    "SNP_A-1652194",
+    NULL,
+    "SNP_A-8576674",
+    NULL,
+    "SNP_A-1512523",
+    NULL,
+    NULL,
+    "SNP_A-1671278",
+    NULL,
+    "SNP_A-1509918",
+    "SNP_A-1516020",
+    "SNP_A-1509433",
+    "SNP_A-1648864",
+    "SNP_A-2026762",
+    "SNP_A-1683494",
+    "SNP_A-1516364",
+    "SNP_A-1511592",
+    NULL,
+    "SNP_A-1507713",
+    "SNP_A-1998060",
+    NULL,
+    "SNP_A-1509399",
+    "SNP_A-4210907",
+    "SNP_A-1516917",
+    "SNP_A-1752725",
+    "SNP_A-1740921",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1726080",
+    "SNP_A-1508570",
+    "SNP_A-1513355",
+    "SNP_A-1511174",
+    "SNP_A-8667710",
+    "SNP_A-1744513",
+    "SNP_A-1509848",
+    "SNP_A-1642063",
+    "SNP_A-1517225",
+    "SNP_A-1735282",
+    "SNP_A-1514082",
+    "SNP_A-1721792",
+    NULL,
+    NULL,
+    "SNP_A-1683648",
+    "SNP_A-1513789",
+    NULL,
+    "SNP_A-1518196",
+    "SNP_A-1511415",
+    "SNP_A-1839566",
+    NULL,
+    "SNP_A-1507679",
+    "SNP_A-1696050",
+    NULL,
+    "SNP_A-8638386",
+    "SNP_A-1509370",
+    "SNP_A-1738296",
+    "SNP_A-4151885",
+    "SNP_A-8412568",
+    "SNP_A-1735470",
+    NULL,
+    "SNP_A-1519322",
+    "SNP_A-1518239",
+    "SNP_A-1512063",
+    "SNP_A-1509965",
+    "SNP_A-1510150",
+    "SNP_A-8474831",
+    "SNP_A-1518471",
+    NULL,
+    "SNP_A-8284049",
+    "SNP_A-1510399",
+    NULL,
+    NULL,
+    "SNP_A-1984125",
+    "SNP_A-1518553",
+    "SNP_A-1516039",
+    "SNP_A-1656753",
+    "SNP_A-1516983",
+    NULL,
+    "SNP_A-1516473",
+    "SNP_A-1670171",
+    "SNP_A-1641937",
+    "SNP_A-1674833",
+    "SNP_A-1517307",
+    "SNP_A-1516948",
+    "SNP_A-1513666",
+    "SNP_A-1517656",
+    "SNP_A-1678308",
+    "SNP_A-1510997",
+    "SNP_A-1515252",
+    "SNP_A-1651496",
+    NULL,
+    "SNP_A-8572678",
+    "SNP_A-1985929",
+    "SNP_A-1757383",
+    "SNP_A-1967975",
+    "SNP_A-1662454",
+    NULL,
+    "SNP_A-1508126",
+    "SNP_A-1510650",
+    "SNP_A-1759002",
+    "SNP_A-1514739",
+    "SNP_A-4269223",
+    "SNP_A-1515533",
+    "SNP_A-4215188",
+    "SNP_A-4213268",
+    "SNP_A-8670996",
+    "SNP_A-1691930",
+    "SNP_A-1509709",
+    "SNP_A-8631542",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1981068",
+    "SNP_A-1514966",
+    "SNP_A-1511705",
+    NULL,
+    "SNP_A-1517417",
+    "SNP_A-1679734",
+    "SNP_A-1508530",
+    "SNP_A-1509162",
+    "SNP_A-1732457",
+    NULL,
+    "SNP_A-1722644",
+    "SNP_A-1516353",
+    "SNP_A-1515369",
+    "SNP_A-1517210",
+    NULL,
+    "SNP_A-8574027",
+    NULL,
+    "SNP_A-1722725",
+    "SNP_A-1699661",
+    "SNP_A-1965297",
+    "SNP_A-1519047",
+    "SNP_A-1511544",
+    "SNP_A-1518707",
+    "SNP_A-1509719",
+    "SNP_A-1674509",
+    "SNP_A-1515158",
+    "SNP_A-1507783",
+    "SNP_A-8619645",
+    "SNP_A-1511527",
+    "SNP_A-1693076",
+    "SNP_A-1509491",
+    "SNP_A-1514804",
+    NULL,
+    "SNP_A-1509832",
+    "SNP_A-1509311",
+    "SNP_A-4266129",
+    "SNP_A-1511521",
+    "SNP_A-1644398",
+    "SNP_A-1659454",
+    "SNP_A-1675640",
+    "SNP_A-1517044",
+    "SNP_A-1514226",
+    "SNP_A-1507683",
+    NULL,
+    "SNP_A-8339267",
+    "SNP_A-1511254",
+    "SNP_A-1745005",
+    "SNP_A-8335551",
+    NULL,
+    "SNP_A-4208551",
+    NULL,
+    "SNP_A-1515850",
+    "SNP_A-1510074",
+    "SNP_A-1693258",
+    NULL,
+    "SNP_A-1508561",
+    "SNP_A-1508652",
+    "SNP_A-1511491",
+    "SNP_A-1515812",
+    "SNP_A-1515015",
+    "SNP_A-1667078",
+    "SNP_A-1510276",
+    NULL,
+    "SNP_A-1511650",
+    "SNP_A-1515476",
+    "SNP_A-1756901",
+    "SNP_A-1519462",
+    "SNP_A-1518621",
+    "SNP_A-1519224",
+    "SNP_A-4267307",
+    "SNP_A-1514118",
+    "SNP_A-1512287",
+    "SNP_A-1509740",
+    NULL,
+    NULL,
+    "SNP_A-1516716",
+    "SNP_A-1508551",
+    "SNP_A-1517125",
+    "SNP_A-8483880",
+    "SNP_A-1690655",
+    "SNP_A-1514093",
+    NULL,
+    "SNP_A-2073667",
+    "SNP_A-1514801",
+    "SNP_A-1510448",
+    "SNP_A-1698073",
+    "SNP_A-1758866",
+    "SNP_A-1655637",
+    "SNP_A-1662276",
+    "SNP_A-1518881",
+    "SNP_A-1515843",
+    "SNP_A-1511840",
+    NULL,
+    "SNP_A-1512444",
+    "SNP_A-1686490",
+    "SNP_A-1697921",
+    NULL,
+    "SNP_A-1516026",
+    "SNP_A-1514933",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1509506",
+    "SNP_A-1518569",
+    "SNP_A-2250871",
+    NULL,
+    "SNP_A-1646128",
+    "SNP_A-1964397",
+    "SNP_A-1740723",
+    NULL,
+    "SNP_A-1508028",
+    "SNP_A-1671874",
+    "SNP_A-1516023",
+    NULL,
+    "SNP_A-1518608",
+    "SNP_A-1509218",
+    "SNP_A-1751031",
+    "SNP_A-1512188",
+    "SNP_A-1516455",
+    "SNP_A-1681208",
+    "SNP_A-4217165",
+    "SNP_A-1508553",
+    "SNP_A-1742773",
+    "SNP_A-1517037",
+    "SNP_A-1508648",
+    "SNP_A-1519059",
+    "SNP_A-1722708",
+    "SNP_A-1510424",
+    "SNP_A-1518945",
+    "SNP_A-1516558",
+    NULL,
+    "SNP_A-1659348",
+    NULL,
+    "SNP_A-1509052",
+    "SNP_A-1516749",
+    "SNP_A-1516148",
+    "SNP_A-1730847",
+    NULL,
+    NULL,
+    "SNP_A-1653090",
+    "SNP_A-1507615",
+    "SNP_A-1649336",
+    "SNP_A-1721752",
+    "SNP_A-1700267",
+    "SNP_A-4212210",
+    "SNP_A-4271318",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-2088765",
+    "SNP_A-1514839",
+    "SNP_A-8282668",
+    NULL,
+    "SNP_A-4214419",
+    "SNP_A-1508144",
+    "SNP_A-4265820",
+    "SNP_A-8285563",
+    "SNP_A-1517427",
+    "SNP_A-1516284",
+    "SNP_A-1672886",
+    "SNP_A-1508016",
+    "SNP_A-4201778",
+    "SNP_A-1701109",
+    "SNP_A-1507681",
+    "SNP_A-1705683",
+    "SNP_A-1514906",
+    "SNP_A-8665038",
+    "SNP_A-4212069",
+    "SNP_A-1519623",
+    "SNP_A-1709843",
+    "SNP_A-1517345",
+    "SNP_A-1651958",
+    "SNP_A-1513648",
+    "SNP_A-1516898",
+    "SNP_A-2158515",
+    "SNP_A-1513987",
+    "SNP_A-8283098",
+    "SNP_A-1747813",
+    "SNP_A-1737419",
+    "SNP_A-1666494",
+    "SNP_A-1730288",
+    "SNP_A-1507698",
+    "SNP_A-1708336",
+    NULL,
+    NULL,
+    "SNP_A-1659630",
+    "SNP_A-1513755",
+    "SNP_A-1660991",
+    NULL,
+    "SNP_A-1519473",
+    "SNP_A-1511085",
+    "SNP_A-1514153",
+    NULL,
+    "SNP_A-1508950",
+    "SNP_A-1516579",
+    "SNP_A-1508501",
+    "SNP_A-1515496",
+    NULL,
+    NULL,
+    "SNP_A-1517489",
+    "SNP_A-1515241",
+    "SNP_A-1746040",
+    "SNP_A-1512618",
+    "SNP_A-1697837",
+    "SNP_A-1512653",
+    "SNP_A-1518723",
+    "SNP_A-1667542",
+    "SNP_A-1518478",
+    NULL,
+    "SNP_A-1507660",
+    "SNP_A-8627338",
+    NULL,
+    "SNP_A-1733642",
+    "SNP_A-1507501",
+    "SNP_A-1900060",
+    "SNP_A-1757129",
+    "SNP_A-1674853",
+    NULL,
+    "SNP_A-1696684",
+    "SNP_A-1743697",
+    NULL,
+    "SNP_A-1513406",
+    "SNP_A-1672646",
+    NULL,
+    "SNP_A-1681934",
+    "SNP_A-1724900",
+    "SNP_A-4268648",
+    "SNP_A-1656069",
+    "SNP_A-1513997",
+    "SNP_A-1515949",
+    "SNP_A-1519452",
+    NULL,
+    NULL,
+    "SNP_A-1727535",
+    "SNP_A-1513982",
+    "SNP_A-1509774",
+    "SNP_A-1515123",
+    "SNP_A-1507413",
+    "SNP_A-1519521",
+    "SNP_A-1985254",
+    "SNP_A-1512367",
+    "SNP_A-1515754",
+    NULL,
+    "SNP_A-1515216",
+    "SNP_A-1682082",
+    "SNP_A-1515676",
+    "SNP_A-1669321",
+    NULL,
+    "SNP_A-1715301",
+    "SNP_A-1511343",
+    "SNP_A-1675385",
+    "SNP_A-1508394",
+    "SNP_A-2013965",
+    NULL,
+    "SNP_A-1712417",
+    "SNP_A-1516433",
+    "SNP_A-1512427",
+    "SNP_A-1724178",
+    "SNP_A-1684360",
+    "SNP_A-1741119",
+    "SNP_A-1518968",
+    NULL,
+    "SNP_A-1998398",
+    "SNP_A-1514468",
+    "SNP_A-1675716",
+    NULL,
+    NULL,
+    "SNP_A-1743005",
+    "SNP_A-1687404",
+    "SNP_A-1743565",
+    "SNP_A-1680996",
+    "SNP_A-1518496",
+    "SNP_A-1518215",
+    "SNP_A-1667166",
+    "SNP_A-1728673",
+    "SNP_A-1682226",
+    "SNP_A-1509413",
+    "SNP_A-1516616",
+    NULL,
+    "SNP_A-1999548",
+    "SNP_A-1514704",
+    "SNP_A-1721722",
+    "SNP_A-1650268",
+    "SNP_A-1517209",
+    "SNP_A-1665620",
+    NULL,
+    "SNP_A-1518292",
+    "SNP_A-1518861",
+    "SNP_A-4210906",
+    "SNP_A-1733012",
+    "SNP_A-1507819",
+    NULL,
+    "SNP_A-1974333",
+    NULL,
+    "SNP_A-1511222",
+    "SNP_A-1680586",
+    "SNP_A-1513139",
+    "SNP_A-1673012",
+    "SNP_A-1734088",
+    "SNP_A-1735863",
+    "SNP_A-8579789",
+    "SNP_A-1717891",
+    NULL,
+    "SNP_A-1681786",
+    "SNP_A-1698883",
+    "SNP_A-1510689",
+    "SNP_A-1513419",
+    "SNP_A-1513447",
+    "SNP_A-1512694",
+    "SNP_A-2266015",
+    "SNP_A-4282402",
+    "SNP_A-8667127",
+    "SNP_A-1664578",
+    "SNP_A-1510468",
+    "SNP_A-1695261",
+    "SNP_A-1507477",
+    NULL,
+    "SNP_A-1507965",
+    "SNP_A-1712915",
+    "SNP_A-1509249",
+    "SNP_A-1729474",
+    "SNP_A-1515029",
+    "SNP_A-1511347",
+    "SNP_A-1510091",
+    "SNP_A-4263520",
+    NULL,
+    NULL,
+    "SNP_A-1510616",
+    "SNP_A-1509477",
+    "SNP_A-1682004",
+    "SNP_A-1515661",
+    "SNP_A-1975414",
+    "SNP_A-1509642",
+    "SNP_A-1513910",
+    "SNP_A-1731079",
+    "SNP_A-1737864",
+    NULL,
+    "SNP_A-1729364",
+    "SNP_A-1666676",
+    "SNP_A-1516439",
+    "SNP_A-1515815",
+    "SNP_A-1517196",
+    "SNP_A-1516391",
+    "SNP_A-1697833",
+    NULL,
+    "SNP_A-1508158",
+    "SNP_A-1698149",
+    "SNP_A-8375918",
+    "SNP_A-1513776",
+    "SNP_A-1658444",
+    "SNP_A-1508981",
+    "SNP_A-1513915",
+    "SNP_A-1654391",
+    "SNP_A-4267837",
+    "SNP_A-4286136",
+    "SNP_A-1671912",
+    "SNP_A-2100306",
+    NULL,
+    NULL,
+    "SNP_A-1510733",
+    "SNP_A-1515832",
+    "SNP_A-1684288",
+    NULL,
+    "SNP_A-1511749",
+    "SNP_A-1739941",
+    "SNP_A-8422438",
+    "SNP_A-1509432",
+    "SNP_A-1519632",
+    "SNP_A-1516321",
+    "SNP_A-1668745",
+    "SNP_A-1514782",
+    "SNP_A-1649686",
+    "SNP_A-1507836",
+    "SNP_A-1517787",
+    "SNP_A-1657994",
+    "SNP_A-1518057",
+    "SNP_A-1510575",
+    "SNP_A-1725222",
+    "SNP_A-1962936",
+    NULL,
+    "SNP_A-1510060",
+    "SNP_A-1512566",
+    "SNP_A-1509984",
+    "SNP_A-1665238",
+    NULL,
+    "SNP_A-4214070",
+    "SNP_A-1508626",
+    NULL,
+    "SNP_A-1686578",
+    "SNP_A-1508088",
+    NULL,
+    "SNP_A-8442992",
+    "SNP_A-1704851",
+    "SNP_A-4196664",
+    "SNP_A-1511157",
+    "SNP_A-1518200",
+    "SNP_A-1517022",
+    "SNP_A-1666394",
+    "SNP_A-1515511",
+    NULL,
+    "SNP_A-1513246",
+    NULL,
+    "SNP_A-8377329",
+    "SNP_A-1511633",
+    "SNP_A-1510699",
+    "SNP_A-8596138",
+    "SNP_A-1512713",
+    "SNP_A-1518297",
+    NULL,
+    "SNP_A-1515373",
+    "SNP_A-1517507",
+    NULL,
+    "SNP_A-1513965",
+    "SNP_A-1721614",
+    "SNP_A-1508116",
+    NULL,
+    "SNP_A-1515586",
+    "SNP_A-1748919",
+    "SNP_A-1507562",
+    NULL,
+    NULL,
+    "SNP_A-8572273",
+    "SNP_A-1642067",
+    "SNP_A-1669933",
+    "SNP_A-4229173",
+    "SNP_A-4208853",
+    "SNP_A-1517850",
+    NULL,
+    "SNP_A-1705773",
+    NULL,
+    "SNP_A-1513999",
+    "SNP_A-1975641",
+    "SNP_A-4160360",
+    "SNP_A-1710666",
+    "SNP_A-1739629",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1518534",
+    "SNP_A-1511015",
+    NULL,
+    "SNP_A-1513947",
+    "SNP_A-1518885",
+    NULL,
+    "SNP_A-1651544",
+    NULL,
+    "SNP_A-1730791",
+    "SNP_A-1519402",
+    "SNP_A-1974074",
+    "SNP_A-1511443",
+    "SNP_A-1645498",
+    NULL,
+    "SNP_A-4262989",
+    "SNP_A-1991224",
+    "SNP_A-1689899",
+    "SNP_A-1511393",
+    "SNP_A-8588267",
+    "SNP_A-4220670",
+    "SNP_A-1963384",
+    "SNP_A-4243762",
+    "SNP_A-1512550",
+    "SNP_A-1680976",
+    "SNP_A-1736081",
+    "SNP_A-1513167",
+    "SNP_A-1514488",
+    "SNP_A-1725516",
+    "SNP_A-1654183",
+    "SNP_A-1513492",
+    "SNP_A-1695547",
+    "SNP_A-1516847",
+    "SNP_A-1515050",
+    "SNP_A-1515413",
+    "SNP_A-1513701",
+    "SNP_A-1667336",
+    "SNP_A-1517311",
+    "SNP_A-1516307",
+    "SNP_A-1519581",
+    "SNP_A-1518514",
+    "SNP_A-1509322",
+    "SNP_A-1514948",
+    NULL,
+    "SNP_A-1518772",
+    NULL,
+    "SNP_A-8651846",
+    "SNP_A-1711116",
+    "SNP_A-2012121",
+    "SNP_A-1723306",
+    NULL,
+    "SNP_A-1510507",
+    "SNP_A-1512140",
+    "SNP_A-1509476",
+    NULL,
+    "SNP_A-1707495",
+    "SNP_A-1510979",
+    "SNP_A-1726830",
+    "SNP_A-1970788",
+    "SNP_A-1510002",
+    "SNP_A-1678824",
+    "SNP_A-1652588",
+    "SNP_A-1509149",
+    "SNP_A-1739065",
+    "SNP_A-1670345",
+    NULL,
+    NULL,
+    "SNP_A-1507765",
+    "SNP_A-1518582",
+    "SNP_A-1642767",
+    "SNP_A-1511314",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1757339",
+    "SNP_A-1509331",
+    "SNP_A-1510901",
+    NULL,
+    "SNP_A-1512987",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516345",
+    "SNP_A-1512138",
+    "SNP_A-1507693",
+    NULL,
+    "SNP_A-1697210",
+    "SNP_A-1707844",
+    "SNP_A-4212188",
+    NULL,
+    NULL,
+    "SNP_A-1510049",
+    "SNP_A-1712237",
+    NULL,
+    "SNP_A-1668064",
+    NULL,
+    "SNP_A-1510562",
+    "SNP_A-1512422",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1664378",
+    "SNP_A-1519542",
+    NULL,
+    "SNP_A-1512615",
+    "SNP_A-1510433",
+    "SNP_A-2162287",
+    "SNP_A-1724538",
+    "SNP_A-1518522",
+    "SNP_A-1515994",
+    "SNP_A-1514587",
+    NULL,
+    "SNP_A-1508184",
+    NULL,
+    "SNP_A-1508414",
+    "SNP_A-1518368",
+    NULL,
+    "SNP_A-1686036",
+    "SNP_A-1665026",
+    "SNP_A-1665236",
+    "SNP_A-1673166",
+    "SNP_A-8335428",
+    NULL,
+    "SNP_A-1512722",
+    "SNP_A-1518441",
+    "SNP_A-1698383",
+    NULL,
+    "SNP_A-1519725",
+    "SNP_A-1507847",
+    "SNP_A-1508593",
+    "SNP_A-1512939",
+    "SNP_A-8290893",
+    "SNP_A-1673552",
+    "SNP_A-1512130",
+    NULL,
+    "SNP_A-1508318",
+    "SNP_A-1507771",
+    NULL,
+    "SNP_A-8573455",
+    "SNP_A-1515062",
+    "SNP_A-1756967",
+    "SNP_A-1510077",
+    "SNP_A-8577614",
+    "SNP_A-1750431",
+    "SNP_A-1513114",
+    "SNP_A-1514182",
+    "SNP_A-1510383",
+    "SNP_A-1728231",
+    "SNP_A-1516437",
+    "SNP_A-1728687",
+    "SNP_A-1718167",
+    "SNP_A-1507962",
+    "SNP_A-1507628",
+    "SNP_A-1517593",
+    "SNP_A-4265643",
+    "SNP_A-1516655",
+    "SNP_A-1510862",
+    "SNP_A-1687174",
+    NULL,
+    "SNP_A-1989988",
+    "SNP_A-1511372",
+    NULL,
+    "SNP_A-1511066",
+    "SNP_A-1515479",
+    NULL,
+    "SNP_A-1647038",
+    "SNP_A-1508349",
+    "SNP_A-1515364",
+    "SNP_A-2163280",
+    "SNP_A-1742883",
+    "SNP_A-1982519",
+    "SNP_A-1510426",
+    "SNP_A-1518128",
+    "SNP_A-1991262",
+    "SNP_A-1649766",
+    "SNP_A-1735426",
+    NULL,
+    "SNP_A-1516205",
+    "SNP_A-8618031",
+    "SNP_A-1735759",
+    "SNP_A-1509955",
+    "SNP_A-1739281",
+    NULL,
+    "SNP_A-1515720",
+    "SNP_A-1514800",
+    "SNP_A-1515995",
+    "SNP_A-1744833",
+    "SNP_A-1735765",
+    NULL,
+    "SNP_A-1517404",
+    "SNP_A-1517381",
+    "SNP_A-1647674",
+    "SNP_A-1656975",
+    "SNP_A-1671048",
+    "SNP_A-1654002",
+    "SNP_A-2170439",
+    "SNP_A-1518298",
+    "SNP_A-1687334",
+    "SNP_A-8577268",
+    "SNP_A-1683608",
+    "SNP_A-1701549",
+    "SNP_A-1713207",
+    "SNP_A-1516745",
+    NULL,
+    "SNP_A-2006416",
+    "SNP_A-1518729",
+    "SNP_A-1651622",
+    "SNP_A-1513344",
+    "SNP_A-8381984",
+    "SNP_A-4299668",
+    "SNP_A-1511576",
+    "SNP_A-1511726",
+    NULL,
+    "SNP_A-1507684",
+    "SNP_A-4213705",
+    NULL,
+    "SNP_A-1712151",
+    NULL,
+    "SNP_A-1511247",
+    NULL,
+    "SNP_A-1986741",
+    "SNP_A-1736159",
+    "SNP_A-4210992",
+    "SNP_A-1513067",
+    "SNP_A-1515979",
+    "SNP_A-1963242",
+    "SNP_A-1517640",
+    "SNP_A-1519576",
+    "SNP_A-1510382",
+    "SNP_A-1519541",
+    NULL,
+    "SNP_A-1511251",
+    "SNP_A-1517147",
+    "SNP_A-8471075",
+    "SNP_A-1997769",
+    "SNP_A-1606306",
+    "SNP_A-4268855",
+    NULL,
+    "SNP_A-1721083",
+    "SNP_A-1686600",
+    "SNP_A-1979481",
+    "SNP_A-1714877",
+    "SNP_A-1712203",
+    "SNP_A-1749895",
+    "SNP_A-1515821",
+    "SNP_A-1758423",
+    "SNP_A-1971436",
+    "SNP_A-1693603",
+    "SNP_A-4156526",
+    "SNP_A-1518182",
+    NULL,
+    "SNP_A-1509214",
+    NULL,
+    "SNP_A-1519365",
+    "SNP_A-1672456",
+    "SNP_A-1518195",
+    "SNP_A-1649838",
+    NULL,
+    NULL,
+    "SNP_A-1518211",
+    "SNP_A-1699823",
+    "SNP_A-1517524",
+    "SNP_A-8284775",
+    "SNP_A-1673106",
+    "SNP_A-1685710",
+    "SNP_A-1507406",
+    "SNP_A-4262899",
+    "SNP_A-1652752",
+    NULL,
+    "SNP_A-1757960",
+    NULL,
+    "SNP_A-1662986",
+    "SNP_A-1718377",
+    "SNP_A-1733425",
+    "SNP_A-1695611",
+    "SNP_A-1518575",
+    NULL,
+    "SNP_A-1716631",
+    "SNP_A-1511817",
+    "SNP_A-1519013",
+    "SNP_A-8661901",
+    "SNP_A-1516377",
+    "SNP_A-1514421",
+    "SNP_A-1516442",
+    "SNP_A-1679544",
+    "SNP_A-1510904",
+    "SNP_A-1753339",
+    "SNP_A-1669261",
+    "SNP_A-4211159",
+    "SNP_A-1668454",
+    NULL,
+    NULL,
+    "SNP_A-1514169",
+    "SNP_A-1676772",
+    NULL,
+    "SNP_A-2011836",
+    "SNP_A-1515608",
+    NULL,
+    "SNP_A-1722340",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514260",
+    "SNP_A-2172988",
+    "SNP_A-1606273",
+    "SNP_A-1680086",
+    "SNP_A-1665064",
+    NULL,
+    "SNP_A-1519094",
+    "SNP_A-1711520",
+    "SNP_A-1687216",
+    "SNP_A-1748613",
+    NULL,
+    "SNP_A-8621458",
+    "SNP_A-4262450",
+    "SNP_A-1697717",
+    "SNP_A-1753771",
+    NULL,
+    "SNP_A-1514112",
+    NULL,
+    NULL,
+    "SNP_A-1510257",
+    "SNP_A-1988139",
+    "SNP_A-1510818",
+    "SNP_A-1746687",
+    "SNP_A-1516562",
+    NULL,
+    "SNP_A-1515550",
+    "SNP_A-1511750",
+    "SNP_A-1662646",
+    "SNP_A-1507409",
+    "SNP_A-1514987",
+    "SNP_A-1751529",
+    "SNP_A-4268070",
+    NULL,
+    "SNP_A-1732043",
+    "SNP_A-1515354",
+    "SNP_A-1512497",
+    "SNP_A-1513018",
+    "SNP_A-1513707",
+    "SNP_A-1668224",
+    "SNP_A-1739933",
+    "SNP_A-1513221",
+    "SNP_A-1697971",
+    "SNP_A-1516722",
+    "SNP_A-4269333",
+    "SNP_A-1519088",
+    "SNP_A-1752001",
+    NULL,
+    "SNP_A-1511607",
+    "SNP_A-1729798",
+    NULL,
+    "SNP_A-1518015",
+    "SNP_A-1512800",
+    NULL,
+    NULL,
+    "SNP_A-1695941",
+    "SNP_A-1744849",
+    "SNP_A-8668929",
+    "SNP_A-1519310",
+    "SNP_A-1507331",
+    "SNP_A-8578650",
+    "SNP_A-1686700",
+    "SNP_A-1986099",
+    NULL,
+    "SNP_A-8496458",
+    "SNP_A-1684134",
+    "SNP_A-1517093",
+    NULL,
+    NULL,
+    "SNP_A-1512405",
+    NULL,
+    "SNP_A-1517321",
+    "SNP_A-1511205",
+    "SNP_A-1513055",
+    "SNP_A-1700131",
+    "SNP_A-1518589",
+    "SNP_A-4212060",
+    "SNP_A-1514621",
+    NULL,
+    "SNP_A-1508499",
+    "SNP_A-1516577",
+    NULL,
+    "SNP_A-8710955",
+    "SNP_A-1508060",
+    "SNP_A-1755950",
+    "SNP_A-1507394",
+    "SNP_A-1517358",
+    "SNP_A-1741925",
+    "SNP_A-1509382",
+    NULL,
+    "SNP_A-1516389",
+    "SNP_A-1757769",
+    "SNP_A-1519103",
+    "SNP_A-1515795",
+    "SNP_A-1733918",
+    NULL,
+    NULL,
+    "SNP_A-1515004",
+    "SNP_A-4212373",
+    NULL,
+    "SNP_A-1515463",
+    "SNP_A-1668032",
+    "SNP_A-1699729",
+    NULL,
+    "SNP_A-1518855",
+    "SNP_A-1669121",
+    "SNP_A-1511739",
+    "SNP_A-1518550",
+    NULL,
+    "SNP_A-1519292",
+    "SNP_A-1509822",
+    NULL,
+    NULL,
+    "SNP_A-1508401",
+    "SNP_A-1681532",
+    "SNP_A-1747831",
+    "SNP_A-1515437",
+    "SNP_A-4213114",
+    "SNP_A-1517139",
+    "SNP_A-1734668",
+    "SNP_A-1515615",
+    "SNP_A-1516994",
+    "SNP_A-1517669",
+    NULL,
+    "SNP_A-1513096",
+    "SNP_A-1688092",
+    "SNP_A-1513813",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1512001",
+    NULL,
+    "SNP_A-1720733",
+    "SNP_A-4241829",
+    "SNP_A-1983612",
+    "SNP_A-1509692",
+    "SNP_A-1516521",
+    "SNP_A-1508153",
+    "SNP_A-1516748",
+    "SNP_A-1510808",
+    NULL,
+    "SNP_A-1516780",
+    "SNP_A-1513402",
+    "SNP_A-1512004",
+    "SNP_A-1516322",
+    "SNP_A-8338982",
+    "SNP_A-1757745",
+    "SNP_A-1515628",
+    NULL,
+    "SNP_A-1682390",
+    "SNP_A-1512409",
+    "SNP_A-1517265",
+    "SNP_A-1694161",
+    "SNP_A-1646692",
+    NULL,
+    "SNP_A-4262252",
+    NULL,
+    "SNP_A-2024717",
+    "SNP_A-1513526",
+    "SNP_A-1731897",
+    "SNP_A-1517138",
+    NULL,
+    NULL,
+    "SNP_A-1749119",
+    "SNP_A-1736369",
+    "SNP_A-1696180",
+    "SNP_A-1517204",
+    "SNP_A-1642551",
+    "SNP_A-1668092",
+    "SNP_A-1702441",
+    NULL,
+    "SNP_A-1735925",
+    "SNP_A-8617303",
+    "SNP_A-1510947",
+    "SNP_A-1509729",
+    "SNP_A-1511672",
+    "SNP_A-4232906",
+    "SNP_A-1514436",
+    "SNP_A-1713474",
+    "SNP_A-1517626",
+    "SNP_A-1518285",
+    "SNP_A-1515574",
+    "SNP_A-4210349",
+    "SNP_A-1756120",
+    "SNP_A-1510870",
+    NULL,
+    "SNP_A-1510787",
+    NULL,
+    "SNP_A-1518763",
+    "SNP_A-4202276",
+    "SNP_A-1514088",
+    "SNP_A-1998468",
+    NULL,
+    "SNP_A-1509034",
+    "SNP_A-1514822",
+    "SNP_A-1715389",
+    "SNP_A-1508089",
+    "SNP_A-1510469",
+    "SNP_A-1516329",
+    "SNP_A-1508020",
+    "SNP_A-2185111",
+    "SNP_A-1713888",
+    "SNP_A-1510579",
+    "SNP_A-1714479",
+    NULL,
+    NULL,
+    "SNP_A-8666389",
+    "SNP_A-1509027",
+    "SNP_A-1672054",
+    "SNP_A-1732137",
+    NULL,
+    "SNP_A-1987418",
+    "SNP_A-1510898",
+    "SNP_A-1512802",
+    NULL,
+    "SNP_A-1514604",
+    "SNP_A-1606315",
+    "SNP_A-1508169",
+    "SNP_A-4266856",
+    "SNP_A-1511294",
+    "SNP_A-1516363",
+    "SNP_A-1507809",
+    "SNP_A-1672894",
+    "SNP_A-1657301",
+    "SNP_A-1673790",
+    "SNP_A-1746004",
+    "SNP_A-1514109",
+    "SNP_A-8287692",
+    NULL,
+    "SNP_A-1509145",
+    "SNP_A-1510846",
+    "SNP_A-1515343",
+    "SNP_A-1987273",
+    "SNP_A-1993607",
+    "SNP_A-1720809",
+    "SNP_A-1699167",
+    "SNP_A-1972753",
+    "SNP_A-1508223",
+    "SNP_A-1508411",
+    "SNP_A-1665268",
+    "SNP_A-1658134",
+    NULL,
+    NULL,
+    "SNP_A-1515541",
+    "SNP_A-1738322",
+    "SNP_A-2121272",
+    NULL,
+    "SNP_A-1518024",
+    "SNP_A-1509831",
+    "SNP_A-1516301",
+    "SNP_A-1515120",
+    NULL,
+    "SNP_A-8280689",
+    "SNP_A-1511953",
+    "SNP_A-1515803",
+    "SNP_A-1510757",
+    NULL,
+    "SNP_A-1516772",
+    "SNP_A-1710876",
+    NULL,
+    "SNP_A-1510230",
+    "SNP_A-1658572",
+    "SNP_A-1516639",
+    "SNP_A-1717737",
+    "SNP_A-1509808",
+    "SNP_A-1962856",
+    "SNP_A-1642951",
+    "SNP_A-1748197",
+    "SNP_A-1518703",
+    "SNP_A-1514291",
+    "SNP_A-1509449",
+    NULL,
+    "SNP_A-1722118",
+    "SNP_A-1514618",
+    "SNP_A-4209249",
+    "SNP_A-1658644",
+    NULL,
+    "SNP_A-1755100",
+    "SNP_A-4266041",
+    "SNP_A-1744289",
+    "SNP_A-1708641",
+    "SNP_A-1514438",
+    "SNP_A-1516289",
+    NULL,
+    "SNP_A-1516077",
+    "SNP_A-1514536",
+    NULL,
+    "SNP_A-8621412",
+    "SNP_A-1737565",
+    "SNP_A-1750137",
+    NULL,
+    "SNP_A-1748157",
+    "SNP_A-1508260",
+    "SNP_A-1643580",
+    "SNP_A-1983974",
+    "SNP_A-1681352",
+    "SNP_A-1518747",
+    "SNP_A-1668913",
+    "SNP_A-1710590",
+    NULL,
+    "SNP_A-1515293",
+    NULL,
+    "SNP_A-1693929",
+    NULL,
+    "SNP_A-1514923",
+    "SNP_A-1651742",
+    NULL,
+    "SNP_A-1720799",
+    NULL,
+    "SNP_A-1515150",
+    NULL,
+    "SNP_A-1736175",
+    "SNP_A-1508268",
+    "SNP_A-1665428",
+    "SNP_A-1518821",
+    NULL,
+    "SNP_A-1508834",
+    NULL,
+    "SNP_A-1518363",
+    "SNP_A-1513681",
+    NULL,
+    "SNP_A-1510245",
+    "SNP_A-1758941",
+    "SNP_A-1724804",
+    "SNP_A-1654667",
+    "SNP_A-8618075",
+    "SNP_A-1515612",
+    "SNP_A-1511644",
+    "SNP_A-1510447",
+    "SNP_A-4263793",
+    NULL,
+    "SNP_A-1743079",
+    "SNP_A-1674149",
+    "SNP_A-1713177",
+    "SNP_A-8617391",
+    NULL,
+    "SNP_A-1708164",
+    "SNP_A-1645680",
+    "SNP_A-1519659",
+    NULL,
+    "SNP_A-1653240",
+    "SNP_A-1515984",
+    "SNP_A-1681228",
+    "SNP_A-1511841",
+    "SNP_A-1516878",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1511408",
+    "SNP_A-1519754",
+    "SNP_A-1510705",
+    "SNP_A-1738979",
+    "SNP_A-1685494",
+    "SNP_A-1513561",
+    "SNP_A-1742999",
+    "SNP_A-1711516",
+    "SNP_A-1678886",
+    NULL,
+    "SNP_A-1735897",
+    "SNP_A-1515772",
+    NULL,
+    "SNP_A-1518255",
+    "SNP_A-1516093",
+    "SNP_A-1653940",
+    "SNP_A-1651486",
+    "SNP_A-1988723",
+    "SNP_A-1646402",
+    "SNP_A-1515579",
+    "SNP_A-1515871",
+    NULL,
+    "SNP_A-1508328",
+    "SNP_A-1606342",
+    "SNP_A-1514795",
+    "SNP_A-1673486",
+    "SNP_A-1515423",
+    "SNP_A-1738563",
+    "SNP_A-1516924",
+    NULL,
+    "SNP_A-1727240",
+    "SNP_A-4211511",
+    "SNP_A-1513515",
+    "SNP_A-1511799",
+    "SNP_A-1690405",
+    "SNP_A-1651694",
+    "SNP_A-1708869",
+    NULL,
+    "SNP_A-8685917",
+    "SNP_A-8476391",
+    "SNP_A-1514171",
+    "SNP_A-1976915",
+    "SNP_A-1514766",
+    "SNP_A-1717899",
+    "SNP_A-1518367",
+    NULL,
+    "SNP_A-1514243",
+    "SNP_A-1758633",
+    "SNP_A-1738829",
+    "SNP_A-1517497",
+    "SNP_A-1513319",
+    "SNP_A-1517622",
+    "SNP_A-1700853",
+    NULL,
+    "SNP_A-1518716",
+    "SNP_A-1758377",
+    "SNP_A-1748801",
+    "SNP_A-8579224",
+    "SNP_A-1518975",
+    NULL,
+    "SNP_A-8572688",
+    "SNP_A-1508641",
+    "SNP_A-1511384",
+    "SNP_A-4268325",
+    "SNP_A-1650660",
+    "SNP_A-1518604",
+    "SNP_A-1977835",
+    "SNP_A-1515643",
+    "SNP_A-1513440",
+    "SNP_A-1673962",
+    NULL,
+    "SNP_A-1670185",
+    "SNP_A-4207989",
+    "SNP_A-1518789",
+    "SNP_A-1684072",
+    "SNP_A-1747051",
+    "SNP_A-4240425",
+    "SNP_A-1518692",
+    "SNP_A-1646218",
+    "SNP_A-1517095",
+    "SNP_A-8283458",
+    "SNP_A-1647590",
+    "SNP_A-1512306",
+    "SNP_A-1517388",
+    "SNP_A-1757452",
+    "SNP_A-1673476",
+    NULL,
+    "SNP_A-1513328",
+    "SNP_A-1687046",
+    NULL,
+    "SNP_A-1733350",
+    "SNP_A-4229009",
+    NULL,
+    "SNP_A-1663606",
+    NULL,
+    "SNP_A-1708108",
+    "SNP_A-1514698",
+    "SNP_A-1513142",
+    "SNP_A-1518923",
+    "SNP_A-1752815",
+    "SNP_A-1517054",
+    "SNP_A-8668314",
+    "SNP_A-1514937",
+    "SNP_A-1511582",
+    NULL,
+    "SNP_A-1698145",
+    NULL,
+    "SNP_A-1643948",
+    "SNP_A-1517028",
+    "SNP_A-1513933",
+    "SNP_A-1995028",
+    "SNP_A-1682630",
+    "SNP_A-1697953",
+    "SNP_A-1510601",
+    "SNP_A-1659698",
+    "SNP_A-1511778",
+    "SNP_A-1513801",
+    "SNP_A-1673036",
+    NULL,
+    NULL,
+    "SNP_A-1732241",
+    "SNP_A-1970567",
+    "SNP_A-1666356",
+    NULL,
+    "SNP_A-1517664",
+    "SNP_A-1515488",
+    "SNP_A-1701195",
+    NULL,
+    "SNP_A-1515893",
+    "SNP_A-1515732",
+    "SNP_A-1516001",
+    "SNP_A-1517073",
+    NULL,
+    "SNP_A-1515575",
+    "SNP_A-1509340",
+    NULL,
+    "SNP_A-4235267",
+    "SNP_A-1508151",
+    "SNP_A-1519694",
+    "SNP_A-1687126",
+    "SNP_A-8414857",
+    "SNP_A-1512000",
+    NULL,
+    "SNP_A-1658180",
+    "SNP_A-1726378",
+    "SNP_A-1509917",
+    "SNP_A-1519416",
+    "SNP_A-1518908",
+    "SNP_A-8456791",
+    "SNP_A-1715363",
+    NULL,
+    "SNP_A-1518063",
+    "SNP_A-1515456",
+    "SNP_A-1735957",
+    "SNP_A-4214416",
+    NULL,
+    "SNP_A-1673398",
+    NULL,
+    "SNP_A-1515714",
+    NULL,
+    "SNP_A-8574187",
+    "SNP_A-1518228",
+    "SNP_A-1754172",
+    "SNP_A-1672852",
+    "SNP_A-1752889",
+    "SNP_A-1748635",
+    NULL,
+    "SNP_A-1750667",
+    "SNP_A-1516112",
+    "SNP_A-1517251",
+    "SNP_A-1509421",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1691204",
+    "SNP_A-1515506",
+    "SNP_A-1511147",
+    "SNP_A-1698169",
+    "SNP_A-2011670",
+    "SNP_A-1508922",
+    "SNP_A-1675049",
+    "SNP_A-1755946",
+    NULL,
+    NULL,
+    "SNP_A-1720627",
+    "SNP_A-1510999",
+    "SNP_A-1509330",
+    "SNP_A-1509156",
+    "SNP_A-1701617",
+    NULL,
+    "SNP_A-2103970",
+    "SNP_A-1513325",
+    "SNP_A-1509927",
+    "SNP_A-1698525",
+    "SNP_A-1512467",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1606314",
+    "SNP_A-4266457",
+    "SNP_A-1712281",
+    NULL,
+    "SNP_A-1508053",
+    "SNP_A-1518530",
+    "SNP_A-1740077",
+    "SNP_A-1509974",
+    "SNP_A-1513759",
+    "SNP_A-1678636",
+    "SNP_A-1748593",
+    "SNP_A-8575624",
+    "SNP_A-8503524",
+    "SNP_A-1668546",
+    NULL,
+    NULL,
+    "SNP_A-1704303",
+    "SNP_A-1963641",
+    NULL,
+    "SNP_A-1515454",
+    "SNP_A-1512055",
+    "SNP_A-8667163",
+    "SNP_A-1509552",
+    "SNP_A-1745021",
+    "SNP_A-1688138",
+    "SNP_A-1508100",
+    "SNP_A-1512762",
+    "SNP_A-1515846",
+    "SNP_A-8531717",
+    "SNP_A-8286427",
+    "SNP_A-8701386",
+    NULL,
+    "SNP_A-1507748",
+    "SNP_A-1689743",
+    NULL,
+    "SNP_A-1515447",
+    "SNP_A-4264332",
+    "SNP_A-1705203",
+    "SNP_A-8667713",
+    "SNP_A-1510653",
+    "SNP_A-4214239",
+    "SNP_A-1715683",
+    "SNP_A-1653160",
+    "SNP_A-1509804",
+    "SNP_A-1516545",
+    "SNP_A-1705401",
+    "SNP_A-1693751",
+    NULL,
+    "SNP_A-1671094",
+    "SNP_A-1516548",
+    NULL,
+    NULL,
+    "SNP_A-1691246",
+    "SNP_A-4279718",
+    "SNP_A-1514899",
+    NULL,
+    "SNP_A-1509339",
+    "SNP_A-1507449",
+    "SNP_A-1683738",
+    NULL,
+    "SNP_A-1705905",
+    NULL,
+    "SNP_A-1701073",
+    "SNP_A-1675732",
+    "SNP_A-1733846",
+    "SNP_A-1516133",
+    "SNP_A-1715065",
+    "SNP_A-1508329",
+    NULL,
+    "SNP_A-1709151",
+    NULL,
+    "SNP_A-1512709",
+    "SNP_A-1719616",
+    "SNP_A-1516436",
+    NULL,
+    "SNP_A-1508033",
+    "SNP_A-1508338",
+    "SNP_A-1509618",
+    "SNP_A-1642021",
+    "SNP_A-1515807",
+    NULL,
+    NULL,
+    "SNP_A-1512742",
+    "SNP_A-4261958",
+    "SNP_A-1518293",
+    "SNP_A-1515060",
+    "SNP_A-1682914",
+    "SNP_A-1972733",
+    "SNP_A-1998569",
+    "SNP_A-1507963",
+    NULL,
+    "SNP_A-1695203",
+    NULL,
+    "SNP_A-8286335",
+    "SNP_A-1662948",
+    "SNP_A-1516715",
+    "SNP_A-8653326",
+    "SNP_A-1731097",
+    NULL,
+    "SNP_A-1699925",
+    NULL,
+    NULL,
+    "SNP_A-8491929",
+    "SNP_A-1648774",
+    "SNP_A-1512164",
+    NULL,
+    "SNP_A-1508379",
+    NULL,
+    "SNP_A-1688990",
+    "SNP_A-1670482",
+    "SNP_A-8354951",
+    "SNP_A-1710870",
+    NULL,
+    "SNP_A-1511781",
+    NULL,
+    NULL,
+    "SNP_A-1510282",
+    "SNP_A-1659694",
+    "SNP_A-4201088",
+    "SNP_A-1514202",
+    "SNP_A-1782432",
+    "SNP_A-1673596",
+    NULL,
+    "SNP_A-1745542",
+    "SNP_A-1511233",
+    "SNP_A-1514625",
+    "SNP_A-1966098",
+    NULL,
+    "SNP_A-1650812",
+    "SNP_A-1512926",
+    "SNP_A-1512729",
+    "SNP_A-1696236",
+    "SNP_A-1509801",
+    "SNP_A-1649072",
+    "SNP_A-8621221",
+    "SNP_A-1512885",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1707786",
+    "SNP_A-1697062",
+    "SNP_A-8620099",
+    "SNP_A-1660947",
+    "SNP_A-1716689",
+    "SNP_A-1515322",
+    "SNP_A-1695607",
+    "SNP_A-1695605",
+    "SNP_A-1667450",
+    "SNP_A-1967779",
+    "SNP_A-1511747",
+    "SNP_A-1519114",
+    "SNP_A-1517729",
+    "SNP_A-1678384",
+    "SNP_A-1981693",
+    "SNP_A-8282782",
+    "SNP_A-1736811",
+    "SNP_A-1518477",
+    "SNP_A-1507949",
+    "SNP_A-1756056",
+    "SNP_A-1510586",
+    "SNP_A-1512280",
+    NULL,
+    NULL,
+    "SNP_A-1991891",
+    NULL,
+    "SNP_A-1509609",
+    "SNP_A-1514281",
+    "SNP_A-1513955",
+    NULL,
+    NULL,
+    "SNP_A-1512057",
+    "SNP_A-1511281",
+    "SNP_A-1513659",
+    "SNP_A-1709863",
+    "SNP_A-1513650",
+    NULL,
+    NULL,
+    "SNP_A-4212577",
+    "SNP_A-1509947",
+    NULL,
+    NULL,
+    "SNP_A-8683916",
+    NULL,
+    "SNP_A-1654197",
+    "SNP_A-1513713",
+    NULL,
+    "SNP_A-1728391",
+    "SNP_A-1694339",
+    "SNP_A-2120818",
+    "SNP_A-8362932",
+    "SNP_A-1745448",
+    "SNP_A-8626474",
+    "SNP_A-1509451",
+    "SNP_A-1514802",
+    "SNP_A-4194624",
+    "SNP_A-1739617",
+    NULL,
+    "SNP_A-1508786",
+    "SNP_A-1518320",
+    "SNP_A-1508483",
+    "SNP_A-1670177",
+    NULL,
+    "SNP_A-1513760",
+    "SNP_A-1508202",
+    "SNP_A-1511284",
+    "SNP_A-1750801",
+    "SNP_A-1736379",
+    "SNP_A-1517206",
+    "SNP_A-1665348",
+    NULL,
+    "SNP_A-1515378",
+    "SNP_A-1758989",
+    "SNP_A-1508298",
+    "SNP_A-1516936",
+    "SNP_A-1511659",
+    "SNP_A-8282451",
+    "SNP_A-1518062",
+    "SNP_A-1518827",
+    "SNP_A-1510393",
+    NULL,
+    "SNP_A-1517319",
+    NULL,
+    "SNP_A-1513487",
+    "SNP_A-1516926",
+    "SNP_A-1677120",
+    "SNP_A-1509949",
+    NULL,
+    "SNP_A-4261716",
+    "SNP_A-1513054",
+    NULL,
+    "SNP_A-1696654",
+    "SNP_A-1512969",
+    NULL,
+    "SNP_A-1510944",
+    "SNP_A-1509921",
+    "SNP_A-1694823",
+    NULL,
+    "SNP_A-1511236",
+    "SNP_A-1736419",
+    "SNP_A-1510037",
+    "SNP_A-1519386",
+    "SNP_A-1514772",
+    "SNP_A-1507429",
+    "SNP_A-1514255",
+    "SNP_A-1518389",
+    "SNP_A-1512628",
+    "SNP_A-1514108",
+    "SNP_A-1659898",
+    "SNP_A-1512295",
+    "SNP_A-1606290",
+    "SNP_A-4267552",
+    NULL,
+    "SNP_A-1507705",
+    NULL,
+    "SNP_A-1512873",
+    "SNP_A-1643720",
+    "SNP_A-2297052",
+    "SNP_A-1518802",
+    "SNP_A-1518260",
+    "SNP_A-1737816",
+    "SNP_A-1749641",
+    "SNP_A-1797637",
+    "SNP_A-4209334",
+    "SNP_A-1511131",
+    "SNP_A-1513093",
+    "SNP_A-1511445",
+    "SNP_A-1507581",
+    "SNP_A-1516942",
+    "SNP_A-1507490",
+    "SNP_A-1519270",
+    NULL,
+    "SNP_A-1649278",
+    "SNP_A-1510834",
+    "SNP_A-1508782",
+    NULL,
+    "SNP_A-1511843",
+    "SNP_A-1677908",
+    "SNP_A-1508524",
+    NULL,
+    NULL,
+    "SNP_A-1508467",
+    NULL,
+    "SNP_A-1517840",
+    NULL,
+    NULL,
+    "SNP_A-1722066",
+    "SNP_A-1736757",
+    NULL,
+    "SNP_A-1704891",
+    "SNP_A-1756274",
+    "SNP_A-1731809",
+    "SNP_A-4249659",
+    "SNP_A-1737009",
+    NULL,
+    "SNP_A-1519175",
+    NULL,
+    "SNP_A-1515639",
+    "SNP_A-1516997",
+    "SNP_A-1515339",
+    "SNP_A-1515989",
+    "SNP_A-1973193",
+    "SNP_A-1513640",
+    NULL,
+    "SNP_A-4213630",
+    "SNP_A-1738052",
+    "SNP_A-1510810",
+    "SNP_A-1516513",
+    "SNP_A-1512798",
+    "SNP_A-1647114",
+    "SNP_A-8618787",
+    "SNP_A-1718057",
+    "SNP_A-1508046",
+    "SNP_A-1516682",
+    "SNP_A-1703079",
+    "SNP_A-1701347",
+    "SNP_A-1661039",
+    "SNP_A-1982917",
+    "SNP_A-1518139",
+    "SNP_A-1684092",
+    "SNP_A-1693142",
+    "SNP_A-1758255",
+    NULL,
+    "SNP_A-8335568",
+    "SNP_A-8666522",
+    "SNP_A-1507629",
+    "SNP_A-8620160",
+    "SNP_A-1669253",
+    "SNP_A-2113716",
+    "SNP_A-1513350",
+    NULL,
+    "SNP_A-1656995",
+    NULL,
+    "SNP_A-1667246",
+    "SNP_A-1510023",
+    "SNP_A-1516117",
+    "SNP_A-1511812",
+    NULL,
+    "SNP_A-1673928",
+    "SNP_A-1675425",
+    "SNP_A-1511381",
+    NULL,
+    "SNP_A-4222217",
+    "SNP_A-1715573",
+    NULL,
+    "SNP_A-1519296",
+    "SNP_A-8697661",
+    "SNP_A-4210506",
+    "SNP_A-1966951",
+    NULL,
+    "SNP_A-1726676",
+    "SNP_A-1682616",
+    "SNP_A-1512361",
+    "SNP_A-8441951",
+    "SNP_A-1514310",
+    "SNP_A-1745384",
+    NULL,
+    "SNP_A-1736185",
+    "SNP_A-1517254",
+    "SNP_A-1731603",
+    "SNP_A-1725558",
+    "SNP_A-1756753",
+    "SNP_A-1514797",
+    "SNP_A-4264152",
+    "SNP_A-1510749",
+    "SNP_A-1748075",
+    "SNP_A-1662614",
+    "SNP_A-1507798",
+    "SNP_A-1511862",
+    "SNP_A-1688184",
+    NULL,
+    "SNP_A-1831054",
+    "SNP_A-1508042",
+    NULL,
+    NULL,
+    "SNP_A-1512137",
+    "SNP_A-8620704",
+    "SNP_A-1517984",
+    "SNP_A-1516618",
+    "SNP_A-1512992",
+    "SNP_A-1511736",
+    "SNP_A-1514498",
+    "SNP_A-8304312",
+    NULL,
+    "SNP_A-1725360",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-4164071",
+    NULL,
+    "SNP_A-8713885",
+    "SNP_A-1517928",
+    NULL,
+    "SNP_A-1712553",
+    "SNP_A-1510129",
+    "SNP_A-1513710",
+    "SNP_A-1674253",
+    "SNP_A-8281918",
+    "SNP_A-1518785",
+    "SNP_A-1699039",
+    "SNP_A-1512340",
+    "SNP_A-1729794",
+    "SNP_A-1664471",
+    "SNP_A-1516849",
+    NULL,
+    "SNP_A-1514187",
+    "SNP_A-2049669",
+    "SNP_A-1515341",
+    "SNP_A-8669684",
+    "SNP_A-1756881",
+    "SNP_A-1712147",
+    "SNP_A-1514156",
+    "SNP_A-1510676",
+    "SNP_A-1517200",
+    "SNP_A-1650598",
+    "SNP_A-1514183",
+    "SNP_A-1513686",
+    "SNP_A-2245303",
+    "SNP_A-1519070",
+    "SNP_A-1737325",
+    "SNP_A-1517413",
+    NULL,
+    NULL,
+    "SNP_A-1708026",
+    NULL,
+    "SNP_A-1517570",
+    "SNP_A-1732199",
+    "SNP_A-1654313",
+    "SNP_A-1512990",
+    "SNP_A-1674108",
+    "SNP_A-1516580",
+    "SNP_A-1513343",
+    "SNP_A-1671968",
+    "SNP_A-1509891",
+    "SNP_A-1508160",
+    NULL,
+    "SNP_A-1701319",
+    "SNP_A-1508183",
+    NULL,
+    NULL,
+    "SNP_A-1648048",
+    "SNP_A-1513742",
+    "SNP_A-1662600",
+    "SNP_A-1519016",
+    "SNP_A-1686210",
+    "SNP_A-1511103",
+    "SNP_A-4276202",
+    "SNP_A-1725402",
+    NULL,
+    "SNP_A-1516259",
+    "SNP_A-1663090",
+    "SNP_A-1512909",
+    "SNP_A-1511931",
+    "SNP_A-1514360",
+    "SNP_A-1513181",
+    "SNP_A-1748589",
+    "SNP_A-1683332",
+    "SNP_A-1510413",
+    "SNP_A-1709993",
+    "SNP_A-1683278",
+    "SNP_A-1696930",
+    "SNP_A-8280585",
+    "SNP_A-1717799",
+    "SNP_A-1515283",
+    "SNP_A-8286416",
+    "SNP_A-1510030",
+    "SNP_A-1515292",
+    NULL,
+    "SNP_A-1513581",
+    NULL,
+    NULL,
+    "SNP_A-1512201",
+    NULL,
+    "SNP_A-1509567",
+    "SNP_A-1514080",
+    "SNP_A-1518167",
+    NULL,
+    "SNP_A-1515746",
+    "SNP_A-1517258",
+    "SNP_A-1518572",
+    "SNP_A-1691448",
+    "SNP_A-1693489",
+    "SNP_A-1515883",
+    "SNP_A-1706949",
+    "SNP_A-1758812",
+    NULL,
+    "SNP_A-1703445",
+    "SNP_A-1733314",
+    "SNP_A-1508693",
+    "SNP_A-1510727",
+    NULL,
+    "SNP_A-1682632",
+    "SNP_A-1716777",
+    "SNP_A-2003233",
+    "SNP_A-1510769",
+    "SNP_A-1511942",
+    NULL,
+    "SNP_A-1518003",
+    "SNP_A-1511581",
+    "SNP_A-2022813",
+    "SNP_A-1991974",
+    "SNP_A-1645878",
+    "SNP_A-1510874",
+    "SNP_A-1514451",
+    "SNP_A-1512787",
+    "SNP_A-2186228",
+    "SNP_A-1647694",
+    NULL,
+    "SNP_A-1714979",
+    "SNP_A-1512235",
+    "SNP_A-1507339",
+    "SNP_A-1746390",
+    "SNP_A-1689438",
+    "SNP_A-1517553",
+    NULL,
+    "SNP_A-1700462",
+    "SNP_A-1676936",
+    "SNP_A-1976099",
+    "SNP_A-1644204",
+    "SNP_A-4265744",
+    "SNP_A-8670168",
+    "SNP_A-1508962",
+    "SNP_A-1509304",
+    "SNP_A-1512950",
+    "SNP_A-1511509",
+    "SNP_A-1519436",
+    "SNP_A-1737898",
+    "SNP_A-1519446",
+    "SNP_A-1755130",
+    NULL,
+    "SNP_A-1976446",
+    "SNP_A-1755860",
+    "SNP_A-1512308",
+    "SNP_A-1517567",
+    "SNP_A-1514160",
+    "SNP_A-4269302",
+    "SNP_A-8282162",
+    "SNP_A-1514859",
+    "SNP_A-4192383",
+    "SNP_A-1680554",
+    "SNP_A-1737397",
+    "SNP_A-1515507",
+    "SNP_A-4211945",
+    "SNP_A-8603288",
+    "SNP_A-1519532",
+    "SNP_A-1675117",
+    "SNP_A-1967497",
+    "SNP_A-1516181",
+    "SNP_A-1758927",
+    "SNP_A-4263425",
+    "SNP_A-1515449",
+    "SNP_A-8667717",
+    "SNP_A-1995352",
+    "SNP_A-1512406",
+    "SNP_A-1508632",
+    "SNP_A-1720009",
+    "SNP_A-1656271",
+    "SNP_A-1515651",
+    "SNP_A-1678666",
+    "SNP_A-1658496",
+    "SNP_A-1984599",
+    "SNP_A-1675770",
+    NULL,
+    "SNP_A-1509509",
+    "SNP_A-1508470",
+    "SNP_A-1509141",
+    "SNP_A-1508894",
+    "SNP_A-1992423",
+    "SNP_A-1507990",
+    "SNP_A-1514975",
+    "SNP_A-1670806",
+    "SNP_A-1690787",
+    "SNP_A-1509373",
+    "SNP_A-1510943",
+    "SNP_A-1659008",
+    "SNP_A-1743557",
+    "SNP_A-1978207",
+    "SNP_A-1513779",
+    "SNP_A-1745862",
+    "SNP_A-1508358",
+    "SNP_A-1508182",
+    "SNP_A-1512636",
+    "SNP_A-2130630",
+    "SNP_A-1702059",
+    NULL,
+    "SNP_A-1721794",
+    NULL,
+    "SNP_A-1511520",
+    "SNP_A-2007150",
+    "SNP_A-1507561_2",
+    "SNP_A-1513954",
+    "SNP_A-4212125",
+    "SNP_A-1690805",
+    NULL,
+    "SNP_A-1961994",
+    "SNP_A-1512419",
+    "SNP_A-8286620",
+    "SNP_A-8714993",
+    "SNP_A-1699819",
+    "SNP_A-4210848",
+    "SNP_A-1722138",
+    "SNP_A-1510240",
+    NULL,
+    "SNP_A-1663808",
+    NULL,
+    "SNP_A-1733742",
+    NULL,
+    NULL,
+    "SNP_A-1515553",
+    "SNP_A-1509995",
+    NULL,
+    "SNP_A-1971897",
+    "SNP_A-1514896",
+    "SNP_A-2270123",
+    "SNP_A-1987165",
+    NULL,
+    "SNP_A-1514106",
+    "SNP_A-1516479",
+    "SNP_A-1513163",
+    "SNP_A-1513630",
+    "SNP_A-1511980",
+    "SNP_A-1510377",
+    NULL,
+    "SNP_A-1518210",
+    "SNP_A-1756292",
+    NULL,
+    "SNP_A-8666185",
+    "SNP_A-1707848",
+    "SNP_A-1518462",
+    "SNP_A-1653832",
+    "SNP_A-1507527",
+    "SNP_A-1999474",
+    "SNP_A-1518031",
+    "SNP_A-1511493",
+    "SNP_A-1518848",
+    "SNP_A-1677922",
+    "SNP_A-4233878",
+    "SNP_A-1507608",
+    NULL,
+    "SNP_A-1516154",
+    "SNP_A-1517068",
+    "SNP_A-1907755",
+    NULL,
+    "SNP_A-1517910",
+    "SNP_A-1519641",
+    NULL,
+    "SNP_A-1519413",
+    NULL,
+    "SNP_A-8287485",
+    "SNP_A-1996099",
+    "SNP_A-1695697",
+    NULL,
+    "SNP_A-1723158",
+    "SNP_A-1514633",
+    "SNP_A-1512042",
+    "SNP_A-1648856",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1687542",
+    "SNP_A-1722106",
+    "SNP_A-1508009",
+    NULL,
+    NULL,
+    "SNP_A-1723260",
+    "SNP_A-1519756",
+    "SNP_A-1743653",
+    "SNP_A-1727505",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1995834",
+    "SNP_A-1516870",
+    NULL,
+    "SNP_A-1507451",
+    "SNP_A-1650542",
+    "SNP_A-1879884",
+    "SNP_A-1720743",
+    "SNP_A-1718395",
+    "SNP_A-1515853",
+    "SNP_A-4198203",
+    "SNP_A-1507341",
+    "SNP_A-1741821",
+    "SNP_A-1994589",
+    "SNP_A-1510299",
+    "SNP_A-1680540",
+    "SNP_A-1674076",
+    "SNP_A-1715771",
+    "SNP_A-1507594",
+    "SNP_A-1660101",
+    "SNP_A-1735182",
+    "SNP_A-1513461",
+    "SNP_A-1515703",
+    "SNP_A-1693779",
+    "SNP_A-1722802",
+    "SNP_A-1511721",
+    "SNP_A-1514428",
+    "SNP_A-1512554",
+    "SNP_A-1510883",
+    NULL,
+    "SNP_A-1723282",
+    "SNP_A-8402650",
+    NULL,
+    NULL,
+    "SNP_A-1513148",
+    "SNP_A-1997035",
+    "SNP_A-1518225",
+    "SNP_A-1668024",
+    "SNP_A-1513184",
+    "SNP_A-1513751",
+    "SNP_A-1758595",
+    "SNP_A-1647778",
+    "SNP_A-1517380",
+    "SNP_A-1711360",
+    "SNP_A-1519118",
+    "SNP_A-1515900",
+    "SNP_A-1665100",
+    NULL,
+    NULL,
+    "SNP_A-4295064",
+    "SNP_A-1696156",
+    "SNP_A-1512142",
+    NULL,
+    "SNP_A-1736109",
+    "SNP_A-1511780",
+    NULL,
+    "SNP_A-1517548",
+    NULL,
+    NULL,
+    "SNP_A-1513696",
+    NULL,
+    "SNP_A-1726914",
+    "SNP_A-8285267",
+    "SNP_A-8666970",
+    "SNP_A-1752733",
+    "SNP_A-1642053",
+    "SNP_A-1644380",
+    "SNP_A-1511898",
+    "SNP_A-1513807",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1973388",
+    "SNP_A-8616901",
+    "SNP_A-1510670",
+    "SNP_A-1512189",
+    "SNP_A-8667521",
+    "SNP_A-1515844",
+    "SNP_A-1507467",
+    "SNP_A-1730523",
+    NULL,
+    "SNP_A-2013050",
+    "SNP_A-1513391",
+    "SNP_A-8336542",
+    NULL,
+    "SNP_A-1662478",
+    NULL,
+    "SNP_A-1688734",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1672428",
+    "SNP_A-1509858",
+    NULL,
+    "SNP_A-1664934",
+    "SNP_A-1658632",
+    "SNP_A-1508432",
+    "SNP_A-1714643",
+    NULL,
+    "SNP_A-1743167",
+    NULL,
+    NULL,
+    "SNP_A-1518665",
+    "SNP_A-1681336",
+    "SNP_A-1514486",
+    NULL,
+    "SNP_A-1699335",
+    "SNP_A-1710097",
+    "SNP_A-8669268",
+    "SNP_A-1508965",
+    "SNP_A-4212292",
+    NULL,
+    NULL,
+    "SNP_A-1514378",
+    "SNP_A-1515485",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1518932",
+    NULL,
+    "SNP_A-1518717",
+    "SNP_A-1512331",
+    "SNP_A-1708661",
+    "SNP_A-1706453",
+    "SNP_A-4213757",
+    "SNP_A-1508520",
+    "SNP_A-8386741",
+    "SNP_A-8574232",
+    NULL,
+    NULL,
+    "SNP_A-4256352",
+    "SNP_A-1736135",
+    "SNP_A-4218294",
+    "SNP_A-8572468",
+    "SNP_A-1514881",
+    "SNP_A-1515076",
+    "SNP_A-1665192",
+    "SNP_A-1508537",
+    "SNP_A-1606287",
+    "SNP_A-1518444",
+    "SNP_A-1518805",
+    NULL,
+    "SNP_A-1678216",
+    "SNP_A-1699101",
+    "SNP_A-1713029",
+    "SNP_A-8668143",
+    "SNP_A-1511428",
+    "SNP_A-1517065",
+    NULL,
+    "SNP_A-1513103",
+    "SNP_A-1511663",
+    "SNP_A-1511063",
+    "SNP_A-1741187",
+    "SNP_A-1653666",
+    "SNP_A-8540991",
+    "SNP_A-1518240",
+    "SNP_A-1507712",
+    "SNP_A-1515823",
+    NULL,
+    "SNP_A-1676872",
+    "SNP_A-1514132",
+    "SNP_A-1508269",
+    "SNP_A-1518921",
+    "SNP_A-1679112",
+    "SNP_A-1512213",
+    NULL,
+    "SNP_A-1518479",
+    "SNP_A-1509950",
+    "SNP_A-1513476",
+    "SNP_A-8617508",
+    "SNP_A-8572403",
+    NULL,
+    "SNP_A-1517930",
+    "SNP_A-1696590",
+    "SNP_A-1513194",
+    "SNP_A-1688030",
+    "SNP_A-8699150",
+    "SNP_A-1518173",
+    "SNP_A-1723956",
+    "SNP_A-1518607",
+    "SNP_A-4215095",
+    "SNP_A-1514256",
+    "SNP_A-1657243",
+    "SNP_A-1722506",
+    "SNP_A-1723386",
+    NULL,
+    "SNP_A-8480540",
+    "SNP_A-1646666",
+    "SNP_A-1697178",
+    NULL,
+    "SNP_A-1673354",
+    "SNP_A-1508302",
+    NULL,
+    "SNP_A-1662308",
+    NULL,
+    "SNP_A-1704763",
+    "SNP_A-1715715",
+    "SNP_A-1668364",
+    "SNP_A-1518378",
+    "SNP_A-1678056",
+    "SNP_A-1675311",
+    NULL,
+    "SNP_A-1515215",
+    "SNP_A-1519148",
+    "SNP_A-1699513",
+    "SNP_A-4225886",
+    "SNP_A-1512852",
+    NULL,
+    "SNP_A-1511340",
+    "SNP_A-1726950",
+    "SNP_A-1706971",
+    NULL,
+    "SNP_A-1511933",
+    "SNP_A-1704987",
+    "SNP_A-1512485",
+    "SNP_A-4212670",
+    "SNP_A-1510180",
+    "SNP_A-2024295",
+    "SNP_A-1664202",
+    "SNP_A-1716473",
+    "SNP_A-1515365",
+    "SNP_A-1517834",
+    "SNP_A-1758202",
+    "SNP_A-1726350",
+    "SNP_A-1514922",
+    "SNP_A-1972677",
+    NULL,
+    "SNP_A-1511958",
+    "SNP_A-1508159",
+    "SNP_A-1657025",
+    "SNP_A-1663234",
+    "SNP_A-1667012",
+    "SNP_A-1516272",
+    "SNP_A-4296863",
+    "SNP_A-1515047",
+    "SNP_A-1749307",
+    NULL,
+    "SNP_A-1518758",
+    "SNP_A-1509549",
+    "SNP_A-1516018",
+    "SNP_A-1515917",
+    "SNP_A-1659452",
+    "SNP_A-4230348",
+    NULL,
+    "SNP_A-1518137",
+    "SNP_A-1510785",
+    NULL,
+    "SNP_A-1708719",
+    "SNP_A-1989030",
+    "SNP_A-1519065",
+    "SNP_A-4212900",
+    "SNP_A-2253902",
+    "SNP_A-1717459",
+    NULL,
+    "SNP_A-1696472",
+    "SNP_A-4263534",
+    "SNP_A-1516527",
+    NULL,
+    "SNP_A-8668857",
+    "SNP_A-1519458",
+    "SNP_A-1662210",
+    "SNP_A-1711953",
+    "SNP_A-1508842",
+    "SNP_A-1722796",
+    "SNP_A-1654573",
+    "SNP_A-1513418",
+    "SNP_A-1516874",
+    NULL,
+    "SNP_A-1510038",
+    "SNP_A-1510608",
+    "SNP_A-4298876",
+    NULL,
+    "SNP_A-1702793",
+    "SNP_A-1512508",
+    NULL,
+    "SNP_A-1519636",
+    "SNP_A-1989176",
+    "SNP_A-1865287",
+    "SNP_A-1507850",
+    "SNP_A-1986279",
+    "SNP_A-4287519",
+    "SNP_A-1678124",
+    "SNP_A-1967595",
+    NULL,
+    NULL,
+    "SNP_A-1510102",
+    NULL,
+    "SNP_A-1606340",
+    "SNP_A-1510397",
+    "SNP_A-1516554",
+    "SNP_A-1758511",
+    NULL,
+    "SNP_A-1516054",
+    "SNP_A-1508671",
+    "SNP_A-1757975",
+    "SNP_A-1664280",
+    "SNP_A-1648236",
+    "SNP_A-1511863",
+    "SNP_A-1515453",
+    "SNP_A-1513422",
+    "SNP_A-1517191",
+    "SNP_A-1514008",
+    NULL,
+    NULL,
+    "SNP_A-1514554",
+    "SNP_A-8289508",
+    "SNP_A-1511073",
+    "SNP_A-1513051",
+    "SNP_A-1995129",
+    "SNP_A-1511204",
+    "SNP_A-1651840",
+    "SNP_A-1518538",
+    "SNP_A-1516489",
+    "SNP_A-1513317",
+    "SNP_A-1513196",
+    "SNP_A-1742361",
+    NULL,
+    "SNP_A-1676084",
+    "SNP_A-1510732",
+    "SNP_A-1514938",
+    "SNP_A-1681696",
+    "SNP_A-1518961",
+    "SNP_A-1870181",
+    "SNP_A-1518673",
+    "SNP_A-1508710",
+    NULL,
+    "SNP_A-1743121",
+    NULL,
+    "SNP_A-1513038",
+    "SNP_A-1512049",
+    "SNP_A-1507583",
+    "SNP_A-1733242",
+    "SNP_A-1753099",
+    "SNP_A-1517639",
+    NULL,
+    "SNP_A-8670068",
+    "SNP_A-1516383",
+    "SNP_A-1671876",
+    NULL,
+    "SNP_A-1514770",
+    "SNP_A-1698565",
+    "SNP_A-1758747",
+    "SNP_A-1514789",
+    "SNP_A-1509754",
+    "SNP_A-1516511",
+    "SNP_A-1510752",
+    NULL,
+    "SNP_A-1697262",
+    "SNP_A-1516188",
+    "SNP_A-1753323",
+    "SNP_A-1694865",
+    "SNP_A-1511802",
+    "SNP_A-1695947",
+    NULL,
+    "SNP_A-1507968",
+    "SNP_A-1737079",
+    NULL,
+    "SNP_A-1508290",
+    "SNP_A-1509103",
+    "SNP_A-1606363",
+    "SNP_A-1679796",
+    "SNP_A-1671622",
+    "SNP_A-1512002",
+    "SNP_A-1512821",
+    "SNP_A-1516120",
+    "SNP_A-1648714",
+    NULL,
+    "SNP_A-1515305",
+    "SNP_A-1742981",
+    "SNP_A-1700781",
+    "SNP_A-1519502",
+    "SNP_A-4268199",
+    "SNP_A-1708104",
+    "SNP_A-1518168",
+    NULL,
+    "SNP_A-1511444",
+    "SNP_A-1965833",
+    "SNP_A-1511114",
+    "SNP_A-4263324",
+    NULL,
+    "SNP_A-1509074",
+    "SNP_A-1516052",
+    "SNP_A-1699917",
+    "SNP_A-1518126",
+    "SNP_A-1731561",
+    "SNP_A-1730927",
+    "SNP_A-1511229",
+    "SNP_A-1507568",
+    "SNP_A-1508070",
+    "SNP_A-1517459",
+    NULL,
+    NULL,
+    "SNP_A-1987958",
+    "SNP_A-1517711",
+    "SNP_A-1661684",
+    "SNP_A-1515670",
+    "SNP_A-1510525",
+    "SNP_A-1679558",
+    "SNP_A-1652398",
+    "SNP_A-1514296",
+    "SNP_A-1518271",
+    "SNP_A-1675413",
+    "SNP_A-1711390",
+    NULL,
+    "SNP_A-1519481",
+    "SNP_A-1509025",
+    "SNP_A-1519403",
+    "SNP_A-1512901",
+    NULL,
+    NULL,
+    "SNP_A-1690745",
+    "SNP_A-4279961",
+    NULL,
+    "SNP_A-1643882",
+    NULL,
+    "SNP_A-1664956",
+    "SNP_A-1519337",
+    "SNP_A-1519364",
+    "SNP_A-1519037",
+    "SNP_A-1515006",
+    "SNP_A-1676048",
+    NULL,
+    "SNP_A-1508674",
+    "SNP_A-8574243",
+    "SNP_A-1515272",
+    "SNP_A-1509470",
+    "SNP_A-1653426",
+    NULL,
+    "SNP_A-1517422",
+    "SNP_A-8289381",
+    "SNP_A-1509971",
+    "SNP_A-1710772",
+    "SNP_A-1700364",
+    NULL,
+    "SNP_A-1713432",
+    NULL,
+    NULL,
+    "SNP_A-1739813",
+    "SNP_A-1514224",
+    NULL,
+    "SNP_A-1508410",
+    "SNP_A-1515707",
+    "SNP_A-1515144",
+    "SNP_A-2160262",
+    "SNP_A-1655239",
+    "SNP_A-1512250",
+    "SNP_A-1516810",
+    "SNP_A-1641835",
+    NULL,
+    "SNP_A-1512814",
+    "SNP_A-8617247",
+    "SNP_A-1754234",
+    "SNP_A-1515075",
+    "SNP_A-1754762",
+    "SNP_A-1758896",
+    "SNP_A-1663906",
+    NULL,
+    "SNP_A-1648420",
+    "SNP_A-1513574",
+    "SNP_A-1513135",
+    NULL,
+    "SNP_A-1755366",
+    NULL,
+    "SNP_A-1507766",
+    "SNP_A-1507325",
+    "SNP_A-1513044",
+    NULL,
+    "SNP_A-1519194",
+    "SNP_A-1740399",
+    "SNP_A-1653650",
+    "SNP_A-1701261",
+    "SNP_A-1510101",
+    "SNP_A-8391871",
+    "SNP_A-1511148",
+    "SNP_A-8576448",
+    "SNP_A-1513457",
+    NULL,
+    "SNP_A-8283079",
+    "SNP_A-1516646",
+    "SNP_A-1517169",
+    "SNP_A-1706837",
+    "SNP_A-1510062",
+    "SNP_A-1509131",
+    "SNP_A-1511499",
+    "SNP_A-1518148",
+    "SNP_A-1720529",
+    NULL,
+    NULL,
+    "SNP_A-1508733",
+    NULL,
+    "SNP_A-1653902",
+    "SNP_A-1511322",
+    "SNP_A-1743353",
+    "SNP_A-1755804",
+    "SNP_A-1518779",
+    "SNP_A-1514328",
+    "SNP_A-1669715",
+    "SNP_A-8671066",
+    "SNP_A-1508695",
+    "SNP_A-1515675",
+    "SNP_A-1514525",
+    NULL,
+    "SNP_A-8617748",
+    "SNP_A-1512151",
+    "SNP_A-1749799",
+    "SNP_A-1511235",
+    "SNP_A-1510667",
+    "SNP_A-1996247",
+    "SNP_A-1518456",
+    "SNP_A-1514768",
+    "SNP_A-1706253",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1652055",
+    NULL,
+    "SNP_A-1518523",
+    "SNP_A-1731353",
+    "SNP_A-4194798",
+    "SNP_A-1748313",
+    "SNP_A-1514726",
+    "SNP_A-1509939",
+    "SNP_A-1508051",
+    "SNP_A-1746376",
+    "SNP_A-1719247",
+    "SNP_A-1689795",
+    "SNP_A-1679090",
+    "SNP_A-1515836",
+    "SNP_A-1510839",
+    "SNP_A-1734298",
+    "SNP_A-1516200",
+    "SNP_A-1722060",
+    "SNP_A-1655761",
+    "SNP_A-1518681",
+    "SNP_A-1512516",
+    NULL,
+    NULL,
+    "SNP_A-8280607",
+    "SNP_A-1512487",
+    "SNP_A-1514503",
+    "SNP_A-1508478",
+    "SNP_A-1512291",
+    "SNP_A-1645856",
+    "SNP_A-1515242",
+    NULL,
+    NULL,
+    "SNP_A-1729494",
+    "SNP_A-8471313",
+    "SNP_A-1722150",
+    "SNP_A-1519684",
+    NULL,
+    "SNP_A-1748503",
+    "SNP_A-1677710",
+    "SNP_A-1514690",
+    "SNP_A-1668416",
+    NULL,
+    "SNP_A-1507648",
+    "SNP_A-8717544",
+    "SNP_A-1746074",
+    "SNP_A-8667234",
+    "SNP_A-1654115",
+    "SNP_A-1648282",
+    "SNP_A-1517924",
+    "SNP_A-1710337",
+    NULL,
+    "SNP_A-1513747",
+    "SNP_A-1652692",
+    "SNP_A-1659716",
+    "SNP_A-1681848",
+    "SNP_A-1671928",
+    "SNP_A-1700506",
+    "SNP_A-1511165",
+    "SNP_A-2119072",
+    "SNP_A-1514651",
+    NULL,
+    "SNP_A-1606269",
+    NULL,
+    "SNP_A-1680196",
+    "SNP_A-1514506",
+    NULL,
+    NULL,
+    "SNP_A-1514687",
+    "SNP_A-1732195",
+    "SNP_A-1708071",
+    "SNP_A-1508322",
+    "SNP_A-1722866",
+    "SNP_A-1514068",
+    NULL,
+    NULL,
+    "SNP_A-1518600",
+    "SNP_A-1728185",
+    "SNP_A-1518000",
+    "SNP_A-8669675",
+    "SNP_A-1701535",
+    "SNP_A-1515992",
+    NULL,
+    "SNP_A-1645166",
+    "SNP_A-1514114",
+    "SNP_A-1510040",
+    "SNP_A-1510784",
+    "SNP_A-1987095",
+    "SNP_A-1518573",
+    "SNP_A-1514677",
+    "SNP_A-1707433",
+    "SNP_A-1508692",
+    "SNP_A-1519422",
+    "SNP_A-1513769",
+    "SNP_A-1510406",
+    "SNP_A-1513716",
+    "SNP_A-1518566",
+    "SNP_A-1517559",
+    "SNP_A-1509852",
+    "SNP_A-2044783",
+    "SNP_A-1508045",
+    "SNP_A-1673172",
+    "SNP_A-1507386",
+    NULL,
+    "SNP_A-1507487",
+    "SNP_A-1513491",
+    NULL,
+    "SNP_A-1517101",
+    "SNP_A-1516084",
+    "SNP_A-1734846",
+    "SNP_A-1510125",
+    "SNP_A-1712497",
+    "SNP_A-1754606",
+    "SNP_A-1648336",
+    "SNP_A-1705803",
+    "SNP_A-1679368",
+    "SNP_A-1508787",
+    "SNP_A-1750933",
+    NULL,
+    "SNP_A-1510042",
+    NULL,
+    "SNP_A-1514312",
+    "SNP_A-1752461",
+    "SNP_A-1510287",
+    "SNP_A-1513003",
+    "SNP_A-1518540",
+    "SNP_A-1672958",
+    NULL,
+    "SNP_A-1667132",
+    "SNP_A-1519034",
+    "SNP_A-1952711",
+    NULL,
+    "SNP_A-1696290",
+    "SNP_A-4270411",
+    NULL,
+    "SNP_A-1514481",
+    NULL,
+    "SNP_A-1515034",
+    "SNP_A-1664312",
+    "SNP_A-1511214",
+    "SNP_A-1508839",
+    "SNP_A-1513383",
+    NULL,
+    "SNP_A-1512245",
+    "SNP_A-4263224",
+    "SNP_A-1686614",
+    "SNP_A-1516429",
+    NULL,
+    "SNP_A-1518995",
+    "SNP_A-1516727",
+    NULL,
+    NULL,
+    "SNP_A-1508465",
+    "SNP_A-1511902",
+    "SNP_A-1519625",
+    "SNP_A-1512094",
+    "SNP_A-1969356",
+    "SNP_A-1980242",
+    "SNP_A-1512420",
+    "SNP_A-1517958",
+    NULL,
+    NULL,
+    "SNP_A-1515886",
+    "SNP_A-1511875",
+    "SNP_A-1515931",
+    NULL,
+    "SNP_A-1512255",
+    "SNP_A-1656779",
+    "SNP_A-1510768",
+    "SNP_A-1516949",
+    "SNP_A-1701765",
+    "SNP_A-8285770",
+    "SNP_A-1747775",
+    "SNP_A-1731055",
+    NULL,
+    NULL,
+    "SNP_A-1519560",
+    "SNP_A-1518773",
+    "SNP_A-1726334",
+    "SNP_A-1512902",
+    NULL,
+    "SNP_A-1683392",
+    "SNP_A-1512058",
+    "SNP_A-1664256",
+    "SNP_A-1720023",
+    NULL,
+    "SNP_A-1706317",
+    "SNP_A-1712681",
+    NULL,
+    "SNP_A-1758209",
+    "SNP_A-1516781",
+    "SNP_A-1512679",
+    "SNP_A-1515441",
+    "SNP_A-1730166",
+    "SNP_A-1508404",
+    NULL,
+    "SNP_A-1691406",
+    "SNP_A-1518416",
+    "SNP_A-1512669",
+    "SNP_A-1518616",
+    "SNP_A-1515332",
+    "SNP_A-1732231",
+    NULL,
+    "SNP_A-1517118",
+    "SNP_A-1515253",
+    "SNP_A-1507476",
+    "SNP_A-1647588",
+    "SNP_A-1511940",
+    "SNP_A-8667375",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1669441",
+    NULL,
+    "SNP_A-1511363",
+    "SNP_A-1606344",
+    "SNP_A-8284550",
+    NULL,
+    "SNP_A-1738551",
+    NULL,
+    "SNP_A-1514513",
+    "SNP_A-1513314",
+    "SNP_A-1717155",
+    "SNP_A-1513218",
+    "SNP_A-1978851",
+    "SNP_A-8621256",
+    "SNP_A-1695343",
+    "SNP_A-1510831",
+    "SNP_A-1508162",
+    NULL,
+    "SNP_A-1512867",
+    "SNP_A-1675692",
+    "SNP_A-1718275",
+    "SNP_A-1510121",
+    "SNP_A-1511245",
+    "SNP_A-1739513",
+    NULL,
+    "SNP_A-1516315",
+    NULL,
+    "SNP_A-1511914",
+    "SNP_A-1978248",
+    "SNP_A-1512617",
+    NULL,
+    NULL,
+    "SNP_A-1989937",
+    "SNP_A-1514952",
+    "SNP_A-1989507",
+    "SNP_A-8281844",
+    "SNP_A-1727276",
+    "SNP_A-1754005",
+    "SNP_A-1710338",
+    "SNP_A-1510375",
+    "SNP_A-1673640",
+    "SNP_A-1515234",
+    "SNP_A-1663792",
+    "SNP_A-8617517",
+    "SNP_A-1516217",
+    "SNP_A-1510191",
+    "SNP_A-1670720",
+    "SNP_A-1980200",
+    NULL,
+    NULL,
+    "SNP_A-1517199",
+    "SNP_A-1514694",
+    NULL,
+    "SNP_A-1662972",
+    "SNP_A-1513794",
+    NULL,
+    "SNP_A-1709799",
+    "SNP_A-1515421",
+    "SNP_A-1515527",
+    "SNP_A-1508942",
+    "SNP_A-1743077",
+    "SNP_A-1510523",
+    "SNP_A-1689166",
+    "SNP_A-1510516",
+    "SNP_A-1519487",
+    NULL,
+    NULL,
+    "SNP_A-1704545",
+    "SNP_A-4209323",
+    "SNP_A-1511095",
+    "SNP_A-1513308",
+    "SNP_A-1750303",
+    NULL,
+    "SNP_A-1510600",
+    "SNP_A-2301874",
+    NULL,
+    "SNP_A-1516221",
+    "SNP_A-1510636",
+    "SNP_A-1683544",
+    "SNP_A-1716871",
+    "SNP_A-1513443",
+    NULL,
+    "SNP_A-1513160",
+    "SNP_A-1511634",
+    NULL,
+    "SNP_A-8666396",
+    NULL,
+    "SNP_A-1694523",
+    "SNP_A-1515436",
+    "SNP_A-1708749",
+    "SNP_A-1512932",
+    "SNP_A-1517008",
+    "SNP_A-1646916",
+    "SNP_A-1518518",
+    "SNP_A-1508334",
+    "SNP_A-1752685",
+    "SNP_A-1743509",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516599",
+    "SNP_A-1517915",
+    "SNP_A-1794941",
+    "SNP_A-1736935",
+    "SNP_A-1678182",
+    "SNP_A-1518742",
+    "SNP_A-1511130",
+    "SNP_A-1973872",
+    "SNP_A-1515300",
+    "SNP_A-1754486",
+    "SNP_A-1729998",
+    "SNP_A-1664738",
+    "SNP_A-1732820",
+    "SNP_A-1510331",
+    "SNP_A-1510072",
+    "SNP_A-1757271",
+    "SNP_A-1508995",
+    "SNP_A-1515329",
+    NULL,
+    "SNP_A-1518104",
+    "SNP_A-1515023",
+    "SNP_A-1516423",
+    "SNP_A-1515833",
+    "SNP_A-1985349",
+    "SNP_A-1740509",
+    "SNP_A-1744691",
+    "SNP_A-1509369",
+    "SNP_A-1508106",
+    "SNP_A-1510963",
+    "SNP_A-1509062",
+    "SNP_A-1757818",
+    "SNP_A-1510805",
+    "SNP_A-8620150",
+    "SNP_A-1509632",
+    "SNP_A-1708060",
+    "SNP_A-1758110",
+    "SNP_A-1513045",
+    "SNP_A-1518931",
+    "SNP_A-1516037",
+    NULL,
+    "SNP_A-1725774",
+    "SNP_A-1646190",
+    "SNP_A-1510353",
+    "SNP_A-1993796",
+    "SNP_A-1508179",
+    "SNP_A-4208257",
+    "SNP_A-1508058",
+    "SNP_A-1513610",
+    NULL,
+    "SNP_A-8423304",
+    NULL,
+    "SNP_A-8417835",
+    NULL,
+    "SNP_A-4265376",
+    "SNP_A-1508143",
+    NULL,
+    "SNP_A-1688200",
+    NULL,
+    NULL,
+    "SNP_A-1512547",
+    NULL,
+    "SNP_A-1512666",
+    "SNP_A-1513819",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1728519",
+    NULL,
+    "SNP_A-1519213",
+    "SNP_A-1510307",
+    NULL,
+    "SNP_A-1673404",
+    NULL,
+    "SNP_A-1674175",
+    "SNP_A-1720165",
+    NULL,
+    "SNP_A-1758370",
+    "SNP_A-1516195",
+    "SNP_A-1512181",
+    "SNP_A-1679470",
+    "SNP_A-1642343",
+    "SNP_A-1508471",
+    "SNP_A-1510806",
+    "SNP_A-8624569",
+    "SNP_A-1516583",
+    "SNP_A-1512803",
+    "SNP_A-1510710",
+    NULL,
+    NULL,
+    "SNP_A-1723984",
+    "SNP_A-1518750",
+    "SNP_A-1510328",
+    "SNP_A-8364408",
+    "SNP_A-1514666",
+    "SNP_A-1518633",
+    "SNP_A-8671025",
+    "SNP_A-4269520",
+    "SNP_A-8410428",
+    "SNP_A-1755698",
+    NULL,
+    "SNP_A-1512473",
+    "SNP_A-1657778",
+    "SNP_A-1514349",
+    NULL,
+    "SNP_A-1517302",
+    "SNP_A-1972767",
+    "SNP_A-1513431",
+    "SNP_A-1753535",
+    "SNP_A-1514993",
+    NULL,
+    "SNP_A-1659658",
+    "SNP_A-4243580",
+    "SNP_A-1514280",
+    "SNP_A-1512231",
+    "SNP_A-1653026",
+    "SNP_A-1509829",
+    NULL,
+    "SNP_A-1510992",
+    "SNP_A-1658578",
+    NULL,
+    NULL,
+    "SNP_A-1510200",
+    NULL,
+    "SNP_A-1511469",
+    "SNP_A-2268676",
+    "SNP_A-1508994",
+    "SNP_A-1512807",
+    "SNP_A-1511472",
+    "SNP_A-1699127",
+    "SNP_A-1652680",
+    "SNP_A-1511762",
+    NULL,
+    "SNP_A-1741943",
+    "SNP_A-1682176",
+    "SNP_A-1509844",
+    "SNP_A-1691366",
+    NULL,
+    "SNP_A-1512744",
+    "SNP_A-1514191",
+    "SNP_A-8541427",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1741667",
+    "SNP_A-8285497",
+    "SNP_A-1998824",
+    "SNP_A-1518759",
+    "SNP_A-1509001",
+    "SNP_A-1682204",
+    "SNP_A-1514778",
+    "SNP_A-8334337",
+    NULL,
+    NULL,
+    "SNP_A-1664176",
+    "SNP_A-1508305",
+    "SNP_A-1508744",
+    "SNP_A-1509293",
+    "SNP_A-8288795",
+    "SNP_A-1644286",
+    "SNP_A-1511656",
+    "SNP_A-1515320",
+    "SNP_A-4265571",
+    "SNP_A-2094244",
+    "SNP_A-1509075",
+    "SNP_A-1722286",
+    "SNP_A-1509560",
+    "SNP_A-1965401",
+    "SNP_A-4262836",
+    "SNP_A-1702541",
+    "SNP_A-4257277",
+    "SNP_A-1518965",
+    "SNP_A-1998179",
+    "SNP_A-1516244",
+    NULL,
+    "SNP_A-1511918",
+    "SNP_A-1517938",
+    "SNP_A-1514798",
+    "SNP_A-4210936",
+    "SNP_A-1514050",
+    "SNP_A-4263967",
+    "SNP_A-1722244",
+    "SNP_A-1660861",
+    "SNP_A-1511366",
+    "SNP_A-8716674",
+    "SNP_A-1515178",
+    "SNP_A-1676180",
+    "SNP_A-1709701",
+    "SNP_A-1517071",
+    "SNP_A-1511699",
+    "SNP_A-1705667",
+    "SNP_A-8487967",
+    "SNP_A-1512643",
+    "SNP_A-1514305",
+    NULL,
+    "SNP_A-1516223",
+    "SNP_A-1513043",
+    "SNP_A-1735430",
+    NULL,
+    "SNP_A-1748987",
+    "SNP_A-1508495",
+    "SNP_A-1511177",
+    "SNP_A-8452192",
+    "SNP_A-1677992",
+    "SNP_A-1518264",
+    "SNP_A-1711286",
+    "SNP_A-1508149",
+    "SNP_A-1514061",
+    NULL,
+    "SNP_A-4212342",
+    "SNP_A-1684294",
+    "SNP_A-1513392",
+    "SNP_A-1510083",
+    "SNP_A-1512980",
+    "SNP_A-1661151",
+    "SNP_A-1703559",
+    "SNP_A-1508095",
+    "SNP_A-1679556",
+    "SNP_A-1679448",
+    "SNP_A-1664614",
+    "SNP_A-1513836",
+    "SNP_A-1514697",
+    "SNP_A-1513223",
+    "SNP_A-1992959",
+    "SNP_A-4213593",
+    "SNP_A-1513082",
+    "SNP_A-1977757",
+    NULL,
+    "SNP_A-1512462",
+    "SNP_A-1695781",
+    "SNP_A-1509705",
+    "SNP_A-1513486",
+    "SNP_A-1517917",
+    "SNP_A-8536461",
+    "SNP_A-1519476",
+    "SNP_A-1752153",
+    "SNP_A-1987687",
+    "SNP_A-1509461",
+    "SNP_A-1709575",
+    "SNP_A-1706595",
+    "SNP_A-1517115",
+    NULL,
+    "SNP_A-1515614",
+    NULL,
+    "SNP_A-1514918",
+    "SNP_A-1511643",
+    "SNP_A-1508655",
+    "SNP_A-1666950",
+    "SNP_A-1740727",
+    "SNP_A-1517487",
+    "SNP_A-1698781",
+    "SNP_A-1519599",
+    "SNP_A-8619993",
+    "SNP_A-1741121",
+    "SNP_A-1508881",
+    "SNP_A-1510765",
+    "SNP_A-1675235",
+    "SNP_A-1511897",
+    "SNP_A-1509272",
+    "SNP_A-1712305",
+    "SNP_A-1518241",
+    "SNP_A-1514170",
+    "SNP_A-1515866",
+    NULL,
+    "SNP_A-1517325",
+    "SNP_A-1973426",
+    "SNP_A-1758853",
+    NULL,
+    "SNP_A-1516332",
+    "SNP_A-1511680",
+    "SNP_A-1721580",
+    "SNP_A-4211305",
+    "SNP_A-1515751",
+    NULL,
+    "SNP_A-1516632",
+    NULL,
+    "SNP_A-1719442",
+    "SNP_A-1647070",
+    "SNP_A-1517362",
+    NULL,
+    "SNP_A-1644032",
+    NULL,
+    "SNP_A-1518906",
+    "SNP_A-1724686",
+    "SNP_A-8285337",
+    "SNP_A-1518146",
+    "SNP_A-1515439",
+    "SNP_A-1509239",
+    "SNP_A-1512785",
+    "SNP_A-1677692",
+    NULL,
+    NULL,
+    "SNP_A-1508738",
+    "SNP_A-1514270",
+    "SNP_A-1964488",
+    "SNP_A-1515705",
+    "SNP_A-1515376",
+    "SNP_A-1516784",
+    "SNP_A-1733486",
+    NULL,
+    "SNP_A-1511949",
+    "SNP_A-1509628",
+    "SNP_A-1509368",
+    NULL,
+    "SNP_A-1995797",
+    NULL,
+    "SNP_A-1509861",
+    "SNP_A-1517595",
+    "SNP_A-1513329",
+    "SNP_A-8619460",
+    "SNP_A-1666740",
+    "SNP_A-1687248",
+    "SNP_A-1758586",
+    "SNP_A-1514223",
+    "SNP_A-8281126",
+    "SNP_A-1514193",
+    "SNP_A-1657842",
+    "SNP_A-1715513",
+    NULL,
+    "SNP_A-1685674",
+    "SNP_A-1975624",
+    "SNP_A-1984463",
+    NULL,
+    "SNP_A-1508362",
+    "SNP_A-2215425",
+    NULL,
+    "SNP_A-1643037",
+    "SNP_A-1518480",
+    "SNP_A-1509850",
+    "SNP_A-1517029",
+    "SNP_A-1513800",
+    "SNP_A-1650962",
+    "SNP_A-8290401",
+    NULL,
+    NULL,
+    "SNP_A-4265531",
+    "SNP_A-8652889",
+    "SNP_A-1976151",
+    "SNP_A-1729876",
+    "SNP_A-1516453",
+    "SNP_A-1738691",
+    "SNP_A-1510911",
+    "SNP_A-1507696",
+    NULL,
+    "SNP_A-1508875",
+    "SNP_A-1508585",
+    "SNP_A-1517100",
+    NULL,
+    NULL,
+    "SNP_A-1722910",
+    "SNP_A-1509200",
+    "SNP_A-1685262",
+    "SNP_A-1660523",
+    "SNP_A-1706571",
+    "SNP_A-1518943",
+    "SNP_A-1685518",
+    "SNP_A-1519465",
+    NULL,
+    "SNP_A-1508846",
+    "SNP_A-1508861",
+    NULL,
+    "SNP_A-4264940",
+    "SNP_A-1519373",
+    "SNP_A-1963663",
+    "SNP_A-1511030",
+    NULL,
+    "SNP_A-1513575",
+    "SNP_A-1724322",
+    "SNP_A-1509047",
+    "SNP_A-8671481",
+    "SNP_A-1683042",
+    "SNP_A-1517600",
+    NULL,
+    "SNP_A-1749923",
+    NULL,
+    "SNP_A-1509391",
+    NULL,
+    "SNP_A-1710401",
+    "SNP_A-4257697",
+    "SNP_A-1678274",
+    "SNP_A-1713978",
+    NULL,
+    NULL,
+    "SNP_A-1510177",
+    "SNP_A-1512380",
+    "SNP_A-1517131",
+    "SNP_A-1737333",
+    "SNP_A-2014565",
+    "SNP_A-1518359",
+    "SNP_A-1518587",
+    "SNP_A-1512124",
+    "SNP_A-1509420",
+    "SNP_A-1519498",
+    "SNP_A-1514546",
+    "SNP_A-1689675",
+    "SNP_A-1686462",
+    "SNP_A-1515501",
+    "SNP_A-1514074",
+    "SNP_A-1509759",
+    "SNP_A-1512216",
+    "SNP_A-1729246",
+    "SNP_A-1696126",
+    "SNP_A-1680148",
+    "SNP_A-4303400",
+    "SNP_A-1511533",
+    "SNP_A-1651768",
+    NULL,
+    "SNP_A-1518012",
+    "SNP_A-4289263",
+    NULL,
+    NULL,
+    "SNP_A-1512020",
+    "SNP_A-1688648",
+    "SNP_A-1998467",
+    "SNP_A-1514725",
+    NULL,
+    "SNP_A-1860220",
+    "SNP_A-1511685",
+    "SNP_A-1512716",
+    "SNP_A-8506147",
+    NULL,
+    "SNP_A-1666080",
+    "SNP_A-2311037",
+    "SNP_A-1510801",
+    "SNP_A-1674064",
+    "SNP_A-1670167",
+    "SNP_A-2070640",
+    "SNP_A-4255849",
+    "SNP_A-1707367",
+    "SNP_A-1513917",
+    "SNP_A-1512918",
+    "SNP_A-4226470",
+    "SNP_A-1515672",
+    "SNP_A-1702547",
+    "SNP_A-1509374",
+    "SNP_A-1511003",
+    NULL,
+    NULL,
+    "SNP_A-1509215",
+    "SNP_A-1512056",
+    "SNP_A-1732269",
+    "SNP_A-1745292",
+    "SNP_A-1999492",
+    "SNP_A-1509450",
+    "SNP_A-1510590",
+    "SNP_A-1744861",
+    "SNP_A-1750869",
+    "SNP_A-1516267",
+    NULL,
+    "SNP_A-1744155",
+    "SNP_A-4200867",
+    "SNP_A-1689266",
+    "SNP_A-1881819",
+    "SNP_A-1706740",
+    "SNP_A-1910447",
+    NULL,
+    "SNP_A-1734982",
+    "SNP_A-1987180",
+    "SNP_A-1507987",
+    "SNP_A-1683650",
+    "SNP_A-1514225",
+    "SNP_A-1518914",
+    "SNP_A-1724652",
+    "SNP_A-1665132",
+    "SNP_A-1507340",
+    NULL,
+    "SNP_A-1511701",
+    "SNP_A-1510867",
+    "SNP_A-1667456",
+    "SNP_A-1516927",
+    "SNP_A-1681230",
+    "SNP_A-8598505",
+    NULL,
+    "SNP_A-1997141",
+    "SNP_A-1513657",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1676077",
+    NULL,
+    "SNP_A-2037848",
+    "SNP_A-4215227",
+    "SNP_A-1515112",
+    "SNP_A-1755720",
+    "SNP_A-1516132",
+    "SNP_A-1519169",
+    "SNP_A-1730150",
+    "SNP_A-1975115",
+    NULL,
+    NULL,
+    "SNP_A-1704173",
+    "SNP_A-1516440",
+    "SNP_A-1513158",
+    "SNP_A-1514518",
+    "SNP_A-1517215",
+    "SNP_A-1648770",
+    "SNP_A-1709901",
+    "SNP_A-8437784",
+    "SNP_A-1720447",
+    "SNP_A-1511874",
+    "SNP_A-2006890",
+    "SNP_A-1660351",
+    "SNP_A-1515694",
+    "SNP_A-1669831",
+    NULL,
+    "SNP_A-1988429",
+    "SNP_A-1515870",
+    "SNP_A-1510723",
+    "SNP_A-1729268",
+    NULL,
+    "SNP_A-8617664",
+    "SNP_A-8286241",
+    "SNP_A-4206832",
+    "SNP_A-8392053",
+    "SNP_A-8577400",
+    "SNP_A-1649479",
+    "SNP_A-2051404",
+    "SNP_A-1714607",
+    "SNP_A-2001162",
+    "SNP_A-1750855",
+    "SNP_A-1713303",
+    NULL,
+    "SNP_A-1676576",
+    "SNP_A-1510673",
+    "SNP_A-1517240",
+    NULL,
+    "SNP_A-1513152",
+    "SNP_A-2021014",
+    "SNP_A-1518934",
+    "SNP_A-4209736",
+    "SNP_A-1718133",
+    "SNP_A-1659200",
+    "SNP_A-1650068",
+    "SNP_A-1679882",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1704329",
+    "SNP_A-1518675",
+    "SNP_A-1740377",
+    NULL,
+    "SNP_A-1508819",
+    "SNP_A-1740063",
+    "SNP_A-1715493",
+    "SNP_A-1606361",
+    "SNP_A-1513783",
+    "SNP_A-1924736",
+    NULL,
+    "SNP_A-1682678",
+    "SNP_A-1717677",
+    "SNP_A-1516335",
+    "SNP_A-1727853",
+    NULL,
+    "SNP_A-1757597",
+    "SNP_A-1507810",
+    "SNP_A-1516096",
+    "SNP_A-1748917",
+    NULL,
+    "SNP_A-1518376",
+    "SNP_A-1518001",
+    "SNP_A-1518076",
+    "SNP_A-1516621",
+    "SNP_A-1754518",
+    "SNP_A-1674989",
+    NULL,
+    "SNP_A-1720571",
+    "SNP_A-1519741",
+    "SNP_A-1517269",
+    "SNP_A-1656051",
+    NULL,
+    "SNP_A-1507378",
+    "SNP_A-1723610",
+    "SNP_A-1719511",
+    "SNP_A-1740943",
+    NULL,
+    "SNP_A-1725174",
+    "SNP_A-1701297",
+    "SNP_A-1511067",
+    "SNP_A-1513952",
+    "SNP_A-1703441",
+    "SNP_A-1514116",
+    "SNP_A-8460935",
+    NULL,
+    NULL,
+    "SNP_A-1683164",
+    "SNP_A-1514635",
+    NULL,
+    NULL,
+    "SNP_A-1659444",
+    "SNP_A-1719179",
+    "SNP_A-1677318",
+    NULL,
+    "SNP_A-1513072",
+    "SNP_A-1513658",
+    "SNP_A-1510561",
+    "SNP_A-1516087",
+    "SNP_A-1709553",
+    "SNP_A-1757593",
+    "SNP_A-1732810",
+    "SNP_A-1725912",
+    "SNP_A-1514746",
+    NULL,
+    "SNP_A-1650674",
+    "SNP_A-1512568",
+    "SNP_A-1984853",
+    "SNP_A-1509392",
+    NULL,
+    "SNP_A-1515679",
+    "SNP_A-1518748",
+    "SNP_A-1646620",
+    NULL,
+    "SNP_A-1701341",
+    "SNP_A-1517212",
+    "SNP_A-1515964",
+    "SNP_A-1647478",
+    "SNP_A-1512395",
+    "SNP_A-1704599",
+    NULL,
+    "SNP_A-1513274",
+    "SNP_A-1689606",
+    "SNP_A-1754640",
+    "SNP_A-1706187",
+    "SNP_A-1652928",
+    "SNP_A-1512180",
+    "SNP_A-1508203",
+    "SNP_A-1656243",
+    "SNP_A-1515539",
+    "SNP_A-1750903",
+    "SNP_A-1677846",
+    "SNP_A-1709719",
+    "SNP_A-1739909",
+    "SNP_A-1653166",
+    "SNP_A-1517501",
+    "SNP_A-1694279",
+    "SNP_A-1743747",
+    "SNP_A-1514787",
+    "SNP_A-1748261",
+    "SNP_A-1509616",
+    "SNP_A-1667990",
+    "SNP_A-1926931",
+    "SNP_A-1516165",
+    "SNP_A-1752155",
+    NULL,
+    NULL,
+    "SNP_A-1665820",
+    "SNP_A-1515237",
+    "SNP_A-1714649",
+    "SNP_A-1512733",
+    NULL,
+    NULL,
+    "SNP_A-1519121",
+    "SNP_A-1514598",
+    "SNP_A-8575217",
+    "SNP_A-1727170",
+    NULL,
+    "SNP_A-1651022",
+    "SNP_A-1509295",
+    "SNP_A-1510559",
+    "SNP_A-1513827",
+    "SNP_A-1676988",
+    "SNP_A-1510969",
+    NULL,
+    "SNP_A-1725936",
+    "SNP_A-1653440",
+    "SNP_A-1755428",
+    "SNP_A-1517549",
+    "SNP_A-1514376",
+    NULL,
+    "SNP_A-1510869",
+    "SNP_A-1512292",
+    "SNP_A-1513237",
+    "SNP_A-1700360",
+    "SNP_A-1509747",
+    "SNP_A-1515880",
+    "SNP_A-1751463",
+    "SNP_A-1984974",
+    NULL,
+    NULL,
+    "SNP_A-1752369",
+    "SNP_A-8286341",
+    "SNP_A-1725698",
+    "SNP_A-1735973",
+    "SNP_A-1711836",
+    "SNP_A-1515939",
+    "SNP_A-1996413",
+    "SNP_A-1748333",
+    "SNP_A-1508600",
+    NULL,
+    "SNP_A-1518036",
+    NULL,
+    "SNP_A-1519271",
+    "SNP_A-1517217",
+    "SNP_A-1690371",
+    "SNP_A-4212899",
+    "SNP_A-1510658",
+    "SNP_A-8665163",
+    NULL,
+    "SNP_A-1518875",
+    "SNP_A-1514381",
+    "SNP_A-1729772",
+    "SNP_A-8578156",
+    "SNP_A-1732496",
+    "SNP_A-1513124",
+    NULL,
+    "SNP_A-1997198",
+    "SNP_A-1511549",
+    NULL,
+    "SNP_A-1705621",
+    "SNP_A-1518326",
+    "SNP_A-1644824",
+    NULL,
+    NULL,
+    "SNP_A-1511686",
+    "SNP_A-1740919",
+    "SNP_A-8671523",
+    "SNP_A-1519174",
+    "SNP_A-1515230",
+    "SNP_A-1685012",
+    "SNP_A-1519562",
+    "SNP_A-1511978",
+    "SNP_A-1513821",
+    "SNP_A-1509186",
+    "SNP_A-1758315",
+    "SNP_A-1519412",
+    "SNP_A-1707479",
+    NULL,
+    "SNP_A-1697645",
+    "SNP_A-8671337",
+    "SNP_A-1512797",
+    "SNP_A-1508059",
+    "SNP_A-1517187",
+    "SNP_A-1738535",
+    "SNP_A-1689382",
+    "SNP_A-1966821",
+    "SNP_A-4252080",
+    "SNP_A-1740089",
+    "SNP_A-1516831",
+    "SNP_A-8354380",
+    NULL,
+    "SNP_A-1517813",
+    "SNP_A-1511845",
+    NULL,
+    NULL,
+    "SNP_A-1514102",
+    "SNP_A-1724541",
+    "SNP_A-1508665",
+    "SNP_A-1659214",
+    "SNP_A-1680146",
+    "SNP_A-1661594",
+    "SNP_A-1711020",
+    "SNP_A-1697653",
+    "SNP_A-1516734",
+    "SNP_A-1744925",
+    "SNP_A-1511796",
+    NULL,
+    "SNP_A-1509849",
+    NULL,
+    "SNP_A-1665926",
+    "SNP_A-1519441",
+    "SNP_A-1678320",
+    NULL,
+    "SNP_A-4212725",
+    "SNP_A-8283303",
+    NULL,
+    "SNP_A-1511636",
+    "SNP_A-1699451",
+    "SNP_A-1512437",
+    "SNP_A-1519164",
+    "SNP_A-8620448",
+    "SNP_A-1516662",
+    "SNP_A-1687224",
+    NULL,
+    "SNP_A-1666350",
+    "SNP_A-1678262",
+    NULL,
+    "SNP_A-1673134",
+    "SNP_A-1717063",
+    "SNP_A-1972441",
+    "SNP_A-2134274",
+    "SNP_A-1517238",
+    NULL,
+    "SNP_A-1708142",
+    "SNP_A-1516509",
+    "SNP_A-1507974",
+    "SNP_A-1606339",
+    "SNP_A-1709569",
+    NULL,
+    NULL,
+    "SNP_A-1689877",
+    "SNP_A-1510584",
+    NULL,
+    "SNP_A-1508069",
+    "SNP_A-1517682",
+    "SNP_A-1758232",
+    NULL,
+    "SNP_A-1513348",
+    NULL,
+    NULL,
+    "SNP_A-1742555",
+    "SNP_A-1731677",
+    NULL,
+    "SNP_A-1721847",
+    "SNP_A-8617244",
+    "SNP_A-1518819",
+    "SNP_A-1514507",
+    "SNP_A-1511565",
+    "SNP_A-1690083",
+    NULL,
+    "SNP_A-1519225",
+    "SNP_A-1512818",
+    "SNP_A-1651614",
+    "SNP_A-1664458",
+    "SNP_A-1668097",
+    "SNP_A-1674961",
+    "SNP_A-1512654",
+    "SNP_A-8670808",
+    "SNP_A-1508783",
+    NULL,
+    "SNP_A-1519691",
+    "SNP_A-1757617",
+    NULL,
+    "SNP_A-1672548",
+    "SNP_A-1512833",
+    "SNP_A-8599372",
+    NULL,
+    "SNP_A-1995540",
+    "SNP_A-1515796",
+    "SNP_A-1508996",
+    "SNP_A-1515781",
+    NULL,
+    "SNP_A-1514826",
+    "SNP_A-1508048",
+    NULL,
+    "SNP_A-1689731",
+    "SNP_A-1512008",
+    "SNP_A-1685378",
+    "SNP_A-1509708",
+    "SNP_A-1732934",
+    "SNP_A-4268664",
+    "SNP_A-1510303",
+    "SNP_A-1512139",
+    "SNP_A-1509107",
+    NULL,
+    "SNP_A-1730148",
+    "SNP_A-1744269",
+    "SNP_A-1516789",
+    NULL,
+    "SNP_A-1518206",
+    "SNP_A-4213865",
+    "SNP_A-1971931",
+    NULL,
+    "SNP_A-1513342",
+    "SNP_A-1652686",
+    "SNP_A-1512496",
+    "SNP_A-2037850",
+    "SNP_A-1678366",
+    "SNP_A-1516753",
+    "SNP_A-1516394",
+    "SNP_A-1509890",
+    "SNP_A-1642687",
+    "SNP_A-4251605",
+    "SNP_A-1517997",
+    "SNP_A-1513382",
+    "SNP_A-1514311",
+    "SNP_A-8662704",
+    "SNP_A-1511102",
+    "SNP_A-1519586",
+    "SNP_A-1684386",
+    NULL,
+    "SNP_A-8619389",
+    "SNP_A-4215022",
+    "SNP_A-1683210",
+    "SNP_A-1519191",
+    NULL,
+    "SNP_A-1509395",
+    "SNP_A-8663959",
+    "SNP_A-1678630",
+    "SNP_A-1519699",
+    "SNP_A-1751857",
+    "SNP_A-1657638",
+    NULL,
+    "SNP_A-1513172",
+    "SNP_A-1997882",
+    "SNP_A-1712335",
+    NULL,
+    "SNP_A-1732139",
+    "SNP_A-1509114",
+    NULL,
+    "SNP_A-1518175",
+    "SNP_A-1514250",
+    "SNP_A-4215769",
+    "SNP_A-1510474",
+    "SNP_A-1513756",
+    "SNP_A-1652136",
+    "SNP_A-1507893",
+    "SNP_A-1517849",
+    "SNP_A-1734130",
+    NULL,
+    "SNP_A-1517793",
+    "SNP_A-1514414",
+    "SNP_A-1656103",
+    "SNP_A-8610868",
+    NULL,
+    "SNP_A-1726966",
+    "SNP_A-1517340",
+    "SNP_A-1511418",
+    "SNP_A-1674747",
+    "SNP_A-1656259",
+    "SNP_A-1725324",
+    NULL,
+    "SNP_A-1742373",
+    "SNP_A-1512650",
+    "SNP_A-1700690",
+    "SNP_A-8620296",
+    NULL,
+    "SNP_A-1513817",
+    "SNP_A-1512624",
+    "SNP_A-1518193",
+    "SNP_A-1714829",
+    "SNP_A-1508279",
+    "SNP_A-1519418",
+    "SNP_A-1710257",
+    NULL,
+    "SNP_A-1707309",
+    "SNP_A-1515697",
+    "SNP_A-1515398",
+    NULL,
+    NULL,
+    "SNP_A-4210469",
+    "SNP_A-1508975",
+    NULL,
+    "SNP_A-1671472",
+    "SNP_A-8621434",
+    "SNP_A-1651450",
+    "SNP_A-4267934",
+    "SNP_A-4257161",
+    NULL,
+    "SNP_A-1519288",
+    "SNP_A-1519086",
+    "SNP_A-1803142",
+    "SNP_A-1512916",
+    NULL,
+    "SNP_A-1515936",
+    "SNP_A-1719455",
+    NULL,
+    NULL,
+    "SNP_A-2022857",
+    "SNP_A-8539611",
+    NULL,
+    "SNP_A-1519236",
+    "SNP_A-1513485",
+    "SNP_A-1511296",
+    "SNP_A-1723448",
+    "SNP_A-1672158",
+    "SNP_A-1803920",
+    "SNP_A-1729045",
+    "SNP_A-1753457",
+    "SNP_A-1694405",
+    NULL,
+    "SNP_A-1658856",
+    NULL,
+    NULL,
+    "SNP_A-1513384",
+    "SNP_A-1681152",
+    "SNP_A-1720031",
+    "SNP_A-1724830",
+    "SNP_A-1518511",
+    "SNP_A-1660159",
+    "SNP_A-1702463",
+    "SNP_A-1515344",
+    "SNP_A-1658190",
+    "SNP_A-1515954",
+    "SNP_A-1518428",
+    "SNP_A-1512168",
+    "SNP_A-1516462",
+    "SNP_A-1508230",
+    "SNP_A-1756495",
+    "SNP_A-1514263",
+    NULL,
+    "SNP_A-4234537",
+    "SNP_A-1519637",
+    "SNP_A-1644004",
+    "SNP_A-1508240",
+    "SNP_A-1752063",
+    "SNP_A-1511475",
+    "SNP_A-1750373",
+    NULL,
+    "SNP_A-1512570",
+    "SNP_A-1509478",
+    NULL,
+    "SNP_A-1707171",
+    "SNP_A-1512121",
+    "SNP_A-1509372",
+    "SNP_A-1511368",
+    "SNP_A-1507651",
+    "SNP_A-1509397",
+    "SNP_A-1713372",
+    NULL,
+    NULL,
+    "SNP_A-1716955",
+    NULL,
+    "SNP_A-1974259",
+    "SNP_A-1702109",
+    "SNP_A-1513889",
+    "SNP_A-1513146",
+    "SNP_A-1660549",
+    "SNP_A-1517535",
+    "SNP_A-1741893",
+    "SNP_A-1513220",
+    NULL,
+    "SNP_A-1507598",
+    "SNP_A-1659500",
+    "SNP_A-1998586",
+    "SNP_A-1678192",
+    "SNP_A-1669091",
+    NULL,
+    "SNP_A-1712843",
+    NULL,
+    "SNP_A-1976902",
+    "SNP_A-1516502",
+    "SNP_A-1710179",
+    NULL,
+    "SNP_A-1514124",
+    "SNP_A-1509583",
+    "SNP_A-1518419",
+    "SNP_A-1510991",
+    "SNP_A-1518332",
+    "SNP_A-1699703",
+    "SNP_A-1717339",
+    "SNP_A-1754544",
+    "SNP_A-8606271",
+    "SNP_A-1512037",
+    "SNP_A-1514895",
+    "SNP_A-1510688",
+    NULL,
+    NULL,
+    "SNP_A-1510196",
+    "SNP_A-8282155",
+    "SNP_A-4266614",
+    "SNP_A-1515307",
+    "SNP_A-1721353",
+    NULL,
+    "SNP_A-1515457",
+    "SNP_A-1515685",
+    "SNP_A-1511342",
+    NULL,
+    "SNP_A-1516852",
+    "SNP_A-1755620",
+    NULL,
+    NULL,
+    "SNP_A-1694385",
+    "SNP_A-8374741",
+    "SNP_A-1675247",
+    "SNP_A-1715785",
+    "SNP_A-1512375",
+    "SNP_A-1514189",
+    "SNP_A-1701401",
+    NULL,
+    NULL,
+    "SNP_A-1510070",
+    NULL,
+    "SNP_A-1978616",
+    "SNP_A-1648234",
+    "SNP_A-1518738",
+    NULL,
+    "SNP_A-1515191",
+    NULL,
+    "SNP_A-1698341",
+    NULL,
+    "SNP_A-1516474",
+    NULL,
+    "SNP_A-1655085",
+    NULL,
+    "SNP_A-2240970",
+    "SNP_A-1757073",
+    "SNP_A-1516503",
+    "SNP_A-8336086",
+    "SNP_A-1710608",
+    "SNP_A-8363789",
+    "SNP_A-8334093",
+    "SNP_A-1509911",
+    "SNP_A-1510048",
+    "SNP_A-1737041",
+    "SNP_A-1739533",
+    NULL,
+    "SNP_A-2103132",
+    "SNP_A-8579541",
+    "SNP_A-1519485",
+    "SNP_A-1967948",
+    "SNP_A-1978834",
+    "SNP_A-4208107",
+    "SNP_A-1517046",
+    "SNP_A-1509458",
+    "SNP_A-1518360",
+    "SNP_A-1514083",
+    "SNP_A-1606277",
+    "SNP_A-8663761",
+    "SNP_A-1856149",
+    "SNP_A-1948716",
+    "SNP_A-1665688",
+    "SNP_A-1513749",
+    NULL,
+    "SNP_A-1515852",
+    NULL,
+    NULL,
+    "SNP_A-1513517",
+    "SNP_A-1513332",
+    NULL,
+    "SNP_A-8620564",
+    NULL,
+    "SNP_A-1510270",
+    "SNP_A-1705039",
+    "SNP_A-8574904",
+    "SNP_A-8666646",
+    "SNP_A-1516114",
+    "SNP_A-1677982",
+    NULL,
+    "SNP_A-1986174",
+    "SNP_A-1516540",
+    "SNP_A-8421848",
+    "SNP_A-1741301",
+    "SNP_A-1698865",
+    "SNP_A-1754954",
+    "SNP_A-1519218",
+    "SNP_A-1981585",
+    NULL,
+    "SNP_A-1726188",
+    "SNP_A-4195010",
+    "SNP_A-8458303",
+    "SNP_A-1736091",
+    "SNP_A-1513399",
+    "SNP_A-1509595",
+    "SNP_A-1716745",
+    "SNP_A-1513855",
+    "SNP_A-1519176",
+    NULL,
+    NULL,
+    "SNP_A-1519119",
+    "SNP_A-1519005",
+    "SNP_A-1509881",
+    "SNP_A-1517565",
+    "SNP_A-1514559",
+    "SNP_A-1675367",
+    "SNP_A-1647060",
+    "SNP_A-1671382",
+    "SNP_A-1518696",
+    "SNP_A-1518529",
+    "SNP_A-1742153",
+    "SNP_A-1513323",
+    NULL,
+    "SNP_A-1518371",
+    "SNP_A-1517189",
+    "SNP_A-1744653",
+    "SNP_A-1675169",
+    NULL,
+    NULL,
+    "SNP_A-1743239",
+    "SNP_A-1695171",
+    "SNP_A-1512910",
+    "SNP_A-1508581",
+    "SNP_A-1514398",
+    "SNP_A-1511196",
+    "SNP_A-1754658",
+    "SNP_A-1512448",
+    "SNP_A-1650024",
+    "SNP_A-1509280",
+    NULL,
+    "SNP_A-1518145",
+    "SNP_A-1706845",
+    "SNP_A-1690277",
+    "SNP_A-1758601",
+    NULL,
+    "SNP_A-1732904",
+    "SNP_A-1711040",
+    "SNP_A-1507978",
+    "SNP_A-1513463",
+    "SNP_A-1699993",
+    "SNP_A-1515696",
+    "SNP_A-1670029",
+    "SNP_A-1606278",
+    "SNP_A-8282357",
+    "SNP_A-2003775",
+    NULL,
+    "SNP_A-1512732",
+    "SNP_A-1519061",
+    NULL,
+    "SNP_A-1664010",
+    "SNP_A-1741819",
+    "SNP_A-1519693",
+    "SNP_A-1709645",
+    "SNP_A-1509715",
+    "SNP_A-1519456",
+    "SNP_A-1515820",
+    NULL,
+    "SNP_A-1519401",
+    "SNP_A-1512208",
+    "SNP_A-1512544",
+    NULL,
+    NULL,
+    "SNP_A-1646360",
+    "SNP_A-1662222",
+    "SNP_A-1508812",
+    "SNP_A-1692876",
+    "SNP_A-1653386",
+    NULL,
+    NULL,
+    "SNP_A-1719121",
+    "SNP_A-1678742",
+    NULL,
+    NULL,
+    "SNP_A-1646768",
+    NULL,
+    "SNP_A-1752375",
+    "SNP_A-1513369",
+    "SNP_A-1507779",
+    "SNP_A-1757897",
+    NULL,
+    "SNP_A-1731837",
+    "SNP_A-1518902",
+    "SNP_A-1971756",
+    NULL,
+    "SNP_A-1890317",
+    "SNP_A-8663623",
+    "SNP_A-4220476",
+    "SNP_A-1710395",
+    NULL,
+    "SNP_A-1694419",
+    "SNP_A-1514289",
+    NULL,
+    "SNP_A-8574676",
+    "SNP_A-1516411",
+    "SNP_A-1511253",
+    "SNP_A-1724718",
+    "SNP_A-1699623",
+    "SNP_A-1518804",
+    "SNP_A-1654585",
+    "SNP_A-1519592",
+    NULL,
+    "SNP_A-1976358",
+    "SNP_A-1654943",
+    "SNP_A-1510024",
+    NULL,
+    "SNP_A-1674189",
+    "SNP_A-1514517",
+    "SNP_A-1755858",
+    NULL,
+    "SNP_A-8396803",
+    "SNP_A-8665294",
+    "SNP_A-1510376",
+    "SNP_A-1509523",
+    "SNP_A-8336762",
+    "SNP_A-1512510",
+    "SNP_A-1515018",
+    "SNP_A-4213395",
+    "SNP_A-1704283",
+    NULL,
+    "SNP_A-1987899",
+    "SNP_A-1508359",
+    NULL,
+    "SNP_A-1689531",
+    "SNP_A-1653354",
+    "SNP_A-1984129",
+    "SNP_A-4263726",
+    "SNP_A-1751517",
+    NULL,
+    "SNP_A-1514508",
+    "SNP_A-1698837",
+    "SNP_A-1513374",
+    "SNP_A-1988119",
+    "SNP_A-1665864",
+    "SNP_A-1508847",
+    "SNP_A-1745424",
+    "SNP_A-1683108",
+    "SNP_A-1518601",
+    "SNP_A-1518086",
+    "SNP_A-1519283",
+    "SNP_A-4289490",
+    NULL,
+    "SNP_A-1516850",
+    "SNP_A-1989707",
+    "SNP_A-1647718",
+    NULL,
+    "SNP_A-1516496",
+    "SNP_A-1705161",
+    "SNP_A-1720747",
+    "SNP_A-1519531",
+    "SNP_A-1512956",
+    "SNP_A-1691086",
+    "SNP_A-1514925",
+    NULL,
+    "SNP_A-1739437",
+    "SNP_A-1676356",
+    "SNP_A-1518379",
+    "SNP_A-1516900",
+    "SNP_A-1519177",
+    "SNP_A-1651028",
+    "SNP_A-1515214",
+    "SNP_A-1511709",
+    "SNP_A-1720667",
+    "SNP_A-1519596",
+    NULL,
+    "SNP_A-1719767",
+    "SNP_A-1673358",
+    "SNP_A-1509480",
+    "SNP_A-1646164",
+    "SNP_A-1697573",
+    NULL,
+    "SNP_A-1515055",
+    NULL,
+    "SNP_A-1513741",
+    "SNP_A-1511218",
+    "SNP_A-1972322",
+    "SNP_A-1739367",
+    "SNP_A-1694179",
+    NULL,
+    "SNP_A-1507926",
+    "SNP_A-1507606",
+    "SNP_A-1720207",
+    "SNP_A-1701509",
+    "SNP_A-4244023",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1697853",
+    "SNP_A-1742949",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1667670",
+    "SNP_A-4240227",
+    "SNP_A-1686934",
+    "SNP_A-1513378",
+    "SNP_A-1515700",
+    "SNP_A-8671139",
+    NULL,
+    "SNP_A-1642835",
+    "SNP_A-1510850",
+    "SNP_A-1509050",
+    "SNP_A-1514816",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514332",
+    "SNP_A-1511601",
+    "SNP_A-4266599",
+    "SNP_A-1971582",
+    "SNP_A-1507947",
+    "SNP_A-1684400",
+    "SNP_A-1646342",
+    "SNP_A-1758749",
+    "SNP_A-1670576",
+    NULL,
+    "SNP_A-1738685",
+    "SNP_A-1675818",
+    "SNP_A-1508017",
+    "SNP_A-1652082",
+    "SNP_A-1991225",
+    "SNP_A-1511179",
+    NULL,
+    "SNP_A-1718581",
+    "SNP_A-2146166",
+    "SNP_A-1723742",
+    NULL,
+    "SNP_A-4223699",
+    "SNP_A-1507471",
+    "SNP_A-1656893",
+    "SNP_A-1733450",
+    "SNP_A-1753281",
+    "SNP_A-1652270",
+    "SNP_A-1517708",
+    "SNP_A-1646466",
+    "SNP_A-1514368",
+    "SNP_A-1738095",
+    "SNP_A-1650042",
+    "SNP_A-8666746",
+    "SNP_A-8286130",
+    NULL,
+    NULL,
+    "SNP_A-1514997",
+    "SNP_A-1517952",
+    "SNP_A-1972442",
+    NULL,
+    "SNP_A-4216046",
+    "SNP_A-1519556",
+    "SNP_A-4212560",
+    "SNP_A-1519157",
+    "SNP_A-1514075",
+    "SNP_A-2000209",
+    "SNP_A-1507486",
+    "SNP_A-1512300",
+    "SNP_A-1516220",
+    "SNP_A-1511798",
+    "SNP_A-1512569",
+    "SNP_A-1519658",
+    "SNP_A-1643375",
+    "SNP_A-1514194",
+    "SNP_A-1518388",
+    "SNP_A-1648638",
+    "SNP_A-1510848",
+    "SNP_A-1519149",
+    "SNP_A-8579497",
+    "SNP_A-1678520",
+    "SNP_A-1518309",
+    "SNP_A-1672448",
+    "SNP_A-1697581",
+    NULL,
+    "SNP_A-1510633",
+    NULL,
+    "SNP_A-1737159",
+    "SNP_A-4209371",
+    "SNP_A-1737215",
+    "SNP_A-1507707",
+    "SNP_A-1757846",
+    "SNP_A-1745676",
+    "SNP_A-1516144",
+    NULL,
+    "SNP_A-1720943",
+    "SNP_A-1701965",
+    NULL,
+    "SNP_A-1655193",
+    "SNP_A-1742107",
+    "SNP_A-1512036",
+    "SNP_A-1515429",
+    "SNP_A-1696522",
+    "SNP_A-1728373",
+    "SNP_A-1645530",
+    "SNP_A-8668775",
+    "SNP_A-1984309",
+    "SNP_A-1514941",
+    NULL,
+    "SNP_A-1512560",
+    "SNP_A-1514004",
+    "SNP_A-1652782",
+    "SNP_A-1516731",
+    "SNP_A-1517479",
+    "SNP_A-1507750",
+    "SNP_A-1518994",
+    "SNP_A-1513109",
+    "SNP_A-1515740",
+    "SNP_A-1993537",
+    "SNP_A-8414344",
+    "SNP_A-1519555",
+    "SNP_A-1706557",
+    "SNP_A-1515802",
+    "SNP_A-8657697",
+    NULL,
+    NULL,
+    "SNP_A-1508293",
+    "SNP_A-1688492",
+    "SNP_A-8285080",
+    NULL,
+    "SNP_A-1721253",
+    "SNP_A-8618321",
+    "SNP_A-1510918",
+    "SNP_A-1666582",
+    "SNP_A-1680212",
+    NULL,
+    "SNP_A-1507911",
+    "SNP_A-4213888",
+    NULL,
+    NULL,
+    "SNP_A-1646880",
+    NULL,
+    "SNP_A-1509438",
+    "SNP_A-8576495",
+    "SNP_A-1515712",
+    "SNP_A-1519743",
+    "SNP_A-1512320",
+    "SNP_A-1967602",
+    "SNP_A-1517249",
+    "SNP_A-1510372",
+    "SNP_A-1606267",
+    "SNP_A-1509242",
+    NULL,
+    NULL,
+    "SNP_A-1508206",
+    "SNP_A-1982943",
+    "SNP_A-4233452",
+    "SNP_A-1512967",
+    "SNP_A-1518944",
+    "SNP_A-1507614",
+    "SNP_A-1657113",
+    "SNP_A-1517556",
+    "SNP_A-1517033",
+    "SNP_A-2193011",
+    "SNP_A-1986404",
+    "SNP_A-1665802",
+    NULL,
+    "SNP_A-1752169",
+    "SNP_A-1695213",
+    "SNP_A-1507420",
+    "SNP_A-1518887",
+    "SNP_A-1507441",
+    NULL,
+    NULL,
+    "SNP_A-2008473",
+    "SNP_A-1716493",
+    "SNP_A-1517907",
+    "SNP_A-1974494",
+    "SNP_A-1738210",
+    "SNP_A-1996089",
+    "SNP_A-1512581",
+    NULL,
+    "SNP_A-1518374",
+    "SNP_A-1517617",
+    NULL,
+    "SNP_A-1510959",
+    "SNP_A-4264493",
+    "SNP_A-1513556",
+    NULL,
+    NULL,
+    "SNP_A-1657481",
+    "SNP_A-1703819",
+    "SNP_A-8572712",
+    NULL,
+    "SNP_A-2020824",
+    NULL,
+    NULL,
+    "SNP_A-1681210",
+    "SNP_A-1743967",
+    "SNP_A-1964460",
+    "SNP_A-1512363",
+    "SNP_A-8386171",
+    "SNP_A-1715847",
+    "SNP_A-4227854",
+    "SNP_A-1512575",
+    "SNP_A-1758837",
+    NULL,
+    "SNP_A-1513651",
+    "SNP_A-1512858",
+    "SNP_A-1519125",
+    "SNP_A-1510656",
+    "SNP_A-1510254",
+    "SNP_A-1964992",
+    "SNP_A-1507627",
+    "SNP_A-1508781",
+    NULL,
+    "SNP_A-1513334",
+    "SNP_A-1709049",
+    "SNP_A-1512815",
+    "SNP_A-1517710",
+    "SNP_A-1517162",
+    "SNP_A-1853719",
+    "SNP_A-1516698",
+    "SNP_A-1644328",
+    NULL,
+    "SNP_A-1730399",
+    "SNP_A-1653064",
+    "SNP_A-2131274",
+    "SNP_A-1650762",
+    "SNP_A-1508931",
+    "SNP_A-1509664",
+    "SNP_A-1519000",
+    "SNP_A-1518159",
+    "SNP_A-1507326",
+    "SNP_A-1700616",
+    "SNP_A-1513450",
+    NULL,
+    "SNP_A-1516663",
+    "SNP_A-1511021",
+    "SNP_A-1512753",
+    "SNP_A-1515633",
+    "SNP_A-1510903",
+    "SNP_A-1712527",
+    "SNP_A-1645302",
+    "SNP_A-1508450",
+    "SNP_A-1516400",
+    "SNP_A-1510494",
+    "SNP_A-1508113",
+    "SNP_A-4266504",
+    "SNP_A-1983318",
+    "SNP_A-1702069",
+    NULL,
+    "SNP_A-1511854",
+    "SNP_A-1518149",
+    "SNP_A-1758739",
+    "SNP_A-1517175",
+    "SNP_A-1698527",
+    "SNP_A-1653378",
+    "SNP_A-1512745",
+    "SNP_A-1508879",
+    NULL,
+    "SNP_A-1742793",
+    NULL,
+    "SNP_A-1680840",
+    "SNP_A-1758526",
+    "SNP_A-1510427",
+    "SNP_A-1516250",
+    "SNP_A-1702889",
+    "SNP_A-1668757",
+    NULL,
+    "SNP_A-1516729",
+    "SNP_A-1964561",
+    "SNP_A-1514252",
+    "SNP_A-4161638",
+    "SNP_A-1509410",
+    "SNP_A-1508425",
+    NULL,
+    "SNP_A-1680096",
+    "SNP_A-8281365",
+    "SNP_A-1739079",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514617",
+    "SNP_A-1509181",
+    "SNP_A-1512370",
+    "SNP_A-1514015",
+    NULL,
+    NULL,
+    "SNP_A-1715177",
+    "SNP_A-8674202",
+    "SNP_A-1642671",
+    NULL,
+    "SNP_A-1513732",
+    "SNP_A-1511696",
+    "SNP_A-1511510",
+    "SNP_A-1512059",
+    "SNP_A-1517675",
+    "SNP_A-1647160",
+    NULL,
+    "SNP_A-1508309",
+    "SNP_A-1750095",
+    "SNP_A-1739713",
+    "SNP_A-8620528",
+    "SNP_A-1512503",
+    NULL,
+    "SNP_A-1692308",
+    NULL,
+    NULL,
+    "SNP_A-1753365",
+    "SNP_A-1511534",
+    "SNP_A-1731181",
+    "SNP_A-1513112",
+    "SNP_A-8281486",
+    "SNP_A-1653054",
+    NULL,
+    "SNP_A-1516435",
+    NULL,
+    "SNP_A-1514495",
+    "SNP_A-2011980",
+    "SNP_A-1513816",
+    "SNP_A-1514395",
+    "SNP_A-1516799",
+    "SNP_A-1676228",
+    NULL,
+    "SNP_A-1989069",
+    "SNP_A-1693493",
+    "SNP_A-1516408",
+    "SNP_A-1519656",
+    "SNP_A-1513446",
+    "SNP_A-1658092",
+    "SNP_A-1655477",
+    "SNP_A-1606333",
+    "SNP_A-1509599",
+    "SNP_A-1515443",
+    "SNP_A-1518674",
+    "SNP_A-1512589",
+    "SNP_A-1507843",
+    "SNP_A-1654069",
+    "SNP_A-1510420",
+    "SNP_A-1517134",
+    NULL,
+    NULL,
+    "SNP_A-2045165",
+    "SNP_A-1514652",
+    "SNP_A-1683604",
+    "SNP_A-1678730",
+    "SNP_A-1517352",
+    "SNP_A-1515942",
+    "SNP_A-1512668",
+    "SNP_A-1743377",
+    "SNP_A-1507667",
+    "SNP_A-1731791",
+    "SNP_A-1718293",
+    NULL,
+    "SNP_A-2118349",
+    "SNP_A-1517297",
+    "SNP_A-1672234",
+    "SNP_A-1745352",
+    "SNP_A-1512649",
+    "SNP_A-1515064",
+    NULL,
+    "SNP_A-8574244",
+    NULL,
+    "SNP_A-1688014",
+    "SNP_A-1513858",
+    "SNP_A-1512960",
+    "SNP_A-1698371",
+    "SNP_A-1509258",
+    "SNP_A-1509155",
+    NULL,
+    NULL,
+    "SNP_A-1704943",
+    "SNP_A-1514674",
+    "SNP_A-1736939",
+    "SNP_A-1666834",
+    "SNP_A-1509674",
+    NULL,
+    "SNP_A-1709203",
+    "SNP_A-1651650",
+    NULL,
+    "SNP_A-1665002",
+    "SNP_A-1510609",
+    NULL,
+    "SNP_A-1507782",
+    "SNP_A-1513203",
+    "SNP_A-1693459",
+    NULL,
+    "SNP_A-1518799",
+    "SNP_A-1513033",
+    "SNP_A-1720025",
+    "SNP_A-1513061",
+    "SNP_A-1516085",
+    "SNP_A-1682784",
+    "SNP_A-1653060",
+    "SNP_A-1606261",
+    "SNP_A-1669579",
+    NULL,
+    "SNP_A-2100900",
+    NULL,
+    "SNP_A-1519329",
+    "SNP_A-1518761",
+    "SNP_A-1682654",
+    "SNP_A-1509602",
+    NULL,
+    "SNP_A-1519686",
+    "SNP_A-1721081",
+    "SNP_A-1689338",
+    "SNP_A-1515400",
+    "SNP_A-1674341",
+    "SNP_A-1978224",
+    "SNP_A-1749853",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1508831",
+    "SNP_A-1519606",
+    "SNP_A-1509160",
+    "SNP_A-1514473",
+    "SNP_A-1656941",
+    "SNP_A-1512352",
+    "SNP_A-1991526",
+    "SNP_A-1513380",
+    "SNP_A-1518290",
+    NULL,
+    "SNP_A-1509611",
+    "SNP_A-4210529",
+    "SNP_A-1646878",
+    "SNP_A-1705245",
+    NULL,
+    "SNP_A-8579143",
+    "SNP_A-1667946",
+    "SNP_A-1746975",
+    "SNP_A-1511603",
+    "SNP_A-1699111",
+    NULL,
+    "SNP_A-1513396",
+    "SNP_A-1512032",
+    "SNP_A-1685184",
+    NULL,
+    "SNP_A-1717451",
+    "SNP_A-1750045",
+    NULL,
+    "SNP_A-1691740",
+    "SNP_A-1682976",
+    NULL,
+    "SNP_A-8527773",
+    "SNP_A-1514427",
+    "SNP_A-1514485",
+    NULL,
+    "SNP_A-1758597",
+    "SNP_A-1512752",
+    "SNP_A-8663214",
+    "SNP_A-1648582",
+    "SNP_A-1718149",
+    "SNP_A-1515448",
+    NULL,
+    "SNP_A-1682758",
+    "SNP_A-8666995",
+    "SNP_A-1516929",
+    "SNP_A-1726240",
+    NULL,
+    NULL,
+    "SNP_A-8427054",
+    "SNP_A-1988777",
+    "SNP_A-4262679",
+    "SNP_A-1757991",
+    NULL,
+    "SNP_A-8663749",
+    NULL,
+    "SNP_A-1514048",
+    "SNP_A-1514750",
+    "SNP_A-1515142",
+    "SNP_A-1519096",
+    "SNP_A-1511637",
+    "SNP_A-1716201",
+    "SNP_A-1514405",
+    NULL,
+    "SNP_A-1512100",
+    "SNP_A-1736827",
+    "SNP_A-1644704",
+    NULL,
+    NULL,
+    "SNP_A-4262851",
+    "SNP_A-1517083",
+    "SNP_A-1728229",
+    "SNP_A-1669709",
+    NULL,
+    "SNP_A-1731933",
+    "SNP_A-1733860",
+    "SNP_A-1711476",
+    "SNP_A-1515480",
+    NULL,
+    "SNP_A-1509905",
+    NULL,
+    "SNP_A-1722078",
+    NULL,
+    "SNP_A-1508724",
+    "SNP_A-8585962",
+    "SNP_A-1508118",
+    NULL,
+    "SNP_A-8579130",
+    "SNP_A-1709797",
+    "SNP_A-1704279",
+    "SNP_A-1749467",
+    "SNP_A-1508456",
+    "SNP_A-4286910",
+    "SNP_A-1721612",
+    "SNP_A-1508823",
+    "SNP_A-1510830",
+    "SNP_A-1671420",
+    "SNP_A-1682572",
+    NULL,
+    "SNP_A-1513242",
+    "SNP_A-1681346",
+    NULL,
+    NULL,
+    "SNP_A-1511872",
+    NULL,
+    "SNP_A-1742445",
+    "SNP_A-1991652",
+    "SNP_A-1511913",
+    "SNP_A-1518507",
+    "SNP_A-1513613",
+    "SNP_A-8446819",
+    "SNP_A-4268367",
+    "SNP_A-1664118",
+    "SNP_A-1515337",
+    "SNP_A-1516308",
+    "SNP_A-4220828",
+    "SNP_A-1694843",
+    "SNP_A-8590565",
+    "SNP_A-1690161",
+    "SNP_A-1713722",
+    "SNP_A-1515838",
+    "SNP_A-1702241",
+    NULL,
+    "SNP_A-1517323",
+    "SNP_A-1653084",
+    "SNP_A-1700432",
+    "SNP_A-1715167",
+    "SNP_A-1984973",
+    "SNP_A-2006750",
+    "SNP_A-1515188",
+    "SNP_A-1517940",
+    NULL,
+    "SNP_A-1512321",
+    "SNP_A-1683654",
+    "SNP_A-1516283",
+    "SNP_A-1507389",
+    "SNP_A-1517066",
+    "SNP_A-1517821",
+    "SNP_A-1653670",
+    "SNP_A-1518638",
+    "SNP_A-1512934",
+    "SNP_A-1657570",
+    "SNP_A-1645508",
+    "SNP_A-1516396",
+    "SNP_A-1512850",
+    "SNP_A-1516176",
+    "SNP_A-1657554",
+    NULL,
+    "SNP_A-1692998",
+    "SNP_A-1743367",
+    "SNP_A-4221442",
+    "SNP_A-1519723",
+    "SNP_A-1702159",
+    "SNP_A-1742915",
+    "SNP_A-1515199",
+    "SNP_A-1515317",
+    "SNP_A-1673886",
+    "SNP_A-1703297",
+    "SNP_A-4266248",
+    "SNP_A-1518556",
+    "SNP_A-1666280",
+    "SNP_A-4287782",
+    "SNP_A-1519514",
+    NULL,
+    "SNP_A-1726092",
+    NULL,
+    "SNP_A-1606268",
+    "SNP_A-1517604",
+    "SNP_A-1512407",
+    NULL,
+    "SNP_A-1509529",
+    "SNP_A-1745693",
+    "SNP_A-1680698",
+    "SNP_A-1510530",
+    "SNP_A-1513448",
+    "SNP_A-1517999",
+    "SNP_A-1698803",
+    NULL,
+    "SNP_A-1509234",
+    "SNP_A-1514431",
+    "SNP_A-1517602",
+    NULL,
+    "SNP_A-4263697",
+    "SNP_A-1735392",
+    NULL,
+    "SNP_A-1511442",
+    "SNP_A-1513873",
+    "SNP_A-1650306",
+    "SNP_A-1740597",
+    "SNP_A-1671992",
+    "SNP_A-1986673",
+    "SNP_A-1728955",
+    "SNP_A-1517862",
+    "SNP_A-1512438",
+    NULL,
+    "SNP_A-1514588",
+    "SNP_A-1708959",
+    "SNP_A-1507946",
+    "SNP_A-1519494",
+    "SNP_A-1510122",
+    "SNP_A-1678548",
+    "SNP_A-1516422",
+    NULL,
+    "SNP_A-1748883",
+    "SNP_A-1644778",
+    "SNP_A-2208824",
+    "SNP_A-1709675",
+    "SNP_A-1518499",
+    "SNP_A-1519399",
+    "SNP_A-1751639",
+    "SNP_A-1516498",
+    NULL,
+    "SNP_A-1675962",
+    "SNP_A-1509763",
+    NULL,
+    "SNP_A-1668897",
+    NULL,
+    "SNP_A-1670860",
+    "SNP_A-8678253",
+    "SNP_A-1737231",
+    "SNP_A-1517568",
+    "SNP_A-1985670",
+    NULL,
+    "SNP_A-1518213",
+    "SNP_A-1683090",
+    "SNP_A-2005419",
+    NULL,
+    "SNP_A-1519548",
+    NULL,
+    "SNP_A-1741901",
+    NULL,
+    "SNP_A-1517620",
+    "SNP_A-1694323",
+    "SNP_A-8688745",
+    "SNP_A-1732265",
+    NULL,
+    NULL,
+    "SNP_A-1510982",
+    "SNP_A-1753921",
+    NULL,
+    "SNP_A-1703509",
+    "SNP_A-1983852",
+    "SNP_A-1662728",
+    NULL,
+    "SNP_A-1980401",
+    "SNP_A-1677736",
+    "SNP_A-1700496",
+    "SNP_A-8289671",
+    "SNP_A-1641881",
+    "SNP_A-1512805",
+    "SNP_A-1509587",
+    NULL,
+    "SNP_A-1517279",
+    "SNP_A-1517389",
+    "SNP_A-1704933",
+    "SNP_A-1731411",
+    NULL,
+    "SNP_A-1686686",
+    NULL,
+    NULL,
+    "SNP_A-1672052",
+    "SNP_A-1691678",
+    "SNP_A-1513333",
+    "SNP_A-1513740",
+    "SNP_A-1979200",
+    "SNP_A-1695973",
+    "SNP_A-1507565",
+    "SNP_A-1512365",
+    "SNP_A-1512265",
+    NULL,
+    "SNP_A-1515103",
+    "SNP_A-1702433",
+    "SNP_A-1508387",
+    "SNP_A-4275855",
+    "SNP_A-1517234",
+    "SNP_A-1518437",
+    "SNP_A-1519375",
+    "SNP_A-8328824",
+    "SNP_A-1511562",
+    "SNP_A-1513770",
+    NULL,
+    NULL,
+    "SNP_A-1706507",
+    NULL,
+    "SNP_A-4269865",
+    "SNP_A-4164238",
+    "SNP_A-1962081",
+    NULL,
+    "SNP_A-1512498",
+    "SNP_A-8621226",
+    "SNP_A-1515690",
+    "SNP_A-1753673",
+    "SNP_A-1515653",
+    "SNP_A-1511934",
+    "SNP_A-1721165",
+    "SNP_A-1507587",
+    NULL,
+    "SNP_A-1710291",
+    "SNP_A-1740169",
+    "SNP_A-2007270",
+    "SNP_A-1517173",
+    "SNP_A-1515912",
+    "SNP_A-1509122",
+    NULL,
+    "SNP_A-1704385",
+    "SNP_A-1510700",
+    "SNP_A-1519655",
+    "SNP_A-1998372",
+    "SNP_A-1513195",
+    NULL,
+    "SNP_A-1672006",
+    "SNP_A-8620206",
+    NULL,
+    "SNP_A-8396597",
+    "SNP_A-1516352",
+    "SNP_A-1517755",
+    "SNP_A-4265880",
+    NULL,
+    "SNP_A-1511627",
+    "SNP_A-1510133",
+    "SNP_A-1515941",
+    "SNP_A-1744441",
+    "SNP_A-2304006",
+    "SNP_A-1514828",
+    "SNP_A-1687446",
+    "SNP_A-1510422",
+    "SNP_A-1508651",
+    "SNP_A-1749087",
+    NULL,
+    "SNP_A-1515083",
+    "SNP_A-1758825",
+    "SNP_A-1507901",
+    "SNP_A-1507721",
+    "SNP_A-1517818",
+    "SNP_A-1695979",
+    "SNP_A-1515769",
+    "SNP_A-1732317",
+    "SNP_A-1509308",
+    NULL,
+    "SNP_A-1512156",
+    "SNP_A-1683802",
+    "SNP_A-1656673",
+    NULL,
+    "SNP_A-1511605",
+    "SNP_A-1648568",
+    "SNP_A-1703277",
+    "SNP_A-1511613",
+    "SNP_A-1656959",
+    "SNP_A-1667314",
+    "SNP_A-1508461",
+    "SNP_A-1726982",
+    "SNP_A-1519321",
+    NULL,
+    "SNP_A-4212636",
+    "SNP_A-1508214",
+    "SNP_A-1508199",
+    "SNP_A-1678208",
+    "SNP_A-4213746",
+    NULL,
+    NULL,
+    "SNP_A-1735000",
+    "SNP_A-1680834",
+    NULL,
+    NULL,
+    "SNP_A-1512333",
+    "SNP_A-1696946",
+    NULL,
+    "SNP_A-1517070",
+    "SNP_A-1985231",
+    "SNP_A-8666676",
+    "SNP_A-1511716",
+    "SNP_A-1697821",
+    "SNP_A-1509874",
+    "SNP_A-1685590",
+    NULL,
+    NULL,
+    "SNP_A-1755424",
+    "SNP_A-1510161",
+    "SNP_A-1646382",
+    "SNP_A-1748193",
+    "SNP_A-1739539",
+    "SNP_A-1507832",
+    "SNP_A-1518891",
+    "SNP_A-1701331",
+    "SNP_A-1517406",
+    NULL,
+    "SNP_A-1694305",
+    "SNP_A-1683484",
+    "SNP_A-1516004",
+    "SNP_A-1517414",
+    "SNP_A-1515139",
+    "SNP_A-1507752",
+    "SNP_A-1514957",
+    "SNP_A-1731831",
+    "SNP_A-1508424",
+    "SNP_A-1515631",
+    NULL,
+    "SNP_A-1509032",
+    "SNP_A-1512410",
+    "SNP_A-1978506",
+    "SNP_A-4213955",
+    "SNP_A-1511049",
+    "SNP_A-1518054",
+    "SNP_A-1644998",
+    "SNP_A-1716207",
+    "SNP_A-1989776",
+    "SNP_A-1508068",
+    "SNP_A-1643127",
+    NULL,
+    "SNP_A-1512639",
+    "SNP_A-1751899",
+    "SNP_A-1682892",
+    "SNP_A-1733130",
+    NULL,
+    "SNP_A-8665684",
+    NULL,
+    "SNP_A-1684740",
+    "SNP_A-8662610",
+    NULL,
+    "SNP_A-1728459",
+    "SNP_A-1514011",
+    "SNP_A-1512552",
+    "SNP_A-1519594",
+    "SNP_A-1681666",
+    NULL,
+    "SNP_A-1707251",
+    NULL,
+    "SNP_A-1755546",
+    "SNP_A-1507481",
+    "SNP_A-1511108",
+    "SNP_A-1513022",
+    "SNP_A-1516906",
+    "SNP_A-1508619",
+    NULL,
+    "SNP_A-1513930",
+    "SNP_A-1512210",
+    NULL,
+    "SNP_A-8337581",
+    "SNP_A-1513818",
+    "SNP_A-1694945",
+    "SNP_A-1679298",
+    "SNP_A-8643657",
+    NULL,
+    "SNP_A-1512376",
+    "SNP_A-1517177",
+    "SNP_A-1689092",
+    "SNP_A-1660257",
+    "SNP_A-1723434",
+    NULL,
+    "SNP_A-1642191",
+    "SNP_A-1675225",
+    "SNP_A-1718862",
+    NULL,
+    "SNP_A-2296153",
+    "SNP_A-1510266",
+    "SNP_A-1511382",
+    "SNP_A-1757939",
+    "SNP_A-1659690",
+    "SNP_A-1672912",
+    NULL,
+    "SNP_A-1515961",
+    "SNP_A-1709821",
+    "SNP_A-1645408",
+    "SNP_A-1671454",
+    NULL,
+    "SNP_A-1656395",
+    "SNP_A-1517959",
+    "SNP_A-1650874",
+    "SNP_A-1516358",
+    "SNP_A-1509101",
+    "SNP_A-1742529",
+    "SNP_A-4290800",
+    NULL,
+    "SNP_A-1512936",
+    "SNP_A-1515706",
+    "SNP_A-1697368",
+    "SNP_A-1509236",
+    "SNP_A-1518878",
+    NULL,
+    NULL,
+    "SNP_A-8577021",
+    NULL,
+    "SNP_A-1751335",
+    "SNP_A-1732996",
+    NULL,
+    "SNP_A-1808280",
+    "SNP_A-1507358",
+    "SNP_A-4260951",
+    "SNP_A-1822633",
+    "SNP_A-8664198",
+    "SNP_A-1516232",
+    "SNP_A-1519604",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1677102",
+    "SNP_A-1510622",
+    "SNP_A-1519354",
+    "SNP_A-1516649",
+    NULL,
+    NULL,
+    "SNP_A-1711244",
+    "SNP_A-1517805",
+    NULL,
+    "SNP_A-1698177",
+    "SNP_A-1662264",
+    "SNP_A-1515315",
+    "SNP_A-1685968",
+    NULL,
+    "SNP_A-1748233",
+    "SNP_A-1513176",
+    "SNP_A-1510627",
+    "SNP_A-1512994",
+    "SNP_A-1692584",
+    "SNP_A-1663628",
+    NULL,
+    "SNP_A-1507538",
+    "SNP_A-1723550",
+    "SNP_A-1674579",
+    "SNP_A-1516592",
+    "SNP_A-1510910",
+    "SNP_A-1642651",
+    "SNP_A-1688076",
+    "SNP_A-1728281",
+    "SNP_A-1513544",
+    "SNP_A-1510294",
+    "SNP_A-1696764",
+    NULL,
+    "SNP_A-8290610",
+    "SNP_A-1516555",
+    "SNP_A-1513101",
+    "SNP_A-1509273",
+    "SNP_A-1700428",
+    "SNP_A-1718211",
+    "SNP_A-1516797",
+    "SNP_A-1515148",
+    NULL,
+    "SNP_A-1509497",
+    NULL,
+    "SNP_A-1516807",
+    NULL,
+    "SNP_A-2017350",
+    "SNP_A-1642953",
+    "SNP_A-1974356",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1513161",
+    "SNP_A-1657764",
+    "SNP_A-1669695",
+    "SNP_A-1515013",
+    "SNP_A-1741379",
+    "SNP_A-1705459",
+    "SNP_A-1517887",
+    "SNP_A-1510506",
+    "SNP_A-1509430",
+    NULL,
+    "SNP_A-1668051",
+    "SNP_A-4269521",
+    "SNP_A-4265566",
+    "SNP_A-1516695",
+    NULL,
+    "SNP_A-1668939",
+    "SNP_A-1727487",
+    "SNP_A-1517571",
+    "SNP_A-1514891",
+    NULL,
+    NULL,
+    "SNP_A-1715647",
+    "SNP_A-1719553",
+    "SNP_A-1643429",
+    "SNP_A-1512930",
+    "SNP_A-1513416",
+    "SNP_A-1720783",
+    "SNP_A-1711432",
+    "SNP_A-1697170",
+    "SNP_A-1507818",
+    "SNP_A-4211732",
+    "SNP_A-1512226",
+    "SNP_A-1517477",
+    "SNP_A-1721445",
+    "SNP_A-1972978",
+    "SNP_A-1515141",
+    "SNP_A-1642079",
+    "SNP_A-1702195",
+    "SNP_A-1752569",
+    NULL,
+    "SNP_A-1649623",
+    "SNP_A-1654481",
+    NULL,
+    "SNP_A-1515284",
+    "SNP_A-1509925",
+    NULL,
+    "SNP_A-1649282",
+    "SNP_A-1705307",
+    "SNP_A-1708040",
+    "SNP_A-2037265",
+    "SNP_A-1512585",
+    "SNP_A-1729982",
+    NULL,
+    "SNP_A-1507619",
+    NULL,
+    "SNP_A-8620251",
+    "SNP_A-2134773",
+    NULL,
+    NULL,
+    "SNP_A-1677888",
+    "SNP_A-1513538",
+    NULL,
+    NULL,
+    "SNP_A-4212404",
+    "SNP_A-1681390",
+    "SNP_A-1606272",
+    "SNP_A-4279785",
+    "SNP_A-1731247",
+    "SNP_A-1509475",
+    "SNP_A-1512290",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1745674",
+    NULL,
+    NULL,
+    "SNP_A-1518599",
+    NULL,
+    "SNP_A-1746597",
+    "SNP_A-1708162",
+    "SNP_A-1681090",
+    "SNP_A-1519695",
+    "SNP_A-1514917",
+    NULL,
+    "SNP_A-1758612",
+    "SNP_A-1518893",
+    "SNP_A-1710431",
+    "SNP_A-8285284",
+    "SNP_A-1515811",
+    "SNP_A-1984182",
+    "SNP_A-1711408",
+    "SNP_A-1509281",
+    "SNP_A-1662918",
+    "SNP_A-1509189",
+    "SNP_A-1647346",
+    "SNP_A-1508939",
+    "SNP_A-8285086",
+    "SNP_A-1509649",
+    "SNP_A-1510866",
+    "SNP_A-1510297",
+    "SNP_A-1514372",
+    "SNP_A-1707980",
+    "SNP_A-1739465",
+    "SNP_A-4213133",
+    "SNP_A-1507347",
+    NULL,
+    NULL,
+    "SNP_A-1985328",
+    NULL,
+    "SNP_A-8345521",
+    "SNP_A-1675478",
+    "SNP_A-1509601",
+    "SNP_A-1989480",
+    "SNP_A-1687952",
+    "SNP_A-1511400",
+    "SNP_A-1516131",
+    NULL,
+    "SNP_A-1512193",
+    "SNP_A-1989405",
+    "SNP_A-1517126",
+    "SNP_A-1734736",
+    "SNP_A-1710652",
+    "SNP_A-4242176",
+    "SNP_A-8417668",
+    "SNP_A-8679732",
+    "SNP_A-1508176",
+    NULL,
+    "SNP_A-1993721",
+    NULL,
+    "SNP_A-1690992",
+    "SNP_A-1669443",
+    "SNP_A-1508282",
+    "SNP_A-8427752",
+    NULL,
+    "SNP_A-1726746",
+    "SNP_A-1507716",
+    NULL,
+    "SNP_A-1725644",
+    NULL,
+    "SNP_A-4202441",
+    "SNP_A-1511571",
+    "SNP_A-1516803",
+    "SNP_A-1507493",
+    NULL,
+    "SNP_A-1507891",
+    "SNP_A-1514041",
+    "SNP_A-1514158",
+    NULL,
+    "SNP_A-1715221",
+    "SNP_A-1661752",
+    "SNP_A-1688108",
+    NULL,
+    "SNP_A-1980018",
+    "SNP_A-1753445",
+    "SNP_A-1512289",
+    "SNP_A-1517241",
+    "SNP_A-1508087",
+    "SNP_A-1517090",
+    "SNP_A-1517012",
+    "SNP_A-1642509",
+    "SNP_A-4210882",
+    "SNP_A-8281011",
+    "SNP_A-1511159",
+    "SNP_A-1700095",
+    "SNP_A-1648592",
+    "SNP_A-1513863",
+    NULL,
+    "SNP_A-1512775",
+    "SNP_A-1519044",
+    NULL,
+    "SNP_A-1650364",
+    "SNP_A-1508867",
+    "SNP_A-1512203",
+    "SNP_A-1508157",
+    "SNP_A-1517020",
+    NULL,
+    "SNP_A-1751667",
+    NULL,
+    "SNP_A-1691974",
+    "SNP_A-1998415",
+    "SNP_A-1507652",
+    "SNP_A-1510143",
+    "SNP_A-4144546",
+    "SNP_A-8670769",
+    "SNP_A-1739747",
+    "SNP_A-8500475",
+    NULL,
+    "SNP_A-1517790",
+    "SNP_A-1975308",
+    "SNP_A-1515109",
+    "SNP_A-1701051",
+    "SNP_A-1738653",
+    "SNP_A-1701575",
+    "SNP_A-1681404",
+    "SNP_A-1677150",
+    "SNP_A-1731485",
+    "SNP_A-1510241",
+    NULL,
+    "SNP_A-1661508",
+    NULL,
+    "SNP_A-1513134",
+    "SNP_A-1519113",
+    "SNP_A-1512864",
+    NULL,
+    "SNP_A-1725908",
+    "SNP_A-1515577",
+    "SNP_A-8576188",
+    "SNP_A-1516620",
+    "SNP_A-1730312",
+    "SNP_A-1992422",
+    "SNP_A-1510165",
+    NULL,
+    "SNP_A-1507537",
+    "SNP_A-1516560",
+    "SNP_A-1758991",
+    NULL,
+    "SNP_A-1659878",
+    NULL,
+    NULL,
+    "SNP_A-1516484",
+    "SNP_A-8602680",
+    "SNP_A-1516875",
+    "SNP_A-1508736",
+    NULL,
+    "SNP_A-1519235",
+    "SNP_A-1514030",
+    "SNP_A-1517300",
+    "SNP_A-1735398",
+    "SNP_A-1512564",
+    "SNP_A-1510570",
+    NULL,
+    NULL,
+    "SNP_A-1515788",
+    NULL,
+    "SNP_A-1510314",
+    "SNP_A-1508385",
+    NULL,
+    "SNP_A-8285722",
+    "SNP_A-1687040",
+    "SNP_A-1655079",
+    NULL,
+    "SNP_A-1509084",
+    "SNP_A-1508773",
+    "SNP_A-1519239",
+    "SNP_A-1518624",
+    "SNP_A-1507369",
+    "SNP_A-1516505",
+    NULL,
+    "SNP_A-1515913",
+    NULL,
+    "SNP_A-1507543",
+    "SNP_A-1982254",
+    NULL,
+    "SNP_A-1606365",
+    NULL,
+    "SNP_A-1740967",
+    NULL,
+    "SNP_A-1696416",
+    "SNP_A-1518251",
+    "SNP_A-1514515",
+    "SNP_A-1995556",
+    "SNP_A-1700169",
+    "SNP_A-4265545",
+    "SNP_A-1517500",
+    NULL,
+    "SNP_A-1513820",
+    "SNP_A-8667348",
+    "SNP_A-1509359",
+    "SNP_A-2303882",
+    NULL,
+    "SNP_A-1511668",
+    "SNP_A-1703587",
+    "SNP_A-1518586",
+    "SNP_A-1690753",
+    "SNP_A-1701027",
+    "SNP_A-1962547",
+    "SNP_A-1725586",
+    "SNP_A-4262386",
+    "SNP_A-1713786",
+    NULL,
+    "SNP_A-1757695",
+    NULL,
+    "SNP_A-1664288",
+    "SNP_A-1649936",
+    "SNP_A-1740357",
+    "SNP_A-1516153",
+    "SNP_A-1507427",
+    "SNP_A-1512689",
+    "SNP_A-8663748",
+    NULL,
+    NULL,
+    "SNP_A-1511046",
+    "SNP_A-1751603",
+    "SNP_A-1664254",
+    NULL,
+    "SNP_A-1511828",
+    "SNP_A-1517287",
+    "SNP_A-2023361",
+    "SNP_A-1650702",
+    "SNP_A-1684652",
+    "SNP_A-1757882",
+    "SNP_A-1513236",
+    "SNP_A-8329146",
+    NULL,
+    "SNP_A-1508759",
+    "SNP_A-8667986",
+    "SNP_A-1514285",
+    NULL,
+    "SNP_A-1518445",
+    "SNP_A-1510503",
+    "SNP_A-1712905",
+    "SNP_A-1731391",
+    NULL,
+    NULL,
+    "SNP_A-1510120",
+    "SNP_A-1517857",
+    "SNP_A-1650018",
+    "SNP_A-1508601",
+    NULL,
+    "SNP_A-8664517",
+    "SNP_A-1517982",
+    "SNP_A-1508107",
+    "SNP_A-1515898",
+    "SNP_A-1665756",
+    NULL,
+    "SNP_A-1710774",
+    "SNP_A-1519569",
+    NULL,
+    "SNP_A-8356282",
+    "SNP_A-8500327",
+    "SNP_A-4190250",
+    "SNP_A-1516894",
+    "SNP_A-4269048",
+    NULL,
+    "SNP_A-2001405",
+    "SNP_A-1510321",
+    "SNP_A-1512478",
+    "SNP_A-8662241",
+    "SNP_A-1511042",
+    NULL,
+    "SNP_A-8711609",
+    "SNP_A-1690209",
+    "SNP_A-1986853",
+    "SNP_A-1645252",
+    "SNP_A-1668060",
+    "SNP_A-8346143",
+    "SNP_A-1728947",
+    "SNP_A-1512170",
+    "SNP_A-8283930",
+    "SNP_A-8667021",
+    "SNP_A-1514126",
+    "SNP_A-1517278",
+    "SNP_A-1969210",
+    "SNP_A-1735032",
+    "SNP_A-1687136",
+    "SNP_A-4270936",
+    "SNP_A-4255983",
+    "SNP_A-1518035",
+    NULL,
+    NULL,
+    "SNP_A-1509923",
+    NULL,
+    "SNP_A-8287424",
+    "SNP_A-1744899",
+    NULL,
+    NULL,
+    "SNP_A-1507644",
+    NULL,
+    "SNP_A-8315677",
+    "SNP_A-1517387",
+    "SNP_A-1511298",
+    "SNP_A-1512499",
+    NULL,
+    NULL,
+    "SNP_A-1510686",
+    "SNP_A-2013749",
+    NULL,
+    "SNP_A-1519210",
+    "SNP_A-8539209",
+    "SNP_A-1509177",
+    "SNP_A-1518245",
+    "SNP_A-1518562",
+    "SNP_A-1733602",
+    NULL,
+    "SNP_A-1518860",
+    "SNP_A-1515882",
+    "SNP_A-1515175",
+    "SNP_A-1694555",
+    "SNP_A-1511657",
+    NULL,
+    "SNP_A-1694587",
+    NULL,
+    "SNP_A-1516092",
+    "SNP_A-1715903",
+    NULL,
+    "SNP_A-1666294",
+    "SNP_A-1514959",
+    "SNP_A-1518315",
+    "SNP_A-1517838",
+    NULL,
+    "SNP_A-1508423",
+    NULL,
+    "SNP_A-1516656",
+    "SNP_A-1509711",
+    "SNP_A-1513363",
+    "SNP_A-1514324",
+    "SNP_A-1508912",
+    "SNP_A-1738048",
+    "SNP_A-1728555",
+    NULL,
+    "SNP_A-1511574",
+    "SNP_A-1512859",
+    NULL,
+    NULL,
+    "SNP_A-1716187",
+    "SNP_A-1519627",
+    "SNP_A-1963872",
+    "SNP_A-1656799",
+    "SNP_A-1519448",
+    NULL,
+    "SNP_A-1514326",
+    "SNP_A-8621287",
+    "SNP_A-1511639",
+    NULL,
+    "SNP_A-1512573",
+    NULL,
+    NULL,
+    "SNP_A-4214918",
+    "SNP_A-1649180",
+    "SNP_A-1515321",
+    "SNP_A-1694927",
+    "SNP_A-1508092",
+    "SNP_A-1515642",
+    "SNP_A-1508115",
+    "SNP_A-4269820",
+    NULL,
+    "SNP_A-1719041",
+    NULL,
+    "SNP_A-1513322",
+    "SNP_A-1671310",
+    "SNP_A-1511505",
+    "SNP_A-1672666",
+    "SNP_A-1662912",
+    "SNP_A-1513730",
+    "SNP_A-8337156",
+    "SNP_A-1512655",
+    "SNP_A-8662602",
+    "SNP_A-1606324",
+    "SNP_A-1507569",
+    "SNP_A-4296108",
+    "SNP_A-8286732",
+    NULL,
+    NULL,
+    "SNP_A-1672224",
+    "SNP_A-1647993",
+    "SNP_A-1730889",
+    "SNP_A-4267432",
+    NULL,
+    "SNP_A-4214461",
+    "SNP_A-2029057",
+    "SNP_A-1510632",
+    "SNP_A-1517041",
+    "SNP_A-1516764",
+    "SNP_A-1517471",
+    "SNP_A-1516140",
+    "SNP_A-1751043",
+    "SNP_A-2304863",
+    NULL,
+    "SNP_A-1703333",
+    "SNP_A-8670229",
+    "SNP_A-4208622",
+    "SNP_A-1735903",
+    "SNP_A-1682810",
+    "SNP_A-1683884",
+    NULL,
+    "SNP_A-1519190",
+    "SNP_A-1672332",
+    "SNP_A-1514407",
+    "SNP_A-8662043",
+    "SNP_A-1513099",
+    "SNP_A-1509813",
+    "SNP_A-1750533",
+    "SNP_A-1507438",
+    "SNP_A-1517700",
+    "SNP_A-1991334",
+    "SNP_A-1515725",
+    "SNP_A-1675964",
+    "SNP_A-1644810",
+    "SNP_A-1674221",
+    "SNP_A-1509627",
+    "SNP_A-1514634",
+    "SNP_A-1510968",
+    "SNP_A-1656057",
+    "SNP_A-1518044",
+    "SNP_A-4261802",
+    "SNP_A-1659648",
+    "SNP_A-1513992",
+    NULL,
+    "SNP_A-1683932",
+    "SNP_A-1686038",
+    "SNP_A-1973624",
+    "SNP_A-1663092",
+    "SNP_A-1516867",
+    "SNP_A-1509582",
+    "SNP_A-1511435",
+    "SNP_A-1728345",
+    NULL,
+    "SNP_A-1752027",
+    "SNP_A-1510010",
+    "SNP_A-1710543",
+    "SNP_A-1514837",
+    "SNP_A-1509797",
+    NULL,
+    "SNP_A-1517309",
+    NULL,
+    "SNP_A-8663571",
+    "SNP_A-1985631",
+    NULL,
+    "SNP_A-1667312",
+    "SNP_A-1703173",
+    "SNP_A-8579371",
+    "SNP_A-8664309",
+    "SNP_A-1968630",
+    "SNP_A-1705743",
+    "SNP_A-1519265",
+    "SNP_A-1517140",
+    "SNP_A-1667652",
+    "SNP_A-4263649",
+    "SNP_A-1509605",
+    "SNP_A-8664545",
+    "SNP_A-1510470",
+    "SNP_A-8414802",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1515239",
+    "SNP_A-1753609",
+    NULL,
+    "SNP_A-1519423",
+    "SNP_A-4252796",
+    "SNP_A-1517687",
+    "SNP_A-1508809",
+    "SNP_A-1513232",
+    "SNP_A-1726674",
+    NULL,
+    "SNP_A-1642575",
+    "SNP_A-1508560",
+    "SNP_A-1664318",
+    "SNP_A-1743869",
+    "SNP_A-1511583",
+    NULL,
+    "SNP_A-1996689",
+    "SNP_A-1508563",
+    "SNP_A-1735617",
+    "SNP_A-1518087",
+    "SNP_A-1674080",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1662598",
+    "SNP_A-1519220",
+    "SNP_A-1510416",
+    "SNP_A-1508512",
+    "SNP_A-1749577",
+    "SNP_A-1514710",
+    NULL,
+    NULL,
+    "SNP_A-1509039",
+    NULL,
+    "SNP_A-1701193",
+    "SNP_A-1684824",
+    "SNP_A-1687186",
+    "SNP_A-1511001",
+    "SNP_A-1515937",
+    "SNP_A-1514347",
+    "SNP_A-1513183",
+    "SNP_A-1519478",
+    "SNP_A-1509830",
+    "SNP_A-1517433",
+    "SNP_A-1508365",
+    "SNP_A-1511618",
+    "SNP_A-1712091",
+    "SNP_A-1658596",
+    "SNP_A-1715267",
+    "SNP_A-1511595",
+    "SNP_A-1709161",
+    NULL,
+    "SNP_A-1672822",
+    "SNP_A-1507875",
+    NULL,
+    NULL,
+    "SNP_A-1698087",
+    NULL,
+    "SNP_A-1515345",
+    NULL,
+    "SNP_A-1652944",
+    NULL,
+    "SNP_A-1518510",
+    "SNP_A-1517253",
+    "SNP_A-1514430",
+    "SNP_A-1519701",
+    NULL,
+    "SNP_A-1511369",
+    NULL,
+    "SNP_A-1750873",
+    "SNP_A-1513737",
+    "SNP_A-1991573",
+    "SNP_A-1674163",
+    "SNP_A-1518618",
+    NULL,
+    NULL,
+    "SNP_A-1683614",
+    NULL,
+    NULL,
+    "SNP_A-1507909",
+    NULL,
+    "SNP_A-1712869",
+    NULL,
+    NULL,
+    "SNP_A-1519324",
+    "SNP_A-1514973",
+    NULL,
+    "SNP_A-1509672",
+    NULL,
+    "SNP_A-1511474",
+    "SNP_A-1729602",
+    "SNP_A-1652950",
+    "SNP_A-1507734",
+    "SNP_A-1507885",
+    "SNP_A-1516965",
+    "SNP_A-1674605",
+    "SNP_A-1966288",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1517871",
+    NULL,
+    "SNP_A-1757852",
+    "SNP_A-1748513",
+    "SNP_A-1983506",
+    NULL,
+    "SNP_A-1699545",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1984173",
+    "SNP_A-1517203",
+    "SNP_A-1692162",
+    "SNP_A-1507938",
+    "SNP_A-1515529",
+    NULL,
+    "SNP_A-1700837",
+    "SNP_A-1704413",
+    "SNP_A-1518653",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1679650",
+    "SNP_A-4210774",
+    "SNP_A-2138290",
+    "SNP_A-1732528",
+    "SNP_A-1509646",
+    "SNP_A-1510449",
+    "SNP_A-1509671",
+    "SNP_A-1510153",
+    NULL,
+    "SNP_A-1708835",
+    "SNP_A-1513368",
+    "SNP_A-1735244",
+    NULL,
+    "SNP_A-1513188",
+    NULL,
+    "SNP_A-1518032",
+    NULL,
+    "SNP_A-1704753",
+    "SNP_A-1662540",
+    NULL,
+    "SNP_A-1510820",
+    "SNP_A-1516533",
+    "SNP_A-1738559",
+    "SNP_A-1741987",
+    "SNP_A-1682514",
+    NULL,
+    NULL,
+    "SNP_A-1740321",
+    "SNP_A-1508426",
+    NULL,
+    NULL,
+    "SNP_A-1514173",
+    NULL,
+    "SNP_A-1513636",
+    "SNP_A-1513892",
+    "SNP_A-8688853",
+    "SNP_A-1518640",
+    NULL,
+    "SNP_A-8577899",
+    "SNP_A-1645046",
+    "SNP_A-1653790",
+    "SNP_A-1512557",
+    "SNP_A-1509238",
+    "SNP_A-1794867",
+    "SNP_A-1719369",
+    "SNP_A-8524474",
+    "SNP_A-1515654",
+    "SNP_A-4279290",
+    "SNP_A-1737603",
+    "SNP_A-1672318",
+    NULL,
+    "SNP_A-1690926",
+    "SNP_A-1649610",
+    "SNP_A-1722818",
+    NULL,
+    NULL,
+    "SNP_A-1514913",
+    "SNP_A-1509940",
+    "SNP_A-1667010",
+    "SNP_A-8537921",
+    "SNP_A-1646182",
+    "SNP_A-1818109",
+    "SNP_A-1516916",
+    "SNP_A-1513255",
+    NULL,
+    "SNP_A-1511788",
+    "SNP_A-1519120",
+    NULL,
+    NULL,
+    "SNP_A-1516079",
+    "SNP_A-1507453",
+    "SNP_A-1748223",
+    NULL,
+    "SNP_A-1847794",
+    "SNP_A-8285409",
+    "SNP_A-1515855",
+    NULL,
+    "SNP_A-1736617",
+    "SNP_A-1510668",
+    "SNP_A-1655281",
+    "SNP_A-1507950",
+    "SNP_A-1723180",
+    "SNP_A-1510740",
+    "SNP_A-8333756",
+    "SNP_A-1508951",
+    "SNP_A-1512780",
+    "SNP_A-4228192",
+    "SNP_A-1977814",
+    "SNP_A-1516487",
+    "SNP_A-1962495",
+    "SNP_A-1507448",
+    "SNP_A-1511727",
+    "SNP_A-8291019",
+    "SNP_A-1509064",
+    "SNP_A-1661248",
+    "SNP_A-1752625",
+    "SNP_A-4262701",
+    "SNP_A-4295063",
+    "SNP_A-1666908",
+    "SNP_A-1685312",
+    "SNP_A-1512841",
+    "SNP_A-1713926",
+    "SNP_A-1671488",
+    "SNP_A-1721972",
+    "SNP_A-1663398",
+    "SNP_A-1513753",
+    "SNP_A-8668013",
+    "SNP_A-1750453",
+    NULL,
+    "SNP_A-1748909",
+    "SNP_A-1509724",
+    NULL,
+    "SNP_A-1509880",
+    NULL,
+    NULL,
+    "SNP_A-1519397",
+    "SNP_A-8662329",
+    "SNP_A-1743421",
+    "SNP_A-1712803",
+    NULL,
+    "SNP_A-1975794",
+    NULL,
+    "SNP_A-1747105",
+    "SNP_A-1511423",
+    "SNP_A-1518766",
+    "SNP_A-1513557",
+    "SNP_A-1510899",
+    "SNP_A-1518933",
+    NULL,
+    "SNP_A-1507678",
+    "SNP_A-1517621",
+    NULL,
+    "SNP_A-1507834",
+    "SNP_A-1512440",
+    "SNP_A-1715163",
+    "SNP_A-1509380",
+    "SNP_A-1518768",
+    NULL,
+    NULL,
+    "SNP_A-1514174",
+    "SNP_A-1515924",
+    "SNP_A-1702691",
+    "SNP_A-1514356",
+    "SNP_A-1686568",
+    NULL,
+    NULL,
+    "SNP_A-1730521",
+    NULL,
+    "SNP_A-1718447",
+    "SNP_A-1518615",
+    "SNP_A-1516578",
+    "SNP_A-1508833",
+    "SNP_A-1669717",
+    "SNP_A-1510534",
+    "SNP_A-1516959",
+    "SNP_A-1657377",
+    "SNP_A-1509643",
+    "SNP_A-1679660",
+    NULL,
+    "SNP_A-1518584",
+    "SNP_A-1516541",
+    "SNP_A-1512461",
+    NULL,
+    "SNP_A-1513260",
+    "SNP_A-1512572",
+    "SNP_A-1759039",
+    NULL,
+    NULL,
+    "SNP_A-1517486",
+    NULL,
+    "SNP_A-1725076",
+    "SNP_A-1514454",
+    "SNP_A-1606354",
+    "SNP_A-8621098",
+    "SNP_A-1680912",
+    "SNP_A-1515881",
+    "SNP_A-1720153",
+    "SNP_A-8671080",
+    NULL,
+    "SNP_A-1514610",
+    "SNP_A-1689570",
+    NULL,
+    "SNP_A-1518877",
+    "SNP_A-1511905",
+    "SNP_A-1747909",
+    "SNP_A-1692862",
+    NULL,
+    "SNP_A-1518715",
+    NULL,
+    "SNP_A-8287693",
+    "SNP_A-1755370",
+    "SNP_A-1755766",
+    NULL,
+    "SNP_A-1695189",
+    "SNP_A-2285206",
+    "SNP_A-1646138",
+    "SNP_A-1514892",
+    "SNP_A-1668016",
+    "SNP_A-1507607",
+    "SNP_A-1691368",
+    "SNP_A-1512076",
+    NULL,
+    "SNP_A-1511178",
+    "SNP_A-1516412",
+    "SNP_A-1680902",
+    "SNP_A-1514550",
+    "SNP_A-1510567",
+    "SNP_A-1509455",
+    "SNP_A-1511842",
+    "SNP_A-1731089",
+    "SNP_A-1698193",
+    "SNP_A-1745978",
+    "SNP_A-1518744",
+    "SNP_A-1515088",
+    "SNP_A-1512891",
+    "SNP_A-8536196",
+    "SNP_A-1508636",
+    "SNP_A-1511419",
+    "SNP_A-1880075",
+    "SNP_A-1657558",
+    NULL,
+    "SNP_A-1511567",
+    "SNP_A-1518256",
+    "SNP_A-1519628",
+    NULL,
+    NULL,
+    "SNP_A-1515565",
+    NULL,
+    NULL,
+    "SNP_A-1734036",
+    NULL,
+    "SNP_A-1730146",
+    "SNP_A-1515417",
+    "SNP_A-1671478",
+    NULL,
+    NULL,
+    "SNP_A-1687920",
+    "SNP_A-1674945",
+    "SNP_A-1691264",
+    "SNP_A-1733438",
+    "SNP_A-4212919",
+    NULL,
+    "SNP_A-1755464",
+    NULL,
+    "SNP_A-1516035",
+    "SNP_A-1519672",
+    "SNP_A-1985513",
+    "SNP_A-1516992",
+    "SNP_A-1514850",
+    NULL,
+    "SNP_A-1694981",
+    "SNP_A-1516851",
+    NULL,
+    "SNP_A-1745936",
+    "SNP_A-8356006",
+    "SNP_A-1516497",
+    "SNP_A-1510648",
+    "SNP_A-1689679",
+    "SNP_A-1510055",
+    "SNP_A-8300274",
+    "SNP_A-1516382",
+    "SNP_A-1510280",
+    "SNP_A-1513523",
+    "SNP_A-1606281",
+    "SNP_A-1508578",
+    NULL,
+    "SNP_A-1516713",
+    "SNP_A-1507749",
+    NULL,
+    "SNP_A-1758322",
+    "SNP_A-1508364",
+    NULL,
+    "SNP_A-1517939",
+    "SNP_A-1507455",
+    "SNP_A-8281778",
+    NULL,
+    "SNP_A-1516354",
+    "SNP_A-1517444",
+    "SNP_A-1657834",
+    "SNP_A-4272372",
+    "SNP_A-1514135",
+    NULL,
+    "SNP_A-1514413",
+    "SNP_A-1510215",
+    "SNP_A-4289806",
+    NULL,
+    "SNP_A-1680758",
+    "SNP_A-1508751",
+    "SNP_A-1509717",
+    "SNP_A-1507605",
+    "SNP_A-1727635",
+    NULL,
+    "SNP_A-1508445",
+    "SNP_A-1518223",
+    "SNP_A-1982915",
+    NULL,
+    "SNP_A-1514185",
+    NULL,
+    "SNP_A-2152865",
+    "SNP_A-1510348",
+    NULL,
+    "SNP_A-1507921",
+    "SNP_A-1519146",
+    "SNP_A-1697104",
+    "SNP_A-1519155",
+    "SNP_A-1744129",
+    "SNP_A-1519593",
+    "SNP_A-4210049",
+    "SNP_A-1509897",
+    "SNP_A-1995973",
+    "SNP_A-1517927",
+    "SNP_A-1507616",
+    "SNP_A-1514125",
+    "SNP_A-1515433",
+    NULL,
+    NULL,
+    "SNP_A-1519420",
+    "SNP_A-1519067",
+    NULL,
+    "SNP_A-1511362",
+    "SNP_A-1677436",
+    "SNP_A-1977421",
+    NULL,
+    "SNP_A-1704513",
+    NULL,
+    "SNP_A-8287007",
+    NULL,
+    "SNP_A-1518670",
+    "SNP_A-1838674",
+    "SNP_A-1729021",
+    "SNP_A-1507907",
+    "SNP_A-1691756",
+    "SNP_A-1517777",
+    "SNP_A-2182075",
+    "SNP_A-1507777",
+    "SNP_A-8313295",
+    "SNP_A-1511038",
+    "SNP_A-1508324",
+    "SNP_A-1693689",
+    "SNP_A-1513975",
+    "SNP_A-1733302",
+    NULL,
+    "SNP_A-1694187",
+    "SNP_A-1507960",
+    "SNP_A-1653280",
+    NULL,
+    "SNP_A-1512435",
+    "SNP_A-1516416",
+    "SNP_A-1508606",
+    "SNP_A-1510900",
+    "SNP_A-1661099",
+    "SNP_A-1645386",
+    "SNP_A-1511088",
+    NULL,
+    NULL,
+    "SNP_A-1509683",
+    "SNP_A-1517511",
+    "SNP_A-1969278",
+    "SNP_A-1758862",
+    "SNP_A-1701493",
+    "SNP_A-1648750",
+    "SNP_A-1507853",
+    "SNP_A-1684594",
+    "SNP_A-1679130",
+    "SNP_A-1685688",
+    "SNP_A-8652736",
+    "SNP_A-1513420",
+    "SNP_A-1515360",
+    "SNP_A-1512903",
+    "SNP_A-1692474",
+    "SNP_A-2178241",
+    "SNP_A-1514556",
+    "SNP_A-1674551",
+    NULL,
+    "SNP_A-1645006",
+    NULL,
+    "SNP_A-1509406",
+    "SNP_A-1516290",
+    "SNP_A-1725916",
+    "SNP_A-1513995",
+    NULL,
+    "SNP_A-4208284",
+    "SNP_A-1660603",
+    "SNP_A-1517243",
+    "SNP_A-1518843",
+    "SNP_A-1508354",
+    "SNP_A-1518966",
+    "SNP_A-1518999",
+    "SNP_A-1514157",
+    NULL,
+    "SNP_A-8578024",
+    NULL,
+    "SNP_A-1741887",
+    NULL,
+    "SNP_A-8573619",
+    "SNP_A-1513728",
+    "SNP_A-1606283",
+    "SNP_A-1647632",
+    "SNP_A-1733410",
+    "SNP_A-1741031",
+    "SNP_A-1759008",
+    "SNP_A-1647915",
+    "SNP_A-1664024",
+    "SNP_A-8670220",
+    "SNP_A-1681712",
+    NULL,
+    "SNP_A-1970714",
+    NULL,
+    NULL,
+    "SNP_A-1518822",
+    "SNP_A-1508102",
+    NULL,
+    "SNP_A-4262805",
+    "SNP_A-1519753",
+    "SNP_A-1665704",
+    "SNP_A-1736381",
+    "SNP_A-1749679",
+    "SNP_A-1851117",
+    "SNP_A-1509490",
+    "SNP_A-1518946",
+    "SNP_A-1513367",
+    "SNP_A-1724476",
+    "SNP_A-1706001",
+    "SNP_A-1650912",
+    "SNP_A-1508292",
+    "SNP_A-1507518",
+    "SNP_A-2004163",
+    NULL,
+    "SNP_A-1692250",
+    "SNP_A-1519492",
+    "SNP_A-1703991",
+    "SNP_A-1723572",
+    "SNP_A-4255722",
+    "SNP_A-8578063",
+    "SNP_A-2212184",
+    "SNP_A-2021465",
+    "SNP_A-1644890",
+    "SNP_A-1518270",
+    "SNP_A-1728735",
+    "SNP_A-1676410",
+    "SNP_A-1509573",
+    "SNP_A-1706415",
+    NULL,
+    "SNP_A-1744797",
+    "SNP_A-1511387",
+    "SNP_A-1758738",
+    "SNP_A-1665546",
+    "SNP_A-1749359",
+    "SNP_A-1513907",
+    NULL,
+    NULL,
+    "SNP_A-1721035",
+    "SNP_A-8339353",
+    "SNP_A-1512884",
+    "SNP_A-1725614",
+    NULL,
+    "SNP_A-4209929",
+    "SNP_A-1511673",
+    "SNP_A-1734560",
+    "SNP_A-1508368",
+    "SNP_A-1517393",
+    "SNP_A-1511775",
+    NULL,
+    "SNP_A-1519490",
+    NULL,
+    "SNP_A-4213556",
+    "SNP_A-1510417",
+    "SNP_A-1513940",
+    "SNP_A-1687012",
+    "SNP_A-8336315",
+    NULL,
+    "SNP_A-1701095",
+    "SNP_A-8579486",
+    NULL,
+    "SNP_A-1676930",
+    "SNP_A-1510932",
+    "SNP_A-1519358",
+    "SNP_A-1514873",
+    "SNP_A-1512580",
+    "SNP_A-8628095",
+    "SNP_A-1606265",
+    "SNP_A-1511712",
+    "SNP_A-1507908",
+    NULL,
+    "SNP_A-8424213",
+    "SNP_A-1512574",
+    "SNP_A-1722590",
+    "SNP_A-1515066",
+    NULL,
+    NULL,
+    "SNP_A-4243809",
+    "SNP_A-1509184",
+    "SNP_A-1518474",
+    "SNP_A-1658666",
+    "SNP_A-1518650",
+    "SNP_A-1650444",
+    "SNP_A-4209666",
+    NULL,
+    "SNP_A-1649342",
+    "SNP_A-8620138",
+    "SNP_A-1508919",
+    "SNP_A-1657992",
+    "SNP_A-1703921",
+    "SNP_A-1514737",
+    "SNP_A-1512274",
+    "SNP_A-1515387",
+    NULL,
+    NULL,
+    "SNP_A-1706851",
+    "SNP_A-1511815",
+    "SNP_A-1508523",
+    "SNP_A-1510573",
+    NULL,
+    NULL,
+    "SNP_A-1516014",
+    "SNP_A-1517758",
+    "SNP_A-1755798",
+    "SNP_A-1713239",
+    "SNP_A-4251476",
+    NULL,
+    "SNP_A-1733650",
+    "SNP_A-8305766",
+    "SNP_A-1714182",
+    "SNP_A-1662024",
+    "SNP_A-1509488",
+    "SNP_A-1658316",
+    "SNP_A-4208320",
+    "SNP_A-1510893",
+    "SNP_A-1508571",
+    "SNP_A-1736053",
+    NULL,
+    "SNP_A-4225328",
+    "SNP_A-1654077",
+    "SNP_A-8283126",
+    "SNP_A-1510071",
+    "SNP_A-1508717",
+    "SNP_A-1517715",
+    NULL,
+    "SNP_A-1509332",
+    "SNP_A-1512634",
+    "SNP_A-1666392",
+    "SNP_A-1513231",
+    "SNP_A-1748505",
+    "SNP_A-2098115",
+    "SNP_A-1509621",
+    "SNP_A-1724676",
+    "SNP_A-2104782",
+    "SNP_A-1516138",
+    NULL,
+    "SNP_A-1508251",
+    NULL,
+    "SNP_A-1643069",
+    "SNP_A-1737101",
+    NULL,
+    "SNP_A-1747083",
+    "SNP_A-1697378",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1999177",
+    "SNP_A-1509639",
+    NULL,
+    "SNP_A-1652346",
+    "SNP_A-1666452",
+    "SNP_A-1514876",
+    NULL,
+    "SNP_A-1508408",
+    NULL,
+    "SNP_A-1660601",
+    "SNP_A-1511164",
+    "SNP_A-1512153",
+    NULL,
+    "SNP_A-1509411",
+    NULL,
+    "SNP_A-1507498",
+    "SNP_A-1509194",
+    NULL,
+    "SNP_A-1752873",
+    "SNP_A-1516982",
+    "SNP_A-1731991",
+    "SNP_A-1518344",
+    "SNP_A-1648830",
+    "SNP_A-1514943",
+    "SNP_A-1646174",
+    "SNP_A-1514014",
+    "SNP_A-1517830",
+    "SNP_A-1518484",
+    "SNP_A-1721325",
+    "SNP_A-1509743",
+    "SNP_A-1724850",
+    "SNP_A-1515498",
+    "SNP_A-1513100",
+    "SNP_A-1509845",
+    "SNP_A-1515274",
+    "SNP_A-1667796",
+    NULL,
+    NULL,
+    "SNP_A-1747411",
+    "SNP_A-1671886",
+    "SNP_A-1509268",
+    NULL,
+    "SNP_A-1709621",
+    "SNP_A-1518358",
+    "SNP_A-1513989",
+    NULL,
+    "SNP_A-1736965",
+    "SNP_A-1751801",
+    "SNP_A-1518375",
+    "SNP_A-1662916",
+    "SNP_A-4289723",
+    "SNP_A-1988734",
+    "SNP_A-1513079",
+    "SNP_A-1515181",
+    NULL,
+    "SNP_A-2012997",
+    "SNP_A-8657221",
+    NULL,
+    "SNP_A-1705915",
+    "SNP_A-1513815",
+    "SNP_A-1690545",
+    "SNP_A-1509129",
+    NULL,
+    "SNP_A-1692062",
+    "SNP_A-2082022",
+    NULL,
+    "SNP_A-8571315",
+    NULL,
+    "SNP_A-1514007",
+    "SNP_A-1518682",
+    "SNP_A-8671191",
+    "SNP_A-1518925",
+    "SNP_A-1515001",
+    NULL,
+    "SNP_A-1696928",
+    NULL,
+    "SNP_A-1516248",
+    NULL,
+    "SNP_A-1511225",
+    "SNP_A-1979155",
+    "SNP_A-1700500",
+    "SNP_A-1508267",
+    NULL,
+    "SNP_A-1514653",
+    "SNP_A-1910936",
+    NULL,
+    "SNP_A-1518420",
+    "SNP_A-1516233",
+    "SNP_A-1695921",
+    "SNP_A-1516972",
+    "SNP_A-1510693",
+    "SNP_A-4209921",
+    NULL,
+    "SNP_A-1519489",
+    NULL,
+    "SNP_A-1516912",
+    "SNP_A-1961690",
+    "SNP_A-1719777",
+    "SNP_A-1696149",
+    "SNP_A-1692278",
+    NULL,
+    "SNP_A-1513700",
+    "SNP_A-1711995",
+    "SNP_A-1676674",
+    "SNP_A-1514195",
+    "SNP_A-1508859",
+    "SNP_A-1511612",
+    "SNP_A-1508250",
+    NULL,
+    NULL,
+    "SNP_A-1737281",
+    "SNP_A-1697166",
+    "SNP_A-1514675",
+    "SNP_A-1818097",
+    "SNP_A-1651896",
+    "SNP_A-1516185",
+    "SNP_A-8286339",
+    "SNP_A-1507440",
+    "SNP_A-1989761",
+    "SNP_A-1507913",
+    "SNP_A-1645418",
+    "SNP_A-1717053",
+    "SNP_A-1973809",
+    "SNP_A-1517557",
+    NULL,
+    "SNP_A-1519745",
+    "SNP_A-1508741",
+    "SNP_A-1515042",
+    "SNP_A-1508897",
+    "SNP_A-1518405",
+    "SNP_A-1513932",
+    NULL,
+    NULL,
+    "SNP_A-1687522",
+    "SNP_A-1712495",
+    "SNP_A-1515542",
+    "SNP_A-1701305",
+    "SNP_A-1514248",
+    "SNP_A-1683786",
+    "SNP_A-1511391",
+    "SNP_A-1517895",
+    NULL,
+    NULL,
+    "SNP_A-1515247",
+    NULL,
+    "SNP_A-1667804",
+    "SNP_A-1515137",
+    "SNP_A-8667327",
+    "SNP_A-1715457",
+    NULL,
+    "SNP_A-1511655",
+    "SNP_A-1512735",
+    "SNP_A-1519339",
+    "SNP_A-1513881",
+    "SNP_A-1519127",
+    "SNP_A-1668482",
+    NULL,
+    "SNP_A-1510271",
+    NULL,
+    "SNP_A-1509924",
+    "SNP_A-1515962",
+    "SNP_A-1512739",
+    "SNP_A-1721233",
+    NULL,
+    "SNP_A-1657345",
+    "SNP_A-1514565",
+    "SNP_A-1518214",
+    "SNP_A-1688310",
+    "SNP_A-1517523",
+    "SNP_A-1516478",
+    "SNP_A-1507786",
+    "SNP_A-1514734",
+    "SNP_A-1518666",
+    "SNP_A-1513015",
+    "SNP_A-8285688",
+    "SNP_A-1752433",
+    "SNP_A-1748663",
+    "SNP_A-8281983",
+    "SNP_A-1510461",
+    "SNP_A-1966988",
+    "SNP_A-1731499",
+    "SNP_A-1518338",
+    NULL,
+    "SNP_A-1508716",
+    "SNP_A-1675878",
+    NULL,
+    "SNP_A-1517400",
+    "SNP_A-1710397",
+    "SNP_A-1518133",
+    "SNP_A-1512257",
+    "SNP_A-1723676",
+    NULL,
+    "SNP_A-8578903",
+    "SNP_A-1510217",
+    NULL,
+    NULL,
+    "SNP_A-1660053",
+    "SNP_A-1509640",
+    "SNP_A-8665250",
+    NULL,
+    "SNP_A-1511518",
+    "SNP_A-1510197",
+    "SNP_A-1703363",
+    "SNP_A-1507573",
+    "SNP_A-1507554",
+    "SNP_A-1660639",
+    "SNP_A-1681474",
+    "SNP_A-1516557",
+    "SNP_A-1695761",
+    NULL,
+    "SNP_A-1713398",
+    NULL,
+    "SNP_A-1509187",
+    "SNP_A-1974315",
+    "SNP_A-1750115",
+    "SNP_A-1742339",
+    "SNP_A-1517348",
+    NULL,
+    "SNP_A-1512194",
+    "SNP_A-1723698",
+    "SNP_A-1983658",
+    "SNP_A-1519057",
+    "SNP_A-1519564",
+    NULL,
+    "SNP_A-1690898",
+    NULL,
+    "SNP_A-1511495",
+    "SNP_A-1515655",
+    "SNP_A-1753135",
+    "SNP_A-1725628",
+    "SNP_A-1511900",
+    "SNP_A-1712759",
+    NULL,
+    "SNP_A-1671026",
+    "SNP_A-1700941",
+    "SNP_A-1510290",
+    "SNP_A-1715135",
+    "SNP_A-4265935",
+    "SNP_A-1514684",
+    "SNP_A-1732389",
+    "SNP_A-1705673",
+    "SNP_A-1512728",
+    NULL,
+    "SNP_A-1679840",
+    NULL,
+    "SNP_A-1517467",
+    NULL,
+    "SNP_A-1519427",
+    "SNP_A-8541032",
+    "SNP_A-1508231",
+    "SNP_A-1518927",
+    "SNP_A-1514578",
+    "SNP_A-1728251",
+    "SNP_A-1693240",
+    NULL,
+    NULL,
+    "SNP_A-1721524",
+    "SNP_A-1710285",
+    "SNP_A-1512781",
+    "SNP_A-1518010",
+    NULL,
+    "SNP_A-1512695",
+    "SNP_A-1516510",
+    "SNP_A-1507879",
+    "SNP_A-1681802",
+    "SNP_A-1514581",
+    NULL,
+    "SNP_A-1508174",
+    NULL,
+    "SNP_A-1519293",
+    "SNP_A-1741323",
+    "SNP_A-1516243",
+    NULL,
+    "SNP_A-1519063",
+    NULL,
+    "SNP_A-1708326",
+    NULL,
+    "SNP_A-1514590",
+    "SNP_A-1976742",
+    NULL,
+    "SNP_A-1996932",
+    "SNP_A-4208730",
+    "SNP_A-1513916",
+    "SNP_A-1758983",
+    "SNP_A-1668156",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-4266233",
+    "SNP_A-1674257",
+    NULL,
+    NULL,
+    "SNP_A-1990440",
+    "SNP_A-1508989",
+    NULL,
+    NULL,
+    "SNP_A-1756290",
+    "SNP_A-1513425",
+    "SNP_A-1519307",
+    NULL,
+    "SNP_A-1513757",
+    "SNP_A-1703877",
+    "SNP_A-1515211",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1510505",
+    "SNP_A-1519722",
+    NULL,
+    "SNP_A-1756192",
+    "SNP_A-1507717",
+    "SNP_A-1516297",
+    "SNP_A-1711899",
+    "SNP_A-2024416",
+    "SNP_A-1674387",
+    "SNP_A-1748245",
+    "SNP_A-1729738",
+    "SNP_A-1509466",
+    "SNP_A-1681170",
+    "SNP_A-1749933",
+    NULL,
+    "SNP_A-1667780",
+    "SNP_A-1518631",
+    "SNP_A-1508677",
+    "SNP_A-1515434",
+    "SNP_A-1511004",
+    "SNP_A-1811005",
+    "SNP_A-1741441",
+    "SNP_A-1994721",
+    "SNP_A-4212515",
+    NULL,
+    "SNP_A-1513774",
+    "SNP_A-1515787",
+    "SNP_A-1509550",
+    "SNP_A-1660481",
+    "SNP_A-1692476",
+    "SNP_A-1512534",
+    "SNP_A-1518041",
+    "SNP_A-1507961",
+    "SNP_A-1751437",
+    "SNP_A-1661604",
+    "SNP_A-1692766",
+    "SNP_A-8667617",
+    "SNP_A-1512576",
+    "SNP_A-1677686",
+    "SNP_A-1509224",
+    "SNP_A-1517551",
+    NULL,
+    "SNP_A-1509956",
+    "SNP_A-8282007",
+    "SNP_A-1519183",
+    NULL,
+    "SNP_A-1642445",
+    NULL,
+    "SNP_A-1509565",
+    "SNP_A-8574453",
+    "SNP_A-1744559",
+    "SNP_A-1646144",
+    "SNP_A-1516406",
+    "SNP_A-1518304",
+    "SNP_A-1514686",
+    "SNP_A-1518686",
+    "SNP_A-1510615",
+    "SNP_A-8374101",
+    "SNP_A-1716217",
+    "SNP_A-1510930",
+    "SNP_A-1984761",
+    NULL,
+    NULL,
+    "SNP_A-1507571",
+    "SNP_A-1740649",
+    "SNP_A-1727150",
+    "SNP_A-8283127",
+    "SNP_A-4267355",
+    "SNP_A-1518910",
+    "SNP_A-8664308",
+    "SNP_A-1518343",
+    "SNP_A-1741063",
+    "SNP_A-8667726",
+    "SNP_A-1513465",
+    "SNP_A-1511991",
+    "SNP_A-1972392",
+    NULL,
+    "SNP_A-1508464",
+    "SNP_A-4232905",
+    NULL,
+    "SNP_A-1700696",
+    NULL,
+    "SNP_A-1712667",
+    "SNP_A-1518078",
+    NULL,
+    "SNP_A-1514920",
+    "SNP_A-1513484",
+    "SNP_A-1518989",
+    "SNP_A-1735657",
+    "SNP_A-1512686",
+    "SNP_A-1977084",
+    "SNP_A-1508498",
+    "SNP_A-1735106",
+    NULL,
+    "SNP_A-1511142",
+    "SNP_A-8663190",
+    "SNP_A-1656367",
+    "SNP_A-1511886",
+    "SNP_A-1661352",
+    "SNP_A-1514872",
+    "SNP_A-1741133",
+    "SNP_A-1739761",
+    "SNP_A-8664988",
+    "SNP_A-1508764",
+    "SNP_A-2014578",
+    "SNP_A-1669889",
+    "SNP_A-1751543",
+    NULL,
+    "SNP_A-1746294",
+    NULL,
+    "SNP_A-1512379",
+    "SNP_A-1707379",
+    "SNP_A-1510804",
+    "SNP_A-1517962",
+    "SNP_A-1515999",
+    "SNP_A-1690513",
+    "SNP_A-1519052",
+    NULL,
+    "SNP_A-1512264",
+    NULL,
+    "SNP_A-1510317",
+    "SNP_A-1987502",
+    "SNP_A-1509110",
+    "SNP_A-1713253",
+    "SNP_A-1725790",
+    "SNP_A-1510269",
+    "SNP_A-1512161",
+    "SNP_A-1516690",
+    "SNP_A-1508037",
+    "SNP_A-1750931",
+    "SNP_A-1519727",
+    "SNP_A-1511821",
+    "SNP_A-8617113",
+    "SNP_A-1713500",
+    "SNP_A-1519347",
+    NULL,
+    NULL,
+    "SNP_A-1513870",
+    "SNP_A-8365414",
+    NULL,
+    "SNP_A-4264899",
+    "SNP_A-1517628",
+    "SNP_A-1708254",
+    NULL,
+    "SNP_A-8531741",
+    "SNP_A-1751929",
+    "SNP_A-1653890",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1658918",
+    "SNP_A-1519731",
+    "SNP_A-1519226",
+    "SNP_A-1679128",
+    "SNP_A-1510332",
+    NULL,
+    "SNP_A-1509344",
+    "SNP_A-1749575",
+    "SNP_A-1702237",
+    "SNP_A-1511764",
+    "SNP_A-1680684",
+    "SNP_A-1507971",
+    "SNP_A-1682170",
+    "SNP_A-1518517",
+    "SNP_A-1981130",
+    "SNP_A-1513714",
+    "SNP_A-1660383",
+    "SNP_A-1519297",
+    "SNP_A-1511820",
+    "SNP_A-1511280",
+    "SNP_A-1750211",
+    "SNP_A-1508635",
+    "SNP_A-1509267",
+    "SNP_A-1511456",
+    "SNP_A-1742029",
+    "SNP_A-1728525",
+    "SNP_A-1646012",
+    NULL,
+    "SNP_A-1515080",
+    "SNP_A-1999931",
+    "SNP_A-1512129",
+    NULL,
+    "SNP_A-1517521",
+    "SNP_A-1657229",
+    "SNP_A-8285517",
+    "SNP_A-1731659",
+    "SNP_A-4269590",
+    "SNP_A-1516526",
+    NULL,
+    "SNP_A-1519620",
+    "SNP_A-1516287",
+    "SNP_A-1732864",
+    "SNP_A-1519182",
+    "SNP_A-4233007",
+    "SNP_A-1518303",
+    "SNP_A-1738016",
+    "SNP_A-1686154",
+    NULL,
+    "SNP_A-1512018",
+    "SNP_A-1732892",
+    NULL,
+    "SNP_A-1514040",
+    "SNP_A-1664516",
+    NULL,
+    "SNP_A-1722254",
+    NULL,
+    NULL,
+    "SNP_A-1517063",
+    "SNP_A-1514607",
+    "SNP_A-1518731",
+    "SNP_A-1519025",
+    "SNP_A-1655524",
+    "SNP_A-1514880",
+    "SNP_A-1665954",
+    NULL,
+    "SNP_A-1507397",
+    "SNP_A-1513963",
+    "SNP_A-1668086",
+    "SNP_A-1700973",
+    "SNP_A-1518366",
+    "SNP_A-1740785",
+    "SNP_A-1716839",
+    NULL,
+    NULL,
+    "SNP_A-1518227",
+    "SNP_A-4197917",
+    "SNP_A-1518056",
+    "SNP_A-1515611",
+    "SNP_A-8322826",
+    "SNP_A-1507584",
+    "SNP_A-1754778",
+    "SNP_A-8618744",
+    NULL,
+    "SNP_A-1513674",
+    "SNP_A-1709857",
+    "SNP_A-1519158",
+    "SNP_A-8578507",
+    "SNP_A-1511837",
+    NULL,
+    NULL,
+    "SNP_A-1510644",
+    "SNP_A-1664820",
+    NULL,
+    NULL,
+    "SNP_A-1515636",
+    "SNP_A-8282139",
+    NULL,
+    "SNP_A-1516865",
+    "SNP_A-1509682",
+    "SNP_A-1606328",
+    "SNP_A-1516640",
+    "SNP_A-4266509",
+    "SNP_A-1516903",
+    "SNP_A-1739341",
+    NULL,
+    NULL,
+    "SNP_A-1748701",
+    "SNP_A-1514500",
+    "SNP_A-1509775",
+    "SNP_A-1747393",
+    "SNP_A-1511557",
+    "SNP_A-1705007",
+    "SNP_A-1513588",
+    "SNP_A-1509066",
+    NULL,
+    "SNP_A-1742677",
+    "SNP_A-1718387",
+    "SNP_A-8350299",
+    "SNP_A-8664688",
+    "SNP_A-1513284",
+    "SNP_A-1652146",
+    "SNP_A-1508932",
+    "SNP_A-8514570",
+    "SNP_A-1513466",
+    "SNP_A-1517219",
+    NULL,
+    "SNP_A-1517658",
+    NULL,
+    NULL,
+    "SNP_A-1513023",
+    "SNP_A-1719839",
+    "SNP_A-1515982",
+    NULL,
+    NULL,
+    "SNP_A-8287043",
+    "SNP_A-1680508",
+    "SNP_A-1707543",
+    "SNP_A-1513862",
+    "SNP_A-1508526",
+    "SNP_A-1751123",
+    NULL,
+    NULL,
+    "SNP_A-1672188",
+    NULL,
+    "SNP_A-1514643",
+    NULL,
+    "SNP_A-1519089",
+    "SNP_A-1738154",
+    NULL,
+    "SNP_A-1512699",
+    NULL,
+    "SNP_A-1735813",
+    "SNP_A-1737866",
+    "SNP_A-1513010",
+    "SNP_A-1648326",
+    "SNP_A-1735318",
+    "SNP_A-1646858",
+    "SNP_A-1516316",
+    "SNP_A-1512385",
+    NULL,
+    "SNP_A-1511293",
+    "SNP_A-1514453",
+    "SNP_A-1696508",
+    "SNP_A-1507998",
+    "SNP_A-4216279",
+    "SNP_A-1514249",
+    "SNP_A-1509536",
+    "SNP_A-1997309",
+    "SNP_A-1508242",
+    "SNP_A-1667316",
+    NULL,
+    NULL,
+    "SNP_A-1512046",
+    "SNP_A-1734866",
+    "SNP_A-1748695",
+    "SNP_A-4266456",
+    "SNP_A-1517208",
+    NULL,
+    "SNP_A-1643449",
+    "SNP_A-1513600",
+    "SNP_A-1516042",
+    "SNP_A-1512309",
+    "SNP_A-1699153",
+    "SNP_A-1519499",
+    "SNP_A-1689845",
+    "SNP_A-1716351",
+    "SNP_A-1664840",
+    "SNP_A-1732606",
+    "SNP_A-1514553",
+    "SNP_A-1718017",
+    "SNP_A-1514334",
+    "SNP_A-1673228",
+    "SNP_A-2186078",
+    NULL,
+    "SNP_A-1508752",
+    "SNP_A-1517544",
+    NULL,
+    NULL,
+    "SNP_A-1726036",
+    "SNP_A-1969830",
+    "SNP_A-1507653",
+    "SNP_A-1737591",
+    "SNP_A-1677802",
+    NULL,
+    "SNP_A-1510432",
+    NULL,
+    "SNP_A-1660573",
+    NULL,
+    "SNP_A-1648692",
+    "SNP_A-1518500",
+    "SNP_A-1518947",
+    "SNP_A-1681966",
+    "SNP_A-1512675",
+    NULL,
+    NULL,
+    "SNP_A-2092729",
+    "SNP_A-8618940",
+    "SNP_A-1516451",
+    "SNP_A-1519716",
+    "SNP_A-1734634",
+    "SNP_A-1728869",
+    "SNP_A-1515204",
+    "SNP_A-1519346",
+    "SNP_A-1513547",
+    "SNP_A-1509502",
+    "SNP_A-4211914",
+    "SNP_A-1510795",
+    "SNP_A-1758426",
+    "SNP_A-2074653",
+    "SNP_A-1507869",
+    "SNP_A-8286466",
+    "SNP_A-1699775",
+    "SNP_A-1510011",
+    "SNP_A-4227853",
+    "SNP_A-1711979",
+    "SNP_A-1516002",
+    "SNP_A-4270831",
+    "SNP_A-1509057",
+    "SNP_A-1511545",
+    "SNP_A-1514033",
+    "SNP_A-1668843",
+    "SNP_A-1675285",
+    "SNP_A-8287008",
+    "SNP_A-8577180",
+    "SNP_A-1515814",
+    NULL,
+    "SNP_A-1509045",
+    "SNP_A-1510578",
+    "SNP_A-1710117",
+    "SNP_A-1673454",
+    "SNP_A-1755270",
+    "SNP_A-1518810",
+    "SNP_A-8424659",
+    "SNP_A-1519101",
+    "SNP_A-1508148",
+    NULL,
+    "SNP_A-1991720",
+    "SNP_A-8360583",
+    NULL,
+    "SNP_A-1518935",
+    "SNP_A-1754612",
+    "SNP_A-1672292",
+    "SNP_A-1517005",
+    "SNP_A-1749545",
+    "SNP_A-1518412",
+    "SNP_A-1514092",
+    "SNP_A-4266639",
+    "SNP_A-1701809",
+    "SNP_A-1676464",
+    "SNP_A-1658746",
+    "SNP_A-1645520",
+    NULL,
+    "SNP_A-8574030",
+    NULL,
+    "SNP_A-8671164",
+    "SNP_A-1511144",
+    "SNP_A-1515073",
+    "SNP_A-1511050",
+    "SNP_A-1517575",
+    "SNP_A-1742825",
+    NULL,
+    NULL,
+    "SNP_A-1661220",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1719583",
+    "SNP_A-1516712",
+    "SNP_A-1510347",
+    "SNP_A-1717685",
+    "SNP_A-1606318",
+    "SNP_A-1723474",
+    "SNP_A-1514406",
+    "SNP_A-1710211",
+    "SNP_A-1701901",
+    NULL,
+    "SNP_A-1512401",
+    "SNP_A-1745099",
+    NULL,
+    "SNP_A-1510663",
+    "SNP_A-1707967",
+    NULL,
+    "SNP_A-8284555",
+    "SNP_A-1517802",
+    "SNP_A-1695461",
+    "SNP_A-1984067",
+    "SNP_A-1667546",
+    "SNP_A-1511484",
+    "SNP_A-1758278",
+    "SNP_A-1758336",
+    "SNP_A-8280672",
+    NULL,
+    "SNP_A-1653464",
+    "SNP_A-1726616",
+    "SNP_A-1515154",
+    NULL,
+    "SNP_A-1515220",
+    "SNP_A-1692632",
+    "SNP_A-1654059",
+    NULL,
+    "SNP_A-1518815",
+    "SNP_A-1716123",
+    "SNP_A-1515858",
+    "SNP_A-1512466",
+    "SNP_A-8669818",
+    "SNP_A-1511941",
+    "SNP_A-1515602",
+    "SNP_A-1518395",
+    "SNP_A-1744257",
+    NULL,
+    "SNP_A-1513427",
+    "SNP_A-1643091",
+    "SNP_A-1510052",
+    "SNP_A-1727531",
+    "SNP_A-1512447",
+    NULL,
+    "SNP_A-8561527",
+    "SNP_A-1735875",
+    "SNP_A-1516802",
+    "SNP_A-1518373",
+    NULL,
+    "SNP_A-1510369",
+    "SNP_A-1513748",
+    "SNP_A-1746446",
+    NULL,
+    "SNP_A-1518942",
+    NULL,
+    "SNP_A-1508961",
+    "SNP_A-1744985",
+    NULL,
+    NULL,
+    "SNP_A-1517443",
+    "SNP_A-2011420",
+    "SNP_A-1511932",
+    NULL,
+    "SNP_A-1681188",
+    "SNP_A-1518678",
+    "SNP_A-1507485",
+    "SNP_A-1664804",
+    "SNP_A-1693977",
+    NULL,
+    "SNP_A-1648342",
+    "SNP_A-1516130",
+    NULL,
+    "SNP_A-8620702",
+    "SNP_A-1643129",
+    "SNP_A-4262369",
+    "SNP_A-1516834",
+    "SNP_A-1509786",
+    NULL,
+    "SNP_A-1668320",
+    "SNP_A-1669269",
+    "SNP_A-1508177",
+    "SNP_A-1726176",
+    "SNP_A-1672534",
+    "SNP_A-1514265",
+    "SNP_A-8283913",
+    "SNP_A-1967664",
+    "SNP_A-1518755",
+    "SNP_A-1517754",
+    "SNP_A-1747715",
+    "SNP_A-1517434",
+    "SNP_A-1507754",
+    "SNP_A-1507356",
+    "SNP_A-1510105",
+    "SNP_A-1732279",
+    "SNP_A-1716813",
+    NULL,
+    "SNP_A-1514163",
+    "SNP_A-4267838",
+    "SNP_A-1515791",
+    "SNP_A-1507896",
+    "SNP_A-1514924",
+    "SNP_A-1507945",
+    NULL,
+    NULL,
+    "SNP_A-1510521",
+    NULL,
+    "SNP_A-1511158",
+    NULL,
+    "SNP_A-1512861",
+    "SNP_A-1644474",
+    "SNP_A-1684758",
+    "SNP_A-1512823",
+    "SNP_A-1510774",
+    "SNP_A-1517580",
+    "SNP_A-2022824",
+    NULL,
+    "SNP_A-1757111",
+    "SNP_A-1509284",
+    "SNP_A-1711478",
+    "SNP_A-8406456",
+    "SNP_A-4211053",
+    NULL,
+    "SNP_A-1516805",
+    "SNP_A-1702649",
+    "SNP_A-1508566",
+    NULL,
+    "SNP_A-1515597",
+    "SNP_A-1518793",
+    "SNP_A-1691540",
+    "SNP_A-2041737",
+    "SNP_A-1519029",
+    NULL,
+    NULL,
+    "SNP_A-4280929",
+    "SNP_A-1512921",
+    NULL,
+    "SNP_A-1742297",
+    "SNP_A-1510273",
+    "SNP_A-1514386",
+    "SNP_A-1508032",
+    NULL,
+    "SNP_A-1509048",
+    "SNP_A-1667466",
+    "SNP_A-8666838",
+    "SNP_A-1511538",
+    "SNP_A-1995254",
+    "SNP_A-1511866",
+    "SNP_A-1510343",
+    "SNP_A-1517882",
+    "SNP_A-1518960",
+    NULL,
+    "SNP_A-1512563",
+    "SNP_A-1728925",
+    "SNP_A-1714459",
+    "SNP_A-1511437",
+    "SNP_A-1511078",
+    "SNP_A-1677488",
+    "SNP_A-1697462",
+    "SNP_A-1519547",
+    "SNP_A-1736383",
+    "SNP_A-1517006",
+    "SNP_A-1517721",
+    "SNP_A-1687620",
+    "SNP_A-1658614",
+    "SNP_A-1998015",
+    NULL,
+    "SNP_A-1511693",
+    "SNP_A-1691492",
+    "SNP_A-1707862",
+    "SNP_A-1510921",
+    NULL,
+    "SNP_A-1514637",
+    "SNP_A-1517247",
+    "SNP_A-8578425",
+    NULL,
+    "SNP_A-8284413",
+    "SNP_A-1511132",
+    NULL,
+    "SNP_A-4200716",
+    "SNP_A-8281471",
+    "SNP_A-1516061",
+    "SNP_A-1517783",
+    NULL,
+    "SNP_A-1514803",
+    "SNP_A-1517891",
+    "SNP_A-1516260",
+    "SNP_A-4218701",
+    "SNP_A-1517158",
+    NULL,
+    "SNP_A-1696636",
+    "SNP_A-1663678",
+    "SNP_A-1652784",
+    "SNP_A-1679148",
+    NULL,
+    "SNP_A-1514020",
+    "SNP_A-1518992",
+    "SNP_A-1734664",
+    "SNP_A-1711698",
+    "SNP_A-1655859",
+    "SNP_A-1657738",
+    "SNP_A-1691042",
+    "SNP_A-1519528",
+    NULL,
+    "SNP_A-1986737",
+    "SNP_A-1690307",
+    "SNP_A-1515451",
+    "SNP_A-1508295",
+    "SNP_A-4265553",
+    "SNP_A-1696748",
+    NULL,
+    "SNP_A-1659482",
+    "SNP_A-8666151",
+    "SNP_A-8281325",
+    "SNP_A-1515028",
+    "SNP_A-1517205",
+    "SNP_A-1508779",
+    NULL,
+    "SNP_A-1509826",
+    "SNP_A-1670550",
+    "SNP_A-1721764",
+    "SNP_A-1518725",
+    "SNP_A-1514146",
+    "SNP_A-1672162",
+    "SNP_A-1715653",
+    "SNP_A-1511167",
+    "SNP_A-1507635",
+    "SNP_A-1512326",
+    "SNP_A-1508698",
+    "SNP_A-1702984",
+    "SNP_A-1741861",
+    "SNP_A-1515203",
+    NULL,
+    NULL,
+    "SNP_A-1653540",
+    "SNP_A-1508977",
+    "SNP_A-1512832",
+    NULL,
+    "SNP_A-1657149",
+    "SNP_A-1738471",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1679570",
+    "SNP_A-1745482",
+    NULL,
+    "SNP_A-1517354",
+    "SNP_A-1653294",
+    "SNP_A-1975935",
+    NULL,
+    "SNP_A-1516294",
+    "SNP_A-1514390",
+    "SNP_A-1519156",
+    "SNP_A-1744813",
+    NULL,
+    "SNP_A-1669313",
+    "SNP_A-1967814",
+    "SNP_A-1703763",
+    "SNP_A-1509396",
+    "SNP_A-1747085",
+    "SNP_A-1698599",
+    "SNP_A-8433657",
+    NULL,
+    "SNP_A-1515459",
+    "SNP_A-1758146",
+    "SNP_A-8617752",
+    "SNP_A-1509086",
+    "SNP_A-1513831",
+    "SNP_A-1508187",
+    "SNP_A-1517415",
+    "SNP_A-1514538",
+    NULL,
+    "SNP_A-1677018",
+    "SNP_A-8418851",
+    NULL,
+    "SNP_A-1514314",
+    "SNP_A-1509637",
+    NULL,
+    NULL,
+    "SNP_A-8281954",
+    NULL,
+    "SNP_A-1665252",
+    "SNP_A-1745782",
+    "SNP_A-1708056",
+    NULL,
+    "SNP_A-1515622",
+    "SNP_A-1510387",
+    "SNP_A-1738433",
+    "SNP_A-1508947",
+    "SNP_A-1606292",
+    "SNP_A-1661648",
+    "SNP_A-1732712",
+    "SNP_A-8280381",
+    NULL,
+    "SNP_A-1514258",
+    "SNP_A-1519011",
+    "SNP_A-1737994",
+    "SNP_A-1514613",
+    NULL,
+    "SNP_A-4264777",
+    "SNP_A-1685008",
+    "SNP_A-1507547",
+    NULL,
+    "SNP_A-8281676",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1512537",
+    "SNP_A-1707894",
+    "SNP_A-1511662",
+    "SNP_A-1516661",
+    NULL,
+    NULL,
+    "SNP_A-1511604",
+    "SNP_A-2001963",
+    "SNP_A-1965934",
+    "SNP_A-1709025",
+    "SNP_A-1757946",
+    "SNP_A-1508043",
+    "SNP_A-1708412",
+    NULL,
+    "SNP_A-1737718",
+    "SNP_A-1519577",
+    "SNP_A-1515804",
+    "SNP_A-1714639",
+    "SNP_A-1511297",
+    "SNP_A-1512661",
+    "SNP_A-1513092",
+    "SNP_A-1744565",
+    "SNP_A-1513720",
+    "SNP_A-1516931",
+    "SNP_A-1508239",
+    "SNP_A-1519232",
+    "SNP_A-1511357",
+    "SNP_A-1716181",
+    "SNP_A-1511180",
+    NULL,
+    NULL,
+    "SNP_A-1676354",
+    "SNP_A-1519651",
+    NULL,
+    "SNP_A-1740149",
+    "SNP_A-1969471",
+    "SNP_A-1735699",
+    "SNP_A-1732742",
+    NULL,
+    NULL,
+    "SNP_A-1660567",
+    "SNP_A-1509083",
+    "SNP_A-1515742",
+    NULL,
+    "SNP_A-1973472",
+    "SNP_A-1514650",
+    "SNP_A-1672486",
+    "SNP_A-1517731",
+    "SNP_A-1513718",
+    "SNP_A-1733442",
+    NULL,
+    "SNP_A-1512362",
+    NULL,
+    "SNP_A-1519260",
+    "SNP_A-1508911",
+    "SNP_A-1735550",
+    "SNP_A-1513832",
+    "SNP_A-1715027",
+    NULL,
+    "SNP_A-1509691",
+    "SNP_A-2161450",
+    "SNP_A-1711162",
+    "SNP_A-1758675",
+    "SNP_A-1509447",
+    "SNP_A-1513599",
+    NULL,
+    "SNP_A-1713053",
+    "SNP_A-1697877",
+    "SNP_A-1519227",
+    "SNP_A-1513166",
+    "SNP_A-1517842",
+    "SNP_A-1721135",
+    "SNP_A-1513320",
+    "SNP_A-1509071",
+    "SNP_A-1649568",
+    "SNP_A-1519108",
+    NULL,
+    "SNP_A-1510127",
+    "SNP_A-1508323",
+    "SNP_A-1513404",
+    NULL,
+    "SNP_A-1513302",
+    "SNP_A-1654613",
+    "SNP_A-1509557",
+    "SNP_A-1651416",
+    "SNP_A-1515552",
+    "SNP_A-1509248",
+    "SNP_A-1508872",
+    "SNP_A-1512348",
+    NULL,
+    "SNP_A-1511364",
+    "SNP_A-1664352",
+    "SNP_A-1656509",
+    "SNP_A-1509730",
+    "SNP_A-1516347",
+    "SNP_A-1665712",
+    "SNP_A-1508929",
+    "SNP_A-1652670",
+    NULL,
+    "SNP_A-1512343",
+    "SNP_A-1649266",
+    "SNP_A-1508731",
+    NULL,
+    NULL,
+    "SNP_A-1646978",
+    "SNP_A-1509518",
+    NULL,
+    "SNP_A-1652174",
+    "SNP_A-1519300",
+    "SNP_A-8285014",
+    "SNP_A-1983208",
+    NULL,
+    "SNP_A-1650508",
+    "SNP_A-1755230",
+    "SNP_A-1510657",
+    "SNP_A-1515157",
+    "SNP_A-1517369",
+    "SNP_A-1514654",
+    NULL,
+    "SNP_A-1710461",
+    "SNP_A-1518427",
+    NULL,
+    "SNP_A-1662574",
+    NULL,
+    NULL,
+    "SNP_A-1511836",
+    "SNP_A-1745388",
+    "SNP_A-1701009",
+    NULL,
+    "SNP_A-1654617",
+    "SNP_A-1513340",
+    NULL,
+    NULL,
+    "SNP_A-1738603",
+    "SNP_A-1517740",
+    NULL,
+    "SNP_A-1516392",
+    NULL,
+    "SNP_A-1511960",
+    "SNP_A-1509787",
+    NULL,
+    "SNP_A-1727154",
+    NULL,
+    "SNP_A-4214021",
+    "SNP_A-2005705",
+    "SNP_A-1518250",
+    "SNP_A-2290542",
+    "SNP_A-1753181",
+    "SNP_A-2006493",
+    "SNP_A-1519429",
+    "SNP_A-1728709",
+    "SNP_A-1661344",
+    "SNP_A-1508503",
+    "SNP_A-1691745",
+    "SNP_A-1702473",
+    "SNP_A-4264575",
+    "SNP_A-1515471",
+    "SNP_A-1512171",
+    "SNP_A-1507892",
+    "SNP_A-1519704",
+    "SNP_A-1709457",
+    "SNP_A-1695595",
+    "SNP_A-1691166",
+    "SNP_A-1748813",
+    NULL,
+    "SNP_A-1693050",
+    "SNP_A-1676462",
+    "SNP_A-1515000",
+    "SNP_A-8662035",
+    "SNP_A-1701917",
+    "SNP_A-1511313",
+    "SNP_A-1741115",
+    NULL,
+    "SNP_A-8284392",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-4263524",
+    "SNP_A-1990957",
+    "SNP_A-1974953",
+    "SNP_A-1671224",
+    "SNP_A-2099345",
+    "SNP_A-1513293",
+    "SNP_A-1654571",
+    "SNP_A-1508860",
+    "SNP_A-1515100",
+    "SNP_A-1514215",
+    NULL,
+    "SNP_A-1511076",
+    "SNP_A-1514336",
+    "SNP_A-1510885",
+    "SNP_A-1740121",
+    NULL,
+    "SNP_A-4210572",
+    "SNP_A-1511947",
+    "SNP_A-1647762",
+    "SNP_A-1510684",
+    "SNP_A-1970968",
+    "SNP_A-1644000",
+    "SNP_A-1515146",
+    "SNP_A-1684220",
+    "SNP_A-1642613",
+    "SNP_A-1709489",
+    "SNP_A-1507742",
+    "SNP_A-1747117",
+    "SNP_A-1747565",
+    "SNP_A-1704465",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1688352",
+    "SNP_A-8287777",
+    "SNP_A-1516842",
+    "SNP_A-1667704",
+    NULL,
+    "SNP_A-1517583",
+    "SNP_A-1513389",
+    NULL,
+    "SNP_A-1516038",
+    "SNP_A-1655313",
+    "SNP_A-1513874",
+    "SNP_A-1730453",
+    "SNP_A-1519209",
+    "SNP_A-1713039",
+    NULL,
+    "SNP_A-1510428",
+    "SNP_A-1693002",
+    "SNP_A-1732183",
+    "SNP_A-1510767",
+    "SNP_A-1515356",
+    "SNP_A-1705891",
+    "SNP_A-1511155",
+    "SNP_A-1758375",
+    "SNP_A-1509698",
+    "SNP_A-1514676",
+    "SNP_A-1671706",
+    "SNP_A-1714437",
+    "SNP_A-1717375",
+    "SNP_A-1668869",
+    "SNP_A-1514998",
+    "SNP_A-1508799",
+    "SNP_A-1515977",
+    "SNP_A-1508472",
+    "SNP_A-1731193",
+    "SNP_A-1518950",
+    "SNP_A-4213394",
+    "SNP_A-1515296",
+    "SNP_A-1679582",
+    "SNP_A-1509504",
+    NULL,
+    "SNP_A-1512166",
+    "SNP_A-1519179",
+    "SNP_A-1516224",
+    "SNP_A-1514755",
+    "SNP_A-1515860",
+    "SNP_A-1745652",
+    "SNP_A-1656247",
+    "SNP_A-1512946",
+    "SNP_A-1721447",
+    "SNP_A-1516666",
+    NULL,
+    "SNP_A-1664340",
+    NULL,
+    "SNP_A-1513171",
+    "SNP_A-1507622",
+    "SNP_A-1514401",
+    "SNP_A-1647934",
+    "SNP_A-1660253",
+    "SNP_A-1512123",
+    "SNP_A-1674767",
+    "SNP_A-1517868",
+    "SNP_A-1510130",
+    "SNP_A-1519387",
+    "SNP_A-1513500",
+    "SNP_A-1507884",
+    NULL,
+    "SNP_A-1695887",
+    "SNP_A-4212893",
+    "SNP_A-1515624",
+    NULL,
+    "SNP_A-1509201",
+    "SNP_A-1677642",
+    "SNP_A-1513590",
+    "SNP_A-1674867",
+    "SNP_A-1664362",
+    "SNP_A-1516463",
+    "SNP_A-1512239",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1724008",
+    NULL,
+    "SNP_A-1519141",
+    "SNP_A-1516941",
+    "SNP_A-1519092",
+    "SNP_A-1736117",
+    "SNP_A-1713414",
+    "SNP_A-1744287",
+    "SNP_A-8617680",
+    "SNP_A-1518913",
+    "SNP_A-1660397",
+    "SNP_A-1724360",
+    "SNP_A-1518265",
+    NULL,
+    "SNP_A-1509966",
+    NULL,
+    "SNP_A-1519028",
+    NULL,
+    "SNP_A-1517423",
+    "SNP_A-1732924",
+    "SNP_A-1654735",
+    "SNP_A-1645640",
+    "SNP_A-1516212",
+    NULL,
+    "SNP_A-1671046",
+    NULL,
+    "SNP_A-1515155",
+    "SNP_A-1515765",
+    NULL,
+    "SNP_A-1699565",
+    NULL,
+    "SNP_A-1519504",
+    "SNP_A-1741549",
+    "SNP_A-1508821",
+    "SNP_A-1689112",
+    "SNP_A-1751981",
+    NULL,
+    "SNP_A-1708913",
+    "SNP_A-4300730",
+    "SNP_A-1518596",
+    "SNP_A-1513708",
+    "SNP_A-4265929",
+    "SNP_A-1709663",
+    "SNP_A-1516820",
+    "SNP_A-1512658",
+    NULL,
+    "SNP_A-1518317",
+    NULL,
+    "SNP_A-1720145",
+    NULL,
+    NULL,
+    "SNP_A-1718281",
+    "SNP_A-1507814",
+    "SNP_A-8288793",
+    "SNP_A-1518851",
+    "SNP_A-1717947",
+    "SNP_A-1508347",
+    "SNP_A-1513781",
+    "SNP_A-1723726",
+    "SNP_A-1517007",
+    NULL,
+    "SNP_A-1512947",
+    "SNP_A-1518512",
+    NULL,
+    NULL,
+    "SNP_A-1509499",
+    "SNP_A-1512748",
+    "SNP_A-1657676",
+    "SNP_A-1758135",
+    NULL,
+    NULL,
+    "SNP_A-1513336",
+    "SNP_A-1728235",
+    "SNP_A-1519080",
+    NULL,
+    NULL,
+    "SNP_A-1728165",
+    "SNP_A-4210050",
+    "SNP_A-1724344",
+    "SNP_A-1758639",
+    "SNP_A-1674363",
+    "SNP_A-1516452",
+    "SNP_A-1514764",
+    "SNP_A-1645720",
+    "SNP_A-8285024",
+    "SNP_A-1656145",
+    "SNP_A-1659544",
+    "SNP_A-1515368",
+    NULL,
+    "SNP_A-1515854",
+    "SNP_A-1748543",
+    "SNP_A-1982987",
+    "SNP_A-1511152",
+    "SNP_A-1515262",
+    "SNP_A-1510836",
+    "SNP_A-1701927",
+    "SNP_A-1519671",
+    "SNP_A-2063632",
+    "SNP_A-1510637",
+    "SNP_A-8287776",
+    "SNP_A-4211109",
+    "SNP_A-4282337",
+    "SNP_A-1666176",
+    "SNP_A-4294864",
+    "SNP_A-1662032",
+    "SNP_A-1514241",
+    "SNP_A-1514304",
+    NULL,
+    "SNP_A-1510249",
+    "SNP_A-1518985",
+    "SNP_A-1706483",
+    "SNP_A-1507578",
+    "SNP_A-1651100",
+    "SNP_A-4214019",
+    "SNP_A-1693126",
+    "SNP_A-1996016",
+    NULL,
+    "SNP_A-1642675",
+    "SNP_A-1514489",
+    "SNP_A-1996101",
+    "SNP_A-1509400",
+    "SNP_A-1674921",
+    "SNP_A-1517383",
+    "SNP_A-1509166",
+    NULL,
+    "SNP_A-1711206",
+    "SNP_A-1507517",
+    "SNP_A-1514432",
+    "SNP_A-1508556",
+    "SNP_A-1519597",
+    NULL,
+    "SNP_A-1515570",
+    "SNP_A-1673742",
+    "SNP_A-1519360",
+    "SNP_A-1517027",
+    "SNP_A-4199126",
+    NULL,
+    "SNP_A-1700155",
+    "SNP_A-8577999",
+    NULL,
+    "SNP_A-1511193",
+    "SNP_A-1508908",
+    "SNP_A-1510832",
+    NULL,
+    "SNP_A-1660299",
+    "SNP_A-1708272",
+    "SNP_A-1519159",
+    "SNP_A-1511551",
+    "SNP_A-1513315",
+    "SNP_A-1509381",
+    NULL,
+    "SNP_A-1739059",
+    NULL,
+    NULL,
+    "SNP_A-8378965",
+    "SNP_A-8573867",
+    "SNP_A-1748321",
+    NULL,
+    "SNP_A-1658086",
+    "SNP_A-4265306",
+    "SNP_A-1518660",
+    "SNP_A-8291644",
+    "SNP_A-1715983",
+    "SNP_A-1512806",
+    "SNP_A-1511414",
+    "SNP_A-1509494",
+    "SNP_A-1508970",
+    "SNP_A-1653000",
+    "SNP_A-1516958",
+    "SNP_A-2191712",
+    "SNP_A-1750615",
+    "SNP_A-2056679",
+    "SNP_A-1517232",
+    "SNP_A-1972989",
+    "SNP_A-1514570",
+    "SNP_A-1514931",
+    "SNP_A-1722360",
+    "SNP_A-1516040",
+    NULL,
+    NULL,
+    "SNP_A-1510842",
+    "SNP_A-1750029",
+    "SNP_A-1606300",
+    NULL,
+    "SNP_A-1689566",
+    NULL,
+    NULL,
+    "SNP_A-1515267",
+    "SNP_A-1511383",
+    "SNP_A-1508627",
+    "SNP_A-1512855",
+    "SNP_A-1518277",
+    "SNP_A-1683236",
+    "SNP_A-1687412",
+    NULL,
+    NULL,
+    "SNP_A-1702975",
+    "SNP_A-1716763",
+    "SNP_A-1673766",
+    "SNP_A-1516305",
+    "SNP_A-1517395",
+    "SNP_A-1697168",
+    "SNP_A-1513948",
+    "SNP_A-1508490",
+    "SNP_A-1694997",
+    "SNP_A-1518904",
+    "SNP_A-1514786",
+    "SNP_A-1733922",
+    "SNP_A-1751593",
+    "SNP_A-1758893",
+    "SNP_A-1985436",
+    "SNP_A-1513373",
+    "SNP_A-1510056",
+    "SNP_A-1647470",
+    "SNP_A-1510543",
+    "SNP_A-1672844",
+    "SNP_A-4209430",
+    "SNP_A-1516413",
+    NULL,
+    "SNP_A-1606280",
+    "SNP_A-1518449",
+    "SNP_A-1518806",
+    "SNP_A-1509815",
+    "SNP_A-4213953",
+    "SNP_A-1740443",
+    "SNP_A-1508836",
+    NULL,
+    "SNP_A-1738867",
+    NULL,
+    "SNP_A-1512253",
+    NULL,
+    "SNP_A-1968413",
+    "SNP_A-1510315",
+    "SNP_A-1681890",
+    NULL,
+    "SNP_A-1511566",
+    "SNP_A-1517050",
+    "SNP_A-1510560",
+    "SNP_A-1967605",
+    "SNP_A-1513981",
+    "SNP_A-1702967",
+    "SNP_A-2293771",
+    NULL,
+    "SNP_A-1509171",
+    "SNP_A-1971818",
+    "SNP_A-8666388",
+    "SNP_A-1643229",
+    "SNP_A-1743383",
+    "SNP_A-1679760",
+    "SNP_A-8619218",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1517572",
+    "SNP_A-1514669",
+    NULL,
+    "SNP_A-1509702",
+    "SNP_A-1731365",
+    "SNP_A-1706159",
+    "SNP_A-1749267",
+    "SNP_A-1518084",
+    "SNP_A-4208520",
+    "SNP_A-1518590",
+    "SNP_A-1507813",
+    NULL,
+    "SNP_A-1839682",
+    "SNP_A-1685564",
+    "SNP_A-1518152",
+    NULL,
+    "SNP_A-1518352",
+    "SNP_A-1507497",
+    "SNP_A-1682482",
+    "SNP_A-1512954",
+    "SNP_A-1513986",
+    "SNP_A-1700464",
+    "SNP_A-1694829",
+    "SNP_A-1517349",
+    "SNP_A-1512931",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1672532",
+    "SNP_A-1754386",
+    NULL,
+    NULL,
+    "SNP_A-1515504",
+    NULL,
+    "SNP_A-1513507",
+    "SNP_A-1512704",
+    "SNP_A-1509213",
+    NULL,
+    "SNP_A-1514370",
+    "SNP_A-1648698",
+    "SNP_A-1514576",
+    "SNP_A-8353508",
+    "SNP_A-1705585",
+    "SNP_A-1752913",
+    NULL,
+    "SNP_A-8668932",
+    "SNP_A-1685182",
+    NULL,
+    NULL,
+    "SNP_A-1509584",
+    NULL,
+    "SNP_A-4262507",
+    "SNP_A-1511265",
+    NULL,
+    "SNP_A-1652924",
+    "SNP_A-1725914",
+    "SNP_A-1645342",
+    "SNP_A-1974770",
+    "SNP_A-1685928",
+    "SNP_A-1517268",
+    "SNP_A-1513623",
+    "SNP_A-1510549",
+    "SNP_A-1507566",
+    NULL,
+    "SNP_A-1718607",
+    "SNP_A-1687050",
+    NULL,
+    "SNP_A-1515011",
+    "SNP_A-1517873",
+    "SNP_A-1676212",
+    "SNP_A-1714499",
+    "SNP_A-1606298",
+    NULL,
+    NULL,
+    "SNP_A-1750139",
+    "SNP_A-1717925",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-4209081",
+    "SNP_A-1516601",
+    NULL,
+    "SNP_A-8408567",
+    "SNP_A-1510214",
+    NULL,
+    "SNP_A-1518089",
+    "SNP_A-1746058",
+    "SNP_A-1519289",
+    "SNP_A-8574020",
+    "SNP_A-1514261",
+    "SNP_A-1516339",
+    "SNP_A-1839665",
+    "SNP_A-1511969",
+    "SNP_A-1507776",
+    "SNP_A-1719833",
+    NULL,
+    "SNP_A-1510598",
+    "SNP_A-1680414",
+    "SNP_A-1509038",
+    "SNP_A-1513137",
+    "SNP_A-1660773",
+    "SNP_A-1655819",
+    NULL,
+    "SNP_A-1701337",
+    NULL,
+    "SNP_A-1508969",
+    "SNP_A-1513920",
+    "SNP_A-1509528",
+    "SNP_A-1739967",
+    "SNP_A-1515805",
+    "SNP_A-1741617",
+    "SNP_A-1518955",
+    "SNP_A-1509199",
+    "SNP_A-1514641",
+    "SNP_A-1510888",
+    "SNP_A-1510758",
+    "SNP_A-1692336",
+    "SNP_A-2001369",
+    "SNP_A-1509766",
+    "SNP_A-1510351",
+    "SNP_A-1518564",
+    "SNP_A-1517368",
+    "SNP_A-1517091",
+    NULL,
+    "SNP_A-1719947",
+    "SNP_A-1517089",
+    NULL,
+    "SNP_A-1512221",
+    NULL,
+    "SNP_A-1706941",
+    NULL,
+    "SNP_A-8652790",
+    "SNP_A-1510887",
+    "SNP_A-1507897",
+    "SNP_A-1515761",
+    "SNP_A-1652250",
+    "SNP_A-1514977",
+    "SNP_A-1972740",
+    "SNP_A-1966937",
+    "SNP_A-1508631",
+    "SNP_A-1514272",
+    "SNP_A-1517376",
+    "SNP_A-1672312",
+    "SNP_A-1507355",
+    "SNP_A-1514469",
+    NULL,
+    "SNP_A-1510744",
+    "SNP_A-1654861",
+    NULL,
+    "SNP_A-8577643",
+    "SNP_A-1508795",
+    "SNP_A-4177287",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1509835",
+    NULL,
+    NULL,
+    "SNP_A-1515744",
+    "SNP_A-1691622",
+    "SNP_A-1722998",
+    "SNP_A-1652180",
+    NULL,
+    NULL,
+    "SNP_A-1658608",
+    "SNP_A-1734402",
+    "SNP_A-1509011",
+    "SNP_A-1758395",
+    "SNP_A-1517429",
+    "SNP_A-1512433",
+    "SNP_A-1515873",
+    "SNP_A-1683848",
+    "SNP_A-1508484",
+    "SNP_A-1513798",
+    "SNP_A-1744905",
+    NULL,
+    "SNP_A-4266270",
+    NULL,
+    NULL,
+    "SNP_A-1659516",
+    "SNP_A-1514548",
+    "SNP_A-1690783",
+    "SNP_A-8285630",
+    "SNP_A-1688938",
+    NULL,
+    "SNP_A-1509002",
+    "SNP_A-2239526",
+    "SNP_A-1514519",
+    NULL,
+    "SNP_A-1686302",
+    "SNP_A-1703505",
+    "SNP_A-1740617",
+    "SNP_A-2143727",
+    "SNP_A-1518348",
+    NULL,
+    "SNP_A-8662800",
+    "SNP_A-1694387",
+    "SNP_A-1516960",
+    NULL,
+    "SNP_A-1646240",
+    NULL,
+    "SNP_A-1515710",
+    "SNP_A-1692976",
+    "SNP_A-1514868",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1512080",
+    "SNP_A-1739825",
+    "SNP_A-1517847",
+    "SNP_A-1511398",
+    NULL,
+    "SNP_A-1840479",
+    "SNP_A-1509425",
+    "SNP_A-1655197",
+    "SNP_A-1647224",
+    "SNP_A-1509982",
+    NULL,
+    "SNP_A-1513403",
+    "SNP_A-1512951",
+    "SNP_A-1724450",
+    "SNP_A-1510617",
+    "SNP_A-8669990",
+    "SNP_A-1669783",
+    "SNP_A-1719137",
+    "SNP_A-1518958",
+    "SNP_A-1999368",
+    NULL,
+    "SNP_A-1679340",
+    NULL,
+    "SNP_A-1509152",
+    "SNP_A-1509513",
+    NULL,
+    NULL,
+    "SNP_A-1513898",
+    "SNP_A-1688868",
+    NULL,
+    "SNP_A-1516633",
+    NULL,
+    "SNP_A-8531233",
+    "SNP_A-1507794",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-4214457",
+    "SNP_A-1745452",
+    NULL,
+    "SNP_A-1516033",
+    "SNP_A-1692458",
+    NULL,
+    "SNP_A-1519737",
+    "SNP_A-1516174",
+    "SNP_A-1512106",
+    "SNP_A-1754690",
+    "SNP_A-1515891",
+    "SNP_A-1659070",
+    "SNP_A-1658006",
+    NULL,
+    "SNP_A-1692700",
+    "SNP_A-1722538",
+    "SNP_A-1517473",
+    "SNP_A-1518492",
+    "SNP_A-1519200",
+    "SNP_A-1513347",
+    "SNP_A-1515386",
+    "SNP_A-1517897",
+    "SNP_A-1517803",
+    NULL,
+    "SNP_A-1515290",
+    "SNP_A-8343600",
+    "SNP_A-1509655",
+    "SNP_A-1514760",
+    "SNP_A-1519019",
+    "SNP_A-1752607",
+    "SNP_A-1514344",
+    "SNP_A-1750009",
+    "SNP_A-1516791",
+    "SNP_A-1979581",
+    "SNP_A-1726988",
+    "SNP_A-1518690",
+    "SNP_A-1511463",
+    "SNP_A-1509365",
+    "SNP_A-1516809",
+    "SNP_A-1744893",
+    "SNP_A-1721748",
+    "SNP_A-4215096",
+    "SNP_A-1515458",
+    "SNP_A-1680906",
+    "SNP_A-1518202",
+    "SNP_A-1732053",
+    "SNP_A-1517631",
+    "SNP_A-1692294",
+    "SNP_A-1988461",
+    "SNP_A-1519197",
+    "SNP_A-1508321",
+    NULL,
+    "SNP_A-1733500",
+    "SNP_A-4269866",
+    "SNP_A-1685100",
+    "SNP_A-1717587",
+    "SNP_A-1508287",
+    "SNP_A-1689703",
+    "SNP_A-1696518",
+    "SNP_A-2204694",
+    "SNP_A-1708144",
+    "SNP_A-1517948",
+    NULL,
+    "SNP_A-1516349",
+    "SNP_A-1647510",
+    "SNP_A-1511856",
+    "SNP_A-1656785",
+    NULL,
+    NULL,
+    "SNP_A-2299117",
+    "SNP_A-1513157",
+    "SNP_A-4268906",
+    "SNP_A-1518218",
+    "SNP_A-1920577",
+    "SNP_A-1509840",
+    NULL,
+    "SNP_A-1649620",
+    "SNP_A-1511084",
+    NULL,
+    "SNP_A-8558185",
+    NULL,
+    "SNP_A-1754670",
+    NULL,
+    "SNP_A-1515406",
+    NULL,
+    "SNP_A-1645036",
+    "SNP_A-1695775",
+    "SNP_A-1724792",
+    NULL,
+    "SNP_A-1512071",
+    "SNP_A-1655805",
+    NULL,
+    "SNP_A-1516719",
+    "SNP_A-1647336",
+    "SNP_A-1511514",
+    NULL,
+    "SNP_A-1515644",
+    "SNP_A-1995593",
+    "SNP_A-8668358",
+    "SNP_A-1975317",
+    NULL,
+    "SNP_A-1510674",
+    "SNP_A-1518226",
+    "SNP_A-1516306",
+    "SNP_A-1509138",
+    "SNP_A-1515665",
+    "SNP_A-1510308",
+    "SNP_A-8664392",
+    "SNP_A-1519721",
+    NULL,
+    "SNP_A-1973439",
+    NULL,
+    "SNP_A-1735961",
+    "SNP_A-1754862",
+    "SNP_A-1508930",
+    "SNP_A-2002270",
+    "SNP_A-1702461",
+    "SNP_A-1519584",
+    "SNP_A-1509360",
+    NULL,
+    "SNP_A-1517331",
+    "SNP_A-8280602",
+    "SNP_A-1606366",
+    "SNP_A-1516398",
+    "SNP_A-1515747",
+    "SNP_A-1674213",
+    NULL,
+    "SNP_A-1683680",
+    "SNP_A-1517554",
+    NULL,
+    "SNP_A-8578040",
+    "SNP_A-1519667",
+    "SNP_A-1713458",
+    "SNP_A-1667694",
+    "SNP_A-1517926",
+    NULL,
+    "SNP_A-4278024",
+    "SNP_A-1509015",
+    "SNP_A-8688398",
+    "SNP_A-4212274",
+    NULL,
+    "SNP_A-8578326",
+    NULL,
+    "SNP_A-1740893",
+    "SNP_A-8667052",
+    "SNP_A-1518922",
+    "SNP_A-1723200",
+    "SNP_A-1512962",
+    "SNP_A-1690271",
+    "SNP_A-1717713",
+    "SNP_A-1509992",
+    "SNP_A-1515561",
+    "SNP_A-1508261",
+    "SNP_A-1658242",
+    NULL,
+    "SNP_A-1979440",
+    NULL,
+    "SNP_A-1717319",
+    "SNP_A-1517267",
+    "SNP_A-1512097",
+    "SNP_A-1510081",
+    "SNP_A-1513775",
+    "SNP_A-1717225",
+    "SNP_A-1513269",
+    NULL,
+    "SNP_A-1697304",
+    "SNP_A-1688448",
+    NULL,
+    "SNP_A-1736285",
+    "SNP_A-1518803",
+    "SNP_A-1518894",
+    "SNP_A-1674155",
+    "SNP_A-1517574",
+    "SNP_A-1507539",
+    "SNP_A-1996688",
+    "SNP_A-1721960",
+    "SNP_A-4209919",
+    "SNP_A-1708540",
+    NULL,
+    "SNP_A-8619528",
+    "SNP_A-1736173",
+    "SNP_A-1511458",
+    "SNP_A-1662876",
+    NULL,
+    "SNP_A-1514422",
+    "SNP_A-1518258",
+    NULL,
+    "SNP_A-1686506",
+    "SNP_A-8462737",
+    "SNP_A-8292330",
+    "SNP_A-1512998",
+    "SNP_A-1508533",
+    "SNP_A-1514806",
+    NULL,
+    NULL,
+    "SNP_A-1510712",
+    "SNP_A-1513174",
+    "SNP_A-1517859",
+    "SNP_A-1515380",
+    "SNP_A-1519744",
+    "SNP_A-1758123",
+    "SNP_A-1512923",
+    "SNP_A-1515402",
+    NULL,
+    "SNP_A-1512548",
+    NULL,
+    "SNP_A-1656037",
+    "SNP_A-1515718",
+    "SNP_A-1709133",
+    NULL,
+    "SNP_A-1513972",
+    "SNP_A-2266895",
+    "SNP_A-1518872",
+    "SNP_A-1509993",
+    NULL,
+    NULL,
+    "SNP_A-1513132",
+    "SNP_A-1513234",
+    "SNP_A-1510479",
+    "SNP_A-2003231",
+    "SNP_A-1644882",
+    NULL,
+    "SNP_A-1519135",
+    "SNP_A-2001397",
+    NULL,
+    "SNP_A-1511119",
+    NULL,
+    NULL,
+    "SNP_A-1513619",
+    "SNP_A-8618386",
+    "SNP_A-1711246",
+    "SNP_A-1517712",
+    "SNP_A-1516155",
+    "SNP_A-1518110",
+    "SNP_A-1679648",
+    NULL,
+    "SNP_A-1514410",
+    "SNP_A-1510988",
+    "SNP_A-1664780",
+    "SNP_A-1660713",
+    "SNP_A-1513267",
+    "SNP_A-1512135",
+    "SNP_A-1702367",
+    "SNP_A-1704327",
+    NULL,
+    "SNP_A-1650704",
+    "SNP_A-1514949",
+    NULL,
+    NULL,
+    "SNP_A-1511626",
+    "SNP_A-1657093",
+    "SNP_A-1508992",
+    "SNP_A-1714681",
+    "SNP_A-1658842",
+    "SNP_A-1513609",
+    NULL,
+    NULL,
+    "SNP_A-1517390",
+    "SNP_A-1668612",
+    "SNP_A-1726894",
+    NULL,
+    "SNP_A-1510126",
+    "SNP_A-1690117",
+    "SNP_A-8671030",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1513364",
+    "SNP_A-1519274",
+    NULL,
+    NULL,
+    "SNP_A-1510993",
+    NULL,
+    "SNP_A-1519755",
+    "SNP_A-1744917",
+    NULL,
+    "SNP_A-1511708",
+    "SNP_A-1518812",
+    NULL,
+    "SNP_A-1509041",
+    "SNP_A-1515862",
+    "SNP_A-1509946",
+    "SNP_A-1519538",
+    "SNP_A-1694859",
+    "SNP_A-1715207",
+    "SNP_A-1679456",
+    "SNP_A-1514808",
+    "SNP_A-8663310",
+    "SNP_A-4243775",
+    "SNP_A-1514614",
+    "SNP_A-1518181",
+    "SNP_A-1512640",
+    NULL,
+    "SNP_A-1510972",
+    NULL,
+    "SNP_A-1515450",
+    "SNP_A-1516508",
+    "SNP_A-1516150",
+    NULL,
+    "SNP_A-1723194",
+    "SNP_A-1510173",
+    "SNP_A-1515250",
+    "SNP_A-1513709",
+    NULL,
+    "SNP_A-1512336",
+    "SNP_A-1511772",
+    "SNP_A-1736551",
+    "SNP_A-1657982",
+    NULL,
+    "SNP_A-1510291",
+    "SNP_A-1511124",
+    NULL,
+    "SNP_A-1707685",
+    "SNP_A-1507807",
+    "SNP_A-1507392",
+    "SNP_A-1510410",
+    "SNP_A-1715957",
+    "SNP_A-1508462",
+    "SNP_A-1657824",
+    NULL,
+    "SNP_A-1726058",
+    "SNP_A-1511783",
+    "SNP_A-1512953",
+    "SNP_A-4266726",
+    "SNP_A-1670702",
+    "SNP_A-1517555",
+    "SNP_A-1963134",
+    "SNP_A-1508617",
+    "SNP_A-1660777",
+    "SNP_A-1508689",
+    "SNP_A-1687104",
+    "SNP_A-1737878",
+    NULL,
+    "SNP_A-1518011",
+    "SNP_A-1676278",
+    "SNP_A-1516312",
+    "SNP_A-1512920",
+    "SNP_A-1511687",
+    NULL,
+    NULL,
+    "SNP_A-1962393",
+    "SNP_A-1519281",
+    "SNP_A-1509580",
+    "SNP_A-1517615",
+    "SNP_A-1507825",
+    "SNP_A-2029049",
+    "SNP_A-1727677",
+    "SNP_A-1694721",
+    "SNP_A-1652816",
+    NULL,
+    "SNP_A-1662496",
+    "SNP_A-1515231",
+    "SNP_A-1661932",
+    "SNP_A-1718685",
+    NULL,
+    "SNP_A-2054607",
+    "SNP_A-1644400",
+    "SNP_A-1518585",
+    "SNP_A-1510613",
+    "SNP_A-1509626",
+    NULL,
+    "SNP_A-4269445",
+    "SNP_A-1681590",
+    "SNP_A-1643818",
+    "SNP_A-1515149",
+    "SNP_A-1980318",
+    "SNP_A-1703675",
+    "SNP_A-1676886",
+    "SNP_A-1511259",
+    "SNP_A-1508750",
+    "SNP_A-1752967",
+    "SNP_A-1508516",
+    "SNP_A-1510204",
+    NULL,
+    "SNP_A-8655245",
+    "SNP_A-1997593",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1510504",
+    NULL,
+    "SNP_A-8296781",
+    "SNP_A-1511804",
+    "SNP_A-1507764",
+    "SNP_A-1510171",
+    NULL,
+    "SNP_A-1507478",
+    "SNP_A-1514297",
+    NULL,
+    "SNP_A-2226670",
+    "SNP_A-1509855",
+    "SNP_A-1715387",
+    "SNP_A-1512389",
+    NULL,
+    "SNP_A-1659862",
+    NULL,
+    NULL,
+    "SNP_A-1509733",
+    "SNP_A-1676452",
+    NULL,
+    "SNP_A-1514720",
+    "SNP_A-1508841",
+    "SNP_A-1508004",
+    NULL,
+    "SNP_A-1512635",
+    "SNP_A-1754114",
+    "SNP_A-1519031",
+    "SNP_A-1758354",
+    "SNP_A-1511792",
+    NULL,
+    "SNP_A-1512146",
+    "SNP_A-1508094",
+    NULL,
+    "SNP_A-1507596",
+    NULL,
+    "SNP_A-1510391",
+    "SNP_A-1645222",
+    "SNP_A-1519522",
+    NULL,
+    "SNP_A-1728613",
+    "SNP_A-1513562",
+    NULL,
+    "SNP_A-1508623",
+    NULL,
+    NULL,
+    "SNP_A-1971598",
+    "SNP_A-1699255",
+    "SNP_A-1519496",
+    "SNP_A-1507432",
+    "SNP_A-1645196",
+    "SNP_A-1705997",
+    "SNP_A-1518786",
+    "SNP_A-1699635",
+    "SNP_A-8572854",
+    "SNP_A-1513793",
+    "SNP_A-1512103",
+    "SNP_A-4212638",
+    "SNP_A-1513144",
+    "SNP_A-1518967",
+    "SNP_A-1725068",
+    NULL,
+    "SNP_A-1514363",
+    "SNP_A-1509712",
+    "SNP_A-1510218",
+    NULL,
+    "SNP_A-1511826",
+    "SNP_A-1519257",
+    "SNP_A-1708218",
+    "SNP_A-1508343",
+    "SNP_A-1671232",
+    "SNP_A-8662220",
+    "SNP_A-1688468",
+    NULL,
+    "SNP_A-1746893",
+    NULL,
+    "SNP_A-1658234",
+    NULL,
+    "SNP_A-1516063",
+    "SNP_A-1510935",
+    "SNP_A-1515610",
+    NULL,
+    "SNP_A-1746164",
+    "SNP_A-1516461",
+    "SNP_A-1519245",
+    NULL,
+    "SNP_A-1978646",
+    "SNP_A-1510984",
+    "SNP_A-1515209",
+    "SNP_A-1512681",
+    "SNP_A-4214839",
+    "SNP_A-1694951",
+    "SNP_A-1649652",
+    "SNP_A-1652900",
+    "SNP_A-1756821",
+    "SNP_A-4210299",
+    NULL,
+    "SNP_A-1508849",
+    NULL,
+    "SNP_A-1750859",
+    "SNP_A-1511198",
+    "SNP_A-1509389",
+    "SNP_A-1757787",
+    "SNP_A-1657309",
+    NULL,
+    "SNP_A-1518009",
+    "SNP_A-1680448",
+    "SNP_A-1516622",
+    "SNP_A-2014634",
+    "SNP_A-1666814",
+    "SNP_A-1511554",
+    NULL,
+    "SNP_A-1509353",
+    "SNP_A-4210809",
+    "SNP_A-1751485",
+    NULL,
+    "SNP_A-1647812",
+    "SNP_A-8352119",
+    "SNP_A-1510322",
+    NULL,
+    "SNP_A-8583531",
+    "SNP_A-8665659",
+    "SNP_A-1646106",
+    NULL,
+    "SNP_A-8281339",
+    "SNP_A-4212904",
+    "SNP_A-1510454",
+    "SNP_A-1511269",
+    NULL,
+    "SNP_A-1511766",
+    "SNP_A-1703083",
+    "SNP_A-1997610",
+    NULL,
+    "SNP_A-1507873",
+    "SNP_A-1702963",
+    NULL,
+    "SNP_A-1513432",
+    "SNP_A-1508192",
+    "SNP_A-1756657",
+    "SNP_A-1509121",
+    "SNP_A-1508818",
+    "SNP_A-1706621",
+    "SNP_A-1662994",
+    "SNP_A-1509347",
+    "SNP_A-1720123",
+    "SNP_A-1993254",
+    "SNP_A-8667951",
+    "SNP_A-1516746",
+    "SNP_A-1659700",
+    "SNP_A-1507868",
+    "SNP_A-1515632",
+    "SNP_A-1675399",
+    "SNP_A-1514301",
+    "SNP_A-1510041",
+    "SNP_A-1738913",
+    NULL,
+    "SNP_A-1507350",
+    "SNP_A-1996196",
+    "SNP_A-1513193",
+    "SNP_A-1515348",
+    "SNP_A-1693337",
+    "SNP_A-1519184",
+    "SNP_A-1509429",
+    "SNP_A-4238502",
+    "SNP_A-1513084",
+    NULL,
+    "SNP_A-1511813",
+    "SNP_A-1516794",
+    NULL,
+    "SNP_A-1509211",
+    NULL,
+    NULL,
+    "SNP_A-1689783",
+    NULL,
+    "SNP_A-1519702",
+    "SNP_A-1514268",
+    "SNP_A-1706811",
+    "SNP_A-1705381",
+    "SNP_A-2130995",
+    "SNP_A-1517114",
+    "SNP_A-1822631",
+    NULL,
+    "SNP_A-1511478",
+    "SNP_A-8335783",
+    "SNP_A-1507851",
+    "SNP_A-1675746",
+    "SNP_A-1509227",
+    "SNP_A-8588567",
+    "SNP_A-1516525",
+    "SNP_A-4264271",
+    "SNP_A-1509377",
+    "SNP_A-1695375",
+    "SNP_A-1981562",
+    "SNP_A-1705753",
+    "SNP_A-1662252",
+    "SNP_A-1757201",
+    "SNP_A-1509441",
+    "SNP_A-1507980",
+    "SNP_A-1758992",
+    NULL,
+    "SNP_A-1662428",
+    "SNP_A-1756278",
+    "SNP_A-1994221",
+    "SNP_A-1725410",
+    "SNP_A-1509739",
+    NULL,
+    "SNP_A-1516987",
+    "SNP_A-1513511",
+    NULL,
+    "SNP_A-1507719",
+    "SNP_A-1755724",
+    "SNP_A-1518623",
+    "SNP_A-8665510",
+    NULL,
+    NULL,
+    "SNP_A-1687048",
+    "SNP_A-1973613",
+    "SNP_A-1517072",
+    NULL,
+    "SNP_A-1514842",
+    "SNP_A-4262602",
+    "SNP_A-1687838",
+    "SNP_A-1937116",
+    NULL,
+    "SNP_A-1668819",
+    "SNP_A-1511242",
+    "SNP_A-4261923",
+    "SNP_A-1510167",
+    "SNP_A-1514879",
+    "SNP_A-1511172",
+    "SNP_A-1514429",
+    NULL,
+    NULL,
+    "SNP_A-4212026",
+    "SNP_A-1741181",
+    NULL,
+    "SNP_A-1511209",
+    "SNP_A-2006783",
+    "SNP_A-1515536",
+    "SNP_A-1508857",
+    NULL,
+    NULL,
+    "SNP_A-1516374",
+    "SNP_A-1508262",
+    "SNP_A-1515251",
+    "SNP_A-1751755",
+    "SNP_A-1515059",
+    "SNP_A-8662322",
+    "SNP_A-1712945",
+    NULL,
+    "SNP_A-1721177",
+    "SNP_A-1516386",
+    "SNP_A-1984545",
+    "SNP_A-2094087",
+    "SNP_A-4291647",
+    "SNP_A-1755432",
+    "SNP_A-1514129",
+    "SNP_A-1734554",
+    "SNP_A-1663844",
+    "SNP_A-1994263",
+    "SNP_A-1518220",
+    "SNP_A-2110959",
+    "SNP_A-4270662",
+    "SNP_A-1509005",
+    "SNP_A-1516097",
+    NULL,
+    "SNP_A-1741749",
+    "SNP_A-1742237",
+    "SNP_A-1518323",
+    "SNP_A-1518863",
+    NULL,
+    "SNP_A-8667688",
+    "SNP_A-1512542",
+    NULL,
+    "SNP_A-1683292",
+    "SNP_A-1511508",
+    "SNP_A-1705699",
+    "SNP_A-1737808",
+    "SNP_A-1646152",
+    "SNP_A-1645888",
+    "SNP_A-1515896",
+    "SNP_A-1517908",
+    NULL,
+    "SNP_A-1744265",
+    "SNP_A-1511133",
+    NULL,
+    "SNP_A-1511632",
+    "SNP_A-1510247",
+    "SNP_A-1691242",
+    "SNP_A-1606346",
+    "SNP_A-1982148",
+    "SNP_A-1706675",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514246",
+    NULL,
+    "SNP_A-1668777",
+    NULL,
+    "SNP_A-1657299",
+    NULL,
+    "SNP_A-1514277",
+    "SNP_A-1975785",
+    "SNP_A-1512646",
+    "SNP_A-1996125",
+    "SNP_A-4265141",
+    "SNP_A-4209032",
+    "SNP_A-1723058",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1513554",
+    "SNP_A-1511666",
+    "SNP_A-1511984",
+    "SNP_A-1704879",
+    "SNP_A-1697064",
+    "SNP_A-1681662",
+    "SNP_A-1516106",
+    "SNP_A-1809703",
+    NULL,
+    "SNP_A-1511584",
+    "SNP_A-1963761",
+    "SNP_A-1517545",
+    "SNP_A-1756184",
+    "SNP_A-1510123",
+    "SNP_A-1512035",
+    "SNP_A-1757221",
+    "SNP_A-1516372_2",
+    NULL,
+    "SNP_A-1517662",
+    "SNP_A-1656625",
+    "SNP_A-1667960",
+    "SNP_A-1739135",
+    "SNP_A-1659464",
+    "SNP_A-1517971",
+    "SNP_A-1516127",
+    "SNP_A-1688644",
+    "SNP_A-2164107",
+    "SNP_A-1510960",
+    "SNP_A-1651316",
+    "SNP_A-1508778",
+    NULL,
+    "SNP_A-1647304",
+    NULL,
+    "SNP_A-1749401",
+    "SNP_A-1514054",
+    NULL,
+    "SNP_A-1512054",
+    "SNP_A-1741863",
+    NULL,
+    "SNP_A-1518347",
+    NULL,
+    "SNP_A-1702653",
+    "SNP_A-8664845",
+    "SNP_A-1515903",
+    "SNP_A-1713003",
+    "SNP_A-1512391",
+    "SNP_A-1644384",
+    "SNP_A-1513444",
+    "SNP_A-1739903",
+    "SNP_A-8378958",
+    "SNP_A-8671207",
+    "SNP_A-1516611",
+    "SNP_A-1670788",
+    "SNP_A-8333753",
+    "SNP_A-1655323",
+    "SNP_A-1516678",
+    "SNP_A-1514415",
+    "SNP_A-1511187",
+    "SNP_A-1519313",
+    "SNP_A-1980270",
+    "SNP_A-1730527",
+    "SNP_A-1510592",
+    "SNP_A-1508876",
+    NULL,
+    "SNP_A-1517421",
+    "SNP_A-1508109",
+    "SNP_A-1715911",
+    "SNP_A-1510760",
+    "SNP_A-1509205",
+    "SNP_A-8621481",
+    "SNP_A-8285505",
+    "SNP_A-1516068",
+    "SNP_A-4210324",
+    "SNP_A-1507839",
+    "SNP_A-1966139",
+    "SNP_A-1733658",
+    NULL,
+    NULL,
+    "SNP_A-1519259",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1513524",
+    "SNP_A-1517454",
+    "SNP_A-1736715",
+    "SNP_A-1675407",
+    "SNP_A-1758638",
+    NULL,
+    "SNP_A-1696994",
+    "SNP_A-1678980",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1512403",
+    "SNP_A-1516488",
+    "SNP_A-1514672",
+    NULL,
+    "SNP_A-1650732",
+    "SNP_A-1654103",
+    "SNP_A-1513387",
+    "SNP_A-1514350",
+    NULL,
+    NULL,
+    "SNP_A-8282271",
+    "SNP_A-1979564",
+    "SNP_A-1713928",
+    "SNP_A-1518103",
+    "SNP_A-1712429",
+    "SNP_A-1511985",
+    NULL,
+    "SNP_A-2243020",
+    "SNP_A-1508263",
+    NULL,
+    "SNP_A-1965880",
+    "SNP_A-1747887",
+    NULL,
+    "SNP_A-1675139",
+    "SNP_A-1516990",
+    "SNP_A-1510807",
+    NULL,
+    "SNP_A-2178048",
+    "SNP_A-1507816",
+    "SNP_A-4211238",
+    "SNP_A-4213380",
+    NULL,
+    NULL,
+    "SNP_A-1509799",
+    "SNP_A-1516295",
+    "SNP_A-1515359",
+    "SNP_A-1731025",
+    "SNP_A-1706147",
+    "SNP_A-1976086",
+    "SNP_A-1689825",
+    "SNP_A-1509065",
+    NULL,
+    "SNP_A-1677112",
+    NULL,
+    "SNP_A-1509386",
+    "SNP_A-1662950",
+    NULL,
+    "SNP_A-1646118",
+    "SNP_A-1517801",
+    NULL,
+    "SNP_A-1695255",
+    "SNP_A-1647208",
+    "SNP_A-1718529",
+    "SNP_A-8474036",
+    "SNP_A-1519376",
+    "SNP_A-1512963",
+    "SNP_A-1518559",
+    "SNP_A-1674062",
+    "SNP_A-1518796",
+    NULL,
+    NULL,
+    "SNP_A-1725976",
+    "SNP_A-1509174",
+    "SNP_A-1510337",
+    NULL,
+    NULL,
+    "SNP_A-1514303",
+    "SNP_A-1742669",
+    NULL,
+    "SNP_A-1967669",
+    "SNP_A-1514830",
+    "SNP_A-1725448",
+    NULL,
+    "SNP_A-1519697",
+    "SNP_A-4265302",
+    "SNP_A-1661874",
+    "SNP_A-1512824",
+    "SNP_A-1707559",
+    "SNP_A-1643089",
+    "SNP_A-1512446",
+    "SNP_A-1644066",
+    "SNP_A-1509496",
+    "SNP_A-1509932",
+    NULL,
+    "SNP_A-1678616",
+    "SNP_A-1508422",
+    NULL,
+    "SNP_A-4244074",
+    "SNP_A-1729202",
+    "SNP_A-1507617",
+    "SNP_A-1721159",
+    "SNP_A-1674205",
+    "SNP_A-1512856",
+    "SNP_A-1742427",
+    "SNP_A-1966000",
+    NULL,
+    "SNP_A-1519334",
+    "SNP_A-1513241",
+    "SNP_A-1989711",
+    "SNP_A-1722172",
+    NULL,
+    "SNP_A-1515442",
+    "SNP_A-1692918",
+    "SNP_A-1517156",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514342",
+    NULL,
+    "SNP_A-1511492",
+    NULL,
+    NULL,
+    "SNP_A-1510292",
+    "SNP_A-1677978",
+    "SNP_A-1514706",
+    "SNP_A-1649602",
+    "SNP_A-1699305",
+    NULL,
+    "SNP_A-1510237",
+    "SNP_A-1737273",
+    NULL,
+    "SNP_A-1515572",
+    "SNP_A-1701223",
+    "SNP_A-1507443",
+    "SNP_A-1510920",
+    "SNP_A-1508966",
+    "SNP_A-1508539",
+    "SNP_A-1512273",
+    NULL,
+    "SNP_A-1737876",
+    "SNP_A-1519468",
+    "SNP_A-1724028",
+    NULL,
+    "SNP_A-1696038",
+    "SNP_A-1508235",
+    "SNP_A-1513337",
+    NULL,
+    "SNP_A-1516598",
+    "SNP_A-1513239",
+    NULL,
+    "SNP_A-1512610",
+    "SNP_A-1514829",
+    NULL,
+    "SNP_A-1518545",
+    "SNP_A-1983456",
+    "SNP_A-1689404",
+    "SNP_A-1513572",
+    "SNP_A-1512507",
+    "SNP_A-1507656",
+    "SNP_A-1686464",
+    "SNP_A-8333960",
+    "SNP_A-8287775",
+    "SNP_A-1510803",
+    "SNP_A-1515125",
+    NULL,
+    NULL,
+    "SNP_A-1643600",
+    "SNP_A-1686388",
+    "SNP_A-1519304",
+    "SNP_A-1514095",
+    NULL,
+    "SNP_A-1513346",
+    "SNP_A-1510512",
+    "SNP_A-1517308",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1749357",
+    NULL,
+    "SNP_A-1756503",
+    "SNP_A-1691610",
+    "SNP_A-1510611",
+    "SNP_A-1518614",
+    "SNP_A-1516911",
+    NULL,
+    "SNP_A-1757789",
+    NULL,
+    "SNP_A-1509761",
+    "SNP_A-1515213",
+    NULL,
+    NULL,
+    "SNP_A-1518002",
+    "SNP_A-4261605",
+    NULL,
+    "SNP_A-1696016",
+    "SNP_A-1517195",
+    "SNP_A-1669307",
+    NULL,
+    "SNP_A-8282432",
+    "SNP_A-1742259",
+    "SNP_A-1679568",
+    NULL,
+    "SNP_A-1676134",
+    "SNP_A-1519714",
+    "SNP_A-1519546",
+    "SNP_A-1518121",
+    "SNP_A-4282415",
+    "SNP_A-1649580",
+    "SNP_A-1704795",
+    "SNP_A-1696496",
+    NULL,
+    "SNP_A-1758138",
+    "SNP_A-1516209",
+    "SNP_A-1513064",
+    "SNP_A-1515081",
+    "SNP_A-1519736",
+    NULL,
+    "SNP_A-4209374",
+    "SNP_A-1507669",
+    "SNP_A-1997940",
+    "SNP_A-1513555",
+    "SNP_A-1510158",
+    "SNP_A-1509879",
+    "SNP_A-1720137",
+    NULL,
+    "SNP_A-1517504",
+    "SNP_A-1509860",
+    "SNP_A-1700109",
+    "SNP_A-4262967",
+    "SNP_A-1669225",
+    "SNP_A-1659528",
+    NULL,
+    NULL,
+    "SNP_A-1509278",
+    "SNP_A-1722196",
+    NULL,
+    "SNP_A-1971383",
+    "SNP_A-8579186",
+    NULL,
+    "SNP_A-1644610",
+    "SNP_A-1511185",
+    "SNP_A-1512089",
+    "SNP_A-8617016",
+    "SNP_A-1518400",
+    "SNP_A-1519237",
+    "SNP_A-8617155",
+    "SNP_A-1512757",
+    "SNP_A-1741491",
+    "SNP_A-1515351",
+    "SNP_A-1507671",
+    "SNP_A-1757793",
+    "SNP_A-1516808",
+    "SNP_A-1662992",
+    "SNP_A-1511345",
+    "SNP_A-1998870",
+    "SNP_A-1508590",
+    NULL,
+    "SNP_A-1515902",
+    "SNP_A-1682888",
+    "SNP_A-1645260",
+    "SNP_A-1517202",
+    "SNP_A-1510863",
+    "SNP_A-1606312",
+    "SNP_A-1512359",
+    "SNP_A-1516744",
+    "SNP_A-8558898",
+    NULL,
+    NULL,
+    "SNP_A-1509014",
+    "SNP_A-8574649",
+    "SNP_A-1513454",
+    "SNP_A-1510647",
+    "SNP_A-1512327",
+    NULL,
+    "SNP_A-1519633",
+    "SNP_A-1512879",
+    "SNP_A-1733038",
+    "SNP_A-1742727",
+    NULL,
+    "SNP_A-1515324",
+    "SNP_A-1963311",
+    "SNP_A-1758629",
+    NULL,
+    "SNP_A-1657882",
+    "SNP_A-4264728",
+    "SNP_A-1508244",
+    "SNP_A-1695419",
+    "SNP_A-1515669",
+    "SNP_A-1756677",
+    "SNP_A-1509657",
+    "SNP_A-1657433",
+    "SNP_A-1508480",
+    "SNP_A-1515667",
+    "SNP_A-1510535",
+    "SNP_A-8580403",
+    "SNP_A-1716723",
+    "SNP_A-1663050",
+    "SNP_A-1516636",
+    "SNP_A-1729470",
+    "SNP_A-2038165",
+    NULL,
+    "SNP_A-1510822",
+    "SNP_A-1517900",
+    "SNP_A-1715087",
+    "SNP_A-1982076",
+    "SNP_A-8665048",
+    NULL,
+    "SNP_A-1515515",
+    "SNP_A-1509598",
+    "SNP_A-1510400",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1676950",
+    "SNP_A-8472301",
+    "SNP_A-1519062",
+    "SNP_A-1716695",
+    "SNP_A-1655289",
+    "SNP_A-1665904",
+    "SNP_A-1508021",
+    "SNP_A-1517106",
+    "SNP_A-1511758",
+    NULL,
+    "SNP_A-1517218",
+    NULL,
+    "SNP_A-1511596",
+    "SNP_A-1710776",
+    "SNP_A-1748985",
+    "SNP_A-2007581",
+    "SNP_A-1748835",
+    NULL,
+    NULL,
+    "SNP_A-1517235",
+    "SNP_A-1515381",
+    "SNP_A-1737433",
+    "SNP_A-1735062",
+    "SNP_A-1692732",
+    NULL,
+    NULL,
+    "SNP_A-1513283",
+    "SNP_A-1980262",
+    "SNP_A-1513643",
+    NULL,
+    "SNP_A-1677980",
+    "SNP_A-1507424",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1758516",
+    "SNP_A-1733152",
+    "SNP_A-1697142",
+    "SNP_A-1513570",
+    "SNP_A-1514192",
+    "SNP_A-1519417",
+    "SNP_A-1687584",
+    NULL,
+    "SNP_A-1511909",
+    "SNP_A-1976963",
+    "SNP_A-1720343",
+    "SNP_A-1511311",
+    NULL,
+    NULL,
+    "SNP_A-1666256",
+    "SNP_A-1512241",
+    NULL,
+    "SNP_A-1508398",
+    "SNP_A-1518235",
+    "SNP_A-1517312",
+    NULL,
+    "SNP_A-1511228",
+    "SNP_A-1515819",
+    "SNP_A-1512491",
+    "SNP_A-1965195",
+    "SNP_A-1706551",
+    "SNP_A-1663228",
+    "SNP_A-1509645",
+    "SNP_A-1751457",
+    "SNP_A-1517761",
+    "SNP_A-1512502",
+    "SNP_A-1512943",
+    "SNP_A-1510871",
+    "SNP_A-1513248",
+    "SNP_A-1513525",
+    "SNP_A-1518862",
+    "SNP_A-1681832",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1518038",
+    NULL,
+    NULL,
+    "SNP_A-8572850",
+    "SNP_A-1516080",
+    "SNP_A-1656049",
+    "SNP_A-1512048",
+    "SNP_A-1650346",
+    "SNP_A-1653952",
+    "SNP_A-4264144",
+    "SNP_A-1749587",
+    "SNP_A-1712805",
+    "SNP_A-1707808",
+    "SNP_A-4263342",
+    "SNP_A-1509351",
+    NULL,
+    "SNP_A-1519617",
+    "SNP_A-1743907",
+    "SNP_A-1510721",
+    "SNP_A-8322795",
+    "SNP_A-1650326",
+    "SNP_A-1749555",
+    "SNP_A-1720481",
+    "SNP_A-1757237",
+    "SNP_A-1661654",
+    "SNP_A-1509446",
+    "SNP_A-1673401",
+    "SNP_A-1969733",
+    "SNP_A-1714394",
+    "SNP_A-1606304",
+    "SNP_A-1649900",
+    "SNP_A-1655981",
+    "SNP_A-1515394",
+    "SNP_A-1511805",
+    "SNP_A-1512605",
+    "SNP_A-1670948",
+    "SNP_A-8572726",
+    "SNP_A-1519442",
+    "SNP_A-8695281",
+    "SNP_A-1511020",
+    "SNP_A-1646234",
+    "SNP_A-1514012",
+    NULL,
+    "SNP_A-8665309",
+    NULL,
+    "SNP_A-1839664",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516550",
+    "SNP_A-1519102",
+    "SNP_A-1513921",
+    "SNP_A-1512011",
+    "SNP_A-8342502",
+    "SNP_A-1509970",
+    "SNP_A-1519678",
+    "SNP_A-1514392",
+    NULL,
+    "SNP_A-1513214",
+    "SNP_A-1669551",
+    "SNP_A-1715489",
+    "SNP_A-1508854",
+    "SNP_A-1743515",
+    NULL,
+    "SNP_A-1664116",
+    "SNP_A-1512338",
+    NULL,
+    "SNP_A-1682520",
+    "SNP_A-1723134",
+    NULL,
+    "SNP_A-1667222",
+    NULL,
+    NULL,
+    "SNP_A-1726826",
+    "SNP_A-1514932",
+    NULL,
+    "SNP_A-1511671",
+    "SNP_A-1507730",
+    "SNP_A-8619266",
+    "SNP_A-1677936",
+    "SNP_A-1510788",
+    NULL,
+    "SNP_A-1984291",
+    "SNP_A-1518867",
+    "SNP_A-1514926",
+    "SNP_A-1975768",
+    "SNP_A-1982835",
+    NULL,
+    "SNP_A-1661660",
+    "SNP_A-1512532",
+    "SNP_A-1508953",
+    "SNP_A-1703897",
+    "SNP_A-8619622",
+    "SNP_A-4209299",
+    "SNP_A-1512983",
+    "SNP_A-1731477",
+    "SNP_A-1511097",
+    "SNP_A-1726694",
+    "SNP_A-1722488",
+    "SNP_A-1696628",
+    "SNP_A-1507509",
+    "SNP_A-1517045",
+    "SNP_A-1653894",
+    "SNP_A-1676798",
+    "SNP_A-1517291",
+    NULL,
+    "SNP_A-1516456",
+    "SNP_A-4216224",
+    "SNP_A-1665496",
+    "SNP_A-1509839",
+    "SNP_A-1512746",
+    "SNP_A-1512660",
+    "SNP_A-1518845",
+    "SNP_A-1510629",
+    "SNP_A-1745550",
+    "SNP_A-1691860",
+    NULL,
+    "SNP_A-1507488",
+    "SNP_A-1515173",
+    "SNP_A-1514208",
+    "SNP_A-1508407",
+    "SNP_A-1519707",
+    "SNP_A-8280683",
+    NULL,
+    NULL,
+    "SNP_A-1512519",
+    "SNP_A-1726822",
+    NULL,
+    NULL,
+    "SNP_A-4261768",
+    "SNP_A-1661043",
+    "SNP_A-1518306",
+    "SNP_A-1509654",
+    "SNP_A-1705097",
+    "SNP_A-1519263",
+    NULL,
+    NULL,
+    "SNP_A-1516045",
+    "SNP_A-1667182",
+    "SNP_A-1514055",
+    NULL,
+    "SNP_A-1752465",
+    "SNP_A-1996872",
+    "SNP_A-1703275",
+    "SNP_A-1514875",
+    "SNP_A-1512908",
+    "SNP_A-1718627",
+    "SNP_A-1514673",
+    "SNP_A-1997914",
+    NULL,
+    "SNP_A-1983165",
+    "SNP_A-1518187",
+    "SNP_A-1689959",
+    "SNP_A-1510277",
+    "SNP_A-1519477",
+    "SNP_A-1730837",
+    "SNP_A-1705889",
+    "SNP_A-1510894",
+    "SNP_A-1512529",
+    "SNP_A-1513126",
+    "SNP_A-1517945",
+    "SNP_A-4301969",
+    "SNP_A-1734120",
+    "SNP_A-1515257",
+    "SNP_A-1512131",
+    "SNP_A-1512783",
+    "SNP_A-1734968",
+    "SNP_A-1715469",
+    "SNP_A-1667646",
+    "SNP_A-1741025",
+    "SNP_A-1661139",
+    "SNP_A-1699891",
+    NULL,
+    "SNP_A-1698475",
+    "SNP_A-1514712",
+    "SNP_A-1516770",
+    NULL,
+    "SNP_A-1514667",
+    NULL,
+    NULL,
+    "SNP_A-1513762",
+    NULL,
+    "SNP_A-4209151",
+    "SNP_A-1980249",
+    "SNP_A-1510054",
+    "SNP_A-1707823",
+    "SNP_A-1509676",
+    "SNP_A-1739159",
+    NULL,
+    "SNP_A-1507590",
+    "SNP_A-1647534",
+    "SNP_A-1752887",
+    "SNP_A-1514141",
+    "SNP_A-4265404",
+    "SNP_A-1517964",
+    "SNP_A-1516157",
+    "SNP_A-1516304",
+    "SNP_A-8466652",
+    "SNP_A-1711973",
+    "SNP_A-1690463",
+    "SNP_A-8686664",
+    "SNP_A-1515914",
+    "SNP_A-8519543",
+    "SNP_A-1512382",
+    "SNP_A-1513518",
+    "SNP_A-1516086",
+    "SNP_A-1989744",
+    "SNP_A-1648036",
+    "SNP_A-1514045",
+    "SNP_A-1664108",
+    "SNP_A-1519751",
+    "SNP_A-1512483",
+    "SNP_A-1508008",
+    NULL,
+    "SNP_A-1517770",
+    "SNP_A-1711024",
+    "SNP_A-2278613",
+    "SNP_A-1685754",
+    "SNP_A-1510819",
+    "SNP_A-1511531",
+    NULL,
+    "SNP_A-1508196",
+    NULL,
+    NULL,
+    "SNP_A-1507472",
+    "SNP_A-1508238",
+    NULL,
+    "SNP_A-1508621",
+    "SNP_A-1507623",
+    "SNP_A-1507672",
+    NULL,
+    "SNP_A-1519298",
+    NULL,
+    NULL,
+    "SNP_A-1517148",
+    "SNP_A-1691788",
+    "SNP_A-1513119",
+    "SNP_A-1517526",
+    "SNP_A-1709909",
+    "SNP_A-1517284",
+    "SNP_A-1511849",
+    "SNP_A-1967174",
+    "SNP_A-1511118",
+    "SNP_A-4210545",
+    "SNP_A-1742935",
+    "SNP_A-1716289",
+    "SNP_A-1516653",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1657910",
+    "SNP_A-1515559",
+    "SNP_A-8291767",
+    "SNP_A-1512313",
+    "SNP_A-1749313",
+    NULL,
+    "SNP_A-1730825",
+    "SNP_A-1516586",
+    "SNP_A-1718481",
+    "SNP_A-1513078",
+    "SNP_A-1509631",
+    "SNP_A-1518509",
+    "SNP_A-1508441",
+    "SNP_A-1518912",
+    "SNP_A-1757083",
+    NULL,
+    "SNP_A-8337037",
+    "SNP_A-1931257",
+    "SNP_A-1517684",
+    "SNP_A-1984992",
+    "SNP_A-1730849",
+    NULL,
+    "SNP_A-1731643",
+    "SNP_A-1971058",
+    "SNP_A-1686640",
+    NULL,
+    "SNP_A-1684974",
+    "SNP_A-1507894",
+    "SNP_A-1518431",
+    "SNP_A-1516247",
+    "SNP_A-1866397",
+    NULL,
+    "SNP_A-1730671",
+    NULL,
+    "SNP_A-8667790",
+    "SNP_A-1514745",
+    NULL,
+    "SNP_A-1508822",
+    NULL,
+    NULL,
+    "SNP_A-1510671",
+    "SNP_A-1727855",
+    "SNP_A-4291648",
+    "SNP_A-1508614",
+    "SNP_A-1725750",
+    NULL,
+    "SNP_A-1512898",
+    "SNP_A-1718083",
+    "SNP_A-1513253",
+    "SNP_A-1512456",
+    "SNP_A-1518316",
+    "SNP_A-1669139",
+    NULL,
+    "SNP_A-1980253",
+    "SNP_A-1515460",
+    "SNP_A-1704911",
+    "SNP_A-1512595",
+    "SNP_A-1706009",
+    "SNP_A-1508112",
+    "SNP_A-1516264",
+    "SNP_A-1693379",
+    NULL,
+    "SNP_A-1516991",
+    "SNP_A-8335309",
+    "SNP_A-1518700",
+    "SNP_A-1660277",
+    "SNP_A-1518106",
+    "SNP_A-1510940",
+    "SNP_A-1519076",
+    "SNP_A-1515228",
+    "SNP_A-1509151",
+    "SNP_A-1758028",
+    "SNP_A-1696242",
+    "SNP_A-1513028",
+    "SNP_A-1968457",
+    "SNP_A-1508117",
+    "SNP_A-1649176",
+    "SNP_A-1516486",
+    "SNP_A-1734954",
+    NULL,
+    "SNP_A-1513359",
+    "SNP_A-1695857",
+    "SNP_A-1757755",
+    "SNP_A-8575279",
+    "SNP_A-1509614",
+    "SNP_A-1510659",
+    "SNP_A-1518546",
+    "SNP_A-1514809",
+    "SNP_A-1707631",
+    "SNP_A-1747203",
+    NULL,
+    "SNP_A-1514060",
+    "SNP_A-1514683",
+    "SNP_A-1736071",
+    "SNP_A-1519041",
+    "SNP_A-1515069",
+    NULL,
+    "SNP_A-1606288",
+    "SNP_A-1508331",
+    "SNP_A-1507714",
+    "SNP_A-1510669",
+    "SNP_A-1510456",
+    "SNP_A-1515027",
+    "SNP_A-1515082",
+    "SNP_A-1515841",
+    NULL,
+    "SNP_A-1738855",
+    "SNP_A-1511057",
+    NULL,
+    "SNP_A-1518864",
+    "SNP_A-1644750",
+    "SNP_A-1508493",
+    "SNP_A-1755610",
+    NULL,
+    "SNP_A-1511702",
+    "SNP_A-1677868",
+    "SNP_A-1510213",
+    "SNP_A-4205449",
+    "SNP_A-1743043",
+    "SNP_A-1516637",
+    "SNP_A-1987670",
+    "SNP_A-1507395",
+    "SNP_A-1743369",
+    "SNP_A-1696932",
+    "SNP_A-1688230",
+    "SNP_A-1753157",
+    "SNP_A-1516915",
+    "SNP_A-1513670",
+    "SNP_A-1654851",
+    "SNP_A-1710796",
+    "SNP_A-1694717",
+    "SNP_A-1513400",
+    NULL,
+    "SNP_A-1642277",
+    "SNP_A-1510796",
+    "SNP_A-1742245",
+    "SNP_A-4263174",
+    "SNP_A-1712795",
+    "SNP_A-1519435",
+    "SNP_A-1510107",
+    "SNP_A-1658986",
+    "SNP_A-1756713",
+    "SNP_A-1518760",
+    "SNP_A-1509521",
+    "SNP_A-1517273",
+    "SNP_A-1516534",
+    "SNP_A-1994710",
+    NULL,
+    "SNP_A-1693331",
+    "SNP_A-1717503",
+    NULL,
+    "SNP_A-1516652",
+    "SNP_A-1511191",
+    "SNP_A-1517781",
+    "SNP_A-1513091",
+    "SNP_A-1509817",
+    "SNP_A-1757914",
+    "SNP_A-1707407",
+    "SNP_A-1753329",
+    "SNP_A-1511517",
+    "SNP_A-1519434",
+    NULL,
+    "SNP_A-1517566",
+    "SNP_A-1519642",
+    "SNP_A-4188813",
+    "SNP_A-1517968",
+    "SNP_A-1645130",
+    "SNP_A-1512830",
+    "SNP_A-1510833",
+    "SNP_A-1518656",
+    NULL,
+    "SNP_A-1518948",
+    "SNP_A-1651892",
+    NULL,
+    "SNP_A-1516956",
+    NULL,
+    "SNP_A-1753253",
+    "SNP_A-1510263",
+    "SNP_A-1519344",
+    "SNP_A-1515036",
+    NULL,
+    "SNP_A-1509710",
+    "SNP_A-1513543",
+    "SNP_A-1507618",
+    "SNP_A-1517460",
+    NULL,
+    "SNP_A-1683888",
+    "SNP_A-1513065",
+    "SNP_A-1672112",
+    "SNP_A-1510446",
+    NULL,
+    "SNP_A-1676860",
+    "SNP_A-1508817",
+    "SNP_A-1753423",
+    NULL,
+    "SNP_A-1746637",
+    "SNP_A-1725900",
+    "SNP_A-1995546",
+    NULL,
+    "SNP_A-1517947",
+    "SNP_A-1510596",
+    "SNP_A-1754894",
+    "SNP_A-1988514",
+    "SNP_A-1742019",
+    NULL,
+    "SNP_A-1509307",
+    "SNP_A-1511227",
+    "SNP_A-1726124",
+    "SNP_A-4247761",
+    "SNP_A-1512176",
+    "SNP_A-1514542",
+    "SNP_A-1756098",
+    "SNP_A-1517765",
+    "SNP_A-1723636",
+    "SNP_A-1511350",
+    "SNP_A-1756108",
+    "SNP_A-8283931",
+    "SNP_A-1509054",
+    "SNP_A-1509807",
+    "SNP_A-1516892",
+    "SNP_A-4236477",
+    NULL,
+    NULL,
+    "SNP_A-1510813",
+    "SNP_A-1664688",
+    "SNP_A-1647494",
+    "SNP_A-1517709",
+    "SNP_A-1514953",
+    "SNP_A-1700526",
+    "SNP_A-1733292",
+    "SNP_A-1711634",
+    NULL,
+    "SNP_A-1514878",
+    "SNP_A-1518702",
+    "SNP_A-1512976",
+    "SNP_A-1517974",
+    "SNP_A-1515270",
+    "SNP_A-1517998",
+    "SNP_A-1512834",
+    NULL,
+    "SNP_A-1517051",
+    NULL,
+    NULL,
+    "SNP_A-4209807",
+    "SNP_A-1758356",
+    "SNP_A-1758544",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1508189",
+    "SNP_A-1672430",
+    "SNP_A-1519279",
+    "SNP_A-1510665",
+    NULL,
+    "SNP_A-1507899",
+    "SNP_A-1507523",
+    "SNP_A-1671144",
+    "SNP_A-1516988",
+    "SNP_A-1508380",
+    "SNP_A-1518739",
+    "SNP_A-1511113",
+    "SNP_A-1686906",
+    "SNP_A-1514212",
+    "SNP_A-1987290",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1729438",
+    "SNP_A-1516853",
+    "SNP_A-1736431",
+    NULL,
+    "SNP_A-8538224",
+    NULL,
+    "SNP_A-1508382",
+    "SNP_A-1509183",
+    NULL,
+    "SNP_A-1693128",
+    "SNP_A-1517612",
+    "SNP_A-1511912",
+    "SNP_A-1508528",
+    "SNP_A-1514689",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1997445",
+    "SNP_A-1517060",
+    "SNP_A-1508535",
+    "SNP_A-1508988",
+    "SNP_A-1698535",
+    "SNP_A-1510312",
+    "SNP_A-1511617",
+    "SNP_A-1512869",
+    NULL,
+    "SNP_A-2068133",
+    NULL,
+    "SNP_A-1684570",
+    "SNP_A-2010576",
+    "SNP_A-1712101",
+    "SNP_A-1709691",
+    "SNP_A-1741407",
+    "SNP_A-1509684",
+    "SNP_A-1671214",
+    "SNP_A-1665304",
+    NULL,
+    NULL,
+    "SNP_A-1507925",
+    "SNP_A-1507361",
+    "SNP_A-8283982",
+    "SNP_A-1508938",
+    "SNP_A-1507944",
+    NULL,
+    "SNP_A-1663192",
+    "SNP_A-8283408",
+    NULL,
+    "SNP_A-1516774",
+    "SNP_A-1508178",
+    "SNP_A-8579292",
+    "SNP_A-1980236",
+    "SNP_A-1513165",
+    "SNP_A-1691286",
+    "SNP_A-1667300",
+    "SNP_A-1686558",
+    "SNP_A-1650706",
+    "SNP_A-1519549",
+    "SNP_A-8342751",
+    "SNP_A-1509899",
+    "SNP_A-1507359",
+    NULL,
+    "SNP_A-1519327",
+    NULL,
+    "SNP_A-1514902",
+    NULL,
+    "SNP_A-1513560",
+    "SNP_A-1519069",
+    NULL,
+    "SNP_A-1733174",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516570",
+    "SNP_A-1606358",
+    "SNP_A-1516075",
+    "SNP_A-1509985",
+    "SNP_A-1511086",
+    NULL,
+    "SNP_A-1718835",
+    "SNP_A-1686694",
+    "SNP_A-1992101",
+    "SNP_A-1513068",
+    NULL,
+    "SNP_A-1963525",
+    "SNP_A-1682910",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1518406",
+    "SNP_A-1513765",
+    NULL,
+    "SNP_A-1656519",
+    "SNP_A-1725474",
+    "SNP_A-1707007",
+    "SNP_A-1517226",
+    "SNP_A-1512351",
+    "SNP_A-1509524",
+    NULL,
+    "SNP_A-1676050",
+    NULL,
+    "SNP_A-1715275",
+    "SNP_A-1713642",
+    "SNP_A-4267110",
+    "SNP_A-1643267",
+    "SNP_A-1744665",
+    "SNP_A-1724744",
+    "SNP_A-1729990",
+    "SNP_A-1659164",
+    "SNP_A-8673368",
+    "SNP_A-1662808",
+    "SNP_A-1510341",
+    "SNP_A-1509857",
+    NULL,
+    "SNP_A-1516981",
+    "SNP_A-1512303",
+    "SNP_A-1748851",
+    "SNP_A-1996914",
+    "SNP_A-1508259",
+    "SNP_A-1514728",
+    "SNP_A-1701805",
+    NULL,
+    NULL,
+    "SNP_A-1512429",
+    "SNP_A-1511641",
+    "SNP_A-1509404",
+    "SNP_A-1512777",
+    "SNP_A-8577770",
+    "SNP_A-1683096",
+    "SNP_A-1737577",
+    "SNP_A-1696348",
+    NULL,
+    "SNP_A-1517447",
+    "SNP_A-1725066",
+    "SNP_A-1972509",
+    "SNP_A-1729852",
+    "SNP_A-1518567",
+    "SNP_A-1682642",
+    "SNP_A-1516815",
+    NULL,
+    "SNP_A-1508664",
+    "SNP_A-1515371",
+    "SNP_A-1647250",
+    NULL,
+    NULL,
+    "SNP_A-1680580",
+    "SNP_A-1974607",
+    "SNP_A-1722676",
+    "SNP_A-1515745",
+    "SNP_A-1710806",
+    "SNP_A-1513041",
+    "SNP_A-1517224",
+    "SNP_A-1516818",
+    "SNP_A-1737663",
+    "SNP_A-1518192",
+    "SNP_A-1515202",
+    "SNP_A-1519735",
+    "SNP_A-1757191",
+    "SNP_A-1508486",
+    "SNP_A-1510728",
+    "SNP_A-1509926",
+    NULL,
+    "SNP_A-1515737",
+    "SNP_A-1516242",
+    "SNP_A-4211955",
+    NULL,
+    "SNP_A-1512647",
+    NULL,
+    "SNP_A-1682028",
+    "SNP_A-1670414",
+    NULL,
+    "SNP_A-1517080",
+    "SNP_A-1519250",
+    "SNP_A-1510736",
+    "SNP_A-1705939",
+    "SNP_A-1647612",
+    "SNP_A-1516707",
+    "SNP_A-1518354",
+    NULL,
+    NULL,
+    "SNP_A-1514387",
+    "SNP_A-4263626",
+    "SNP_A-1732788",
+    "SNP_A-1510231",
+    "SNP_A-8575764",
+    "SNP_A-1515455",
+    "SNP_A-1508294",
+    NULL,
+    "SNP_A-1653178",
+    "SNP_A-1701573",
+    "SNP_A-1507351",
+    "SNP_A-1704793",
+    NULL,
+    NULL,
+    "SNP_A-8699341",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1704305",
+    "SNP_A-1695027",
+    NULL,
+    "SNP_A-1757937",
+    "SNP_A-1517440",
+    "SNP_A-1509301",
+    "SNP_A-1668428",
+    "SNP_A-1642729",
+    "SNP_A-1509559",
+    NULL,
+    "SNP_A-1727899",
+    "SNP_A-1724096",
+    NULL,
+    "SNP_A-1517867",
+    "SNP_A-1513584",
+    "SNP_A-1730140",
+    NULL,
+    "SNP_A-1732732",
+    "SNP_A-8503013",
+    "SNP_A-1513835",
+    "SNP_A-4214223",
+    "SNP_A-1675353",
+    "SNP_A-1709771",
+    NULL,
+    "SNP_A-1710582",
+    "SNP_A-1508436",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1509530",
+    "SNP_A-1672050",
+    "SNP_A-1511681",
+    "SNP_A-1510408",
+    NULL,
+    "SNP_A-1704645",
+    "SNP_A-1758889",
+    "SNP_A-1514434",
+    "SNP_A-1513914",
+    NULL,
+    "SNP_A-1660607",
+    "SNP_A-1999231",
+    NULL,
+    "SNP_A-1712323",
+    "SNP_A-1508637",
+    "SNP_A-4189704",
+    "SNP_A-1512136",
+    "SNP_A-1510745",
+    "SNP_A-1703833",
+    "SNP_A-1754258",
+    "SNP_A-1515538",
+    "SNP_A-1737930",
+    "SNP_A-1742719",
+    NULL,
+    "SNP_A-1515277",
+    "SNP_A-1750895",
+    "SNP_A-8461405",
+    "SNP_A-1515389",
+    NULL,
+    "SNP_A-1747129",
+    "SNP_A-1671014",
+    "SNP_A-1646386",
+    "SNP_A-1747265",
+    NULL,
+    "SNP_A-1508945",
+    "SNP_A-1516937",
+    "SNP_A-1698805",
+    "SNP_A-1999620",
+    NULL,
+    "SNP_A-1746971",
+    NULL,
+    NULL,
+    "SNP_A-1509944",
+    "SNP_A-1746020",
+    "SNP_A-1518093",
+    "SNP_A-1514046",
+    "SNP_A-1905459",
+    "SNP_A-1674923",
+    "SNP_A-1676232",
+    "SNP_A-1518870",
+    "SNP_A-1980419",
+    "SNP_A-1662224",
+    "SNP_A-1979467",
+    "SNP_A-1508247",
+    NULL,
+    "SNP_A-1508921",
+    "SNP_A-1972675",
+    "SNP_A-2081808",
+    NULL,
+    "SNP_A-1746224",
+    "SNP_A-1672414",
+    "SNP_A-1724968",
+    "SNP_A-1513288",
+    NULL,
+    "SNP_A-1515503",
+    "SNP_A-1711740",
+    "SNP_A-1515988",
+    "SNP_A-1702265",
+    "SNP_A-1515752",
+    "SNP_A-1509669",
+    "SNP_A-1697196",
+    "SNP_A-1508257",
+    "SNP_A-1518602",
+    "SNP_A-1515671",
+    "SNP_A-1971019",
+    "SNP_A-1650000",
+    NULL,
+    "SNP_A-4209166",
+    "SNP_A-1517810",
+    NULL,
+    "SNP_A-1672426",
+    "SNP_A-1691214",
+    NULL,
+    "SNP_A-1519378",
+    "SNP_A-1701503",
+    "SNP_A-1731415",
+    "SNP_A-1660355",
+    "SNP_A-1509029",
+    "SNP_A-1727054",
+    "SNP_A-1739715",
+    NULL,
+    "SNP_A-2129353",
+    "SNP_A-1512155",
+    "SNP_A-1511082",
+    "SNP_A-1519761",
+    "SNP_A-1738627",
+    "SNP_A-1511183",
+    "SNP_A-1668356",
+    "SNP_A-1514460",
+    "SNP_A-1749035",
+    NULL,
+    "SNP_A-1510881",
+    "SNP_A-1686146",
+    NULL,
+    "SNP_A-1514945",
+    NULL,
+    NULL,
+    "SNP_A-4212658",
+    "SNP_A-1513069",
+    "SNP_A-1839412",
+    "SNP_A-1669429",
+    "SNP_A-1734002",
+    "SNP_A-1664758",
+    NULL,
+    "SNP_A-1656557",
+    "SNP_A-1515328",
+    "SNP_A-4297781",
+    "SNP_A-1731683",
+    "SNP_A-4269894",
+    "SNP_A-1507746",
+    "SNP_A-1730256",
+    NULL,
+    "SNP_A-1514084",
+    "SNP_A-1512846",
+    "SNP_A-1738529",
+    NULL,
+    "SNP_A-1515668",
+    NULL,
+    NULL,
+    "SNP_A-1740815",
+    "SNP_A-1509876",
+    NULL,
+    "SNP_A-1719215",
+    "SNP_A-1512256",
+    "SNP_A-1711182",
+    "SNP_A-1511586",
+    "SNP_A-1649732",
+    "SNP_A-1516559",
+    NULL,
+    NULL,
+    "SNP_A-1643451",
+    "SNP_A-1519247",
+    NULL,
+    "SNP_A-4204527",
+    "SNP_A-2296449",
+    NULL,
+    "SNP_A-1975055",
+    "SNP_A-4265081",
+    "SNP_A-1755970",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1660559",
+    "SNP_A-1515007",
+    "SNP_A-1752683",
+    "SNP_A-1685620",
+    "SNP_A-1758244",
+    "SNP_A-1728057",
+    "SNP_A-1514527",
+    "SNP_A-1513365",
+    "SNP_A-1517757",
+    "SNP_A-1994208",
+    "SNP_A-1516700",
+    "SNP_A-1511308",
+    "SNP_A-1511210",
+    "SNP_A-1511215",
+    "SNP_A-1654689",
+    NULL,
+    NULL,
+    "SNP_A-1681624",
+    "SNP_A-1693839",
+    "SNP_A-1675852",
+    "SNP_A-1508936",
+    "SNP_A-1665470",
+    "SNP_A-1721714",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1733422",
+    "SNP_A-1703417",
+    "SNP_A-1507871",
+    "SNP_A-1728181",
+    "SNP_A-1518004",
+    NULL,
+    "SNP_A-1730206",
+    "SNP_A-1516650",
+    NULL,
+    "SNP_A-1718859",
+    NULL,
+    NULL,
+    "SNP_A-1754934",
+    NULL,
+    "SNP_A-1755328",
+    "SNP_A-1671964",
+    "SNP_A-1510917",
+    "SNP_A-1514736",
+    NULL,
+    "SNP_A-1517530",
+    "SNP_A-1741219",
+    "SNP_A-4211963",
+    "SNP_A-1665998",
+    "SNP_A-1515358",
+    "SNP_A-1510713",
+    NULL,
+    NULL,
+    "SNP_A-4265787",
+    "SNP_A-1647308",
+    "SNP_A-1518769",
+    "SNP_A-1512687",
+    "SNP_A-1700640",
+    "SNP_A-1727499",
+    "SNP_A-1714701",
+    "SNP_A-1663932",
+    "SNP_A-1508855",
+    "SNP_A-4264492",
+    "SNP_A-1717095",
+    "SNP_A-1518754",
+    "SNP_A-1514190",
+    NULL,
+    "SNP_A-1671200",
+    NULL,
+    "SNP_A-1736033",
+    "SNP_A-1649228",
+    NULL,
+    NULL,
+    "SNP_A-1972782",
+    NULL,
+    "SNP_A-1517056",
+    "SNP_A-1713906",
+    NULL,
+    "SNP_A-1981625",
+    "SNP_A-1507904",
+    NULL,
+    "SNP_A-1513664",
+    "SNP_A-1650538",
+    "SNP_A-1507699",
+    "SNP_A-1517178",
+    "SNP_A-1709369",
+    NULL,
+    NULL,
+    "SNP_A-1697597",
+    "SNP_A-8291255",
+    "SNP_A-1508181",
+    "SNP_A-1963480",
+    "SNP_A-1512714",
+    "SNP_A-1518561",
+    NULL,
+    "SNP_A-1518216",
+    "SNP_A-1983544",
+    "SNP_A-1511273",
+    "SNP_A-1514198",
+    "SNP_A-8280892",
+    NULL,
+    NULL,
+    "SNP_A-1512296",
+    "SNP_A-1659082",
+    "SNP_A-1701811",
+    "SNP_A-1997690",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1514562",
+    NULL,
+    NULL,
+    "SNP_A-1680458",
+    "SNP_A-1516064",
+    "SNP_A-1517097",
+    "SNP_A-1719075",
+    "SNP_A-1511486",
+    "SNP_A-1749719",
+    "SNP_A-1513385",
+    "SNP_A-8619854",
+    "SNP_A-1516274",
+    "SNP_A-1739241",
+    NULL,
+    "SNP_A-1508005",
+    "SNP_A-1703773",
+    "SNP_A-8704518",
+    "SNP_A-1517170",
+    NULL,
+    "SNP_A-1511094",
+    NULL,
+    "SNP_A-1694797",
+    "SNP_A-1970516",
+    NULL,
+    "SNP_A-1514058",
+    "SNP_A-1743669",
+    "SNP_A-4265352",
+    NULL,
+    "SNP_A-1969221",
+    "SNP_A-1514110",
+    NULL,
+    NULL,
+    "SNP_A-1509185",
+    "SNP_A-1513016",
+    NULL,
+    "SNP_A-1511270",
+    "SNP_A-1754880",
+    "SNP_A-1664712",
+    "SNP_A-1511930",
+    "SNP_A-1509053",
+    NULL,
+    "SNP_A-4211070",
+    "SNP_A-1515738",
+    "SNP_A-1515336",
+    "SNP_A-1517518",
+    NULL,
+    "SNP_A-2309793",
+    "SNP_A-1510443",
+    "SNP_A-1675974",
+    "SNP_A-8288334",
+    "SNP_A-1517315",
+    "SNP_A-1648492",
+    "SNP_A-1515528",
+    "SNP_A-1714929",
+    "SNP_A-1514708",
+    NULL,
+    NULL,
+    "SNP_A-1514693",
+    "SNP_A-1644724",
+    "SNP_A-1651480",
+    "SNP_A-1513838",
+    "SNP_A-1519166",
+    "SNP_A-1664452",
+    "SNP_A-8334358",
+    "SNP_A-1519488",
+    "SNP_A-1517465",
+    "SNP_A-1688912",
+    "SNP_A-1746266",
+    "SNP_A-1742542",
+    "SNP_A-1518311",
+    "SNP_A-1508504",
+    "SNP_A-1678892",
+    "SNP_A-1691158",
+    "SNP_A-8665291",
+    "SNP_A-1508824",
+    "SNP_A-1515940",
+    "SNP_A-1509079",
+    "SNP_A-1704685",
+    "SNP_A-4222383",
+    "SNP_A-1513766",
+    NULL,
+    "SNP_A-1669461",
+    "SNP_A-1689180",
+    "SNP_A-1509593",
+    NULL,
+    NULL,
+    "SNP_A-1757273",
+    "SNP_A-2060761",
+    "SNP_A-1695043",
+    "SNP_A-1699663",
+    "SNP_A-1519453",
+    NULL,
+    "SNP_A-1519552",
+    "SNP_A-1715429",
+    "SNP_A-8618151",
+    "SNP_A-8558834",
+    "SNP_A-1673644",
+    "SNP_A-1676528",
+    NULL,
+    "SNP_A-2002855",
+    "SNP_A-1729936",
+    NULL,
+    "SNP_A-1731987",
+    "SNP_A-1512074",
+    NULL,
+    "SNP_A-1696616",
+    "SNP_A-1998217",
+    "SNP_A-1644456",
+    "SNP_A-4208993",
+    NULL,
+    "SNP_A-1748431",
+    "SNP_A-1643506",
+    "SNP_A-1515208",
+    NULL,
+    "SNP_A-1658944",
+    "SNP_A-1994231",
+    NULL,
+    "SNP_A-1699691",
+    "SNP_A-1512770",
+    NULL,
+    "SNP_A-1756204",
+    NULL,
+    "SNP_A-1736169",
+    "SNP_A-1518595",
+    "SNP_A-1721498",
+    "SNP_A-1507376",
+    "SNP_A-1707019",
+    "SNP_A-1507833",
+    "SNP_A-1514031",
+    "SNP_A-1519316",
+    "SNP_A-1510001",
+    NULL,
+    NULL,
+    "SNP_A-1508439",
+    "SNP_A-1646176",
+    "SNP_A-1514965",
+    "SNP_A-1513071",
+    "SNP_A-1664752",
+    NULL,
+    NULL,
+    "SNP_A-2010454",
+    "SNP_A-1516629",
+    NULL,
+    NULL,
+    "SNP_A-1511528",
+    "SNP_A-1516071",
+    "SNP_A-1512837",
+    "SNP_A-1667200",
+    "SNP_A-1518037",
+    "SNP_A-1518884",
+    "SNP_A-1509026",
+    "SNP_A-1652444",
+    "SNP_A-1664526",
+    "SNP_A-1702401",
+    "SNP_A-1516230",
+    NULL,
+    "SNP_A-1686350",
+    "SNP_A-1654167",
+    "SNP_A-1690197",
+    "SNP_A-1656187",
+    "SNP_A-4211913",
+    "SNP_A-1758783",
+    "SNP_A-1512388",
+    "SNP_A-8282977",
+    "SNP_A-1507540",
+    "SNP_A-1511334",
+    "SNP_A-1517601",
+    "SNP_A-1512724",
+    NULL,
+    NULL,
+    "SNP_A-1509136",
+    "SNP_A-1518695",
+    "SNP_A-1673174",
+    "SNP_A-1516342",
+    "SNP_A-1708166",
+    "SNP_A-1507433",
+    "SNP_A-1512110",
+    "SNP_A-1511919",
+    NULL,
+    "SNP_A-1972317",
+    "SNP_A-1516720",
+    "SNP_A-1514159",
+    NULL,
+    "SNP_A-1507437",
+    NULL,
+    "SNP_A-2114688",
+    "SNP_A-1510405",
+    "SNP_A-1670428",
+    "SNP_A-1730346",
+    "SNP_A-4204045",
+    NULL,
+    NULL,
+    "SNP_A-4267927",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1509465",
+    "SNP_A-1696690",
+    "SNP_A-1513475",
+    "SNP_A-4213279",
+    "SNP_A-1732578",
+    NULL,
+    NULL,
+    "SNP_A-1519407",
+    "SNP_A-1741545",
+    "SNP_A-1515969",
+    "SNP_A-1511477",
+    "SNP_A-1516804",
+    "SNP_A-1514138",
+    "SNP_A-1688364",
+    NULL,
+    "SNP_A-1674165",
+    "SNP_A-1728693",
+    NULL,
+    NULL,
+    "SNP_A-4244157",
+    "SNP_A-1733672",
+    "SNP_A-4278783",
+    "SNP_A-1650360",
+    "SNP_A-1749617",
+    "SNP_A-1514105",
+    "SNP_A-1704203",
+    "SNP_A-1514369",
+    NULL,
+    "SNP_A-1516790",
+    "SNP_A-8665721",
+    "SNP_A-1511199",
+    NULL,
+    NULL,
+    "SNP_A-1663846",
+    "SNP_A-1518524",
+    "SNP_A-8573720",
+    "SNP_A-1511623",
+    "SNP_A-1990627",
+    "SNP_A-1513724",
+    NULL,
+    "SNP_A-1516739",
+    NULL,
+    "SNP_A-1732179",
+    NULL,
+    NULL,
+    "SNP_A-1518801",
+    "SNP_A-1513479",
+    "SNP_A-1756977",
+    "SNP_A-1509673",
+    "SNP_A-1515129",
+    "SNP_A-1820937",
+    "SNP_A-1642395",
+    "SNP_A-1517694",
+    "SNP_A-1714675",
+    "SNP_A-1515658",
+    NULL,
+    "SNP_A-1513371",
+    "SNP_A-1510572",
+    "SNP_A-1672526",
+    "SNP_A-1511365",
+    NULL,
+    "SNP_A-1519575",
+    "SNP_A-1644334",
+    "SNP_A-1507399",
+    "SNP_A-1748871",
+    "SNP_A-1664604",
+    "SNP_A-4209089",
+    "SNP_A-1512553",
+    "SNP_A-1748921",
+    NULL,
+    "SNP_A-1751367",
+    "SNP_A-1513049",
+    "SNP_A-1517970",
+    "SNP_A-1734790",
+    "SNP_A-1700147",
+    NULL,
+    "SNP_A-1509603",
+    "SNP_A-1516122",
+    "SNP_A-1509519",
+    "SNP_A-4266689",
+    "SNP_A-8576875",
+    "SNP_A-8574331",
+    "SNP_A-1515970",
+    "SNP_A-1519639",
+    "SNP_A-1518986",
+    "SNP_A-1513715",
+    "SNP_A-1698787",
+    "SNP_A-1660511",
+    "SNP_A-1512524",
+    "SNP_A-1513506",
+    "SNP_A-8670495",
+    "SNP_A-1680682",
+    "SNP_A-1507973",
+    NULL,
+    "SNP_A-1517087",
+    "SNP_A-1517809",
+    NULL,
+    "SNP_A-1514450",
+    "SNP_A-1740871",
+    "SNP_A-1517562",
+    "SNP_A-8412855",
+    "SNP_A-1511720",
+    "SNP_A-1508124",
+    "SNP_A-1508079",
+    "SNP_A-1510094",
+    "SNP_A-1684488",
+    "SNP_A-1515176",
+    "SNP_A-1705705",
+    NULL,
+    "SNP_A-1748089",
+    "SNP_A-1519362",
+    "SNP_A-1512258",
+    "SNP_A-1689002",
+    "SNP_A-1518840",
+    "SNP_A-1991020",
+    "SNP_A-1648795",
+    NULL,
+    "SNP_A-8459270",
+    "SNP_A-1716145",
+    "SNP_A-1726076",
+    NULL,
+    "SNP_A-1518560",
+    NULL,
+    "SNP_A-1510418",
+    "SNP_A-1507815",
+    "SNP_A-1517752",
+    "SNP_A-1726316",
+    "SNP_A-1518842",
+    "SNP_A-1512065",
+    "SNP_A-8621443",
+    NULL,
+    "SNP_A-1998843",
+    "SNP_A-1683906",
+    "SNP_A-1648724",
+    NULL,
+    "SNP_A-8283004",
+    "SNP_A-1681202",
+    "SNP_A-1516999",
+    NULL,
+    "SNP_A-1685314",
+    "SNP_A-1511006",
+    NULL,
+    NULL,
+    "SNP_A-1682180",
+    "SNP_A-1511194",
+    "SNP_A-1659032",
+    "SNP_A-1519128",
+    "SNP_A-1517075",
+    "SNP_A-1515227",
+    "SNP_A-1655055",
+    "SNP_A-1518919",
+    "SNP_A-1514900",
+    "SNP_A-1516104",
+    "SNP_A-8337132",
+    NULL,
+    "SNP_A-1752703",
+    NULL,
+    "SNP_A-1512007",
+    NULL,
+    "SNP_A-1516025",
+    "SNP_A-1694255",
+    "SNP_A-1665750",
+    "SNP_A-1706553",
+    "SNP_A-1732301",
+    "SNP_A-1512604",
+    "SNP_A-1671988",
+    NULL,
+    "SNP_A-1667554",
+    "SNP_A-1517174",
+    "SNP_A-1679542",
+    "SNP_A-1512207",
+    NULL,
+    "SNP_A-1513931",
+    "SNP_A-1968254",
+    "SNP_A-1714392",
+    NULL,
+    "SNP_A-1507922",
+    "SNP_A-1514862",
+    "SNP_A-1519605",
+    "SNP_A-1509957",
+    "SNP_A-8280720",
+    "SNP_A-1515580",
+    "SNP_A-1682416",
+    NULL,
+    "SNP_A-4202615",
+    "SNP_A-8483363",
+    "SNP_A-1756759",
+    "SNP_A-1517536",
+    "SNP_A-2005552",
+    NULL,
+    "SNP_A-1670385",
+    "SNP_A-1744541",
+    NULL,
+    "SNP_A-1508770",
+    "SNP_A-1515607",
+    "SNP_A-1515598",
+    "SNP_A-1513497",
+    "SNP_A-1730561",
+    "SNP_A-1645706",
+    NULL,
+    "SNP_A-8620696",
+    "SNP_A-1513784",
+    "SNP_A-1688152",
+    NULL,
+    "SNP_A-1720443",
+    "SNP_A-1698953",
+    "SNP_A-1667618",
+    "SNP_A-1511027",
+    NULL,
+    "SNP_A-1510044",
+    "SNP_A-1514740",
+    "SNP_A-1518230",
+    "SNP_A-1518162",
+    "SNP_A-1692882",
+    "SNP_A-1669195",
+    "SNP_A-1644560",
+    "SNP_A-1666420",
+    "SNP_A-1722658",
+    "SNP_A-1510473",
+    "SNP_A-1606341",
+    "SNP_A-1509024",
+    NULL,
+    NULL,
+    "SNP_A-8414436",
+    "SNP_A-1509305",
+    "SNP_A-1514302",
+    "SNP_A-1519371",
+    "SNP_A-1693150",
+    "SNP_A-8336597",
+    "SNP_A-1698001",
+    "SNP_A-8636202",
+    "SNP_A-8576782",
+    "SNP_A-1669427",
+    "SNP_A-1714022",
+    NULL,
+    "SNP_A-1728009",
+    "SNP_A-1693363",
+    "SNP_A-1748081",
+    NULL,
+    "SNP_A-8414858",
+    "SNP_A-1723192",
+    "SNP_A-4261939",
+    "SNP_A-1511667",
+    "SNP_A-1669173",
+    "SNP_A-1701273",
+    "SNP_A-1519078",
+    "SNP_A-4211092",
+    "SNP_A-1670015",
+    "SNP_A-1715529",
+    "SNP_A-8285985",
+    "SNP_A-1519267",
+    NULL,
+    "SNP_A-1509094",
+    "SNP_A-1513498",
+    "SNP_A-1511722",
+    "SNP_A-8578800",
+    "SNP_A-1512771",
+    "SNP_A-1672044",
+    "SNP_A-1734942",
+    NULL,
+    "SNP_A-2089115",
+    "SNP_A-1981432",
+    "SNP_A-1716375",
+    NULL,
+    "SNP_A-1663980",
+    "SNP_A-1659430",
+    "SNP_A-8340054",
+    "SNP_A-8283477",
+    "SNP_A-1519026",
+    "SNP_A-1516448",
+    "SNP_A-1728653",
+    "SNP_A-8668776",
+    "SNP_A-1668264",
+    "SNP_A-1691200",
+    "SNP_A-1659804",
+    NULL,
+    "SNP_A-1515286",
+    NULL,
+    "SNP_A-1755570",
+    "SNP_A-1669795",
+    "SNP_A-1709103",
+    NULL,
+    "SNP_A-1507567",
+    "SNP_A-1658540",
+    NULL,
+    "SNP_A-2003904",
+    "SNP_A-1510742",
+    "SNP_A-1986449",
+    "SNP_A-1684912",
+    NULL,
+    "SNP_A-1517798",
+    "SNP_A-1706395",
+    "SNP_A-1746420",
+    "SNP_A-1512677",
+    "SNP_A-1514136",
+    "SNP_A-1648474",
+    NULL,
+    "SNP_A-1513859",
+    "SNP_A-1509514",
+    "SNP_A-1508288",
+    "SNP_A-1511230",
+    "SNP_A-1508555",
+    "SNP_A-1518403",
+    "SNP_A-1508871",
+    "SNP_A-1992958",
+    "SNP_A-1515048",
+    NULL,
+    "SNP_A-1510797",
+    NULL,
+    "SNP_A-1646493",
+    "SNP_A-1513102",
+    "SNP_A-1513468",
+    NULL,
+    "SNP_A-1746821",
+    NULL,
+    "SNP_A-1988718",
+    "SNP_A-4230648",
+    "SNP_A-1672134",
+    "SNP_A-1648644",
+    NULL,
+    "SNP_A-1510734",
+    "SNP_A-1507447",
+    NULL,
+    "SNP_A-4261705",
+    "SNP_A-1508944",
+    "SNP_A-1675045",
+    "SNP_A-1727587",
+    "SNP_A-1511899",
+    "SNP_A-1515261",
+    "SNP_A-1673808",
+    "SNP_A-1508215",
+    "SNP_A-1738264",
+    "SNP_A-1515945",
+    "SNP_A-1648664",
+    "SNP_A-1513001",
+    NULL,
+    NULL,
+    "SNP_A-1661780",
+    "SNP_A-1517425",
+    NULL,
+    NULL,
+    "SNP_A-1989197",
+    NULL,
+    "SNP_A-1694423",
+    "SNP_A-1744105",
+    "SNP_A-1511838",
+    "SNP_A-1704049",
+    "SNP_A-1660401",
+    "SNP_A-1515878",
+    "SNP_A-1508018",
+    "SNP_A-1751173",
+    NULL,
+    "SNP_A-1517885",
+    NULL,
+    "SNP_A-1512023",
+    "SNP_A-1519608",
+    "SNP_A-1684338",
+    "SNP_A-1511272",
+    "SNP_A-1702219",
+    "SNP_A-1512919",
+    "SNP_A-1507823",
+    "SNP_A-1968587",
+    NULL,
+    "SNP_A-1510986",
+    "SNP_A-1753589",
+    "SNP_A-1730809",
+    "SNP_A-1711146",
+    NULL,
+    "SNP_A-1671336",
+    "SNP_A-1516254",
+    "SNP_A-1512024",
+    "SNP_A-1508633",
+    "SNP_A-1701129",
+    "SNP_A-1752697",
+    "SNP_A-1508952",
+    "SNP_A-1514776",
+    "SNP_A-1662504",
+    "SNP_A-1509223",
+    "SNP_A-1509069",
+    "SNP_A-1507572",
+    NULL,
+    "SNP_A-1511037",
+    "SNP_A-1517332",
+    "SNP_A-1747667",
+    "SNP_A-1511890",
+    NULL,
+    "SNP_A-1510860",
+    "SNP_A-1741317",
+    "SNP_A-1754156",
+    "SNP_A-1512583",
+    "SNP_A-1703273",
+    NULL,
+    "SNP_A-1510602",
+    "SNP_A-8404312",
+    "SNP_A-1513790",
+    "SNP_A-1729722",
+    "SNP_A-1516996",
+    "SNP_A-1510243",
+    "SNP_A-1737948",
+    "SNP_A-1675986",
+    NULL,
+    "SNP_A-1510295",
+    "SNP_A-1515238",
+    NULL,
+    "SNP_A-1508790",
+    NULL,
+    "SNP_A-1708795",
+    "SNP_A-1511725",
+    "SNP_A-1744159",
+    "SNP_A-1508434",
+    "SNP_A-1514914",
+    "SNP_A-1740285",
+    "SNP_A-1510895",
+    "SNP_A-1516593",
+    "SNP_A-1756979",
+    "SNP_A-1512979",
+    "SNP_A-1515973",
+    "SNP_A-1507983",
+    "SNP_A-1507415",
+    "SNP_A-1519359",
+    NULL,
+    "SNP_A-1691830",
+    NULL,
+    "SNP_A-1995947",
+    "SNP_A-1511252",
+    NULL,
+    "SNP_A-2003143",
+    "SNP_A-1510544",
+    "SNP_A-1510028",
+    NULL,
+    "SNP_A-4266880",
+    "SNP_A-1509484",
+    NULL,
+    "SNP_A-1649410",
+    "SNP_A-1508564",
+    "SNP_A-1714088",
+    NULL,
+    "SNP_A-1518722",
+    "SNP_A-1513095",
+    "SNP_A-8336669",
+    "SNP_A-1508826",
+    NULL,
+    NULL,
+    "SNP_A-1513672",
+    "SNP_A-4269303",
+    "SNP_A-1513976",
+    NULL,
+    "SNP_A-8281534",
+    NULL,
+    NULL,
+    "SNP_A-1516765",
+    "SNP_A-1512536",
+    "SNP_A-1514769",
+    "SNP_A-1519666",
+    "SNP_A-1713666",
+    "SNP_A-1738413",
+    "SNP_A-1510014",
+    "SNP_A-4290532",
+    "SNP_A-1515573",
+    "SNP_A-1649972",
+    "SNP_A-1512093",
+    "SNP_A-1645336",
+    "SNP_A-1706071",
+    "SNP_A-1512631",
+    "SNP_A-1758532",
+    NULL,
+    "SNP_A-1510937",
+    NULL,
+    "SNP_A-2039461",
+    "SNP_A-1514161",
+    NULL,
+    "SNP_A-1671872",
+    "SNP_A-1982471",
+    "SNP_A-1656199",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1726184",
+    NULL,
+    "SNP_A-1642361",
+    "SNP_A-1686874",
+    "SNP_A-1507529",
+    "SNP_A-1512169",
+    "SNP_A-1509288",
+    "SNP_A-1514299",
+    "SNP_A-1511081",
+    "SNP_A-1659666",
+    "SNP_A-1687936",
+    NULL,
+    NULL,
+    "SNP_A-1644416",
+    "SNP_A-4271063",
+    "SNP_A-1510452",
+    "SNP_A-1518295",
+    "SNP_A-1515790",
+    "SNP_A-1509650",
+    "SNP_A-8577081",
+    NULL,
+    "SNP_A-1507967",
+    "SNP_A-1732419",
+    "SNP_A-1512899",
+    "SNP_A-2001649",
+    "SNP_A-1981952",
+    "SNP_A-1518125",
+    "SNP_A-1714737",
+    "SNP_A-1518105",
+    NULL,
+    "SNP_A-1729136",
+    "SNP_A-1749839",
+    NULL,
+    "SNP_A-1658734",
+    "SNP_A-8337788",
+    "SNP_A-1684030",
+    NULL,
+    "SNP_A-1687292",
+    NULL,
+    "SNP_A-1647108",
+    "SNP_A-8283392",
+    "SNP_A-1714513",
+    NULL,
+    NULL,
+    "SNP_A-1517122",
+    "SNP_A-1507706",
+    "SNP_A-1716133",
+    "SNP_A-1508024",
+    "SNP_A-1508801",
+    "SNP_A-1755236",
+    "SNP_A-1663238",
+    "SNP_A-1711812",
+    "SNP_A-1513052",
+    "SNP_A-1519111",
+    "SNP_A-1721608",
+    "SNP_A-1518120",
+    "SNP_A-1735088",
+    "SNP_A-1507916",
+    NULL,
+    "SNP_A-1655629",
+    "SNP_A-1674795",
+    NULL,
+    "SNP_A-1516208",
+    "SNP_A-1518516",
+    "SNP_A-1508946",
+    "SNP_A-1513456",
+    "SNP_A-1643395",
+    "SNP_A-1755122",
+    "SNP_A-1755404",
+    "SNP_A-1514609",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-8525056",
+    "SNP_A-1741899",
+    "SNP_A-1692406",
+    "SNP_A-1699539",
+    "SNP_A-1519243",
+    "SNP_A-4262966",
+    "SNP_A-1998455",
+    NULL,
+    "SNP_A-1719301",
+    "SNP_A-8619026",
+    "SNP_A-1514680",
+    "SNP_A-1980736",
+    "SNP_A-1510311",
+    "SNP_A-1738256",
+    "SNP_A-1515513",
+    "SNP_A-1732171",
+    NULL,
+    "SNP_A-1514630",
+    "SNP_A-1518990",
+    "SNP_A-1517697",
+    NULL,
+    "SNP_A-1507364",
+    "SNP_A-1509089",
+    "SNP_A-1784336",
+    "SNP_A-1514547",
+    "SNP_A-1678606",
+    "SNP_A-1664262",
+    "SNP_A-1508186",
+    "SNP_A-1699273",
+    "SNP_A-8578418",
+    "SNP_A-1719033",
+    NULL,
+    "SNP_A-1653376",
+    "SNP_A-1515764",
+    "SNP_A-1659018",
+    "SNP_A-1509276",
+    "SNP_A-1646994",
+    "SNP_A-1508389",
+    "SNP_A-1731587",
+    "SNP_A-1668686",
+    "SNP_A-4264547",
+    "SNP_A-1516747",
+    NULL,
+    "SNP_A-1508683",
+    "SNP_A-1730495",
+    "SNP_A-1717857",
+    "SNP_A-1729908",
+    "SNP_A-1507373",
+    "SNP_A-1514339",
+    "SNP_A-1512324",
+    "SNP_A-1713838",
+    "SNP_A-1519066",
+    NULL,
+    "SNP_A-1714581",
+    "SNP_A-4213236",
+    "SNP_A-1747043",
+    NULL,
+    "SNP_A-1508130",
+    "SNP_A-1517522",
+    "SNP_A-1514738",
+    "SNP_A-1651060",
+    "SNP_A-1509366",
+    "SNP_A-4222799",
+    NULL,
+    NULL,
+    "SNP_A-1515133",
+    "SNP_A-1706919",
+    "SNP_A-4229862",
+    NULL,
+    NULL,
+    "SNP_A-1658454",
+    "SNP_A-1508376",
+    NULL,
+    "SNP_A-1518883",
+    NULL,
+    "SNP_A-1756413",
+    "SNP_A-1755022",
+    "SNP_A-1896362",
+    "SNP_A-1511274",
+    "SNP_A-1735230",
+    NULL,
+    "SNP_A-1736375",
+    "SNP_A-1509757",
+    "SNP_A-1517893",
+    NULL,
+    NULL,
+    "SNP_A-1510403",
+    "SNP_A-4262419",
+    "SNP_A-1517724",
+    "SNP_A-1509088",
+    NULL,
+    "SNP_A-1519335",
+    "SNP_A-1701165",
+    "SNP_A-1518536",
+    "SNP_A-1516674",
+    "SNP_A-1684664",
+    NULL,
+    NULL,
+    "SNP_A-1744359",
+    "SNP_A-1517228",
+    NULL,
+    "SNP_A-1517659",
+    NULL,
+    "SNP_A-1642731",
+    NULL,
+    "SNP_A-8620128",
+    "SNP_A-1518816",
+    "SNP_A-1722296",
+    "SNP_A-4243282",
+    "SNP_A-1712295",
+    NULL,
+    "SNP_A-1515414",
+    "SNP_A-1519081",
+    "SNP_A-1649524",
+    NULL,
+    "SNP_A-1515568",
+    "SNP_A-1734686",
+    "SNP_A-1518322",
+    "SNP_A-1516768",
+    "SNP_A-1513281",
+    "SNP_A-1745702",
+    NULL,
+    NULL,
+    "SNP_A-1515022",
+    NULL,
+    "SNP_A-1509296",
+    "SNP_A-1509018",
+    "SNP_A-1672124",
+    NULL,
+    "SNP_A-1518664",
+    "SNP_A-1742103",
+    "SNP_A-1513945",
+    "SNP_A-1715857",
+    "SNP_A-1723532",
+    "SNP_A-1516848",
+    "SNP_A-1731789",
+    "SNP_A-1518279",
+    "SNP_A-1721678",
+    NULL,
+    "SNP_A-1695963",
+    "SNP_A-1517373",
+    "SNP_A-8616917",
+    "SNP_A-1710728",
+    "SNP_A-8688097",
+    "SNP_A-4247402",
+    NULL,
+    "SNP_A-1518781",
+    "SNP_A-1997224",
+    "SNP_A-1514018",
+    "SNP_A-1510553",
+    "SNP_A-1513318",
+    "SNP_A-1510994",
+    "SNP_A-1514810",
+    "SNP_A-1662660",
+    "SNP_A-8658609",
+    "SNP_A-1509204",
+    "SNP_A-8577846",
+    "SNP_A-1650350",
+    "SNP_A-1511182",
+    "SNP_A-1651656",
+    "SNP_A-1678840",
+    "SNP_A-1508667",
+    "SNP_A-8667316",
+    "SNP_A-1515887",
+    "SNP_A-1738373",
+    "SNP_A-1515347",
+    NULL,
+    "SNP_A-1507675",
+    "SNP_A-1509659",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516317",
+    NULL,
+    "SNP_A-1508337",
+    "SNP_A-1517438",
+    "SNP_A-4213214",
+    "SNP_A-1512014",
+    "SNP_A-1673580",
+    NULL,
+    "SNP_A-1648518",
+    "SNP_A-1730369",
+    "SNP_A-1515680",
+    "SNP_A-1679872",
+    "SNP_A-1699699",
+    "SNP_A-1510722",
+    "SNP_A-1512893",
+    "SNP_A-1727010",
+    "SNP_A-1714989",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-4262072",
+    "SNP_A-1738138",
+    "SNP_A-8618034",
+    "SNP_A-1512799",
+    "SNP_A-1518381",
+    NULL,
+    "SNP_A-1662206",
+    NULL,
+    "SNP_A-1705659",
+    "SNP_A-1513549",
+    "SNP_A-1517736",
+    "SNP_A-1517246",
+    NULL,
+    "SNP_A-1511989",
+    "SNP_A-1508402",
+    "SNP_A-1681142",
+    NULL,
+    "SNP_A-1507784",
+    NULL,
+    "SNP_A-1666182",
+    "SNP_A-1724816",
+    NULL,
+    "SNP_A-1675841",
+    "SNP_A-1519415",
+    "SNP_A-1684475",
+    "SNP_A-1513509",
+    "SNP_A-8670989",
+    "SNP_A-1516193",
+    NULL,
+    "SNP_A-1709747",
+    "SNP_A-1656563",
+    "SNP_A-1517920",
+    "SNP_A-1682488",
+    "SNP_A-1517432",
+    NULL,
+    NULL,
+    "SNP_A-1725818",
+    NULL,
+    "SNP_A-8414596",
+    "SNP_A-1685276",
+    "SNP_A-1507733",
+    "SNP_A-1517931",
+    "SNP_A-1515289",
+    "SNP_A-1678184",
+    "SNP_A-1510554",
+    "SNP_A-1660661",
+    "SNP_A-4210870",
+    "SNP_A-1519370",
+    NULL,
+    "SNP_A-1655661",
+    "SNP_A-1516099",
+    "SNP_A-1667778",
+    "SNP_A-1513683",
+    NULL,
+    "SNP_A-1681610",
+    "SNP_A-1687374",
+    "SNP_A-1513973",
+    "SNP_A-8665651",
+    "SNP_A-1516730",
+    "SNP_A-1515101",
+    "SNP_A-1512488",
+    "SNP_A-1515727",
+    "SNP_A-1510281",
+    "SNP_A-1900834",
+    "SNP_A-8572543",
+    NULL,
+    "SNP_A-1517293",
+    "SNP_A-1510912",
+    "SNP_A-1698011",
+    "SNP_A-1665114",
+    "SNP_A-1510694",
+    "SNP_A-8287890",
+    "SNP_A-2221983",
+    "SNP_A-1744109",
+    "SNP_A-1509563",
+    "SNP_A-1516738",
+    "SNP_A-1667478",
+    "SNP_A-1514389",
+    "SNP_A-1514119",
+    "SNP_A-1973029",
+    "SNP_A-1507436",
+    "SNP_A-1665070",
+    "SNP_A-1726942",
+    "SNP_A-4208147",
+    "SNP_A-1665198",
+    "SNP_A-1509099",
+    "SNP_A-1712027",
+    "SNP_A-8290125",
+    "SNP_A-1519720",
+    "SNP_A-1508893",
+    "SNP_A-1978352",
+    "SNP_A-1507686",
+    "SNP_A-1510718",
+    "SNP_A-1694987",
+    "SNP_A-1515291",
+    "SNP_A-1507890",
+    "SNP_A-1508491",
+    "SNP_A-4176907",
+    NULL,
+    "SNP_A-1690261",
+    "SNP_A-1680732",
+    NULL,
+    "SNP_A-1712541",
+    NULL,
+    "SNP_A-1517646",
+    "SNP_A-1514254",
+    "SNP_A-1518307",
+    "SNP_A-1512688",
+    "SNP_A-1513872",
+    "SNP_A-1758179",
+    "SNP_A-1998811",
+    "SNP_A-1695905",
+    "SNP_A-4202194",
+    "SNP_A-1707782",
+    "SNP_A-1515403",
+    "SNP_A-1515842",
+    NULL,
+    NULL,
+    "SNP_A-1519253",
+    "SNP_A-1513291",
+    "SNP_A-1514056",
+    "SNP_A-1516751",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1707950",
+    "SNP_A-1508707",
+    "SNP_A-1974622",
+    "SNP_A-4295226",
+    "SNP_A-1519367",
+    NULL,
+    NULL,
+    "SNP_A-1513127",
+    NULL,
+    "SNP_A-2002809",
+    NULL,
+    NULL,
+    "SNP_A-1512657",
+    "SNP_A-1518383",
+    "SNP_A-1752495",
+    "SNP_A-1519278",
+    "SNP_A-1731777",
+    "SNP_A-2204640",
+    "SNP_A-1508599",
+    "SNP_A-1516703",
+    "SNP_A-1739237",
+    "SNP_A-1512505",
+    NULL,
+    "SNP_A-1507915",
+    "SNP_A-1654811",
+    NULL,
+    "SNP_A-1693673",
+    "SNP_A-1507844",
+    NULL,
+    "SNP_A-1516928",
+    NULL,
+    "SNP_A-1515932",
+    "SNP_A-1702115",
+    NULL,
+    NULL,
+    "SNP_A-1747097",
+    "SNP_A-1725562",
+    "SNP_A-1509435",
+    "SNP_A-1731303",
+    "SNP_A-1655645",
+    "SNP_A-1993736",
+    "SNP_A-4267298",
+    NULL,
+    "SNP_A-1661558",
+    NULL,
+    NULL,
+    "SNP_A-4263142",
+    "SNP_A-1515786",
+    NULL,
+    "SNP_A-1512479",
+    "SNP_A-1735298",
+    NULL,
+    "SNP_A-1509270",
+    "SNP_A-1511654",
+    NULL,
+    "SNP_A-1606271",
+    "SNP_A-1510884",
+    "SNP_A-8662321",
+    "SNP_A-1515340",
+    "SNP_A-4264240",
+    NULL,
+    "SNP_A-4262031",
+    "SNP_A-1512199",
+    "SNP_A-1508443",
+    NULL,
+    "SNP_A-1517512",
+    "SNP_A-1682034",
+    NULL,
+    "SNP_A-4215118",
+    "SNP_A-1508197",
+    "SNP_A-1758215",
+    "SNP_A-1514364",
+    "SNP_A-1652206",
+    "SNP_A-1721654",
+    "SNP_A-1661994",
+    "SNP_A-1513173",
+    "SNP_A-1517666",
+    "SNP_A-1510395",
+    "SNP_A-1519440",
+    "SNP_A-1509723",
+    "SNP_A-1518122",
+    "SNP_A-8283621",
+    "SNP_A-4261770",
+    "SNP_A-1514817",
+    "SNP_A-1693925",
+    "SNP_A-1735915",
+    "SNP_A-1507886",
+    NULL,
+    "SNP_A-1512662",
+    "SNP_A-1699309",
+    "SNP_A-1519276",
+    NULL,
+    "SNP_A-1720857",
+    "SNP_A-1508236",
+    NULL,
+    "SNP_A-1515089",
+    "SNP_A-1757855",
+    NULL,
+    "SNP_A-1519615",
+    "SNP_A-8706733",
+    NULL,
+    "SNP_A-1709559",
+    "SNP_A-1719741",
+    "SNP_A-4267813",
+    "SNP_A-1718763",
+    "SNP_A-1729646",
+    NULL,
+    "SNP_A-1511917",
+    "SNP_A-1688514",
+    "SNP_A-1511207",
+    "SNP_A-1995447",
+    "SNP_A-1512812",
+    "SNP_A-1509586",
+    "SNP_A-1984960",
+    "SNP_A-2243201",
+    "SNP_A-1508440",
+    "SNP_A-1723898",
+    "SNP_A-8286506",
+    "SNP_A-4265117",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1677028",
+    "SNP_A-1511354",
+    "SNP_A-1516210",
+    "SNP_A-1507895",
+    "SNP_A-1511628",
+    "SNP_A-1698435",
+    "SNP_A-1701921",
+    "SNP_A-1745848",
+    "SNP_A-1518237",
+    NULL,
+    "SNP_A-1659398",
+    NULL,
+    "SNP_A-1641817",
+    "SNP_A-1516920",
+    "SNP_A-1510909",
+    "SNP_A-1517384",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1747421",
+    NULL,
+    "SNP_A-1643141",
+    "SNP_A-8574892",
+    "SNP_A-1694691",
+    "SNP_A-1994928",
+    NULL,
+    "SNP_A-1508437",
+    "SNP_A-1512620",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1658926",
+    "SNP_A-1518021",
+    "SNP_A-1516226",
+    "SNP_A-1515105",
+    "SNP_A-1508345",
+    NULL,
+    "SNP_A-1661602",
+    "SNP_A-1516624",
+    "SNP_A-1709337",
+    "SNP_A-8618434",
+    "SNP_A-1508788",
+    "SNP_A-1726550",
+    "SNP_A-1972555",
+    NULL,
+    NULL,
+    "SNP_A-1513187",
+    "SNP_A-1511927",
+    NULL,
+    "SNP_A-1515613",
+    "SNP_A-1510817",
+    NULL,
+    "SNP_A-1508999",
+    "SNP_A-1513671",
+    "SNP_A-1731139",
+    "SNP_A-1519107",
+    "SNP_A-1991634",
+    "SNP_A-1734294",
+    "SNP_A-1507636",
+    "SNP_A-4211393",
+    "SNP_A-1518252",
+    NULL,
+    "SNP_A-1510634",
+    "SNP_A-1507500",
+    NULL,
+    "SNP_A-1519332",
+    "SNP_A-1691034",
+    "SNP_A-1728999",
+    "SNP_A-1748949",
+    "SNP_A-4267051",
+    "SNP_A-1515043",
+    "SNP_A-1993039",
+    "SNP_A-1654319",
+    "SNP_A-1712859",
+    "SNP_A-1885798",
+    "SNP_A-1655747",
+    "SNP_A-4211219",
+    "SNP_A-1512796",
+    "SNP_A-1735955",
+    "SNP_A-8620645",
+    "SNP_A-1514459",
+    "SNP_A-1509297",
+    "SNP_A-1515224",
+    "SNP_A-1510618",
+    "SNP_A-8334608",
+    "SNP_A-1739293",
+    "SNP_A-1514479",
+    "SNP_A-1650226",
+    "SNP_A-1510459",
+    "SNP_A-1508473",
+    NULL,
+    "SNP_A-1513296",
+    "SNP_A-1508509",
+    "SNP_A-8619245",
+    "SNP_A-1513029",
+    "SNP_A-1518541",
+    NULL,
+    NULL,
+    "SNP_A-1712579",
+    NULL,
+    NULL,
+    "SNP_A-1984994",
+    "SNP_A-1747449",
+    "SNP_A-8620230",
+    "SNP_A-1517599",
+    "SNP_A-1512600",
+    "SNP_A-1516882",
+    NULL,
+    "SNP_A-1515177",
+    "SNP_A-8362381",
+    "SNP_A-1666874",
+    "SNP_A-8281433",
+    "SNP_A-8662222",
+    "SNP_A-1509167",
+    "SNP_A-1509526",
+    "SNP_A-1514939",
+    "SNP_A-1514217",
+    "SNP_A-1656899",
+    "SNP_A-1696302",
+    NULL,
+    "SNP_A-1700751",
+    NULL,
+    "SNP_A-1668488",
+    NULL,
+    "SNP_A-1512017",
+    "SNP_A-4261589",
+    NULL,
+    NULL,
+    "SNP_A-1509383",
+    "SNP_A-1515770",
+    "SNP_A-1653204",
+    "SNP_A-2253016",
+    "SNP_A-1727779",
+    NULL,
+    "SNP_A-1518531",
+    "SNP_A-1512182",
+    "SNP_A-1517892",
+    "SNP_A-8627302",
+    "SNP_A-1518236",
+    "SNP_A-1510018",
+    "SNP_A-1510092",
+    "SNP_A-1749397",
+    "SNP_A-1515897",
+    "SNP_A-1644698",
+    "SNP_A-4300456",
+    "SNP_A-1510360",
+    "SNP_A-1650644",
+    "SNP_A-1722204",
+    "SNP_A-1651114",
+    NULL,
+    "SNP_A-1514882",
+    "SNP_A-1516300",
+    "SNP_A-1508629",
+    "SNP_A-1519379",
+    "SNP_A-1690257",
+    "SNP_A-1706205",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1516403",
+    "SNP_A-8573784",
+    "SNP_A-1519048",
+    "SNP_A-1516428",
+    NULL,
+    "SNP_A-1755826",
+    "SNP_A-1512458",
+    "SNP_A-1508221",
+    "SNP_A-1663068",
+    "SNP_A-1516971",
+    "SNP_A-8550283",
+    "SNP_A-1717349",
+    "SNP_A-1751291",
+    "SNP_A-1513031",
+    "SNP_A-1508142",
+    "SNP_A-1516600",
+    NULL,
+    "SNP_A-1512350",
+    "SNP_A-1728545",
+    "SNP_A-1510203",
+    "SNP_A-8423658",
+    "SNP_A-1670880",
+    "SNP_A-1512602",
+    "SNP_A-1508320",
+    "SNP_A-8514729",
+    "SNP_A-1709257",
+    NULL,
+    "SNP_A-1512774",
+    "SNP_A-1517634",
+    "SNP_A-1515907",
+    "SNP_A-1516763",
+    "SNP_A-8662027",
+    "SNP_A-1508038",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1519404",
+    "SNP_A-1516415",
+    "SNP_A-1966487",
+    "SNP_A-1606282",
+    "SNP_A-1515938",
+    "SNP_A-1517577",
+    "SNP_A-1643613",
+    "SNP_A-1510366",
+    "SNP_A-1512691",
+    "SNP_A-1658646",
+    NULL,
+    "SNP_A-1661534",
+    "SNP_A-1696790",
+    NULL,
+    NULL,
+    "SNP_A-1748523",
+    NULL,
+    "SNP_A-1507542",
+    "SNP_A-1512835",
+    "SNP_A-1517594",
+    "SNP_A-1508098",
+    NULL,
+    "SNP_A-1676822",
+    "SNP_A-1516839",
+    "SNP_A-8645526",
+    NULL,
+    "SNP_A-1962115",
+    NULL,
+    "SNP_A-1510515",
+    NULL,
+    "SNP_A-1518745",
+    "SNP_A-1711730",
+    "SNP_A-1516241",
+    "SNP_A-4215480",
+    "SNP_A-1517431",
+    "SNP_A-1717097",
+    "SNP_A-1714463",
+    "SNP_A-1665434",
+    "SNP_A-1976762",
+    NULL,
+    "SNP_A-1708450",
+    "SNP_A-1690942",
+    "SNP_A-4224741",
+    "SNP_A-1688056",
+    NULL,
+    "SNP_A-1642417",
+    "SNP_A-1519287",
+    "SNP_A-1513405",
+    "SNP_A-1518909",
+    "SNP_A-1516854",
+    "SNP_A-1673436",
+    "SNP_A-1699229",
+    "SNP_A-1732494",
+    "SNP_A-1649600",
+    "SNP_A-1671824",
+    NULL,
+    "SNP_A-8667581",
+    NULL,
+    "SNP_A-4234613",
+    "SNP_A-1722534",
+    "SNP_A-1508527",
+    "SNP_A-2170758",
+    "SNP_A-1648238",
+    "SNP_A-1508616",
+    NULL,
+    "SNP_A-1517112",
+    "SNP_A-4211726",
+    "SNP_A-1511360",
+    "SNP_A-1519677",
+    NULL,
+    "SNP_A-1657087",
+    NULL,
+    "SNP_A-1509180",
+    "SNP_A-8491192",
+    "SNP_A-1711014",
+    "SNP_A-1515959",
+    NULL,
+    NULL,
+    "SNP_A-1513504",
+    "SNP_A-1695975",
+    NULL,
+    "SNP_A-1513968",
+    NULL,
+    "SNP_A-1660737",
+    "SNP_A-1517496",
+    "SNP_A-1510964",
+    NULL,
+    "SNP_A-1510922",
+    "SNP_A-1685080",
+    "SNP_A-1674883",
+    "SNP_A-1672482",
+    "SNP_A-1512813",
+    NULL,
+    NULL,
+    "SNP_A-1507740",
+    "SNP_A-1513388",
+    "SNP_A-1516266",
+    "SNP_A-1509364",
+    "SNP_A-1758672",
+    "SNP_A-1745246",
+    NULL,
+    "SNP_A-1659434",
+    "SNP_A-1693088",
+    "SNP_A-1709969",
+    "SNP_A-1519590",
+    "SNP_A-1513958",
+    "SNP_A-1723464",
+    "SNP_A-1721251",
+    "SNP_A-1509770",
+    "SNP_A-1646752",
+    "SNP_A-4220939",
+    "SNP_A-1518657",
+    "SNP_A-1513026",
+    NULL,
+    "SNP_A-1511377",
+    "SNP_A-1699365",
+    "SNP_A-1518930",
+    "SNP_A-1515926",
+    "SNP_A-1738985",
+    "SNP_A-1513984",
+    "SNP_A-1737179",
+    "SNP_A-1518244",
+    "SNP_A-1507860",
+    "SNP_A-1757243",
+    "SNP_A-1648034",
+    "SNP_A-8593289",
+    "SNP_A-1680426",
+    "SNP_A-1681450",
+    "SNP_A-1751567",
+    NULL,
+    "SNP_A-1508225",
+    "SNP_A-1514792",
+    "SNP_A-1703375",
+    NULL,
+    "SNP_A-1511555",
+    "SNP_A-8336622",
+    "SNP_A-1513868",
+    "SNP_A-1508500",
+    "SNP_A-1510652",
+    "SNP_A-1510336",
+    "SNP_A-4209839",
+    "SNP_A-1684172",
+    "SNP_A-1518194",
+    "SNP_A-1509243",
+    "SNP_A-1510520",
+    "SNP_A-1667922",
+    NULL,
+    "SNP_A-1516654",
+    "SNP_A-1750555",
+    "SNP_A-1513823",
+    "SNP_A-1739731",
+    "SNP_A-1515918",
+    "SNP_A-8646564",
+    "SNP_A-1660213",
+    NULL,
+    "SNP_A-1508140",
+    "SNP_A-1725302",
+    NULL,
+    "SNP_A-1519064",
+    "SNP_A-1734524",
+    "SNP_A-1736393",
+    NULL,
+    "SNP_A-1984223",
+    "SNP_A-1744705",
+    NULL,
+    "SNP_A-1651592",
+    "SNP_A-8574402",
+    "SNP_A-1508258",
+    "SNP_A-4220909",
+    "SNP_A-1518795",
+    "SNP_A-1646842",
+    NULL,
+    NULL,
+    "SNP_A-1703087",
+    NULL,
+    "SNP_A-1508281",
+    "SNP_A-1727979",
+    "SNP_A-1509168",
+    "SNP_A-1509220",
+    "SNP_A-1698821",
+    "SNP_A-2196202",
+    "SNP_A-1517184",
+    "SNP_A-1645642",
+    "SNP_A-1514467",
+    NULL,
+    "SNP_A-1981961",
+    "SNP_A-2177202",
+    "SNP_A-8400470",
+    NULL,
+    NULL,
+    "SNP_A-8621393",
+    "SNP_A-1516528",
+    "SNP_A-1510264",
+    "SNP_A-4286699",
+    "SNP_A-1516028",
+    "SNP_A-1705485",
+    NULL,
+    NULL,
+    "SNP_A-1512445",
+    NULL,
+    "SNP_A-1508735",
+    "SNP_A-1519249",
+    "SNP_A-8353707",
+    NULL,
+    "SNP_A-8667249",
+    NULL,
+    NULL,
+    "SNP_A-1648312",
+    "SNP_A-1701197",
+    NULL,
+    "SNP_A-1681900",
+    "SNP_A-1515730",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1994879",
+    "SNP_A-1730186",
+    "SNP_A-2081432",
+    "SNP_A-1518774",
+    "SNP_A-1507837",
+    "SNP_A-1519696",
+    "SNP_A-2094256",
+    "SNP_A-1514036",
+    "SNP_A-1511353",
+    "SNP_A-1669107",
+    "SNP_A-1518962",
+    "SNP_A-4219855",
+    NULL,
+    "SNP_A-1971615",
+    "SNP_A-1513094",
+    "SNP_A-1694129",
+    "SNP_A-1515058",
+    NULL,
+    "SNP_A-1515017",
+    "SNP_A-1667104",
+    "SNP_A-1517598",
+    "SNP_A-8282281",
+    "SNP_A-1508905",
+    "SNP_A-8620398",
+    "SNP_A-1512262",
+    "SNP_A-1517123",
+    NULL,
+    "SNP_A-1733978",
+    "SNP_A-1518396",
+    "SNP_A-1509309",
+    "SNP_A-1508703",
+    "SNP_A-1871165",
+    NULL,
+    "SNP_A-1510905",
+    "SNP_A-8573813",
+    "SNP_A-1518641",
+    "SNP_A-8610646",
+    "SNP_A-1512849",
+    "SNP_A-1510471",
+    "SNP_A-1512966",
+    "SNP_A-1510987",
+    "SNP_A-1736731",
+    "SNP_A-1684280",
+    NULL,
+    "SNP_A-1678680",
+    NULL,
+    "SNP_A-1727457",
+    "SNP_A-1713027",
+    "SNP_A-1980269",
+    "SNP_A-4266608",
+    "SNP_A-1644618",
+    "SNP_A-1513834",
+    "SNP_A-1511602",
+    "SNP_A-1513480",
+    "SNP_A-1507919",
+    NULL,
+    "SNP_A-1519660",
+    "SNP_A-1512322",
+    "SNP_A-1984688",
+    "SNP_A-1977043",
+    "SNP_A-4240818",
+    NULL,
+    NULL,
+    "SNP_A-1509063",
+    "SNP_A-1515590",
+    "SNP_A-1606316",
+    "SNP_A-1507412",
+    NULL,
+    NULL,
+    "SNP_A-8578177",
+    "SNP_A-1508496",
+    "SNP_A-1735366",
+    NULL,
+    "SNP_A-1515566",
+    "SNP_A-1711250",
+    "SNP_A-1696620",
+    "SNP_A-1507802",
+    NULL,
+    "SNP_A-4212644",
+    "SNP_A-1513489",
+    "SNP_A-1708492",
+    NULL,
+    "SNP_A-1641833",
+    NULL,
+    "SNP_A-8648595",
+    "SNP_A-1711808",
+    "SNP_A-1736243",
+    "SNP_A-1723958",
+    "SNP_A-1518818",
+    "SNP_A-1516954",
+    "SNP_A-1655129",
+    NULL,
+    "SNP_A-1996860",
+    "SNP_A-1509762",
+    "SNP_A-1660557",
+    "SNP_A-1515426",
+    "SNP_A-1509197",
+    "SNP_A-1515830",
+    "SNP_A-1510099",
+    "SNP_A-1672372",
+    "SNP_A-1722248",
+    "SNP_A-1510498",
+    "SNP_A-1701595",
+    "SNP_A-2001802",
+    "SNP_A-1507984",
+    "SNP_A-1514645",
+    "SNP_A-1606321",
+    "SNP_A-1510541",
+    "SNP_A-1511206",
+    "SNP_A-1976610",
+    "SNP_A-2066088",
+    NULL,
+    "SNP_A-1710187",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1699659",
+    "SNP_A-1519758",
+    NULL,
+    "SNP_A-8665458",
+    NULL,
+    "SNP_A-1996518",
+    "SNP_A-1508832",
+    "SNP_A-1515895",
+    "SNP_A-1514380",
+    NULL,
+    "SNP_A-1513939",
+    "SNP_A-1746176",
+    "SNP_A-4212177",
+    "SNP_A-1508706",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1511494",
+    "SNP_A-1509123",
+    "SNP_A-1648775",
+    "SNP_A-1509783",
+    NULL,
+    "SNP_A-1513155",
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-1509842",
+    "SNP_A-1690457",
+    "SNP_A-1681412",
+    "SNP_A-1514325",
+    "SNP_A-4263794",
+    "SNP_A-1672736",
+    "SNP_A-1516547",
+    NULL,
+    "SNP_A-1714953",
+    "SNP_A-1679598",
+    NULL,
+    NULL,
+    "SNP_A-1987104",
+    "SNP_A-1510109",
+    "SNP_A-1722548",
+    "SNP_A-1508800",
+    NULL,
+    NULL,
+    "SNP_A-4287305",
+    NULL,
+    NULL,
+    "SNP_A-1508830",
+    "SNP_A-1508663",
+    "SNP_A-1516430",
+    "SNP_A-1511579",
+    "SNP_A-1684210",
+    "SNP_A-1509906",
+    NULL,
+    "SNP_A-1716737",
+    "SNP_A-1991843",
+    "SNP_A-1507650",
+    "SNP_A-1510453",
+    "SNP_A-1512791",
+    NULL,
+    "SNP_A-8281015",
+    NULL,
+    "SNP_A-1511598",
+    "SNP_A-1516669",
+    "SNP_A-1513057",
+    "SNP_A-1509037",
+    "SNP_A-1507969",
+    "SNP_A-1512840",
+    "SNP_A-1728879",
+    "SNP_A-1511008",
+    "SNP_A-1508863",
+    "SNP_A-1669623",
+    "SNP_A-1517430",
+    "SNP_A-1511629",
+    "SNP_A-1721385",
+    NULL,
+    "SNP_A-4196564",
+    "SNP_A-1641757",
+    "SNP_A-1727244",
+    "SNP_A-1722842",
+    "SNP_A-1886018",
+    "SNP_A-1948603",
+    NULL,
+    "SNP_A-1508660",
+    "SNP_A-1746571",
+    "SNP_A-8573298",
+    "SNP_A-8284574",
+    "SNP_A-1508845",
+    NULL,
+    "SNP_A-1996855",
+    "SNP_A-8409798",
+    "SNP_A-1508958",
+    "SNP_A-1756208",
+    NULL,
+    "SNP_A-1517591",
+    "SNP_A-1518339",
+    NULL,
+    "SNP_A-1734514",
+    "SNP_A-1662562",
+    "SNP_A-1700915",
+    "SNP_A-1510012",
+    "SNP_A-1507575",
+    "SNP_A-1509991",
+    "SNP_A-1516126",
+    "SNP_A-4265100",
+    "SNP_A-1678248",
+    "SNP_A-1651370",
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    "SNP_A-8669792",
+    "SNP_A-1754782",
+    "SNP_A-1516776",
+    "SNP_A-1513897",
+    "SNP_A-1671043",
+    "SNP_A-1510323",
+    "SNP_A-1518022",
+    "SNP_A-1518169",
+    "SNP_A-1510313",
+    NULL,
+    "SNP_A-1648846",
+    NULL,
+    "SNP_A-1721189",
+    "SNP_A-1685578",
+    "SNP_A-1508642",
+    NULL,
+    "SNP_A-1689598",
+    "SNP_A-1998631",
+    "SNP_A-8291364",
+    "SNP_A-1752751",
+    "SNP_A-1510681",
+    "SNP_A-4236199",
+    "SNP_A-1509508",
+    "SNP_A-1515537",
+    "SNP_A-1517822",
+    NULL,
+    "SNP_A-1514022",
+    "SNP_A-1508386",
+    "SNP_A-1514122",
+    "SNP_A-2183543",
+    NULL,
+    "SNP_A-1510365",
+    "SNP_A-1510401"
+};
@@ -0,0 +1,102 @@
+#!/usr/bin/perl
+
+use warnings;
+use strict;
+
+# Writes affyexception.c, a perfect hash of the Affymetrix exception class
+# SNPs listed after __DATA__ at the end of fralib.pm, for strand.c.
+#
+# usage: affyexception.pl ../../fralib.pm > affyexception.c
+#
+# Keys go into buckets by their FNV-1a hash, the largest buckets first
+# are given the smallest displacement placing all their keys in free
+# slots.  A lookup hashes the key once for its bucket and once more with
+# the displacement of the bucket for its slot, see isaffymetrixexception.
+
+my $fralibFile = shift || die "usage: affyexception.pl fralib.pm";
+my @snps;
+
+open(FRALIB, $fralibFile) || die "Cannot open $fralibFile";
+while (<FRALIB>)
+{
+    last if (/^__DATA__$/);
+}
+while (<FRALIB>)
+{
+    s/\r?\n?$//;
+    push(@snps, $_) if ($_ ne '');
+}
+close(FRALIB);
+
+scalar(@snps) || die "No exception class SNPs after __DATA__ in $fralibFile";
+
+# strand.c computes the same 32 bit FNV-1a, seeded through the offset basis
+sub fnv
+{
+    my ($key, $seed) = @_;
+    my $h = 2166136261 ^ $seed;
+
+    for my $c (unpack('C*', $key))
+    {
+        $h ^= $c;
+        $h = ($h * 16777619) & 0xffffffff;
+    }
+
+    return $h;
+}
+
+my $bucketNo = int((scalar(@snps) + 3) / 4);
+my $slotNo = int(scalar(@snps) * 5 / 4) + 1;
+my @buckets;
+my @displacements = (0) x $bucketNo;
+my @slots;
+
+for my $snp (@snps)
+{
+    push(@{$buckets[fnv($snp, 0) % $bucketNo]}, $snp);
+}
+
+for my $b (sort {scalar(@{$buckets[$b] || []}) <=> scalar(@{$buckets[$a] || []}) || $a <=> $b} (0 .. $bucketNo-1))
+{
+    my @keys = @{$buckets[$b] || []};
+    next if (scalar(@keys)==0);
+
+    DISPLACEMENT: for my $d (1 .. 65535)
+    {
+        my %TAKEN;
+        for my $key (@keys)
+        {
+            my $slot = fnv($key, $d) % $slotNo;
+            next DISPLACEMENT if (defined($slots[$slot]) || exists($TAKEN{$slot}));
+            $TAKEN{$slot} = $key;
+        }
+
+        map {$slots[$_] = $TAKEN{$_}} keys(%TAKEN);
+        $displacements[$b] = $d;
+        last;
+    }
+
+    $displacements[$b] || die "No displacement places bucket $b";
+}
+
+print "/* generated by affyexception.pl from the list at the end of fralib.pm, do not edit */\n";
+print "#include <stdint.h>\n";
+print "#include <stddef.h>\n";
+print "\n";
+printf "const uint32_t affyExceptionBucketNo = %d;\n", $bucketNo;
+printf "const uint32_t affyExceptionSlotNo = %d;\n", $slotNo;
+print "\n";
+print "const uint16_t affyExceptionDisplacements[] =\n{\n";
+for (my $i=0; $i<$bucketNo; $i+=12)
+{
+    my $last = $i+11 < $bucketNo-1 ? $i+11 : $bucketNo-1;
+    print "    " . join(", ", @displacements[$i .. $last]) . ($last < $bucketNo-1 ? ",\n" : "\n");
+}
+print "};\n";
+print "\n";
+print "const char *affyExceptionSlots[] =\n{\n";
+for my $i (0 .. $slotNo-1)
+{
+    print "    " . (defined($slots[$i]) ? "\"$slots[$i]\"" : "NULL") . ($i < $slotNo-1 ? ",\n" : "\n");
+}
+print "};\n";
@@ -0,0 +1,415 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "filesubs.h"
+#include "align.h"
+
+/* 8 lanes of 16 bit scores, SSE2/NEON width */
+typedef int16_t v8i16 __attribute__ ((vector_size (16)));
+#define LANES 8
+
+/* alignment scores are kept in 16 bits */
+#define MAX_ALIGN_LENGTH 16000
+
+ALIGN_WORKSPACE *newalignworkspace()
+{
+    ALIGN_WORKSPACE *ws;
+
+    FRALLOC(ws, 1, ALIGN_WORKSPACE);
+
+    return ws;
+}
+
+void freealignworkspace(ALIGN_WORKSPACE *ws)
+{
+    free(ws->diagonals);
+    free(ws->codes);
+    free(ws->wide1);
+    free(ws->wide2);
+    free(ws->trace);
+    free(ws);
+}
+
+static void reserve(ALIGN_WORKSPACE *ws, int n1, int n2)
+{
+    size_t cells;
+
+    if (n1 <= ws->cap1 && n2 <= ws->cap2)
+    {
+        return;
+    }
+
+    ws->cap1 = MAX(n1, ws->cap1);
+    ws->cap2 = MAX(n2, ws->cap2);
+    cells = ((size_t)ws->cap1 + 1) * (ws->cap2 + 1);
+
+    /* 3 rolling anti-diagonals, padded by a vector on each side */
+    ws->diagonals = (int16_t *) xrealloc(ws->diagonals, 3*(ws->cap1 + 2*LANES + 2)*sizeof(int16_t));
+    ws->codes = (int16_t *) xrealloc(ws->codes, (ws->cap1 + 2*LANES + 2)*sizeof(int16_t));
+    ws->wide1 = (int16_t *) xrealloc(ws->wide1, (ws->cap1 + LANES + 1)*sizeof(int16_t));
+    ws->wide2 = (int16_t *) xrealloc(ws->wide2, (ws->cap2 + LANES + 1)*sizeof(int16_t));
+    ws->trace = (unsigned char *) xrealloc(ws->trace, cells/4 + 1);
+}
+
+#define SETTRACE(ws,n1,j,i,code) \
+    { size_t c = ((size_t)(j))*((n1)+1)+(i); \
+      (ws)->trace[c>>2] = ((ws)->trace[c>>2] & ~(3 << ((c&3)*2))) | ((code) << ((c&3)*2)); }
+#define GETTRACE(ws,n1,j,i) \
+    (((ws)->trace[(((size_t)(j))*((n1)+1)+(i))>>2] >> (((((size_t)(j))*((n1)+1)+(i))&3)*2)) & 3)
+
+/*
+ * The score matrix is filled one anti-diagonal d = i+j at a time; cells on
+ * a diagonal only depend on the previous two, so a diagonal is computed
+ * LANES cells per instruction.  seq2 is reversed so that the bases compared
+ * along a diagonal are contiguous in both sequences.
+ */
+void globalalign(char *seq1, int n1, char *seq2, int n2, char *aln1, char *aln2, ALIGN_WORKSPACE *ws)
+{
+    int16_t *prev2, *prev, *cur, *tmp, *w1, *w2;
+    int d, i, j, k, iLo, iHi, len;
+    v8i16 up, left, dg, eq, a, b, mask, best, code;
+    v8i16 one = {1,1,1,1,1,1,1,1};
+    v8i16 codeU = {TRACE_U,TRACE_U,TRACE_U,TRACE_U,TRACE_U,TRACE_U,TRACE_U,TRACE_U};
+    v8i16 codeL = {TRACE_L,TRACE_L,TRACE_L,TRACE_L,TRACE_L,TRACE_L,TRACE_L,TRACE_L};
+    v8i16 codeD = {TRACE_D,TRACE_D,TRACE_D,TRACE_D,TRACE_D,TRACE_D,TRACE_D,TRACE_D};
+    int16_t sUp, sLeft, sDiag, sBest, sCode;
+    char c;
+
+    if (n1 > MAX_ALIGN_LENGTH || n2 > MAX_ALIGN_LENGTH)
+    {
+        fatal("Sequences longer than %d cannot be aligned\n", MAX_ALIGN_LENGTH);
+    }
+
+    reserve(ws, n1, n2);
+
+    /* index 0 of each diagonal buffer is i = -1 */
+    prev2 = ws->diagonals + 1;
+    prev = prev2 + ws->cap1 + 2*LANES + 2;
+    cur = prev + ws->cap1 + 2*LANES + 2;
+    w1 = ws->wide1;
+    w2 = ws->wide2;
+
+    for (i=0; i<n1; i++)
+    {
+        w1[i] = (unsigned char) seq1[i];
+    }
+    for (k=0; k<n2; k++)
+    {
+        w2[k] = (unsigned char) seq2[n2-1-k];
+    }
+
+    for (d=0; d<=n1+n2; d++)
+    {
+        iLo = MAX(0, d-n2);
+        iHi = MIN(n1, d);
+
+        /* borders */
+        if (iLo == 0)
+        {
+            cur[0] = -d;
+            SETTRACE(ws, n1, d, 0, d == 0 ? TRACE_E : TRACE_U);
+        }
+        if (iHi == d && d > 0)
+        {
+            cur[d] = -d;
+            SETTRACE(ws, n1, 0, d, TRACE_L);
+        }
+
+        /* interior cells (j,i) with i in [max(1,d-n2), min(n1,d-1)] */
+        i = MAX(1, iLo);
+        for (; i + LANES - 1 <= MIN(n1, d-1); i += LANES)
+        {
+            memcpy(&up, prev + i, sizeof(v8i16));
+            memcpy(&left, prev + i - 1, sizeof(v8i16));
+            memcpy(&dg, prev2 + i - 1, sizeof(v8i16));
+            memcpy(&a, w1 + i - 1, sizeof(v8i16));
+            memcpy(&b, w2 + n2 - d + i, sizeof(v8i16));
+
+            up -= one;
+            left -= one;
+            eq = a == b;
+            dg -= eq;
+
+            /* $up<$left ? $left : $up, then diagonal wins ties */
+            mask = up < left;
+            best = (left & mask) | (up & ~mask);
+            code = (codeL & mask) | (codeU & ~mask);
+            mask = best <= dg;
+            best = (dg & mask) | (best & ~mask);
+            code = (codeD & mask) | (code & ~mask);
+
+            memcpy(cur + i, &best, sizeof(v8i16));
+            memcpy(ws->codes + i, &code, sizeof(v8i16));
+        }
+        for (; i <= MIN(n1, d-1); i++)
+        {
+            sUp = prev[i] - 1;
+            sLeft = prev[i-1] - 1;
+            sDiag = prev2[i-1] + (w1[i-1] == w2[n2-d+i]);
+            sBest = sUp < sLeft ? sLeft : sUp;
+            sCode = sUp < sLeft ? TRACE_L : TRACE_U;
+            if (sBest <= sDiag)
+            {
+                sBest = sDiag;
+                sCode = TRACE_D;
+            }
+            cur[i] = sBest;
+            ws->codes[i] = sCode;
+        }
+
+        /* pack the diagonal's traceback codes */
+        for (i=MAX(1, iLo); i<=MIN(n1, d-1); i++)
+        {
+            SETTRACE(ws, n1, d-i, i, ws->codes[i]);
+        }
+
+        tmp = prev2;
+        prev2 = prev;
+        prev = cur;
+        cur = tmp;
+    }
+
+    /* traceback from the bottom right corner, built back to front */
+    i = n1;
+    j = n2;
+    len = 0;
+    while (i != 0 || j != 0)
+    {
+        switch (GETTRACE(ws, n1, j, i))
+        {
+            case TRACE_D:
+                aln1[len] = seq1[--i];
+                aln2[len++] = seq2[--j];
+                break;
+            case TRACE_U:
+                aln1[len] = '-';
+                aln2[len++] = seq2[--j];
+                break;
+            case TRACE_L:
+                aln1[len] = seq1[--i];
+                aln2[len++] = '-';
+                break;
+            default:
+                fatal("Invalid traceback at (%d,%d)\n", j, i);
+        }
+    }
+
+    for (k=0; k<len/2; k++)
+    {
+        c = aln1[k];
+        aln1[k] = aln1[len-1-k];
+        aln1[len-1-k] = c;
+        c = aln2[k];
+        aln2[k] = aln2[len-1-k];
+        aln2[len-1-k] = c;
+    }
+    aln1[len] = '\0';
+    aln2[len] = '\0';
+}
+
+static int isiupac(char c)
+{
+    return c != '\0' && strchr("ACGTMRWSYKVHDBNXacgtmrwsykvhdbnx", c) != NULL;
+}
+
+/*
+ * splits flanks as /([ACGTMRWSYKVHDBNX]*)(\[.+\])([ACGTMRWSYKVHDBNX]*)/i,
+ * returns 0 if the flanks do not match
+ */
+static int splitflanks(char *flanks, char **fivePrime, int *fivePrimeLength,
+                       char **snp, int *snpLength, char **threePrime, int *threePrimeLength)
+{
+    char *open, *close, *s;
+
+    *fivePrime = *snp = *threePrime = flanks;
+    *fivePrimeLength = *snpLength = *threePrimeLength = 0;
+
+    /* .+ needs at least one character between the brackets */
+    if ((open = strchr(flanks, '[')) == NULL || (close = strrchr(flanks, ']')) == NULL || close < open + 2)
+    {
+        return 0;
+    }
+
+    for (s=open; s>flanks && isiupac(s[-1]); s--);
+    *fivePrime = s;
+    *fivePrimeLength = open - s;
+    *snp = open;
+    *snpLength = close - open + 1;
+    *threePrime = close + 1;
+    for (s=close+1; isiupac(*s); s++);
+    *threePrimeLength = s - close - 1;
+
+    return 1;
+}
+
+/*
+ * ungapped similarity of the two arms as in getFlanksSimilarity.  fraTools'
+ * baseMatch never matches ambiguity codes, so only identical bases count.
+ */
+double flankssimilarity(char *flanks1, char *flanks2)
+{
+    char *five1, *snp1, *three1, *five2, *snp2, *three2;
+    int fiveLen1, snpLen1, threeLen1, fiveLen2, snpLen2, threeLen2;
+    int k, fiveTotal, threeTotal, concordance = 0;
+
+    splitflanks(flanks1, &five1, &fiveLen1, &snp1, &snpLen1, &three1, &threeLen1);
+    splitflanks(flanks2, &five2, &fiveLen2, &snp2, &snpLen2, &three2, &threeLen2);
+
+    fiveTotal = MIN(fiveLen1, fiveLen2);
+    for (k=1; k<=fiveTotal; k++)
+    {
+        concordance += five1[fiveLen1-k] == five2[fiveLen2-k];
+    }
+
+    threeTotal = MIN(threeLen1, threeLen2);
+    for (k=0; k<threeTotal; k++)
+    {
+        concordance += three1[k] == three2[k];
+    }
+
+    return fiveTotal + threeTotal == 0 ? 0 : ((double) concordance) / (fiveTotal + threeTotal);
+}
+
+static void reversecopy(char *out, char *in, int n)
+{
+    int k;
+
+    for (k=0; k<n; k++)
+    {
+        out[k] = in[n-1-k];
+    }
+    out[n] = '\0';
+}
+
+/* getAlignedFlanksSimilarity: 5' arms are aligned outwards from the SNP */
+void alignflanks(FLANK_ALIGNMENT *pair, ALIGN_WORKSPACE *ws)
+{
+    char *five1, *snp1, *three1, *five2, *snp2, *three2;
+    char *rev1, *rev2, *fiveAln1, *fiveAln2, *threeAln1, *threeAln2;
+    int fiveLen1, snpLen1, threeLen1, fiveLen2, snpLen2, threeLen2;
+    int k, fiveLen, threeLen;
+    size_t n;
+
+    splitflanks(pair->flanks1, &five1, &fiveLen1, &snp1, &snpLen1, &three1, &threeLen1);
+    splitflanks(pair->flanks2, &five2, &fiveLen2, &snp2, &snpLen2, &three2, &threeLen2);
+
+    FRALLOC(rev1, fiveLen1 + 1, char);
+    FRALLOC(rev2, fiveLen2 + 1, char);
+    FRALLOC(fiveAln1, fiveLen1 + fiveLen2 + 1, char);
+    FRALLOC(fiveAln2, fiveLen1 + fiveLen2 + 1, char);
+    FRALLOC(threeAln1, threeLen1 + threeLen2 + 1, char);
+    FRALLOC(threeAln2, threeLen1 + threeLen2 + 1, char);
+
+    reversecopy(rev1, five1, fiveLen1);
+    reversecopy(rev2, five2, fiveLen2);
+    globalalign(rev1, fiveLen1, rev2, fiveLen2, fiveAln1, fiveAln2, ws);
+    globalalign(three1, threeLen1, three2, threeLen2, threeAln1, threeAln2, ws);
+
+    pair->concordance = 0;
+    pair->total = 0;
+    fiveLen = strlen(fiveAln1);
+    threeLen = strlen(threeAln1);
+    for (k=0; k<fiveLen; k++)
+    {
+        if (fiveAln1[k] != '-' && fiveAln2[k] != '-')
+        {
+            pair->concordance += fiveAln1[k] == fiveAln2[k];
+            ++pair->total;
+        }
+    }
+    for (k=0; k<threeLen; k++)
+    {
+        if (threeAln1[k] != '-' && threeAln2[k] != '-')
+        {
+            pair->concordance += threeAln1[k] == threeAln2[k];
+            ++pair->total;
+        }
+    }
+
+    n = fiveLen + threeLen + MAX(snpLen1, snpLen2) + 1;
+    FRALLOC(pair->aligned1, n, char);
+    FRALLOC(pair->aligned2, n, char);
+    reversecopy(pair->aligned1, fiveAln1, fiveLen);
+    strncat(pair->aligned1, snp1, snpLen1);
+    strcat(pair->aligned1, threeAln1);
+    reversecopy(pair->aligned2, fiveAln2, fiveLen);
+    strncat(pair->aligned2, snp2, snpLen2);
+    strcat(pair->aligned2, threeAln2);
+
+    free(rev1);
+    free(rev2);
+    free(fiveAln1);
+    free(fiveAln2);
+    free(threeAln1);
+    free(threeAln2);
+}
+
+typedef struct
+{
+    FLANK_ALIGNMENT *pairs;
+    int pairNo;
+    int next;
+    pthread_mutex_t lock;
+} ALIGN_BATCH;
+
+#define ALIGN_CHUNK 256
+
+static void *alignworker(void *arg)
+{
+    ALIGN_BATCH *batch = (ALIGN_BATCH *) arg;
+    ALIGN_WORKSPACE *ws = newalignworkspace();
+    int start, k;
+
+    while (1)
+    {
+        pthread_mutex_lock(&batch->lock);
+        start = batch->next;
+        batch->next += ALIGN_CHUNK;
+        pthread_mutex_unlock(&batch->lock);
+
+        if (start >= batch->pairNo)
+        {
+            break;
+        }
+
+        for (k=start; k<MIN(start+ALIGN_CHUNK, batch->pairNo); k++)
+        {
+            alignflanks(&batch->pairs[k], ws);
+        }
+    }
+
+    freealignworkspace(ws);
+
+    return NULL;
+}
+
+void alignflanksbatch(FLANK_ALIGNMENT *pairs, int pairNo, int threadNo)
+{
+    ALIGN_BATCH batch;
+    pthread_t *threads;
+    int t;
+
+    batch.pairs = pairs;
+    batch.pairNo = pairNo;
+    batch.next = 0;
+    pthread_mutex_init(&batch.lock, NULL);
+
+    threadNo = MAX(1, MIN(threadNo, (pairNo + ALIGN_CHUNK - 1) / ALIGN_CHUNK));
+    FRALLOC(threads, threadNo, pthread_t);
+    for (t=0; t<threadNo; t++)
+    {
+        if (pthread_create(&threads[t], NULL, alignworker, &batch))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (t=0; t<threadNo; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    pthread_mutex_destroy(&batch.lock);
+    free(threads);
+}
@@ -0,0 +1,46 @@
+#include <stdint.h>
+
+/* traceback codes, 4 to a byte */
+#define TRACE_D 0
+#define TRACE_U 1
+#define TRACE_L 2
+#define TRACE_E 3
+
+typedef struct
+{
+    int cap1;
+    int cap2;
+    int16_t *diagonals;
+    int16_t *codes;
+    int16_t *wide1;
+    int16_t *wide2;
+    unsigned char *trace;
+} ALIGN_WORKSPACE;
+
+/*
+ * a flank pair as compared by fannotatestrands' getAlignedFlanksSimilarity,
+ * the similarity is concordance/total over aligned non-gap positions
+ */
+typedef struct
+{
+    char *flanks1;
+    char *flanks2;
+    int concordance;
+    int total;
+    char *aligned1;
+    char *aligned2;
+} FLANK_ALIGNMENT;
+
+ALIGN_WORKSPACE *newalignworkspace() ;
+void freealignworkspace(ALIGN_WORKSPACE *ws) ;
+
+/*
+ * global alignment, match +1, mismatch 0, gap -1, ties broken towards
+ * diagonal then up as in fratbi::getGlobalAlignment.  aln1 and aln2 need
+ * n1+n2+1 bytes each.
+ */
+void globalalign(char *seq1, int n1, char *seq2, int n2, char *aln1, char *aln2, ALIGN_WORKSPACE *ws) ;
+
+double flankssimilarity(char *flanks1, char *flanks2) ;
+void alignflanks(FLANK_ALIGNMENT *pair, ALIGN_WORKSPACE *ws) ;
+void alignflanksbatch(FLANK_ALIGNMENT *pairs, int pairNo, int threadNo) ;
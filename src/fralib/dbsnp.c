@@ -0,0 +1,694 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "filesubs.h"
+#include "dbsnp.h"
+
+/* rows as read from the dumps, before they are packed into the image */
+typedef struct
+{
+    uint32_t rs;
+    uint32_t row;
+    DBSNP_LOCATION location;
+} BUILD_LOCATION;
+
+typedef struct
+{
+    uint32_t rs;
+    uint32_t row;
+    DBSNP_HAPMAP hapmap;
+} BUILD_HAPMAP;
+
+/* strings are interned, the dumps repeat a few hundred distinct values */
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t cap;
+    uint32_t *table;
+    uint32_t tableCap;
+    uint32_t n;
+} STRING_POOL;
+
+static uint32_t hashstring(char *s)
+{
+    uint32_t h = 2166136261u;
+
+    for (; *s; s++)
+    {
+        h = (h ^ (unsigned char) *s) * 16777619u;
+    }
+
+    return h;
+}
+
+static uint32_t internstring(STRING_POOL *pool, char *s)
+{
+    uint32_t i, j, offset, *table;
+    size_t n;
+
+    if (2*(pool->n + 1) > pool->tableCap)
+    {
+        /* rehash into a table twice the size */
+        table = pool->table;
+        pool->tableCap = pool->tableCap ? 2*pool->tableCap : 1024;
+        FRALLOC(pool->table, pool->tableCap, uint32_t);
+        for (i=0; table!=NULL && i<pool->tableCap/2; i++)
+        {
+            if (table[i])
+            {
+                for (j=hashstring(pool->data + table[i]) & (pool->tableCap-1); pool->table[j]; j=(j+1) & (pool->tableCap-1));
+                pool->table[j] = table[i];
+            }
+        }
+        free(table);
+    }
+
+    if (*s == '\0')
+    {
+        return 0;
+    }
+
+    for (j=hashstring(s) & (pool->tableCap-1); pool->table[j]; j=(j+1) & (pool->tableCap-1))
+    {
+        if (strcmp(pool->data + pool->table[j], s) == 0)
+        {
+            return pool->table[j];
+        }
+    }
+
+    n = strlen(s) + 1;
+    if (pool->size + n > pool->cap)
+    {
+        pool->cap = MAX(2*pool->cap, pool->size + n + 4096);
+        pool->data = (char *) xrealloc(pool->data, pool->cap);
+    }
+    offset = pool->size;
+    memcpy(pool->data + offset, s, n);
+    pool->size += n;
+    pool->table[j] = offset;
+    ++pool->n;
+
+    return offset;
+}
+
+uint32_t parsers(char *rsID)
+{
+    char *end;
+    unsigned long rs;
+
+    if (strncmp(rsID, "rs", 2) != 0 || !isdigit(rsID[2]))
+    {
+        return 0;
+    }
+
+    rs = strtoul(rsID+2, &end, 10);
+
+    return *end == '\0' && rs <= UINT32_MAX ? rs : 0;
+}
+
+static inline uint64_t mphhash(uint32_t key, uint32_t seed)
+{
+    uint64_t x = key + seed * 0x9E3779B97F4A7C15ULL;
+
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+
+    return x;
+}
+
+static inline uint32_t mphslot(int32_t *displacements, uint32_t n, uint32_t key)
+{
+    int32_t d = displacements[mphhash(key, 0) % n];
+
+    return d < 0 ? (uint32_t)(-d - 1) : mphhash(key, d) % n;
+}
+
+/*
+ * Hash and displace: keys are hashed into n buckets, buckets are placed
+ * largest first by trying seeds until all their keys fall into free slots,
+ * single keys then take the remaining slots directly.
+ */
+static void buildmph(uint32_t *keys, uint32_t n, int32_t *displacements, uint32_t *slots)
+{
+    uint32_t *counts, *starts, *members, *order, *tried;
+    unsigned char *taken;
+    uint32_t i, j, k, b, size, maxSize = 0, freeSlot = 0, s;
+    int32_t d;
+    int ok;
+
+    FRALLOC(counts, n + 1, uint32_t);
+    FRALLOC(starts, n + 1, uint32_t);
+    FRALLOC(members, n, uint32_t);
+    FRALLOC(order, n, uint32_t);
+    FRALLOC(taken, n, unsigned char);
+
+    for (i=0; i<n; i++)
+    {
+        ++counts[mphhash(keys[i], 0) % n];
+    }
+    for (b=0; b<n; b++)
+    {
+        starts[b+1] = starts[b] + counts[b];
+        maxSize = MAX(maxSize, counts[b]);
+    }
+    memset(counts, 0, n*sizeof(uint32_t));
+    for (i=0; i<n; i++)
+    {
+        b = mphhash(keys[i], 0) % n;
+        members[starts[b] + counts[b]++] = i;
+    }
+
+    /* buckets by decreasing size */
+    for (size=maxSize, j=0; size>0; size--)
+    {
+        for (b=0; b<n; b++)
+        {
+            if (counts[b] == size)
+            {
+                order[j++] = b;
+            }
+        }
+    }
+
+    FRALLOC(tried, maxSize + 1, uint32_t);
+    for (i=0; i<j; i++)
+    {
+        b = order[i];
+        if (counts[b] == 1)
+        {
+            while (taken[freeSlot])
+            {
+                ++freeSlot;
+            }
+            taken[freeSlot] = 1;
+            slots[members[starts[b]]] = freeSlot;
+            displacements[b] = -(int32_t)freeSlot - 1;
+            continue;
+        }
+
+        for (d=1; ; d++)
+        {
+            if (d == INT32_MAX)
+            {
+                fatal("Cannot build a perfect hash for %u keys\n", n);
+            }
+
+            /* the keys of a bucket must land in distinct free slots */
+            ok = 1;
+            for (size=0; size<counts[b] && ok; size++)
+            {
+                s = tried[size] = mphhash(keys[members[starts[b]+size]], d) % n;
+                ok = !taken[s];
+                for (k=0; k<size && ok; k++)
+                {
+                    ok = tried[k] != s;
+                }
+            }
+
+            if (ok)
+            {
+                for (size=0; size<counts[b]; size++)
+                {
+                    taken[tried[size]] = 1;
+                    slots[members[starts[b]+size]] = tried[size];
+                }
+                displacements[b] = d;
+                break;
+            }
+        }
+    }
+
+    free(counts);
+    free(starts);
+    free(members);
+    free(order);
+    free(taken);
+    free(tried);
+}
+
+static int comparelocations(const void *a, const void *b)
+{
+    BUILD_LOCATION *l1 = (BUILD_LOCATION *) a;
+    BUILD_LOCATION *l2 = (BUILD_LOCATION *) b;
+
+    if (l1->rs != l2->rs)
+    {
+        return l1->rs < l2->rs ? -1 : 1;
+    }
+
+    return l1->row < l2->row ? -1 : (l1->row > l2->row);
+}
+
+static int comparehapmaps(const void *a, const void *b)
+{
+    BUILD_HAPMAP *h1 = (BUILD_HAPMAP *) a;
+    BUILD_HAPMAP *h2 = (BUILD_HAPMAP *) b;
+
+    if (h1->rs != h2->rs)
+    {
+        return h1->rs < h2->rs ? -1 : 1;
+    }
+
+    return h1->row < h2->row ? -1 : (h1->row > h2->row);
+}
+
+/* orders keys by rs number */
+static int comparekeys(const void *a, const void *b)
+{
+    DBSNP_RECORD *r1 = (DBSNP_RECORD *) a;
+    DBSNP_RECORD *r2 = (DBSNP_RECORD *) b;
+
+    if (r1->rs != r2->rs)
+    {
+        return r1->rs < r2->rs ? -1 : 1;
+    }
+
+    return 0;
+}
+
+/* index of rs in keys sorted by rs number, n if it is not there */
+static uint32_t findkey(DBSNP_RECORD *keys, uint32_t n, uint32_t rs)
+{
+    uint32_t lo = 0, hi = n, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo)/2;
+        if (keys[mid].rs < rs)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    return lo < n && keys[lo].rs == rs ? lo : n;
+}
+
+/* UCSC dumps start with the bin column, which the database queries do not see */
+static int bincolumns(char **fields)
+{
+    return strncmp(fields[0], "chr", 3) == 0 ? 0 : 1;
+}
+
+static int israndom(char *chromosome)
+{
+    size_t n = strlen(chromosome);
+
+    return n >= 6 && strcmp(chromosome + n - 6, "random") == 0;
+}
+
+static BUILD_HAPMAP *readhapmaps(char *file, STRING_POOL *pool, uint32_t *hapmapNo)
+{
+    BUILD_HAPMAP *hapmaps = NULL, *h;
+    FILE *fp;
+    char *line = NULL, *fields[32];
+    size_t cap = 0;
+    uint32_t n = 0, hapmapCap = 0, rs;
+    int fieldNo, o, lineNo = 0;
+
+    fp = zopen(file);
+    while (readline(fp, &line, &cap) != -1)
+    {
+        ++lineNo;
+        if (line[0] == '#' || line[0] == '\0')
+        {
+            continue;
+        }
+
+        fieldNo = splitline(line, fields, 32, '\t');
+        o = bincolumns(fields);
+        if (fieldNo < o + 12)
+        {
+            fatal("%s: line %d is not a hapmapSnps record\n", file, lineNo);
+        }
+        /* HapMap rows are joined on the name alone */
+        if ((rs = parsers(fields[o+3])) == 0)
+        {
+            continue;
+        }
+
+        if (n == hapmapCap)
+        {
+            hapmapCap = hapmapCap ? 2*hapmapCap : 65536;
+            hapmaps = (BUILD_HAPMAP *) xrealloc(hapmaps, hapmapCap*sizeof(BUILD_HAPMAP));
+        }
+
+        h = &hapmaps[n];
+        memset(h, 0, sizeof(BUILD_HAPMAP));
+        h->rs = rs;
+        h->row = n++;
+        h->hapmap.strand = fields[o+5][0];
+        h->hapmap.observed = internstring(pool, fields[o+6]);
+        h->hapmap.allele1 = fields[o+7][0];
+        h->hapmap.homoCount1 = atoi(fields[o+8]);
+        h->hapmap.allele2 = fields[o+9][0];
+        h->hapmap.homoCount2 = atoi(fields[o+10]);
+        h->hapmap.heteroCount = atoi(fields[o+11]);
+    }
+    zclose(fp, file);
+    free(line);
+
+    qsort(hapmaps, n, sizeof(BUILD_HAPMAP), comparehapmaps);
+    *hapmapNo = n;
+
+    return hapmaps;
+}
+
+static void setpointers(DBSNP_INDEX *di)
+{
+    DBSNP_INDEX_HEADER *h = (DBSNP_INDEX_HEADER *) di->data;
+    size_t expected;
+
+    di->header = h;
+    di->displacements = (int32_t *) (di->data + sizeof(DBSNP_INDEX_HEADER));
+    di->records = (DBSNP_RECORD *) (di->displacements + h->keyNo);
+    di->locations = (DBSNP_LOCATION *) (di->records + h->keyNo);
+    di->hapmaps = (DBSNP_HAPMAP *) (di->locations + h->locationNo);
+    di->strings = (char *) (di->hapmaps + h->hapmapNo);
+
+    expected = (unsigned char *) di->strings + h->stringBytes - di->data;
+    if (expected != di->size)
+    {
+        fatal("%s is truncated or corrupt\n", di->file);
+    }
+}
+
+DBSNP_INDEX *builddbsnpindex(char *snpFile, char **hapmapFiles, char **populations, char *build)
+{
+    DBSNP_INDEX *di;
+    DBSNP_INDEX_HEADER *h;
+    DBSNP_RECORD *keys = NULL;
+    BUILD_LOCATION *locations = NULL, *l;
+    BUILD_HAPMAP *hapmaps[DBSNP_POPULATION_NO];
+    STRING_POOL pool;
+    FILE *fp;
+    char *line = NULL, *fields[32];
+    size_t cap = 0;
+    uint32_t i, j, k, keyNo = 0, keyCap = 0, mappedNo, locationNo = 0, locationCap = 0, hapmapNo = 0, rs;
+    uint32_t hapmapNos[DBSNP_POPULATION_NO], *keyValues, *slots;
+    int fieldNo, o, p, lineNo = 0;
+
+    memset(&pool, 0, sizeof(pool));
+    pool.cap = 4096;
+    pool.data = (char *) xrealloc(NULL, pool.cap);
+    pool.data[0] = '\0';
+    pool.size = 1;
+
+    fp = zopen(snpFile);
+    while (readline(fp, &line, &cap) != -1)
+    {
+        ++lineNo;
+        if (line[0] == '#' || line[0] == '\0')
+        {
+            continue;
+        }
+
+        fieldNo = splitline(line, fields, 32, '\t');
+        o = bincolumns(fields);
+        if (fieldNo < o + 15)
+        {
+            fatal("%s: line %d is not a snp table record\n", snpFile, lineNo);
+        }
+        if ((rs = parsers(fields[o+3])) == 0 || israndom(fields[o]))
+        {
+            continue;
+        }
+
+        if (locationNo == locationCap)
+        {
+            locationCap = locationCap ? 2*locationCap : 1048576;
+            locations = (BUILD_LOCATION *) xrealloc(locations, locationCap*sizeof(BUILD_LOCATION));
+        }
+
+        l = &locations[locationNo];
+        memset(l, 0, sizeof(BUILD_LOCATION));
+        l->rs = rs;
+        l->row = locationNo++;
+        l->location.chromosome = internstring(&pool, fields[o]);
+        l->location.position = atol(fields[o+1]) + 1;
+        l->location.strand = fields[o+5][0];
+        l->location.observed = internstring(&pool, fields[o+8]);
+        l->location.snpClass = internstring(&pool, fields[o+10]);
+        l->location.function = internstring(&pool, fields[o+14]);
+    }
+    zclose(fp, snpFile);
+    free(line);
+
+    /* an rs number mapped to several locations keeps them together, in dump order */
+    qsort(locations, locationNo, sizeof(BUILD_LOCATION), comparelocations);
+    for (i=0; i<locationNo; i++)
+    {
+        if (i == 0 || locations[i].rs != locations[i-1].rs)
+        {
+            if (keyNo == keyCap)
+            {
+                keyCap = keyCap ? 2*keyCap : 1048576;
+                keys = (DBSNP_RECORD *) xrealloc(keys, keyCap*sizeof(DBSNP_RECORD));
+            }
+            memset(&keys[keyNo], 0, sizeof(DBSNP_RECORD));
+            keys[keyNo].rs = locations[i].rs;
+            keys[keyNo++].firstLocation = i;
+        }
+        ++keys[keyNo-1].locationNo;
+    }
+
+    /*
+     * the HapMap tables are joined on the rs number alone, so genotyped rs
+     * numbers without a location are keys too, with no locations
+     */
+    mappedNo = keyNo;
+    for (p=0; p<DBSNP_POPULATION_NO; p++)
+    {
+        hapmaps[p] = NULL;
+        hapmapNos[p] = 0;
+        if (hapmapFiles[p] == NULL)
+        {
+            continue;
+        }
+
+        hapmaps[p] = readhapmaps(hapmapFiles[p], &pool, &hapmapNos[p]);
+        for (j=0; j<hapmapNos[p]; j++)
+        {
+            if ((j > 0 && hapmaps[p][j].rs == hapmaps[p][j-1].rs) ||
+                findkey(keys, mappedNo, hapmaps[p][j].rs) < mappedNo)
+            {
+                continue;
+            }
+
+            if (keyNo == keyCap)
+            {
+                keyCap = keyCap ? 2*keyCap : 1048576;
+                keys = (DBSNP_RECORD *) xrealloc(keys, keyCap*sizeof(DBSNP_RECORD));
+            }
+            memset(&keys[keyNo], 0, sizeof(DBSNP_RECORD));
+            keys[keyNo++].rs = hapmaps[p][j].rs;
+        }
+    }
+
+    qsort(keys, keyNo, sizeof(DBSNP_RECORD), comparekeys);
+    for (i=0, k=0; i<keyNo; i++)
+    {
+        if (k == 0 || keys[i].rs != keys[k-1].rs)
+        {
+            keys[k++] = keys[i];
+        }
+    }
+    keyNo = k;
+
+    /* every HapMap row of a genotyped rs number, as the left joins return them all */
+    for (p=0; p<DBSNP_POPULATION_NO; p++)
+    {
+        for (j=0; j<hapmapNos[p]; j++)
+        {
+            if (j == 0 || hapmaps[p][j].rs != hapmaps[p][j-1].rs)
+            {
+                k = findkey(keys, keyNo, hapmaps[p][j].rs);
+                keys[k].hapmap[p] = hapmapNo + 1;
+            }
+            ++keys[k].hapmapNo[p];
+            ++hapmapNo;
+        }
+    }
+
+    /* pack the image */
+    FRALLOC(di, 1, DBSNP_INDEX);
+    di->file = strdup(snpFile);
+    di->size = sizeof(DBSNP_INDEX_HEADER) + keyNo*(sizeof(int32_t) + sizeof(DBSNP_RECORD)) +
+               locationNo*sizeof(DBSNP_LOCATION) + hapmapNo*sizeof(DBSNP_HAPMAP) + pool.size;
+    FRALLOC(di->data, di->size, unsigned char);
+
+    h = (DBSNP_INDEX_HEADER *) di->data;
+    h->magic = DBSNP_INDEX_MAGIC;
+    h->version = DBSNP_INDEX_VERSION;
+    snprintf(h->build, sizeof(h->build), "%s", build);
+    h->keyNo = keyNo;
+    h->locationNo = locationNo;
+    h->hapmapNo = hapmapNo;
+    h->stringBytes = pool.size;
+    for (p=0; p<DBSNP_POPULATION_NO; p++)
+    {
+        snprintf(h->populations[p], sizeof(h->populations[p]), "%s", populations[p]);
+    }
+    setpointers(di);
+
+    for (i=0; i<locationNo; i++)
+    {
+        di->locations[i] = locations[i].location;
+    }
+
+    /* the rows are numbered above in population and rs order */
+    for (p=0, k=0; p<DBSNP_POPULATION_NO; p++)
+    {
+        for (j=0; j<hapmapNos[p]; j++)
+        {
+            di->hapmaps[k++] = hapmaps[p][j].hapmap;
+        }
+        free(hapmaps[p]);
+    }
+
+    FRALLOC(keyValues, MAX(keyNo, 1), uint32_t);
+    FRALLOC(slots, MAX(keyNo, 1), uint32_t);
+    for (i=0; i<keyNo; i++)
+    {
+        keyValues[i] = keys[i].rs;
+    }
+    buildmph(keyValues, keyNo, di->displacements, slots);
+    for (i=0; i<keyNo; i++)
+    {
+        di->records[slots[i]] = keys[i];
+    }
+    memcpy(di->strings, pool.data, pool.size);
+
+    free(keyValues);
+    free(slots);
+    free(keys);
+    free(locations);
+    free(pool.data);
+    free(pool.table);
+
+    return di;
+}
+
+void writedbsnpindex(DBSNP_INDEX *di, char *file)
+{
+    FILE *fp = xopen(file, "w");
+
+    if (fwrite(di->data, 1, di->size, fp) != di->size || fclose(fp) != 0)
+    {
+        fatal("Cannot write %s\n", file);
+    }
+}
+
+DBSNP_INDEX *dbsnpindexopen(char *file)
+{
+    DBSNP_INDEX *di;
+    struct stat st;
+    int fd;
+
+    if ((fd = open(file, O_RDONLY)) == -1 || fstat(fd, &st) == -1)
+    {
+        fatal("Cannot open %s\n", file);
+    }
+
+    FRALLOC(di, 1, DBSNP_INDEX);
+    di->file = strdup(file);
+    di->size = st.st_size;
+    di->mapped = 1;
+    if (di->size < sizeof(DBSNP_INDEX_HEADER) ||
+        (di->data = (unsigned char *) mmap(NULL, di->size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+    {
+        fatal("Cannot map %s\n", file);
+    }
+    close(fd);
+
+    if (((DBSNP_INDEX_HEADER *) di->data)->magic != DBSNP_INDEX_MAGIC)
+    {
+        fatal("%s is not a dbSNP index\n", file);
+    }
+    if (((DBSNP_INDEX_HEADER *) di->data)->version != DBSNP_INDEX_VERSION)
+    {
+        fatal("%s is a version %d dbSNP index, version %d expected\n", file,
+              ((DBSNP_INDEX_HEADER *) di->data)->version, DBSNP_INDEX_VERSION);
+    }
+    setpointers(di);
+
+    return di;
+}
+
+void dbsnpindexclose(DBSNP_INDEX *di)
+{
+    if (di->mapped)
+    {
+        munmap(di->data, di->size);
+    }
+    else
+    {
+        free(di->data);
+    }
+    free(di->file);
+    free(di);
+}
+
+DBSNP_RECORD *dbsnpfind(DBSNP_INDEX *di, uint32_t rs)
+{
+    DBSNP_RECORD *record;
+
+    if (di->header->keyNo == 0 || rs == 0)
+    {
+        return NULL;
+    }
+
+    record = &di->records[mphslot(di->displacements, di->header->keyNo, rs)];
+
+    return record->rs == rs ? record : NULL;
+}
+
+#define BATCH 256
+
+void dbsnpfindbatch(DBSNP_INDEX *di, uint32_t *rs, int n, DBSNP_RECORD **records)
+{
+    uint32_t buckets[BATCH], slots[BATCH];
+    uint32_t keyNo = di->header->keyNo;
+    int32_t d;
+    int i, j, m;
+
+    if (keyNo == 0)
+    {
+        memset(records, 0, n*sizeof(DBSNP_RECORD *));
+        return;
+    }
+
+    /* each stage prefetches what the next one reads */
+    for (i=0; i<n; i+=BATCH)
+    {
+        m = MIN(BATCH, n - i);
+        for (j=0; j<m; j++)
+        {
+            buckets[j] = mphhash(rs[i+j], 0) % keyNo;
+            __builtin_prefetch(&di->displacements[buckets[j]]);
+        }
+        for (j=0; j<m; j++)
+        {
+            d = di->displacements[buckets[j]];
+            slots[j] = d < 0 ? (uint32_t)(-d - 1) : mphhash(rs[i+j], d) % keyNo;
+            __builtin_prefetch(&di->records[slots[j]]);
+        }
+        for (j=0; j<m; j++)
+        {
+            records[i+j] = rs[i+j] != 0 && di->records[slots[j]].rs == rs[i+j] ? &di->records[slots[j]] : NULL;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#define DBSNP_INDEX_MAGIC   0x58444953
+#define DBSNP_INDEX_VERSION 2
+#define DBSNP_POPULATION_NO 4
+
+/*
+ * A dbSNP index file is the image below written out as is and mapped back:
+ *
+ *   DBSNP_INDEX_HEADER
+ *   int32_t[keyNo]             displacements of the minimal perfect hash
+ *   DBSNP_RECORD[keyNo]        one per mapped or genotyped rs number, stored
+ *                              at its hash slot
+ *   DBSNP_LOCATION[locationNo] mapped locations, grouped by rs number
+ *   DBSNP_HAPMAP[hapmapNo]     HapMap genotype counts, grouped by population
+ *                              and rs number
+ *   char[stringBytes]          interned strings, offset 0 is ""
+ *
+ * An rs number is hashed to a bucket of the displacement table.  A bucket
+ * holding one key stores -(slot+1), otherwise the seed that scatters its
+ * keys into free slots.  Lookups compare the rs number of the slot, so
+ * numbers that are not in the index are rejected.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    char build[16];
+    uint32_t keyNo;
+    uint32_t locationNo;
+    uint32_t hapmapNo;
+    uint32_t stringBytes;
+    char populations[DBSNP_POPULATION_NO][8];
+} DBSNP_INDEX_HEADER;
+
+typedef struct
+{
+    uint32_t rs;
+    uint32_t firstLocation;
+    uint32_t locationNo;
+    uint32_t hapmap[DBSNP_POPULATION_NO];
+    uint32_t hapmapNo[DBSNP_POPULATION_NO];
+} DBSNP_RECORD;
+
+/* a row of the UCSC snp table, position is chromStart+1 */
+typedef struct
+{
+    uint32_t chromosome;
+    uint32_t position;
+    uint32_t observed;
+    uint32_t snpClass;
+    uint32_t function;
+    char strand;
+    char reserved[3];
+} DBSNP_LOCATION;
+
+/*
+ * a row of a UCSC hapmapSnps table, hapmap[] holds the index + 1 of the
+ * first row of an rs number and hapmapNo[] its number of rows
+ */
+typedef struct
+{
+    uint32_t observed;
+    uint32_t homoCount1;
+    uint32_t homoCount2;
+    uint32_t heteroCount;
+    char strand;
+    char allele1;
+    char allele2;
+    char reserved;
+} DBSNP_HAPMAP;
+
+typedef struct
+{
+    char *file;
+    unsigned char *data;
+    size_t size;
+    int mapped;
+    DBSNP_INDEX_HEADER *header;
+    int32_t *displacements;
+    DBSNP_RECORD *records;
+    DBSNP_LOCATION *locations;
+    DBSNP_HAPMAP *hapmaps;
+    char *strings;
+} DBSNP_INDEX;
+
+/*
+ * builds an index from a UCSC snp table dump, skipping random contigs as
+ * the database queries do, with the HapMap dumps of the populations given
+ * (NULL for a population without one)
+ */
+DBSNP_INDEX *builddbsnpindex(char *snpFile, char **hapmapFiles, char **populations, char *build) ;
+void writedbsnpindex(DBSNP_INDEX *di, char *file) ;
+DBSNP_INDEX *dbsnpindexopen(char *file) ;
+void dbsnpindexclose(DBSNP_INDEX *di) ;
+
+/* rs number of rs123, 0 if it is not one */
+uint32_t parsers(char *rsID) ;
+
+DBSNP_RECORD *dbsnpfind(DBSNP_INDEX *di, uint32_t rs) ;
+
+/* looks up n rs numbers, prefetching the slots of later ones */
+void dbsnpfindbatch(DBSNP_INDEX *di, uint32_t *rs, int n, DBSNP_RECORD **records) ;
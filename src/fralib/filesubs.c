@@ -0,0 +1,251 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include "filesubs.h"
+
+/* the gunzip processes of the files opened by zopen, by the descriptor they write to */
+typedef struct
+{
+    int fd;
+    pid_t pid;
+} GUNZIP_CHILD;
+
+static GUNZIP_CHILD *gunzipChildren = NULL;
+static int gunzipChildNo = 0;
+static pthread_mutex_t gunzipLock = PTHREAD_MUTEX_INITIALIZER;
+
+void fatal(char *fmt, ...)
+{
+    va_list args;
+
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fflush(stderr);
+    exit(1);
+}
+
+void *xrealloc(void *ptr, size_t size)
+{
+    if ((ptr = realloc(ptr, size)) == NULL)
+    {
+        fatal("CM\n");
+    }
+
+    return ptr;
+}
+
+FILE *xopen(char *file, char *mode)
+{
+    FILE *fp;
+
+    if (strcmp(file, "-") == 0)
+    {
+        return mode[0] == 'r' ? stdin : stdout;
+    }
+
+    if ((fp = fopen(file, mode)) == NULL)
+    {
+        fatal("Cannot open %s\n", file);
+    }
+
+    return fp;
+}
+
+/* gunzip is run without a shell so that any file name is passed as it is */
+FILE *zopen(char *file)
+{
+    FILE *fp;
+    int fds[2];
+    pid_t pid;
+
+    if (!hasextension(file, "gz"))
+    {
+        return xopen(file, "r");
+    }
+
+    /* close on exec keeps the pipes of other threads out of the child */
+    if (pipe2(fds, O_CLOEXEC) == -1)
+    {
+        fatal("Cannot open pipe to %s\n", file);
+    }
+
+    if ((pid = fork()) == -1)
+    {
+        fatal("Cannot open pipe to %s\n", file);
+    }
+    if (pid == 0)
+    {
+        if (dup2(fds[1], STDOUT_FILENO) == -1)
+        {
+            _exit(127);
+        }
+        execlp("gunzip", "gunzip", "-c", file, (char *) NULL);
+        _exit(127);
+    }
+
+    close(fds[1]);
+    if ((fp = fdopen(fds[0], "r")) == NULL)
+    {
+        fatal("Cannot open pipe to %s\n", file);
+    }
+
+    pthread_mutex_lock(&gunzipLock);
+    gunzipChildren = (GUNZIP_CHILD *) xrealloc(gunzipChildren, (gunzipChildNo + 1)*sizeof(GUNZIP_CHILD));
+    gunzipChildren[gunzipChildNo].fd = fds[0];
+    gunzipChildren[gunzipChildNo++].pid = pid;
+    pthread_mutex_unlock(&gunzipLock);
+
+    return fp;
+}
+
+void zclose(FILE *fp, char *file)
+{
+    pid_t pid = -1;
+    int i, status;
+
+    if (hasextension(file, "gz"))
+    {
+        pthread_mutex_lock(&gunzipLock);
+        for (i=0; i<gunzipChildNo; i++)
+        {
+            if (gunzipChildren[i].fd == fileno(fp))
+            {
+                pid = gunzipChildren[i].pid;
+                gunzipChildren[i] = gunzipChildren[--gunzipChildNo];
+                break;
+            }
+        }
+        pthread_mutex_unlock(&gunzipLock);
+
+        fclose(fp);
+        while (pid != -1 && waitpid(pid, &status, 0) == -1)
+        {
+            if (errno != EINTR)
+            {
+                fatal("Cannot read %s\n", file);
+            }
+        }
+        if (pid == -1 || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        {
+            fatal("Cannot read %s\n", file);
+        }
+    }
+    else if (fp != stdin)
+    {
+        fclose(fp);
+    }
+}
+
+long readline(FILE *fp, char **line, size_t *cap)
+{
+    ssize_t len;
+
+    if ((len = getline(line, cap, fp)) == -1)
+    {
+        return -1;
+    }
+
+    /* s/\r?\n?$// */
+    if (len && (*line)[len-1] == '\n')
+    {
+        (*line)[--len] = '\0';
+    }
+    if (len && (*line)[len-1] == '\r')
+    {
+        (*line)[--len] = '\0';
+    }
+
+    return len;
+}
+
+int splitline(char *line, char **fields, int maxFields, char delim)
+{
+    int n = 0;
+    char *s = line;
+
+    fields[n++] = s;
+    while (n < maxFields && (s = strchr(s, delim)) != NULL)
+    {
+        *s++ = '\0';
+        fields[n++] = s;
+    }
+
+    return n;
+}
+
+int countfields(char *line, char delim)
+{
+    int n = 1;
+
+    while ((line = strchr(line, delim)) != NULL)
+    {
+        ++line;
+        ++n;
+    }
+
+    return n;
+}
+
+int findlabel(char **fields, int fieldNo, char *label)
+{
+    int col;
+
+    for (col=0; col<fieldNo; col++)
+    {
+        if (strcmp(fields[col], label) == 0)
+        {
+            return col;
+        }
+    }
+
+    return -1;
+}
+
+int getlabel(char **fields, int fieldNo, char *label, char *file)
+{
+    int col;
+
+    if ((col = findlabel(fields, fieldNo, label)) == -1)
+    {
+        fatal("Cannot find '%s' in %s\n", label, file);
+    }
+
+    return col;
+}
+
+char *fileprefix(char *file)
+{
+    char *name, *s;
+
+    name = (s = strrchr(file, '/')) == NULL ? strdup(file) : strdup(s+1);
+    if ((s = strchr(name, '.')) != NULL)
+    {
+        *s = '\0';
+    }
+
+    return name;
+}
+
+int hasextension(char *file, char *extension)
+{
+    size_t fileLen = strlen(file);
+    size_t extLen = strlen(extension);
+
+    return fileLen > extLen && file[fileLen-extLen-1] == '.' && strcmp(file+fileLen-extLen, extension) == 0;
+}
+
+int getcpuno()
+{
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return n < 1 ? 1 : (int) n;
+}
@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <unistd.h>
+
+#define FRALLOC(item,n,type)     if ((item = (type *)calloc((n),sizeof(type))) == NULL) \
+                                        fatal("Unable to allocate %ld unit(s) for item\n",(long)(n))
+
+#undef MAX
+#undef MIN
+
+#define MAX(a,b)   ( (a) < (b) ?  (b) : (a) )
+#define MIN(a,b)   ( (a) < (b) ?  (a) : (b) )
+
+void fatal(char *fmt, ...) __attribute__((noreturn)) ;
+void *xrealloc(void *ptr, size_t size) ;
+FILE *xopen(char *file, char *mode) ;
+
+/* opens a file for reading, through gunzip if it ends in .gz */
+FILE *zopen(char *file) ;
+void zclose(FILE *fp, char *file) ;
+
+/* reads a line, strips \r?\n, returns length or -1 on eof */
+long readline(FILE *fp, char **line, size_t *cap) ;
+
+/* splits line in place on delim, returns no. of fields */
+int splitline(char *line, char **fields, int maxFields, char delim) ;
+int countfields(char *line, char delim) ;
+int findlabel(char **fields, int fieldNo, char *label) ;
+int getlabel(char **fields, int fieldNo, char *label, char *file) ;
+
+/* fileparse($file, '\..*') name component */
+char *fileprefix(char *file) ;
+int hasextension(char *file, char *extension) ;
+
+int getcpuno() ;
@@ -0,0 +1,14 @@
+#define YES  1
+#define NO   0
+
+#include <filesubs.h>
+#include <gtsubs.h>
+#include <twobit.h>
+#include <align.h>
+#include <geneindex.h>
+#include <dbsnp.h>
+#include <keytable.h>
+#include <plinkbed.h>
+#include <strand.h>
+#include <pvalues.h>
+#include <ranstream.h>
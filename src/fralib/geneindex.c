@@ -0,0 +1,692 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "filesubs.h"
+#include "geneindex.h"
+
+/* a gene as read from a UCSC dump, before it is packed into the image */
+typedef struct
+{
+    char chromosome[24];
+    GENE_RECORD record;
+    int32_t *exons;
+} BUILD_GENE;
+
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t cap;
+} STRING_POOL;
+
+static uint32_t addstring(STRING_POOL *pool, char *s)
+{
+    size_t n = strlen(s) + 1;
+    uint32_t offset = pool->size;
+
+    if (pool->size + n > pool->cap)
+    {
+        pool->cap = MAX(2*pool->cap, pool->size + n + 4096);
+        pool->data = (char *) xrealloc(pool->data, pool->cap);
+    }
+    memcpy(pool->data + pool->size, s, n);
+    pool->size += n;
+
+    return offset;
+}
+
+/* fields 1.. joined by tabs, in place */
+static char *jointail(char **fields, int fieldNo)
+{
+    int i;
+
+    for (i=2; i<fieldNo; i++)
+    {
+        fields[i][-1] = '\t';
+    }
+
+    return fieldNo > 1 ? fields[1] : "";
+}
+
+void genechromosome(char *chromosome, char *label, size_t size)
+{
+    if (strncmp(chromosome, "chr", 3) == 0)
+    {
+        chromosome += 3;
+    }
+    if (strcmp(chromosome, "MT") == 0)
+    {
+        chromosome = "M";
+    }
+
+    snprintf(label, size, "%s", chromosome);
+}
+
+static int comparebuildgenes(const void *a, const void *b)
+{
+    BUILD_GENE *g1 = (BUILD_GENE *) a;
+    BUILD_GENE *g2 = (BUILD_GENE *) b;
+    int c;
+
+    if ((c = strcmp(g1->chromosome, g2->chromosome)) != 0)
+    {
+        return c;
+    }
+    if (g1->record.start != g2->record.start)
+    {
+        return g1->record.start < g2->record.start ? -1 : 1;
+    }
+    if (g1->record.end != g2->record.end)
+    {
+        return g1->record.end < g2->record.end ? -1 : 1;
+    }
+
+    return 0;
+}
+
+static int comparekeys(const void *a, const void *b)
+{
+    return strcmp(*(char **)a, *(char **)b);
+}
+
+static int32_t *parsecoordinates(char *list, int n, char *file, int lineNo)
+{
+    int32_t *coordinates;
+    char *s = list, *end;
+    int i;
+
+    FRALLOC(coordinates, MAX(n, 1), int32_t);
+    for (i=0; i<n; i++)
+    {
+        coordinates[i] = strtol(s, &end, 10);
+        if (end == s)
+        {
+            fatal("%s: line %d has %d exons but fewer coordinates\n", file, lineNo, n);
+        }
+        s = *end == ',' ? end + 1 : end;
+    }
+
+    return coordinates;
+}
+
+/*
+ * Sets maxEnd over the implicit tree of n genes sorted by start and returns
+ * the level of its root, after Li's cgranges.
+ */
+static int indexlevels(GENE_RECORD *a, int64_t n)
+{
+    int64_t i, lastI = 0, k, x, step;
+    int32_t last = 0, e, el, er;
+
+    if (n == 0)
+    {
+        return -1;
+    }
+
+    for (i=0; i<n; i+=2)
+    {
+        lastI = i;
+        last = a[i].maxEnd = a[i].end;
+    }
+
+    for (k=1; ((int64_t)1)<<k <= n; k++)
+    {
+        x = ((int64_t)1) << (k-1);
+        step = x << 2;
+        for (i=(x<<1)-1; i<n; i+=step)
+        {
+            el = a[i-x].maxEnd;
+            er = i+x < n ? a[i+x].maxEnd : last;
+            e = a[i].end;
+            e = MAX(e, el);
+            a[i].maxEnd = MAX(e, er);
+        }
+        lastI = (lastI >> k) & 1 ? lastI - x : lastI + x;
+        if (lastI < n && a[lastI].maxEnd > last)
+        {
+            last = a[lastI].maxEnd;
+        }
+    }
+
+    return k - 1;
+}
+
+static void setpointers(GENE_INDEX *gi)
+{
+    GENE_INDEX_HEADER *h = (GENE_INDEX_HEADER *) gi->data;
+    size_t expected;
+
+    gi->header = h;
+    gi->chromosomes = (GENE_CHROMOSOME *) (gi->data + sizeof(GENE_INDEX_HEADER));
+    gi->genes = (GENE_RECORD *) (gi->chromosomes + h->chromosomeNo);
+    gi->exons = (int32_t *) (gi->genes + h->geneNo);
+    gi->strings = (char *) (gi->exons + 2*(size_t)h->exonNo);
+
+    expected = (unsigned char *) gi->strings + h->stringBytes - gi->data;
+    if (expected != gi->size)
+    {
+        fatal("%s is truncated or corrupt\n", gi->file);
+    }
+}
+
+GENE_INDEX *buildgeneindex(char *ucscFile, char *annotationFile, char *build)
+{
+    GENE_INDEX *gi;
+    GENE_INDEX_HEADER *h;
+    BUILD_GENE *genes = NULL, *g;
+    STRING_POOL pool = {NULL, 0, 0};
+    FILE *fp;
+    char *line = NULL, *fields[32], *key, **found;
+    char **annotationRows = NULL, **annotationKeys = NULL;
+    char *annotationLabels = "";
+    size_t cap = 0;
+    int fieldNo, lineNo = 0, o, i, j, geneNo = 0, geneCap = 0, rowNo = 0, rowCap = 0;
+    int annotationNo = 0, chromosomeNo = 0, hasSymbols = 0;
+    uint32_t exonNo = 0;
+    GENE_CHROMOSOME *c;
+    int32_t *exons;
+
+    /* annotations are kept as their tab joined lines, sorted by gene name */
+    addstring(&pool, "");
+    if (annotationFile != NULL)
+    {
+        fp = zopen(annotationFile);
+        if (readline(fp, &line, &cap) == -1)
+        {
+            fatal("%s is empty\n", annotationFile);
+        }
+        annotationNo = countfields(line, '\t') - 1;
+        fieldNo = splitline(line, fields, 32, '\t');
+        annotationLabels = strdup(jointail(fields, fieldNo));
+
+        while (readline(fp, &line, &cap) != -1)
+        {
+            if (rowNo == rowCap)
+            {
+                rowCap = rowCap ? 2*rowCap : 65536;
+                annotationRows = (char **) xrealloc(annotationRows, rowCap*sizeof(char *));
+            }
+            annotationRows[rowNo++] = strdup(line);
+        }
+        zclose(fp, annotationFile);
+
+        qsort(annotationRows, rowNo, sizeof(char *), comparekeys);
+        FRALLOC(annotationKeys, MAX(rowNo, 1), char *);
+        for (i=0; i<rowNo; i++)
+        {
+            annotationKeys[i] = annotationRows[i];
+            if ((key = strchr(annotationRows[i], '\t')) != NULL)
+            {
+                *key = '\0';
+            }
+        }
+    }
+
+    fp = zopen(ucscFile);
+    while (readline(fp, &line, &cap) != -1)
+    {
+        ++lineNo;
+        if (line[0] == '#' || line[0] == '\0')
+        {
+            continue;
+        }
+
+        fieldNo = splitline(line, fields, 32, '\t');
+
+        /* knownGene starts with the name, refGene with the bin */
+        if (fieldNo >= 10 && (strcmp(fields[2], "+") == 0 || strcmp(fields[2], "-") == 0))
+        {
+            o = 0;
+        }
+        else if (fieldNo >= 11 && (strcmp(fields[3], "+") == 0 || strcmp(fields[3], "-") == 0))
+        {
+            o = 1;
+        }
+        else
+        {
+            fatal("%s: line %d is not a knownGene or refGene record\n", ucscFile, lineNo);
+        }
+
+        if (geneNo == geneCap)
+        {
+            geneCap = geneCap ? 2*geneCap : 65536;
+            genes = (BUILD_GENE *) xrealloc(genes, geneCap*sizeof(BUILD_GENE));
+        }
+
+        g = &genes[geneNo++];
+        memset(g, 0, sizeof(BUILD_GENE));
+        genechromosome(fields[o+1], g->chromosome, sizeof(g->chromosome));
+        g->record.strand = fields[o+2][0];
+        g->record.start = atoi(fields[o+3]);
+        g->record.end = atoi(fields[o+4]);
+        g->record.cdsStart = atoi(fields[o+5]);
+        g->record.cdsEnd = atoi(fields[o+6]);
+        g->record.exonNo = atoi(fields[o+7]);
+        g->exons = parsecoordinates(fields[o+8], g->record.exonNo, ucscFile, lineNo);
+        exons = parsecoordinates(fields[o+9], g->record.exonNo, ucscFile, lineNo);
+        g->exons = (int32_t *) xrealloc(g->exons, 2*MAX(g->record.exonNo, 1)*sizeof(int32_t));
+        for (i=g->record.exonNo-1; i>=0; i--)
+        {
+            g->exons[2*i] = g->exons[i];
+        }
+        for (i=0; i<(int)g->record.exonNo; i++)
+        {
+            g->exons[2*i+1] = exons[i];
+        }
+        free(exons);
+        exonNo += g->record.exonNo;
+
+        g->record.name = addstring(&pool, fields[o]);
+        if (annotationFile != NULL)
+        {
+            key = fields[o];
+            found = (char **) bsearch(&key, annotationKeys, rowNo, sizeof(char *), comparekeys);
+            if (found != NULL)
+            {
+                key = *found + strlen(*found) + 1;
+                g->record.annotation = addstring(&pool, key);
+            }
+        }
+        else if (o == 1 && fieldNo > 12)
+        {
+            /* refGene carries the gene symbol */
+            g->record.annotation = addstring(&pool, fields[12]);
+            hasSymbols = 1;
+        }
+    }
+    zclose(fp, ucscFile);
+
+    if (hasSymbols)
+    {
+        annotationLabels = "gene-symbol";
+        annotationNo = 1;
+    }
+
+    qsort(genes, geneNo, sizeof(BUILD_GENE), comparebuildgenes);
+    for (i=0; i<geneNo; i++)
+    {
+        if (i == 0 || strcmp(genes[i].chromosome, genes[i-1].chromosome) != 0)
+        {
+            ++chromosomeNo;
+        }
+    }
+
+    /* pack the image */
+    FRALLOC(gi, 1, GENE_INDEX);
+    gi->file = strdup(ucscFile);
+    j = addstring(&pool, annotationLabels);
+    gi->size = sizeof(GENE_INDEX_HEADER) + chromosomeNo*sizeof(GENE_CHROMOSOME) +
+               geneNo*sizeof(GENE_RECORD) + 2*(size_t)exonNo*sizeof(int32_t) + pool.size;
+    FRALLOC(gi->data, gi->size, unsigned char);
+
+    h = (GENE_INDEX_HEADER *) gi->data;
+    h->magic = GENE_INDEX_MAGIC;
+    h->version = GENE_INDEX_VERSION;
+    snprintf(h->build, sizeof(h->build), "%s", build);
+    h->chromosomeNo = chromosomeNo;
+    h->geneNo = geneNo;
+    h->exonNo = exonNo;
+    h->stringBytes = pool.size;
+    h->annotationLabels = j;
+    h->annotationNo = annotationNo;
+    setpointers(gi);
+
+    exonNo = 0;
+    c = gi->chromosomes - 1;
+    for (i=0; i<geneNo; i++)
+    {
+        if (i == 0 || strcmp(genes[i].chromosome, genes[i-1].chromosome) != 0)
+        {
+            ++c;
+            snprintf(c->chromosome, sizeof(c->chromosome), "%s", genes[i].chromosome);
+            c->firstGene = i;
+        }
+        ++c->geneNo;
+
+        gi->genes[i] = genes[i].record;
+        gi->genes[i].firstExon = exonNo;
+        memcpy(gi->exons + 2*(size_t)exonNo, genes[i].exons, 2*genes[i].record.exonNo*sizeof(int32_t));
+        exonNo += genes[i].record.exonNo;
+        free(genes[i].exons);
+    }
+    for (i=0; i<chromosomeNo; i++)
+    {
+        c = &gi->chromosomes[i];
+        c->maxLevel = indexlevels(gi->genes + c->firstGene, c->geneNo);
+    }
+    memcpy(gi->strings, pool.data, pool.size);
+
+    for (i=0; i<rowNo; i++)
+    {
+        free(annotationRows[i]);
+    }
+    if (annotationFile != NULL)
+    {
+        free(annotationLabels);
+    }
+    free(annotationRows);
+    free(annotationKeys);
+    free(pool.data);
+    free(genes);
+    free(line);
+
+    return gi;
+}
+
+void writegeneindex(GENE_INDEX *gi, char *file)
+{
+    FILE *fp = xopen(file, "w");
+
+    if (fwrite(gi->data, 1, gi->size, fp) != gi->size || fclose(fp) != 0)
+    {
+        fatal("Cannot write %s\n", file);
+    }
+}
+
+GENE_INDEX *geneindexopen(char *file)
+{
+    GENE_INDEX *gi;
+    struct stat st;
+    uint32_t magic = 0;
+    int fd;
+
+    if ((fd = open(file, O_RDONLY)) == -1 || fstat(fd, &st) == -1)
+    {
+        fatal("Cannot open %s\n", file);
+    }
+
+    if (st.st_size < (off_t) sizeof(GENE_INDEX_HEADER) ||
+        read(fd, &magic, sizeof(magic)) != sizeof(magic) || magic != GENE_INDEX_MAGIC)
+    {
+        close(fd);
+        return buildgeneindex(file, NULL, "n/a");
+    }
+
+    FRALLOC(gi, 1, GENE_INDEX);
+    gi->file = strdup(file);
+    gi->size = st.st_size;
+    gi->mapped = 1;
+    if ((gi->data = (unsigned char *) mmap(NULL, gi->size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+    {
+        fatal("Cannot map %s\n", file);
+    }
+    close(fd);
+
+    if (((GENE_INDEX_HEADER *) gi->data)->version != GENE_INDEX_VERSION)
+    {
+        fatal("%s is a version %d gene index, version %d expected\n", file,
+              ((GENE_INDEX_HEADER *) gi->data)->version, GENE_INDEX_VERSION);
+    }
+    setpointers(gi);
+
+    return gi;
+}
+
+void geneindexclose(GENE_INDEX *gi)
+{
+    if (gi->mapped)
+    {
+        munmap(gi->data, gi->size);
+    }
+    else
+    {
+        free(gi->data);
+    }
+    free(gi->file);
+    free(gi);
+}
+
+int geneindexfind(GENE_INDEX *gi, char *chromosome)
+{
+    char label[24];
+    uint32_t i;
+
+    genechromosome(chromosome, label, sizeof(label));
+    for (i=0; i<gi->header->chromosomeNo; i++)
+    {
+        if (strcmp(gi->chromosomes[i].chromosome, label) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+static int compareindices(const void *a, const void *b)
+{
+    uint32_t i1 = *(uint32_t *)a;
+    uint32_t i2 = *(uint32_t *)b;
+
+    return i1 < i2 ? -1 : (i1 > i2 ? 1 : 0);
+}
+
+static void addhit(uint32_t **hits, int *cap, int n, uint32_t hit)
+{
+    if (n == *cap)
+    {
+        *cap = *cap ? 2 * *cap : 64;
+        *hits = (uint32_t *) xrealloc(*hits, *cap * sizeof(uint32_t));
+    }
+    (*hits)[n] = hit;
+}
+
+int geneoverlaps(GENE_INDEX *gi, int chromosome, int64_t start, int64_t end, uint32_t **hits, int *cap)
+{
+    struct {int64_t x; int k; int w;} stack[64], z;
+    GENE_CHROMOSOME *c;
+    GENE_RECORD *a;
+    int64_t n, i, i0, i1, y;
+    int t = 0, hitNo = 0;
+
+    if (chromosome < 0 || (c = &gi->chromosomes[chromosome])->geneNo == 0)
+    {
+        return 0;
+    }
+
+    a = gi->genes + c->firstGene;
+    n = c->geneNo;
+
+    /* descend left while a subtree can still reach start, right while starts are before end */
+    stack[t].x = (((int64_t)1) << c->maxLevel) - 1;
+    stack[t].k = c->maxLevel;
+    stack[t++].w = 0;
+    while (t)
+    {
+        z = stack[--t];
+        if (z.k <= 3)
+        {
+            /* small subtrees are scanned */
+            i0 = z.x >> z.k << z.k;
+            i1 = MIN(i0 + (((int64_t)1) << (z.k+1)) - 1, n);
+            for (i=i0; i<i1 && a[i].start<end; i++)
+            {
+                if (start < a[i].end)
+                {
+                    addhit(hits, cap, hitNo++, c->firstGene + i);
+                }
+            }
+        }
+        else if (z.w == 0)
+        {
+            y = z.x - (((int64_t)1) << (z.k-1));
+            stack[t].x = z.x;
+            stack[t].k = z.k;
+            stack[t++].w = 1;
+            if (y >= n || a[y].maxEnd > start)
+            {
+                stack[t].x = y;
+                stack[t].k = z.k - 1;
+                stack[t++].w = 0;
+            }
+        }
+        else if (z.x < n && a[z.x].start < end)
+        {
+            if (start < a[z.x].end)
+            {
+                addhit(hits, cap, hitNo++, c->firstGene + z.x);
+            }
+            stack[t].x = z.x + (((int64_t)1) << (z.k-1));
+            stack[t].k = z.k - 1;
+            stack[t++].w = 0;
+        }
+    }
+
+    qsort(*hits, hitNo, sizeof(uint32_t), compareindices);
+
+    return hitNo;
+}
+
+int geneexonoverlaps(GENE_INDEX *gi, uint32_t gene, int64_t start, int64_t end)
+{
+    GENE_RECORD *g = &gi->genes[gene];
+    int32_t *exon = gi->exons + 2*(size_t)g->firstExon;
+    uint32_t i;
+
+    for (i=0; i<g->exonNo; i++, exon+=2)
+    {
+        if (exon[0] < end && start < exon[1])
+        {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+void genesweepinit(GENE_SWEEP *sw, GENE_INDEX *gi)
+{
+    memset(sw, 0, sizeof(GENE_SWEEP));
+    sw->gi = gi;
+    sw->chromosome = -1;
+}
+
+void genesweepfree(GENE_SWEEP *sw)
+{
+    free(sw->active);
+    sw->active = NULL;
+    sw->activeNo = sw->activeCap = 0;
+}
+
+int genesweep(GENE_SWEEP *sw, int chromosome, int64_t start, int64_t end)
+{
+    GENE_RECORD *genes = sw->gi->genes;
+    GENE_CHROMOSOME *c;
+    uint32_t lo, hi, mid, last;
+    int i, n;
+
+    if (chromosome < 0)
+    {
+        sw->chromosome = -1;
+        sw->activeNo = 0;
+        return 0;
+    }
+
+    c = &sw->gi->chromosomes[chromosome];
+    last = c->firstGene + c->geneNo;
+
+    if (chromosome != sw->chromosome || start < sw->start || end < sw->end)
+    {
+        /* the window moved back, reseed it from the tree */
+        sw->activeNo = geneoverlaps(sw->gi, chromosome, start, end, &sw->active, &sw->activeCap);
+        for (lo=c->firstGene, hi=last; lo<hi; )
+        {
+            mid = lo + (hi - lo)/2;
+            if (genes[mid].start < end)
+            {
+                lo = mid + 1;
+            }
+            else
+            {
+                hi = mid;
+            }
+        }
+        sw->next = lo;
+    }
+    else
+    {
+        for (i=0, n=0; i<sw->activeNo; i++)
+        {
+            if (genes[sw->active[i]].end > start)
+            {
+                sw->active[n++] = sw->active[i];
+            }
+        }
+        sw->activeNo = n;
+
+        for (; sw->next<last && genes[sw->next].start<end; sw->next++)
+        {
+            if (genes[sw->next].end > start)
+            {
+                addhit(&sw->active, &sw->activeCap, sw->activeNo++, sw->next);
+            }
+        }
+    }
+
+    sw->chromosome = chromosome;
+    sw->start = start;
+    sw->end = end;
+
+    return sw->activeNo;
+}
+
+static GENE_QUERY *sortQueries;
+static int *sortChromosomes;
+
+static int comparequeries(const void *a, const void *b)
+{
+    int i1 = *(int *)a;
+    int i2 = *(int *)b;
+
+    if (sortChromosomes[i1] != sortChromosomes[i2])
+    {
+        return sortChromosomes[i1] < sortChromosomes[i2] ? -1 : 1;
+    }
+    if (sortQueries[i1].start != sortQueries[i2].start)
+    {
+        return sortQueries[i1].start < sortQueries[i2].start ? -1 : 1;
+    }
+
+    return i1 - i2;
+}
+
+void geneoverlapsbatch(GENE_INDEX *gi, GENE_QUERY *queries, int queryNo)
+{
+    GENE_SWEEP sw;
+    GENE_QUERY *q;
+    int *order, *chromosomes;
+    int i;
+
+    FRALLOC(order, MAX(queryNo, 1), int);
+    FRALLOC(chromosomes, MAX(queryNo, 1), int);
+    for (i=0; i<queryNo; i++)
+    {
+        order[i] = i;
+        chromosomes[i] = geneindexfind(gi, queries[i].chromosome);
+    }
+    sortQueries = queries;
+    sortChromosomes = chromosomes;
+    qsort(order, queryNo, sizeof(int), comparequeries);
+
+    genesweepinit(&sw, gi);
+    for (i=0; i<queryNo; i++)
+    {
+        q = &queries[order[i]];
+        q->geneNo = genesweep(&sw, chromosomes[order[i]], q->start, q->end);
+        q->genes = NULL;
+        if (q->geneNo)
+        {
+            q->genes = (uint32_t *) xrealloc(NULL, q->geneNo*sizeof(uint32_t));
+            memcpy(q->genes, sw.active, q->geneNo*sizeof(uint32_t));
+        }
+    }
+    genesweepfree(&sw);
+
+    free(order);
+    free(chromosomes);
+}
@@ -0,0 +1,121 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#define GENE_INDEX_MAGIC   0x58444947
+#define GENE_INDEX_VERSION 1
+
+/*
+ * A gene index file is the in-memory image below written out as is, so it
+ * is mapped rather than read:
+ *
+ *   GENE_INDEX_HEADER
+ *   GENE_CHROMOSOME[chromosomeNo]
+ *   GENE_RECORD[geneNo]        sorted by chromosome then start
+ *   int32_t[2*exonNo]          exon start, end pairs
+ *   char[stringBytes]          names and annotations, offset 0 is ""
+ *
+ * Within a chromosome the genes form an implicit interval tree: the gene
+ * at index i sits at level (number of trailing 1 bits of i) and maxEnd
+ * holds the largest end in its subtree, so overlap queries need no other
+ * structure.  Coordinates are 0-based half-open as in the UCSC tables.
+ */
+typedef struct
+{
+    uint32_t magic;
+    uint32_t version;
+    char build[16];
+    uint32_t chromosomeNo;
+    uint32_t geneNo;
+    uint32_t exonNo;
+    uint32_t stringBytes;
+    uint32_t annotationLabels;
+    uint32_t annotationNo;
+} GENE_INDEX_HEADER;
+
+typedef struct
+{
+    char chromosome[24];
+    uint32_t firstGene;
+    uint32_t geneNo;
+    int32_t maxLevel;
+    uint32_t reserved;
+} GENE_CHROMOSOME;
+
+typedef struct
+{
+    int32_t start;
+    int32_t end;
+    int32_t maxEnd;
+    int32_t cdsStart;
+    int32_t cdsEnd;
+    uint32_t name;
+    uint32_t annotation;
+    uint32_t firstExon;
+    uint32_t exonNo;
+    char strand;
+    char reserved[3];
+} GENE_RECORD;
+
+typedef struct
+{
+    char *file;
+    unsigned char *data;
+    size_t size;
+    int mapped;
+    GENE_INDEX_HEADER *header;
+    GENE_CHROMOSOME *chromosomes;
+    GENE_RECORD *genes;
+    int32_t *exons;
+    char *strings;
+} GENE_INDEX;
+
+/*
+ * keeps the genes overlapping a window that moves along a chromosome,
+ * active holds their indices in start order
+ */
+typedef struct
+{
+    GENE_INDEX *gi;
+    int chromosome;
+    int64_t start;
+    int64_t end;
+    uint32_t next;
+    uint32_t *active;
+    int activeNo;
+    int activeCap;
+} GENE_SWEEP;
+
+typedef struct
+{
+    char *chromosome;
+    int64_t start;
+    int64_t end;
+    uint32_t *genes;
+    int geneNo;
+} GENE_QUERY;
+
+/*
+ * builds an index from a UCSC knownGene or refGene dump, with the optional
+ * tab separated annotation file keyed by gene name in its first column
+ */
+GENE_INDEX *buildgeneindex(char *ucscFile, char *annotationFile, char *build) ;
+void writegeneindex(GENE_INDEX *gi, char *file) ;
+
+/* maps an index file, or builds one in memory if given a UCSC dump */
+GENE_INDEX *geneindexopen(char *file) ;
+void geneindexclose(GENE_INDEX *gi) ;
+int geneindexfind(GENE_INDEX *gi, char *chromosome) ;
+
+/* the fraTools label of a UCSC, VCF or mk chromosome */
+void genechromosome(char *chromosome, char *label, size_t size) ;
+
+/* genes of a chromosome overlapping 0-based [start, end), returns the count, hits in start order */
+int geneoverlaps(GENE_INDEX *gi, int chromosome, int64_t start, int64_t end, uint32_t **hits, int *cap) ;
+int geneexonoverlaps(GENE_INDEX *gi, uint32_t gene, int64_t start, int64_t end) ;
+
+void genesweepinit(GENE_SWEEP *sw, GENE_INDEX *gi) ;
+void genesweepfree(GENE_SWEEP *sw) ;
+int genesweep(GENE_SWEEP *sw, int chromosome, int64_t start, int64_t end) ;
+
+/* answers the queries in (chromosome, start) order with one sweep */
+void geneoverlapsbatch(GENE_INDEX *gi, GENE_QUERY *queries, int queryNo) ;
@@ -0,0 +1,307 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "filesubs.h"
+#include "gtsubs.h"
+
+#define GT_BUFFER 1048576
+
+/* genotype codes 0, 1, 2 are calls, anything else is missing */
+int parsegenotype(char *s)
+{
+    if (s[0] >= '0' && s[0] <= '2' && (s[1] == '\0' || s[1] == '\t'))
+    {
+        return s[0] - '0';
+    }
+
+    return -1;
+}
+
+static char *readheader(char *file)
+{
+    FILE *fp;
+    char *line = NULL;
+    size_t cap = 0;
+
+    fp = xopen(file, "r");
+    if (readline(fp, &line, &cap) == -1)
+    {
+        free(line);
+        line = NULL;
+    }
+    fclose(fp);
+
+    return line;
+}
+
+int isgt(char *file)
+{
+    char *line;
+    int result;
+
+    if (!hasextension(file, "gt") || (line = readheader(file)) == NULL)
+    {
+        return 0;
+    }
+
+    result = strncmp(line, "sample-id", 9) == 0 && (line[9] == '\t' || line[9] == '\0');
+    free(line);
+
+    return result;
+}
+
+int istg(char *file)
+{
+    char *line;
+    int result;
+
+    if (!hasextension(file, "tg") || (line = readheader(file)) == NULL)
+    {
+        return 0;
+    }
+
+    result = (strncmp(line, "snp-id", 6) == 0 || strncmp(line, "marker-id", 9) == 0);
+    free(line);
+
+    return result;
+}
+
+void setgenotype(GENOTYPES *gt, int sample, int snp, int genotype)
+{
+    int word = snp >> 6;
+    uint64_t bit = 1ULL << (snp & 63);
+
+    GENO_P(gt, sample, word) &= ~bit;
+    GENO_Q(gt, sample, word) &= ~bit;
+
+    switch (genotype)
+    {
+        case 0:
+            break;
+        case 1:
+            GENO_P(gt, sample, word) |= bit;
+            break;
+        case 2:
+            GENO_P(gt, sample, word) |= bit;
+            GENO_Q(gt, sample, word) |= bit;
+            break;
+        default:
+            GENO_Q(gt, sample, word) |= bit;
+    }
+}
+
+int getgenotype(GENOTYPES *gt, int sample, int snp)
+{
+    int word = snp >> 6;
+    int shift = snp & 63;
+    int p = (GENO_P(gt, sample, word) >> shift) & 1;
+    int q = (GENO_Q(gt, sample, word) >> shift) & 1;
+
+    return p ? 1 + q : (q ? -1 : 0);
+}
+
+/* sets every genotype, including the padding, to missing */
+static void clearsamples(GENOTYPES *gt, int from, int to)
+{
+    size_t i;
+
+    for (i=((size_t)from)*gt->wordNo*2; i<((size_t)to)*gt->wordNo*2; i+=2)
+    {
+        gt->geno[i] = 0;
+        gt->geno[i+1] = ~0ULL;
+    }
+}
+
+static int countlines(char *file)
+{
+    FILE *fp;
+    char *buffer;
+    size_t n, i;
+    int lineNo = 0;
+    char last = '\n';
+
+    FRALLOC(buffer, GT_BUFFER, char);
+    fp = xopen(file, "r");
+    while ((n = fread(buffer, 1, GT_BUFFER, fp)) > 0)
+    {
+        for (i=0; i<n; i++)
+        {
+            lineNo += buffer[i] == '\n';
+        }
+        last = buffer[n-1];
+    }
+    fclose(fp);
+    free(buffer);
+
+    return lineNo + (last != '\n');
+}
+
+GENOTYPES *readgenotypes(char *file)
+{
+    GENOTYPES *gt;
+    FILE *fp;
+    char *line = NULL, *s, *t;
+    size_t cap = 0;
+    long len;
+    int tgFile = 0, i, n, sampleCap = 0;
+
+    if (istg(file))
+    {
+        tgFile = 1;
+    }
+    else if (isgt(file))
+    {
+        tgFile = 0;
+    }
+    else
+    {
+        fatal("%s not a tgFile or gtFile\n", file);
+    }
+
+    FRALLOC(gt, 1, GENOTYPES);
+    fp = xopen(file, "r");
+    if ((len = readline(fp, &line, &cap)) == -1)
+    {
+        fatal("%s is empty\n", file);
+    }
+
+    /* header gives the column elements */
+    n = countfields(line, '\t') - 1;
+    if (tgFile)
+    {
+        gt->sampleNo = n;
+        gt->snpNo = countlines(file) - 1;
+        FRALLOC(gt->sampleIDs, MAX(n, 1), char *);
+        FRALLOC(gt->snpIDs, MAX(gt->snpNo, 1), char *);
+    }
+    else
+    {
+        gt->snpNo = n;
+        FRALLOC(gt->snpIDs, MAX(n, 1), char *);
+    }
+
+    s = strchr(line, '\t');
+    for (i=0; i<n; i++)
+    {
+        t = strchr(++s, '\t');
+        if (t != NULL)
+        {
+            *t = '\0';
+        }
+        if (tgFile)
+        {
+            gt->sampleIDs[i] = strdup(s);
+        }
+        else
+        {
+            gt->snpIDs[i] = strdup(s);
+        }
+        s = t;
+    }
+
+    gt->wordNo = (gt->snpNo + 63) / 64;
+    if (tgFile)
+    {
+        FRALLOC(gt->geno, ((size_t)gt->sampleNo)*gt->wordNo*2 + 2, uint64_t);
+        clearsamples(gt, 0, gt->sampleNo);
+    }
+
+    n = 0;
+    while ((len = readline(fp, &line, &cap)) != -1)
+    {
+        if (len == 0)
+        {
+            continue;
+        }
+
+        if (tgFile)
+        {
+            if (n >= gt->snpNo)
+            {
+                fatal("%s changed while being read\n", file);
+            }
+
+            if ((s = strchr(line, '\t')) == NULL)
+            {
+                fatal("%s: row %d has no genotypes\n", file, n+2);
+            }
+            *s = '\0';
+            gt->snpIDs[n] = strdup(line);
+
+            for (i=0; i<gt->sampleNo; i++)
+            {
+                if (s == NULL)
+                {
+                    fatal("%s: row %d has too few columns\n", file, n+2);
+                }
+                setgenotype(gt, i, n, parsegenotype(++s));
+                s = strchr(s, '\t');
+            }
+        }
+        else
+        {
+            if (n == sampleCap)
+            {
+                sampleCap = sampleCap ? 2*sampleCap : 256;
+                gt->sampleIDs = (char **) xrealloc(gt->sampleIDs, sampleCap*sizeof(char *));
+                gt->geno = (uint64_t *) xrealloc(gt->geno, (((size_t)sampleCap)*gt->wordNo*2 + 2)*sizeof(uint64_t));
+            }
+            gt->sampleNo = n + 1;
+            clearsamples(gt, n, n+1);
+
+            if ((s = strchr(line, '\t')) != NULL)
+            {
+                *s = '\0';
+            }
+            gt->sampleIDs[n] = strdup(line);
+
+            for (i=0; i<gt->snpNo; i++)
+            {
+                if (s == NULL)
+                {
+                    fatal("%s: row %d has too few columns\n", file, n+2);
+                }
+                setgenotype(gt, n, i, parsegenotype(++s));
+                s = strchr(s, '\t');
+            }
+        }
+
+        ++n;
+    }
+
+    if (tgFile)
+    {
+        gt->snpNo = n;
+    }
+    else
+    {
+        gt->sampleNo = n;
+    }
+
+    free(line);
+    if (fp != stdin)
+    {
+        fclose(fp);
+    }
+
+    return gt;
+}
+
+void freegenotypes(GENOTYPES *gt)
+{
+    int i;
+
+    for (i=0; i<gt->sampleNo; i++)
+    {
+        free(gt->sampleIDs[i]);
+    }
+    for (i=0; i<gt->snpNo; i++)
+    {
+        free(gt->snpIDs[i]);
+    }
+    free(gt->sampleIDs);
+    free(gt->snpIDs);
+    free(gt->geno);
+    free(gt);
+}
@@ -0,0 +1,31 @@
+#include <stdint.h>
+
+/*
+ * 2-bit packed genotypes, sample-major, 64 SNPs per word pair.
+ * Each genotype is encoded in the bit planes (p,q) as
+ *
+ *   0 -> (0,0)    1 -> (1,0)    2 -> (1,1)    -1 -> (0,1)
+ *
+ * so that p marks carriers of allele B, p&q marks homozygotes BB and
+ * ~p&q marks missing genotypes.  Padding bits are stored as missing.
+ */
+typedef struct
+{
+    int sampleNo;
+    int snpNo;
+    int wordNo;
+    char **sampleIDs;
+    char **snpIDs;
+    uint64_t *geno;
+} GENOTYPES;
+
+#define GENO_P(gt,sample,word) ((gt)->geno[(((size_t)(sample))*(gt)->wordNo+(word))*2])
+#define GENO_Q(gt,sample,word) ((gt)->geno[(((size_t)(sample))*(gt)->wordNo+(word))*2+1])
+
+int parsegenotype(char *s) ;
+int isgt(char *file) ;
+int istg(char *file) ;
+GENOTYPES *readgenotypes(char *file) ;
+void freegenotypes(GENOTYPES *gt) ;
+void setgenotype(GENOTYPES *gt, int sample, int snp, int genotype) ;
+int getgenotype(GENOTYPES *gt, int sample, int snp) ;
@@ -0,0 +1,128 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "filesubs.h"
+#include "keytable.h"
+
+void bufferappend(BUFFER *b, char *s, size_t n)
+{
+    /* one byte is kept free for a terminator */
+    if (b->size + n + 1 > b->cap)
+    {
+        b->cap = MAX(2*b->cap, b->size + n + 1);
+        b->data = (char *) xrealloc(b->data, b->cap);
+    }
+    memcpy(b->data + b->size, s, n);
+    b->size += n;
+}
+
+void bufferappendchar(BUFFER *b, char c)
+{
+    bufferappend(b, &c, 1);
+}
+
+/* FNV-1a with a murmur finalizer, the table uses the low bits */
+uint64_t hashbytes(char *s, size_t n)
+{
+    uint64_t h = 14695981039346656037ULL;
+    size_t i;
+
+    for (i=0; i<n; i++)
+    {
+        h ^= (unsigned char) s[i];
+        h *= 1099511628211ULL;
+    }
+
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+
+    return h;
+}
+
+long keytablefind(KEY_TABLE *t, char *key, uint32_t n, uint64_t h)
+{
+    uint32_t slot;
+    KEY_ENTRY *e;
+
+    if (t->slots == NULL)
+    {
+        return -1;
+    }
+
+    for (slot=h & t->slotMask; t->slots[slot]; slot=(slot+1) & t->slotMask)
+    {
+        e = &t->entries[t->slots[slot] - 1];
+        if (e->hash == h && e->keyLength == n && memcmp(t->keys.data + e->key, key, n) == 0)
+        {
+            return t->slots[slot] - 1;
+        }
+    }
+
+    return -1;
+}
+
+uint32_t keytableadd(KEY_TABLE *t, char *key, uint32_t n, uint64_t h)
+{
+    uint32_t i, slot, slotNo;
+    KEY_ENTRY *e;
+
+    if (2*(t->n + 1) > (t->slots == NULL ? 0 : t->slotMask + 1))
+    {
+        slotNo = t->slots == NULL ? 1024 : 2*(t->slotMask + 1);
+        free(t->slots);
+        FRALLOC(t->slots, slotNo, uint32_t);
+        t->slotMask = slotNo - 1;
+        for (i=0; i<t->n; i++)
+        {
+            for (slot=t->entries[i].hash & t->slotMask; t->slots[slot]; slot=(slot+1) & t->slotMask);
+            t->slots[slot] = i + 1;
+        }
+    }
+
+    if (t->n == t->cap)
+    {
+        t->cap = t->cap ? 2*t->cap : 1024;
+        t->entries = (KEY_ENTRY *) xrealloc(t->entries, t->cap*sizeof(KEY_ENTRY));
+    }
+
+    /* keys are stored \0 terminated */
+    e = &t->entries[t->n];
+    e->hash = h;
+    e->key = t->keys.size;
+    e->keyLength = n;
+    bufferappend(&t->keys, key, n);
+    bufferappendchar(&t->keys, '\0');
+
+    for (slot=h & t->slotMask; t->slots[slot]; slot=(slot+1) & t->slotMask);
+    t->slots[slot] = ++t->n;
+
+    return t->n - 1;
+}
+
+uint32_t keytableget(KEY_TABLE *t, char *key, uint32_t n)
+{
+    uint64_t h = hashbytes(key, n);
+    long i;
+
+    if ((i = keytablefind(t, key, n, h)) == -1)
+    {
+        i = keytableadd(t, key, n, h);
+    }
+
+    return i;
+}
+
+char *keytablekey(KEY_TABLE *t, uint32_t i)
+{
+    return t->keys.data + t->entries[i].key;
+}
+
+void keytablefree(KEY_TABLE *t)
+{
+    free(t->keys.data);
+    free(t->entries);
+    free(t->slots);
+    memset(t, 0, sizeof(KEY_TABLE));
+}
@@ -0,0 +1,49 @@
+#include <stdint.h>
+#include <stddef.h>
+
+/* a growable byte buffer */
+typedef struct
+{
+    char *data;
+    size_t size;
+    size_t cap;
+} BUFFER;
+
+void bufferappend(BUFFER *b, char *s, size_t n) ;
+void bufferappendchar(BUFFER *b, char c) ;
+
+typedef struct
+{
+    uint64_t hash;
+    size_t key;
+    uint32_t keyLength;
+} KEY_ENTRY;
+
+/*
+ * a set of byte string keys numbered in the order they are added, callers
+ * keep their values in arrays indexed by that number.  Open addressing on
+ * a table kept at most half full.
+ */
+typedef struct
+{
+    BUFFER keys;
+    KEY_ENTRY *entries;
+    uint32_t n;
+    uint32_t cap;
+    uint32_t *slots;
+    uint32_t slotMask;
+} KEY_TABLE;
+
+uint64_t hashbytes(char *s, size_t n) ;
+
+/* the number of the key, -1 if it is not in the table */
+long keytablefind(KEY_TABLE *t, char *key, uint32_t n, uint64_t h) ;
+
+/* adds a key that is not in the table and returns its number */
+uint32_t keytableadd(KEY_TABLE *t, char *key, uint32_t n, uint64_t h) ;
+
+/* the number of the key, added if it is not in the table */
+uint32_t keytableget(KEY_TABLE *t, char *key, uint32_t n) ;
+
+char *keytablekey(KEY_TABLE *t, uint32_t i) ;
+void keytablefree(KEY_TABLE *t) ;
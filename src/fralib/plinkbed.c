@@ -0,0 +1,153 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include "plinkbed.h"
+
+/* 16 byte lanes, SSSE3/NEON shuffles */
+typedef unsigned char v16u8 __attribute__ ((vector_size (16)));
+typedef uint32_t v4u32 __attribute__ ((vector_size (16)));
+typedef uint64_t v2u64 __attribute__ ((vector_size (16)));
+
+#define EVEN_M1 0x5555555555555555ULL
+
+unsigned char bedMagic[BED_MAGIC_SIZE] = {0x6c, 0x1b, 0x01};
+
+static const v16u8 evenBytes = {0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30};
+static const v16u8 oddBytes = {1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31};
+static const v16u8 codeTable = {BED_HOM_A1, BED_HET, BED_HOM_A2, BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING,
+                                BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING, BED_MISSING};
+static const v16u8 lowBytes = {0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12};
+
+static inline int allset(v16u8 mask)
+{
+    v2u64 m = (v2u64) mask;
+
+    return (m[0] & m[1]) == ~0ULL;
+}
+
+char *decodebedcodes(char *s, char *end, int n, unsigned char *codes)
+{
+    v16u8 a, b, g, t;
+    int i = 0;
+
+    /* 16 single character genotypes at a time, the genotypes gathered by a shuffle */
+    while (n - i >= 16 && s + 32 <= end)
+    {
+        memcpy(&a, s, 16);
+        memcpy(&b, s + 16, 16);
+        g = __builtin_shuffle(a, b, evenBytes) - '0';
+        t = __builtin_shuffle(a, b, oddBytes);
+        if (!allset((v16u8) (t == '\t') & (v16u8) (g <= 2)))
+        {
+            break;
+        }
+
+        g = __builtin_shuffle(codeTable, g);
+        memcpy(codes + i, &g, 16);
+        i += 16;
+        s += 32;
+    }
+
+    for (; i<n; i++)
+    {
+        if (s >= end || *s == '\n' || *s == '\r')
+        {
+            return NULL;
+        }
+
+        if (s[0] >= '0' && s[0] <= '2' && (s + 1 == end || s[1] == '\t' || s[1] == '\n' || s[1] == '\r'))
+        {
+            codes[i] = codeTable[s[0] - '0'];
+            ++s;
+        }
+        else
+        {
+            codes[i] = BED_MISSING;
+            while (s < end && *s != '\t' && *s != '\n' && *s != '\r')
+            {
+                ++s;
+            }
+        }
+
+        if (i < n-1)
+        {
+            if (s >= end || *s != '\t')
+            {
+                return NULL;
+            }
+            ++s;
+        }
+    }
+
+    return s;
+}
+
+void packbedcodes(unsigned char *codes, int n, unsigned char *record)
+{
+    v4u32 x;
+    v16u8 y;
+    int i, j;
+
+    /* the 4 codes of each 32 bit lane are folded into its low byte */
+    for (i=0; i+16<=n; i+=16)
+    {
+        memcpy(&x, codes + i, 16);
+        x |= x >> 6;
+        x |= x >> 12;
+        y = __builtin_shuffle((v16u8) x, lowBytes);
+        memcpy(record + i/4, &y, 4);
+    }
+
+    for (; i<n; i+=4)
+    {
+        record[i/4] = 0;
+        for (j=0; j<4 && i+j<n; j++)
+        {
+            record[i/4] |= codes[i+j] << (2*j);
+        }
+    }
+}
+
+void swapbedalleles(unsigned char *record, int sampleNo)
+{
+    int size = BED_RECORD_SIZE(sampleNo), i;
+    uint64_t w, same;
+
+    /* 00 and 11 exchange, the codes whose bits are equal */
+    for (i=0; i<size; i+=8)
+    {
+        w = 0;
+        memcpy(&w, record + i, size - i < 8 ? size - i : 8);
+        same = ~((w >> 1) ^ w) & EVEN_M1;
+        w ^= same | (same << 1);
+        memcpy(record + i, &w, size - i < 8 ? size - i : 8);
+    }
+
+    if (sampleNo % 4)
+    {
+        record[size-1] &= (1 << (2*(sampleNo % 4))) - 1;
+    }
+}
+
+void countbedalleles(unsigned char *record, int sampleNo, long *a1, long *a2)
+{
+    int size = BED_RECORD_SIZE(sampleNo), i;
+    long homA2 = 0, het = 0, missing = 0;
+    uint64_t w, hi, lo;
+
+    for (i=0; i<size; i+=8)
+    {
+        w = 0;
+        memcpy(&w, record + i, size - i < 8 ? size - i : 8);
+        hi = (w >> 1) & EVEN_M1;
+        lo = w & EVEN_M1;
+        homA2 += __builtin_popcountll(hi & lo);
+        het += __builtin_popcountll(hi & ~lo);
+        missing += __builtin_popcountll(~hi & lo);
+    }
+
+    /* the padding reads as A1 homozygotes */
+    *a1 = 2*(sampleNo - homA2 - het - missing) + het;
+    *a2 = 2*homA2 + het;
+}
@@ -0,0 +1,30 @@
+#include <stdint.h>
+
+/*
+ * PLINK .bed genotype codes, 2 bits per sample, 4 samples to a byte with
+ * the first sample in the low bits.  Records are SNP-major and padded to
+ * whole bytes with 00.
+ */
+#define BED_HOM_A1  0
+#define BED_MISSING 1
+#define BED_HET     2
+#define BED_HOM_A2  3
+
+#define BED_MAGIC_SIZE 3
+extern unsigned char bedMagic[BED_MAGIC_SIZE];
+
+#define BED_RECORD_SIZE(sampleNo) (((sampleNo) + 3) / 4)
+
+/*
+ * decodes n tab separated genotypes starting at s into codes, 0/1/2 copies
+ * of allele B become A1 = allele A codes and anything else is missing.
+ * Returns the terminator of the last genotype, NULL if the row ends early.
+ */
+char *decodebedcodes(char *s, char *end, int n, unsigned char *codes) ;
+
+void packbedcodes(unsigned char *codes, int n, unsigned char *record) ;
+
+/* exchanges A1 and A2 in a record, the padding stays 00 */
+void swapbedalleles(unsigned char *record, int sampleNo) ;
+
+void countbedalleles(unsigned char *record, int sampleNo, long *a1, long *a2) ;
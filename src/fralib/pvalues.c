@@ -0,0 +1,460 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "filesubs.h"
+#include "pvalues.h"
+
+/* 16 byte lanes, SSE2/NEON registers */
+typedef double v2df __attribute__ ((vector_size (16)));
+typedef int64_t v2di __attribute__ ((vector_size (16)));
+
+#define LANES 2
+
+#define LN2_HI   6.93147180369123816490e-01
+#define LN2_LO   1.90821492927058770002e-10
+#define LOG2E    1.44269504088896338700e+00
+#define LOG10E   4.34294481903251827651e-01
+#define SQRT1_2  7.07106781186547524401e-01
+#define SQRT2    1.41421356237309504880e+00
+#define ROUNDER  6755399441055744.0
+
+/* the chi square series are evaluated in lanes up to this many terms, df 2*CHISQ_MAX_TERMS */
+#define CHISQ_MAX_TERMS 100
+
+/* beyond this half chi square exp(-y) is near underflow and the series is summed from its last term */
+#define CHISQ_LARGE 690.0
+
+/*
+ * Chebyshev coefficients of erfcx(x)/t in y = 2t-1, t = 2/(2+x), which is
+ * smooth on [0, inf].  Computed in long double from erfcl at 80 nodes, the
+ * terms beyond these are below 1e-18.
+ */
+static const double erfcxCoefficients[] =
+{
+    1.15406747723293938e+00, 3.55436921270498487e-01, 6.50951588287865244e-02,
+    3.67114239583663924e-03, -1.11284474335263251e-03, -1.60758299153780924e-04,
+    3.27803157417315476e-05, 5.44244164550481939e-06, -1.51546655531698926e-06,
+    -1.42976081811731768e-07, 8.23460882742582786e-08, -1.29628468534753001e-09,
+    -4.15472163090311935e-09, 6.34705827746138724e-10, 1.43208227158228346e-10,
+    -6.16039009321484640e-11, 2.06121359943352983e-12, 3.57149356543609055e-12,
+    -8.58642640360262818e-13, -6.14557734671290767e-14, 7.41870195104191860e-14,
+    -1.28950669586735955e-14, -2.35864930017704033e-15, 1.57248549576514962e-15,
+    -2.27311794604237449e-16, -6.35948948666739677e-17, 3.63675289969528359e-17,
+    -5.11574018823707233e-18
+};
+
+#define ERFCX_TERMS (sizeof(erfcxCoefficients) / sizeof(double))
+
+/*
+ * Q(df/2, y) = exp(-y) (E + C y^h sum_{k<m} y^k / ((1+h)...(k+h))) with
+ * h = 0 for even df and 1/2 for odd df, when E is erfcx(sqrt(y))
+ */
+typedef struct
+{
+    int m;
+    int odd;
+    double h;
+    double C;
+    double logC;
+    double logProduct;
+    double inverses[CHISQ_MAX_TERMS];
+} CHISQ_SERIES;
+
+#define VCONST(c) ((v2df) {(c), (c)})
+
+static inline int vany(v2di mask)
+{
+    return (mask[0] | mask[1]) != 0;
+}
+
+static inline v2df vselect(v2di mask, v2df a, v2df b)
+{
+    return (v2df) (((v2di) a & mask) | ((v2di) b & ~mask));
+}
+
+static inline v2df vexp(v2df x)
+{
+    v2df t, k, r, p;
+    v2di ki, k1, k2;
+
+    x = vselect(x < -746.0, VCONST(-746.0), x);
+    x = vselect(x > 709.78, VCONST(709.78), x);
+
+    /* x = k ln2 + r, k rounded by the magic constant */
+    t = x*LOG2E + ROUNDER;
+    k = t - ROUNDER;
+    ki = (v2di) t - (v2di) VCONST(ROUNDER);
+    r = x - k*LN2_HI - k*LN2_LO;
+
+    p = VCONST(1.0/6227020800.0);
+    p = 1.0/479001600.0 + r*p;
+    p = 1.0/39916800.0 + r*p;
+    p = 1.0/3628800.0 + r*p;
+    p = 1.0/362880.0 + r*p;
+    p = 1.0/40320.0 + r*p;
+    p = 1.0/5040.0 + r*p;
+    p = 1.0/720.0 + r*p;
+    p = 1.0/120.0 + r*p;
+    p = 1.0/24.0 + r*p;
+    p = 1.0/6.0 + r*p;
+    p = 0.5 + r*p;
+    p = 1.0 + r*p;
+    p = 1.0 + r*p;
+
+    /* 2^k in 2 factors, each stays normal down to the subnormals */
+    k1 = ki >> 1;
+    k2 = ki - k1;
+
+    return p * (v2df) ((k1 + 1023) << 52) * (v2df) ((k2 + 1023) << 52);
+}
+
+static inline v2df vlog(v2df x)
+{
+    v2df m, f, f2, s, e, scale;
+    v2di bits, tiny, big;
+
+    /* subnormals are scaled up by 2^100 */
+    tiny = x < 0x1p-1000;
+    scale = vselect(tiny, VCONST(100.0), VCONST(0));
+    x = vselect(tiny, x*0x1p100, x);
+
+    bits = (v2di) x;
+    m = (v2df) ((bits & 0x000fffffffffffffLL) | 0x3ff0000000000000LL);
+    big = m > SQRT2;
+    m = vselect(big, m*0.5, m);
+    e = __builtin_convertvector(((bits >> 52) & 0x7ff) - 1023 - big, v2df) - scale;
+
+    /* log m = 2 atanh((m-1)/(m+1)), |f| < 0.172 */
+    f = (m - 1.0) / (m + 1.0);
+    f2 = f*f;
+    s = VCONST(1.0/21.0);
+    s = 1.0/19.0 + f2*s;
+    s = 1.0/17.0 + f2*s;
+    s = 1.0/15.0 + f2*s;
+    s = 1.0/13.0 + f2*s;
+    s = 1.0/11.0 + f2*s;
+    s = 1.0/9.0 + f2*s;
+    s = 1.0/7.0 + f2*s;
+    s = 1.0/5.0 + f2*s;
+    s = 1.0/3.0 + f2*s;
+
+    s = e*LN2_HI + (e*LN2_LO + 2.0*f + 2.0*f*f2*s);
+
+    return vselect(x == 0, VCONST(-INFINITY), s);
+}
+
+static inline v2df vsqrt(v2df x)
+{
+    int i;
+
+    for (i=0; i<LANES; i++)
+    {
+        x[i] = sqrt(x[i]);
+    }
+
+    return x;
+}
+
+/* exp(x^2) erfc(x) for x >= 0 by the Clenshaw recurrence */
+static inline v2df verfcx(v2df x)
+{
+    v2df t, y, b0, b1, b2;
+    int k;
+
+    t = 2.0 / (2.0 + x);
+    y = 2.0*t - 1.0;
+    b1 = b2 = VCONST(0);
+    for (k=ERFCX_TERMS-1; k>=1; k--)
+    {
+        b0 = erfcxCoefficients[k] + 2.0*y*b1 - b2;
+        b2 = b1;
+        b1 = b0;
+    }
+
+    return t * (0.5*erfcxCoefficients[0] + y*b1 - b2);
+}
+
+static inline v2df vnormaltail(v2df z, void *arguments)
+{
+    v2df a, q;
+
+    a = (v2df) ((v2di) z & 0x7fffffffffffffffLL);
+    q = 0.5 * vexp(-0.5*a*a) * verfcx(a*SQRT1_2);
+
+    return vselect(z < 0, 1.0 - q, q);
+}
+
+static inline v2df vnormallog10tail(v2df z, void *arguments)
+{
+    v2df a, ex, q;
+    v2di negative = z < 0;
+
+    a = (v2df) ((v2di) z & 0x7fffffffffffffffLL);
+    ex = verfcx(a*SQRT1_2);
+    q = -0.5*a*a + vlog(0.5*ex);
+    if (vany(negative))
+    {
+        q = vselect(negative, vlog(1.0 - 0.5*vexp(-0.5*a*a)*ex), q);
+    }
+
+    return q * LOG10E;
+}
+
+/* the series summed from its first term, the sum stays below exp(y) */
+static inline v2df vseriesfirst(v2df y, CHISQ_SERIES *c)
+{
+    v2df s = VCONST(1.0);
+    int k;
+
+    for (k=c->m-1; k>=1; k--)
+    {
+        s = 1.0 + y*c->inverses[k]*s;
+    }
+
+    return s;
+}
+
+/* the series summed from its last term, for large y where exp(-y) underflows */
+static inline v2df vserieslast(v2df y, CHISQ_SERIES *c)
+{
+    v2df r = 1.0 / y, s = VCONST(1.0);
+    int k;
+
+    for (k=1; k<c->m; k++)
+    {
+        s = 1.0 + (k + c->h)*r*s;
+    }
+
+    return s;
+}
+
+/* log of the last term C y^(m-1+h) / ((1+h)...(m-1+h)) */
+static inline v2df vloglastterm(v2df y, CHISQ_SERIES *c)
+{
+    return c->logC + (c->m - 1 + c->h)*vlog(y) - c->logProduct;
+}
+
+static inline v2df vchisqtail(v2df x, void *arguments)
+{
+    CHISQ_SERIES *c = (CHISQ_SERIES *) arguments;
+    v2df y, root, e, ey, first, last, p;
+    v2di large;
+
+    y = 0.5*x;
+    root = e = first = last = VCONST(0);
+    if (c->odd)
+    {
+        root = vsqrt(y);
+        e = verfcx(root);
+    }
+    ey = vexp(-y);
+
+    if (c->m == 0)
+    {
+        p = ey * e;
+    }
+    else
+    {
+        large = y > CHISQ_LARGE;
+        if (vany(~large))
+        {
+            first = ey * (e + c->C * (c->odd ? root : VCONST(1.0)) * vseriesfirst(y, c));
+        }
+        if (vany(large))
+        {
+            last = ey*e + vexp(vloglastterm(y, c) - y) * vserieslast(y, c);
+        }
+        p = vselect(large, last, first);
+    }
+
+    p = vselect(x <= 0, VCONST(1.0), p);
+
+    return vselect(x == INFINITY, VCONST(0), p);
+}
+
+static inline v2df vchisqlog10tail(v2df x, void *arguments)
+{
+    CHISQ_SERIES *c = (CHISQ_SERIES *) arguments;
+    v2df y, root, e, l, first, last, q;
+    v2di large;
+
+    y = 0.5*x;
+    root = e = first = last = VCONST(0);
+    if (c->odd)
+    {
+        root = vsqrt(y);
+        e = verfcx(root);
+    }
+
+    if (c->m == 0)
+    {
+        q = -y + vlog(e);
+    }
+    else
+    {
+        large = y > CHISQ_LARGE;
+        if (vany(~large))
+        {
+            first = -y + vlog(e + c->C * (c->odd ? root : VCONST(1.0)) * vseriesfirst(y, c));
+        }
+        if (vany(large))
+        {
+            l = vloglastterm(y, c);
+            last = -y + l + vlog(c->odd ? vserieslast(y, c) + e*vexp(-l) : vserieslast(y, c));
+        }
+        q = vselect(large, last, first);
+    }
+
+    q = vselect(x <= 0, VCONST(0), q);
+
+    return vselect(x == INFINITY, VCONST(-INFINITY), q) * LOG10E;
+}
+
+/* applies f to 2 statistics at a time, the last ones padded, f is inlined */
+static inline void batch(double *in, size_t n, double *out, v2df (*f)(v2df, void *), void *arguments)
+{
+    v2df v;
+    size_t i;
+
+    for (i=0; i+LANES<=n; i+=LANES)
+    {
+        memcpy(&v, in + i, sizeof(v2df));
+        v = f(v, arguments);
+        memcpy(out + i, &v, sizeof(v2df));
+    }
+
+    if (i < n)
+    {
+        v = VCONST(0);
+        memcpy(&v, in + i, (n - i)*sizeof(double));
+        v = f(v, arguments);
+        memcpy(out + i, &v, (n - i)*sizeof(double));
+    }
+}
+
+static void chisqseries(int df, CHISQ_SERIES *c)
+{
+    int k;
+
+    c->odd = df % 2;
+    c->m = df / 2;
+    c->h = c->odd ? 0.5 : 0;
+    c->C = c->odd ? 2.0 / sqrt(M_PI) : 1.0;
+    c->logC = log(c->C);
+    c->logProduct = 0;
+    for (k=1; k<c->m; k++)
+    {
+        c->inverses[k] = 1.0 / (k + c->h);
+        c->logProduct += log(k + c->h);
+    }
+}
+
+void normaltails(double *z, size_t n, double *p)
+{
+    batch(z, n, p, vnormaltail, NULL);
+}
+
+void normallog10tails(double *z, size_t n, double *lp)
+{
+    batch(z, n, lp, vnormallog10tail, NULL);
+}
+
+void chisqtails(int df, double *x, size_t n, double *p)
+{
+    CHISQ_SERIES c;
+    size_t i;
+
+    if (df < 1)
+    {
+        fatal("chisqtails: %d degrees of freedom\n", df);
+    }
+
+    if (df > 2*CHISQ_MAX_TERMS)
+    {
+        for (i=0; i<n; i++)
+        {
+            p[i] = exp(chisqlogtail(df, x[i]));
+        }
+        return;
+    }
+
+    chisqseries(df, &c);
+    batch(x, n, p, vchisqtail, &c);
+}
+
+void chisqlog10tails(int df, double *x, size_t n, double *lp)
+{
+    CHISQ_SERIES c;
+    size_t i;
+
+    if (df < 1)
+    {
+        fatal("chisqlog10tails: %d degrees of freedom\n", df);
+    }
+
+    if (df > 2*CHISQ_MAX_TERMS)
+    {
+        for (i=0; i<n; i++)
+        {
+            lp[i] = chisqlogtail(df, x[i]) * LOG10E;
+        }
+        return;
+    }
+
+    chisqseries(df, &c);
+    batch(x, n, lp, vchisqlog10tail, &c);
+}
+
+/* the regularized incomplete gamma Q(df/2, x/2) by its series or by its continued fraction */
+double chisqlogtail(int df, double x)
+{
+    double a = 0.5*df, y = 0.5*x, logPrefix, sum, term, an, b, c, d, delta, h;
+    int i;
+
+    if (isnan(x) || x <= 0)
+    {
+        return isnan(x) ? x : 0;
+    }
+    if (isinf(x))
+    {
+        return -INFINITY;
+    }
+
+    logPrefix = a*log(y) - y - lgamma(a);
+    if (y < a + 1)
+    {
+        for (sum=term=1/a, i=1; i<100000 && term > sum*1e-17; i++)
+        {
+            term *= y / (a + i);
+            sum += term;
+        }
+
+        return log1p(-exp(logPrefix) * sum);
+    }
+
+    /* modified Lentz */
+    b = y + 1 - a;
+    c = 1e300;
+    d = 1 / b;
+    h = d;
+    for (i=1; i<100000; i++)
+    {
+        an = -i * (i - a);
+        b += 2;
+        d = an*d + b;
+        d = fabs(d) < 1e-300 ? 1e-300 : d;
+        c = b + an/c;
+        c = fabs(c) < 1e-300 ? 1e-300 : c;
+        d = 1 / d;
+        delta = d*c;
+        h *= delta;
+        if (fabs(delta - 1) < 1e-16)
+        {
+            break;
+        }
+    }
+
+    return logPrefix + log(h);
+}
@@ -0,0 +1,20 @@
+#include <stddef.h>
+
+/*
+ * batch tail probabilities, n statistics in and n probabilities or log10
+ * probabilities out.  The log10 versions stay finite where the
+ * probabilities underflow.  The statistics are evaluated in vector lanes.
+ * make check measures them against a long double reference, relative
+ * errors stay below 5e-13 up to df 500 where nicklib's are up to 5e-3.
+ */
+
+/* P(Z > z) of the standard normal, nicklib's ntail */
+void normaltails(double *z, size_t n, double *p) ;
+void normallog10tails(double *z, size_t n, double *lp) ;
+
+/* P(X > x) of chi square with df degrees of freedom, nicklib's rtlchsq */
+void chisqtails(int df, double *x, size_t n, double *p) ;
+void chisqlog10tails(int df, double *x, size_t n, double *lp) ;
+
+/* scalar natural log of the chi square tail, for any df */
+double chisqlogtail(int df, double x) ;
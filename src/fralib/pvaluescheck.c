@@ -0,0 +1,195 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+#include <time.h>
+#include "filesubs.h"
+#include "pvalues.h"
+
+/*
+ * accuracy check and microbenchmark of the batch tail probabilities against
+ * a long double reference and the scalar nicklib functions they replace,
+ * run by make check
+ */
+
+/* nicklib's statsubs.h */
+double ntail(double z) ;
+double rtlchsq(int df, double z) ;
+
+#define SAMPLE_NO 200000
+#define BENCH_NO 10000000
+
+/* relative error bounds of the batch functions over the tail range */
+#define MAX_RELATIVE_ERROR       1e-12
+#define MAX_LOG_RELATIVE_ERROR   1e-12
+
+/* the natural log of the upper regularized gamma Q(df/2, x/2), by its series or continued fraction */
+static long double logchisqtail(int df, long double x)
+{
+    long double a = df/2.0L, y = x/2.0L, prefix, sum, term, b, c, d, h, an, delta;
+    int i;
+
+    if (x <= 0)
+    {
+        return 0;
+    }
+
+    prefix = a*logl(y) - y - lgammal(a);
+    if (y < a + 1)
+    {
+        for (sum=term=1/a, i=1; i<1000000 && term>sum*1e-21L; i++)
+        {
+            term *= y/(a + i);
+            sum += term;
+        }
+        return log1pl(-expl(prefix)*sum);
+    }
+
+    b = y + 1 - a;
+    c = 1/LDBL_MIN;
+    d = 1/b;
+    h = d;
+    for (i=1; i<1000000; i++)
+    {
+        an = -i*(i - a);
+        b += 2;
+        d = an*d + b;
+        d = fabsl(d) < LDBL_MIN ? LDBL_MIN : d;
+        c = b + an/c;
+        c = fabsl(c) < LDBL_MIN ? LDBL_MIN : c;
+        d = 1/d;
+        delta = d*c;
+        h *= delta;
+        if (fabsl(delta - 1) < 1e-20L)
+        {
+            break;
+        }
+    }
+
+    return prefix + logl(h);
+}
+
+static double relativeerror(double value, long double reference)
+{
+    return fabsl((value - reference)/reference);
+}
+
+/* log10 probabilities are compared relative to their magnitude, absolutely near 0 */
+static double logrelativeerror(double value, long double reference)
+{
+    return fabsl((value - reference)/MAX(fabsl(reference), 1));
+}
+
+static double seconds(clock_t start)
+{
+    return (double) (clock() - start)/CLOCKS_PER_SEC;
+}
+
+int main(int argc, char **argv)
+{
+    int dfs[] = {1, 2, 3, 4, 5, 7, 10, 20, 51, 100, 200, 201, 500};
+    int i, j, failed = 0;
+    double *x, *p, *lp, error, logError, nicklibError;
+    long double reference;
+    clock_t start;
+
+    FRALLOC(x, BENCH_NO, double);
+    FRALLOC(p, BENCH_NO, double);
+    FRALLOC(lp, BENCH_NO, double);
+    srand48(1);
+
+    printf("maximum relative error, probabilities below DBL_MIN excluded\n");
+    printf("%-12s %12s %12s %12s\n", "", "batch", "batch log10", "nicklib");
+
+    /* the bulk of the distribution, far tails down to underflow and small statistics */
+    for (j=0; j<sizeof(dfs)/sizeof(int); j++)
+    {
+        for (i=0; i<SAMPLE_NO; i++)
+        {
+            x[i] = i%3 == 0 ? drand48()*5*dfs[j] : i%3 == 1 ? drand48()*3000 : exp(drand48()*20 - 10);
+        }
+        chisqtails(dfs[j], x, SAMPLE_NO, p);
+        chisqlog10tails(dfs[j], x, SAMPLE_NO, lp);
+
+        error = logError = nicklibError = 0;
+        for (i=0; i<SAMPLE_NO; i++)
+        {
+            reference = logchisqtail(dfs[j], x[i]);
+            logError = MAX(logError, logrelativeerror(lp[i], reference/logl(10)));
+            if (expl(reference) > DBL_MIN)
+            {
+                error = MAX(error, relativeerror(p[i], expl(reference)));
+                nicklibError = MAX(nicklibError, relativeerror(rtlchsq(dfs[j], x[i]), expl(reference)));
+            }
+        }
+        printf("chisq df %-3d %12.2e %12.2e %12.2e\n", dfs[j], error, logError, nicklibError);
+        failed |= error > MAX_RELATIVE_ERROR || logError > MAX_LOG_RELATIVE_ERROR;
+    }
+
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        x[i] = drand48()*80 - 40;
+    }
+    normaltails(x, SAMPLE_NO, p);
+    normallog10tails(x, SAMPLE_NO, lp);
+
+    error = logError = nicklibError = 0;
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        reference = 0.5L*erfcl(x[i]/sqrtl(2));
+        logError = MAX(logError, logrelativeerror(lp[i], log10l(reference)));
+        if (reference > DBL_MIN)
+        {
+            error = MAX(error, relativeerror(p[i], reference));
+            nicklibError = MAX(nicklibError, relativeerror(ntail(x[i]), reference));
+        }
+    }
+    printf("%-12s %12.2e %12.2e %12.2e\n", "normal", error, logError, nicklibError);
+    failed |= error > MAX_RELATIVE_ERROR || logError > MAX_LOG_RELATIVE_ERROR;
+
+    /* seconds for BENCH_NO statistics, the output is touched first so that no page faults are timed */
+    for (i=0; i<BENCH_NO; i++)
+    {
+        x[i] = drand48()*30;
+        p[i] = 0;
+    }
+
+    printf("\nseconds for %d statistics in [0, 30]\n", BENCH_NO);
+    printf("%-12s %12s %12s\n", "", "batch", "nicklib");
+    for (j=0; j<3; j++)
+    {
+        start = clock();
+        chisqtails(dfs[j], x, BENCH_NO, p);
+        error = seconds(start);
+
+        start = clock();
+        for (i=0; i<BENCH_NO; i++)
+        {
+            p[i] = rtlchsq(dfs[j], x[i]);
+        }
+        printf("chisq df %-3d %12.3f %12.3f\n", dfs[j], error, seconds(start));
+    }
+
+    start = clock();
+    normaltails(x, BENCH_NO, p);
+    error = seconds(start);
+
+    start = clock();
+    for (i=0; i<BENCH_NO; i++)
+    {
+        p[i] = ntail(x[i]);
+    }
+    printf("%-12s %12.3f %12.3f\n", "normal", error, seconds(start));
+
+    free(x);
+    free(p);
+    free(lp);
+
+    if (failed)
+    {
+        fprintf(stderr, "relative error above %g\n", MAX_RELATIVE_ERROR);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,808 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <pthread.h>
+#include "filesubs.h"
+#include "ranstream.h"
+
+#define PHILOX_M0 0xD2511F53U
+#define PHILOX_M1 0xCD9E8D57U
+#define PHILOX_W0 0x9E3779B9U
+#define PHILOX_W1 0xBB67AE85U
+
+/* blocks drawn by a thread at a time, permutations are drawn 1 at a time */
+#define RAN_CHUNK 4096
+
+/* binomials are drawn by inversion below this mean of the smaller side */
+#define BINOM_INVERSION_MEAN 30
+
+void philox4x32(uint32_t counter[4], uint32_t key[2], uint32_t out[4])
+{
+    uint32_t c0 = counter[0], c1 = counter[1], c2 = counter[2], c3 = counter[3];
+    uint32_t k0 = key[0], k1 = key[1];
+    uint64_t p0, p1;
+    int r;
+
+    for (r=0; r<10; r++)
+    {
+        p0 = (uint64_t) PHILOX_M0 * c0;
+        p1 = (uint64_t) PHILOX_M1 * c2;
+        c0 = (uint32_t) (p1 >> 32) ^ c1 ^ k0;
+        c1 = (uint32_t) p1;
+        c2 = (uint32_t) (p0 >> 32) ^ c3 ^ k1;
+        c3 = (uint32_t) p0;
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    out[0] = c0;
+    out[1] = c1;
+    out[2] = c2;
+    out[3] = c3;
+}
+
+/*
+ * blocks first .. first+n-1 of a stream into out.  The counters are
+ * independent so the multiplies of consecutive blocks overlap in the
+ * pipeline.
+ */
+static void philoxblocks(uint32_t key[2], uint64_t stream, uint64_t first, size_t n, uint32_t *out)
+{
+    uint32_t counter[4];
+    size_t i;
+
+    counter[2] = (uint32_t) stream;
+    counter[3] = (uint32_t) (stream >> 32);
+    for (i=0; i<n; i++)
+    {
+        counter[0] = (uint32_t) (first + i);
+        counter[1] = (uint32_t) ((first + i) >> 32);
+        philox4x32(counter, key, out + 4*i);
+    }
+}
+
+/* 53 bits of 2 words in [0,1) */
+static inline double wordstodouble(uint32_t a, uint32_t b)
+{
+    return ((a >> 5) * 67108864.0 + (b >> 6)) * (1.0 / 9007199254740992.0);
+}
+
+/* 2 normals from a block by Box-Muller */
+static inline void blocktogauss(uint32_t *w, double *g)
+{
+    double r = sqrt(-2.0 * log(1.0 - wordstodouble(w[0], w[1])));
+    double theta = 2.0 * M_PI * wordstodouble(w[2], w[3]);
+
+    g[0] = r * cos(theta);
+    g[1] = r * sin(theta);
+}
+
+void ranstreaminit(RAN_STREAM *s, uint64_t seed, uint64_t stream)
+{
+    memset(s, 0, sizeof(RAN_STREAM));
+    s->key[0] = (uint32_t) seed;
+    s->key[1] = (uint32_t) (seed >> 32);
+    s->stream = stream;
+    s->used = 4;
+}
+
+void ranstreamseek(RAN_STREAM *s, uint64_t word)
+{
+    s->block = word / 4;
+    s->used = 4;
+    s->hasSpare = 0;
+    if (word % 4)
+    {
+        philoxblocks(s->key, s->stream, s->block++, 1, s->words);
+        s->used = word % 4;
+    }
+}
+
+uint32_t ranstreamword(RAN_STREAM *s)
+{
+    if (s->used == 4)
+    {
+        philoxblocks(s->key, s->stream, s->block++, 1, s->words);
+        s->used = 0;
+    }
+
+    return s->words[s->used++];
+}
+
+/* DRAND */
+double ranstreamdouble(RAN_STREAM *s)
+{
+    uint32_t a = ranstreamword(s);
+
+    return wordstodouble(a, ranstreamword(s));
+}
+
+/* ranmod, 0 .. n-1 without the modulo bias of DRAND */
+int ranstreammod(RAN_STREAM *s, int n)
+{
+    uint64_t m;
+    uint32_t threshold;
+
+    if (n <= 1)
+    {
+        return 0;
+    }
+
+    m = (uint64_t) ranstreamword(s) * (uint32_t) n;
+    if ((uint32_t) m < (uint32_t) n)
+    {
+        threshold = -(uint32_t) n % (uint32_t) n;
+        while ((uint32_t) m < threshold)
+        {
+            m = (uint64_t) ranstreamword(s) * (uint32_t) n;
+        }
+    }
+
+    return m >> 32;
+}
+
+/* gauss, normals come in pairs from whole blocks */
+double ranstreamgauss(RAN_STREAM *s)
+{
+    double g[2];
+
+    if (s->hasSpare)
+    {
+        s->hasSpare = 0;
+        return s->spare;
+    }
+
+    s->used = 4;
+    philoxblocks(s->key, s->stream, s->block++, 1, s->words);
+    blocktogauss(s->words, g);
+    s->spare = g[1];
+    s->hasSpare = 1;
+
+    return g[0];
+}
+
+/* gaussa, the same normals as n calls of ranstreamgauss */
+void ranstreamgaussa(RAN_STREAM *s, double *a, size_t n)
+{
+    uint32_t *words;
+    size_t i = 0, blockNo, k;
+
+    if (n && s->hasSpare)
+    {
+        a[i++] = ranstreamgauss(s);
+    }
+
+    blockNo = (n - i) / 2;
+    if (blockNo)
+    {
+        FRALLOC(words, 4*MIN(blockNo, RAN_CHUNK), uint32_t);
+        while (i + 1 < n)
+        {
+            k = MIN((n - i) / 2, RAN_CHUNK);
+            philoxblocks(s->key, s->stream, s->block, k, words);
+            s->block += k;
+            s->used = 4;
+            for (blockNo=0; blockNo<k; blockNo++, i+=2)
+            {
+                blocktogauss(words + 4*blockNo, a + i);
+            }
+        }
+        free(words);
+    }
+
+    if (i < n)
+    {
+        a[i] = ranstreamgauss(s);
+    }
+}
+
+/* ranexp */
+double ranstreamexp(RAN_STREAM *s)
+{
+    return -log(1.0 - ranstreamdouble(s));
+}
+
+/* ranperm, a random order of a by Fisher-Yates */
+void ranstreamperm(RAN_STREAM *s, int *a, int n)
+{
+    int i, j, t;
+
+    for (i=n-1; i>0; i--)
+    {
+        j = ranstreammod(s, i+1);
+        t = a[i];
+        a[i] = a[j];
+        a[j] = t;
+    }
+}
+
+/* randis, an index drawn with the weights p */
+int ranstreamdis(RAN_STREAM *s, double *p, int n)
+{
+    double total = 0, u;
+    int i;
+
+    for (i=0; i<n; i++)
+    {
+        total += p[i];
+    }
+
+    u = ranstreamdouble(s) * total;
+    for (i=0; i<n-1; i++)
+    {
+        if ((u -= p[i]) < 0)
+        {
+            return i;
+        }
+    }
+
+    return n-1;
+}
+
+/* ransamp, nsamp indices drawn with the weights p by bisecting their cumulative sums */
+void ranstreamsamp(RAN_STREAM *s, int *samp, int nsamp, double *p, int plen)
+{
+    double *cumulative, u;
+    int i, lo, hi, mid;
+
+    FRALLOC(cumulative, plen, double);
+    for (i=0; i<plen; i++)
+    {
+        cumulative[i] = (i ? cumulative[i-1] : 0) + p[i];
+    }
+
+    for (i=0; i<nsamp; i++)
+    {
+        u = ranstreamdouble(s) * cumulative[plen-1];
+        for (lo=0, hi=plen-1; lo<hi; )
+        {
+            mid = (lo + hi) / 2;
+            if (u < cumulative[mid])
+            {
+                hi = mid;
+            }
+            else
+            {
+                lo = mid + 1;
+            }
+        }
+        samp[i] = lo;
+    }
+
+    free(cumulative);
+}
+
+void ranstreampick2(RAN_STREAM *s, int n, int *k1, int *k2)
+{
+    *k1 = ranstreammod(s, n);
+    *k2 = ranstreammod(s, n-1);
+    if (*k2 >= *k1)
+    {
+        ++*k2;
+    }
+}
+
+/* ranbinom by inversion from the smaller of p and 1-p, for a small mean where q^n stays normal */
+static int binominversion(RAN_STREAM *s, int n, double p)
+{
+    double q, r, f, u;
+    int k, flip = p > 0.5;
+
+    if (n <= 0 || p <= 0)
+    {
+        return 0;
+    }
+    if (p >= 1)
+    {
+        return n;
+    }
+
+    p = flip ? 1 - p : p;
+    q = 1 - p;
+    r = p / q;
+    f = exp(n * log(q));
+    u = ranstreamdouble(s);
+    for (k=0; k<n && u > f; k++)
+    {
+        u -= f;
+        f *= r * (n - k) / (k + 1);
+    }
+
+    return flip ? n - k : k;
+}
+
+/*
+ * ranbinom.  As nicklib does, a large n is split at the a-th smallest of n
+ * uniforms, which is beta(a, n+1-a): the uniforms below it are binomial on
+ * the smaller side.  Each split halves n until the mean is small enough for
+ * inversion.
+ */
+int ranstreambinom(RAN_STREAM *s, int n, double p)
+{
+    double x;
+    int a, k = 0;
+
+    while (n > 0 && p > 0 && p < 1 && n * MIN(p, 1 - p) >= BINOM_INVERSION_MEAN)
+    {
+        a = n / 2 + 1;
+        x = ranstreambeta(s, a, n + 1 - a);
+        if (x >= p)
+        {
+            n = a - 1;
+            p /= x;
+        }
+        else
+        {
+            k += a;
+            n -= a;
+            p = (p - x) / (1 - x);
+        }
+    }
+
+    return k + binominversion(s, n, p);
+}
+
+/* rangam and gds, Ahrens and Dieter's GS below a = 1 and Best's XG above it */
+double ranstreamgam(RAN_STREAM *s, double a)
+{
+    double b, c, p, u, v, w, x, y, z;
+
+    if (a <= 0)
+    {
+        fatal("ranstreamgam: shape %g\n", a);
+    }
+
+    if (a == 1)
+    {
+        return ranstreamexp(s);
+    }
+
+    if (a < 1)
+    {
+        b = 1 + a / M_E;
+        while (1)
+        {
+            p = b * ranstreamdouble(s);
+            u = ranstreamdouble(s);
+            if (p <= 1)
+            {
+                x = pow(p, 1 / a);
+                if (u <= exp(-x))
+                {
+                    return x;
+                }
+            }
+            else
+            {
+                x = -log((b - p) / a);
+                if (u <= pow(x, a - 1))
+                {
+                    return x;
+                }
+            }
+        }
+    }
+
+    b = a - 1;
+    c = 3 * a - 0.75;
+    while (1)
+    {
+        u = ranstreamdouble(s);
+        v = ranstreamdouble(s);
+        w = u * (1 - u);
+        y = sqrt(c / w) * (u - 0.5);
+        x = b + y;
+        if (x < 0 || w == 0)
+        {
+            continue;
+        }
+
+        z = 64 * w * w * w * v * v;
+        if (z <= 1 - 2 * y * y / x || log(z) <= 2 * (b * log(x / b) - y))
+        {
+            return x;
+        }
+    }
+}
+
+/* ranbeta */
+double ranstreambeta(RAN_STREAM *s, double a, double b)
+{
+    double x = ranstreamgam(s, a);
+
+    return x / (x + ranstreamgam(s, b));
+}
+
+/* ranchi */
+double ranstreamchi(RAN_STREAM *s, int d)
+{
+    return 2 * ranstreamgam(s, 0.5 * d);
+}
+
+/* poidev and ranpoiss, by multiplying uniforms below a mean of 12 and by rejection from a Lorentzian above it */
+double ranstreampoiss(RAN_STREAM *s, double mean)
+{
+    double g, t, y, em, sq, logMean;
+
+    if (mean <= 0)
+    {
+        return 0;
+    }
+
+    if (mean < 12)
+    {
+        g = exp(-mean);
+        for (em=-1, t=1; t>g; em++)
+        {
+            t *= ranstreamdouble(s);
+        }
+        return em;
+    }
+
+    sq = sqrt(2 * mean);
+    logMean = log(mean);
+    g = mean * logMean - lgamma(mean + 1);
+    do
+    {
+        do
+        {
+            y = tan(M_PI * ranstreamdouble(s));
+            em = sq * y + mean;
+        }
+        while (em < 0);
+
+        em = floor(em);
+        t = 0.9 * (1 + y * y) * exp(em * logMean - lgamma(em + 1) - g);
+    }
+    while (ranstreamdouble(s) > t);
+
+    return em;
+}
+
+/* ranpoissx, Poisson conditioned on at least 1, by inversion up to a mean of 1 */
+double ranstreampoissx(RAN_STREAM *s, double mean)
+{
+    double t, u, k;
+
+    if (mean > 1)
+    {
+        while ((k = ranstreampoiss(s, mean)) < 1);
+        return k;
+    }
+
+    if (mean <= 0)
+    {
+        return 1;
+    }
+
+    /* P(k) / P(k > 0) summed from k = 1 */
+    t = exp(-mean);
+    u = -expm1(-mean) * ranstreamdouble(s);
+    for (k=1, t*=mean; t > 0; k++, t*=mean/k)
+    {
+        if ((u -= t) < 0)
+        {
+            break;
+        }
+    }
+
+    return k;
+}
+
+/* ranmultinom, the counts of n draws with the weights p, as binomials of what is left */
+void ranstreammultinom(RAN_STREAM *s, int *samp, int n, double *p, int len)
+{
+    double total = 0;
+    int i;
+
+    for (i=0; i<len; i++)
+    {
+        samp[i] = 0;
+        total += p[i];
+    }
+    if (len == 0 || n <= 0)
+    {
+        return;
+    }
+
+    for (i=0; i<len-1 && n>0; i++)
+    {
+        samp[i] = total > 0 ? ranstreambinom(s, n, p[i] / total) : 0;
+        n -= samp[i];
+        total -= p[i];
+    }
+    samp[len-1] += n;
+}
+
+/* ewens, the classes 1, 2, ... of n items by the Chinese restaurant process */
+void ranstreamewens(RAN_STREAM *s, int *a, int n, double theta)
+{
+    int i, classNo = 1;
+
+    if (n <= 0)
+    {
+        return;
+    }
+
+    a[0] = 1;
+    for (i=1; i<n; i++)
+    {
+        if (ranstreamdouble(s) > theta / (i + theta))
+        {
+            a[i] = a[ranstreammod(s, i)];
+        }
+        else
+        {
+            a[i] = ++classNo;
+        }
+    }
+}
+
+/* the lower triangular L of a = L L', row major */
+static void cholesky(double *l, double *a, int n, char *caller)
+{
+    double sum;
+    int i, j, k;
+
+    for (i=0; i<n; i++)
+    {
+        for (j=0; j<=i; j++)
+        {
+            for (sum=a[i*n+j], k=0; k<j; k++)
+            {
+                sum -= l[i*n+k] * l[j*n+k];
+            }
+
+            if (i == j)
+            {
+                if (sum <= 0)
+                {
+                    fatal("%s: matrix not positive definite\n", caller);
+                }
+                l[i*n+i] = sqrt(sum);
+            }
+            else
+            {
+                l[i*n+j] = sum / l[j*n+j];
+            }
+        }
+        for (j=i+1; j<n; j++)
+        {
+            l[i*n+j] = 0;
+        }
+    }
+}
+
+/* genmultgauss, num rows of n normals with covariance covar */
+void ranstreammultgauss(RAN_STREAM *s, double *rvec, int num, int n, double *covar)
+{
+    double *l, *z, sum;
+    int r, i, j;
+
+    FRALLOC(l, MAX(n*n, 1), double);
+    cholesky(l, covar, n, "ranstreammultgauss");
+    ranstreamgaussa(s, rvec, (size_t) num * n);
+
+    /* a row becomes L z, from its last element as each depends on those before it */
+    for (r=0; r<num; r++)
+    {
+        z = rvec + (size_t) r * n;
+        for (i=n-1; i>=0; i--)
+        {
+            for (sum=0, j=0; j<=i; j++)
+            {
+                sum += l[i*n+j] * z[j];
+            }
+            z[i] = sum;
+        }
+    }
+
+    free(l);
+}
+
+/*
+ * raninvwis, which draws like nicklib the Wishart matrix L A A' L' with t
+ * degrees of freedom, L L' = scale and A lower triangular by Bartlett's
+ * decomposition: chi square roots on the diagonal and normals below it
+ */
+void ranstreaminvwis(RAN_STREAM *s, double *wis, int t, int d, double *scale)
+{
+    double *l, *a, *m, sum;
+    int i, j, k;
+
+    if (t < d)
+    {
+        fatal("ranstreaminvwis: %d degrees of freedom for dimension %d\n", t, d);
+    }
+
+    FRALLOC(l, MAX(d*d, 1), double);
+    FRALLOC(a, MAX(d*d, 1), double);
+    FRALLOC(m, MAX(d*d, 1), double);
+    cholesky(l, scale, d, "ranstreaminvwis");
+
+    for (i=0; i<d; i++)
+    {
+        a[i*d+i] = sqrt(ranstreamchi(s, t - i));
+        for (j=0; j<i; j++)
+        {
+            a[i*d+j] = ranstreamgauss(s);
+        }
+    }
+
+    /* M = L A, lower triangular */
+    for (i=0; i<d; i++)
+    {
+        for (j=0; j<=i; j++)
+        {
+            for (sum=0, k=j; k<=i; k++)
+            {
+                sum += l[i*d+k] * a[k*d+j];
+            }
+            m[i*d+j] = sum;
+        }
+    }
+
+    for (i=0; i<d; i++)
+    {
+        for (j=0; j<=i; j++)
+        {
+            for (sum=0, k=0; k<=j; k++)
+            {
+                sum += m[i*d+k] * m[j*d+k];
+            }
+            wis[i*d+j] = wis[j*d+i] = sum;
+        }
+    }
+
+    free(l);
+    free(a);
+    free(m);
+}
+
+/* the same doubles as n calls of ranstreamdouble */
+void ranstreamdoubles(RAN_STREAM *s, double *a, size_t n)
+{
+    uint32_t *words;
+    size_t i = 0, k, j;
+
+    /* whole blocks once the stream is at a block boundary */
+    while (i < n && s->used != 4 && s->used % 2 == 0)
+    {
+        a[i++] = ranstreamdouble(s);
+    }
+
+    if (s->used == 4 && n - i >= 2)
+    {
+        FRALLOC(words, 4*MIN((n - i) / 2, RAN_CHUNK), uint32_t);
+        while (n - i >= 2)
+        {
+            k = MIN((n - i) / 2, RAN_CHUNK);
+            philoxblocks(s->key, s->stream, s->block, k, words);
+            s->block += k;
+            for (j=0; j<2*k; j++)
+            {
+                a[i++] = wordstodouble(words[2*j], words[2*j+1]);
+            }
+        }
+        free(words);
+    }
+
+    for (; i<n; i++)
+    {
+        a[i] = ranstreamdouble(s);
+    }
+}
+
+typedef struct
+{
+    uint64_t seed;
+    uint64_t stream;
+    double *a;
+    int *perms;
+    size_t n;
+    size_t itemNo;
+    size_t next;
+    int kind;
+    pthread_mutex_t lock;
+} RAN_BATCH;
+
+#define RAN_UNIFORM     0
+#define RAN_GAUSSIAN    1
+#define RAN_PERMUTATION 2
+
+/* chunks go to the threads as they ask, each chunk is drawn from its own place in the stream */
+static void *ranworker(void *arg)
+{
+    RAN_BATCH *batch = (RAN_BATCH *) arg;
+    RAN_STREAM s;
+    size_t start, end, k;
+    int i;
+
+    ranstreaminit(&s, batch->seed, batch->stream);
+    while (1)
+    {
+        pthread_mutex_lock(&batch->lock);
+        start = batch->next;
+        batch->next += batch->kind == RAN_PERMUTATION ? 1 : 2*RAN_CHUNK;
+        pthread_mutex_unlock(&batch->lock);
+
+        if (start >= batch->itemNo)
+        {
+            break;
+        }
+        end = MIN(start + (batch->kind == RAN_PERMUTATION ? 1 : 2*RAN_CHUNK), batch->itemNo);
+
+        /* 2 doubles or 2 normals to a block */
+        if (batch->kind == RAN_UNIFORM)
+        {
+            ranstreamseek(&s, 2*start);
+            ranstreamdoubles(&s, batch->a + start, end - start);
+        }
+        else if (batch->kind == RAN_GAUSSIAN)
+        {
+            ranstreamseek(&s, 2*start);
+            ranstreamgaussa(&s, batch->a + start, end - start);
+        }
+        else
+        {
+            k = start;
+            ranstreamseek(&s, k << 34);
+            for (i=0; i<(int) batch->n; i++)
+            {
+                batch->perms[k*batch->n + i] = i;
+            }
+            ranstreamperm(&s, batch->perms + k*batch->n, batch->n);
+        }
+    }
+
+    return NULL;
+}
+
+static void ranbatch(RAN_BATCH *batch, int threadNo)
+{
+    pthread_t *threads;
+    int t;
+
+    batch->next = 0;
+    pthread_mutex_init(&batch->lock, NULL);
+
+    threadNo = MAX(1, threadNo);
+    FRALLOC(threads, threadNo, pthread_t);
+    for (t=0; t<threadNo; t++)
+    {
+        if (pthread_create(&threads[t], NULL, ranworker, batch))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (t=0; t<threadNo; t++)
+    {
+        pthread_join(threads[t], NULL);
+    }
+
+    free(threads);
+    pthread_mutex_destroy(&batch->lock);
+}
+
+void ranuniforms(uint64_t seed, uint64_t stream, double *a, size_t n, int threadNo)
+{
+    RAN_BATCH batch = {seed, stream, a, NULL, 0, n, 0, RAN_UNIFORM};
+
+    ranbatch(&batch, threadNo);
+}
+
+void rangaussians(uint64_t seed, uint64_t stream, double *a, size_t n, int threadNo)
+{
+    RAN_BATCH batch = {seed, stream, a, NULL, 0, n, 0, RAN_GAUSSIAN};
+
+    ranbatch(&batch, threadNo);
+}
+
+void ranpermutations(uint64_t seed, uint64_t stream, int *perms, int n, int count, int threadNo)
+{
+    RAN_BATCH batch = {seed, stream, NULL, perms, n, count, 0, RAN_PERMUTATION};
+
+    ranbatch(&batch, threadNo);
+}
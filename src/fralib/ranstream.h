@@ -0,0 +1,60 @@
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * counter-based random streams on Philox4x32-10.  Word i of a stream is
+ * word i%4 of the block Philox(key = seed, counter = (i/4, stream)), so a
+ * stream can be seeked anywhere, streams of a seed never overlap and a
+ * stream gives the same words whichever thread draws them.
+ */
+typedef struct
+{
+    uint32_t key[2];
+    uint64_t stream;
+    uint64_t block;
+    uint32_t words[4];
+    int used;
+    int hasSpare;
+    double spare;
+} RAN_STREAM;
+
+void philox4x32(uint32_t counter[4], uint32_t key[2], uint32_t out[4]) ;
+
+void ranstreaminit(RAN_STREAM *s, uint64_t seed, uint64_t stream) ;
+
+/* moves the stream to its word-th word */
+void ranstreamseek(RAN_STREAM *s, uint64_t word) ;
+
+/* the functions of ranmath.h over a stream, ranstreamdouble has the 53 bits of DRAND2 */
+uint32_t ranstreamword(RAN_STREAM *s) ;
+double ranstreamdouble(RAN_STREAM *s) ;
+int ranstreammod(RAN_STREAM *s, int n) ;
+double ranstreamgauss(RAN_STREAM *s) ;
+void ranstreamgaussa(RAN_STREAM *s, double *a, size_t n) ;
+double ranstreamexp(RAN_STREAM *s) ;
+void ranstreamperm(RAN_STREAM *s, int *a, int n) ;
+int ranstreamdis(RAN_STREAM *s, double *p, int n) ;
+void ranstreamsamp(RAN_STREAM *s, int *samp, int nsamp, double *p, int plen) ;
+void ranstreampick2(RAN_STREAM *s, int n, int *k1, int *k2) ;
+int ranstreambinom(RAN_STREAM *s, int n, double p) ;
+double ranstreamgam(RAN_STREAM *s, double a) ;
+double ranstreambeta(RAN_STREAM *s, double a, double b) ;
+double ranstreamchi(RAN_STREAM *s, int d) ;
+double ranstreampoiss(RAN_STREAM *s, double mean) ;
+double ranstreampoissx(RAN_STREAM *s, double mean) ;
+void ranstreammultinom(RAN_STREAM *s, int *samp, int n, double *p, int len) ;
+void ranstreamewens(RAN_STREAM *s, int *a, int n, double theta) ;
+void ranstreammultgauss(RAN_STREAM *s, double *rvec, int num, int n, double *covar) ;
+void ranstreaminvwis(RAN_STREAM *s, double *wis, int t, int d, double *scale) ;
+
+/* n doubles in [0,1), the same as n calls of ranstreamdouble from whole blocks */
+void ranstreamdoubles(RAN_STREAM *s, double *a, size_t n) ;
+
+/*
+ * bulk draws from the start of a stream split over threadNo threads,
+ * the same for any threadNo.  Permutation k of 0..n-1 is drawn from
+ * word k*2^34 of the stream.
+ */
+void ranuniforms(uint64_t seed, uint64_t stream, double *a, size_t n, int threadNo) ;
+void rangaussians(uint64_t seed, uint64_t stream, double *a, size_t n, int threadNo) ;
+void ranpermutations(uint64_t seed, uint64_t stream, int *perms, int n, int count, int threadNo) ;
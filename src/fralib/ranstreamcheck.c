@@ -0,0 +1,266 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include "filesubs.h"
+#include "ranstream.h"
+
+/*
+ * known answers of Philox4x32-10, the reproducibility of the streams and
+ * the moments of the ranmath.h samplers over them, run by make check
+ */
+
+#define SAMPLE_NO 200000
+
+/* moments are accepted within this many standard errors */
+#define MAX_Z 5.0
+
+typedef struct
+{
+    uint32_t counter[4];
+    uint32_t key[2];
+    uint32_t out[4];
+} PHILOX_KAT;
+
+/* the known answers of the Random123 distribution */
+static PHILOX_KAT kats[] =
+{
+    {{0, 0, 0, 0}, {0, 0}, {0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8}},
+    {{0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}, {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd}},
+    {{0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}, {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}}
+};
+
+static int failures = 0;
+
+static void check(int passed, char *what)
+{
+    printf("%-48s %s\n", what, passed ? "ok" : "FAILED");
+    failures += !passed;
+}
+
+/* the sample mean and variance against the expected ones, within MAX_Z standard errors */
+static void checkmoments(double *x, int n, double mean, double variance, char *what)
+{
+    double m = 0, m2 = 0, m4 = 0, d, meanZ, varianceZ;
+    char label[128];
+    int i;
+
+    for (i=0; i<n; i++)
+    {
+        m += x[i];
+    }
+    m /= n;
+    for (i=0; i<n; i++)
+    {
+        d = x[i] - m;
+        m2 += d * d;
+        m4 += d * d * d * d;
+    }
+    m2 /= n - 1;
+    m4 /= n;
+
+    meanZ = fabs(m - mean) / sqrt(variance / n);
+    varianceZ = variance > 0 ? fabs(m2 - variance) / sqrt(MAX(m4 - m2 * m2, 1e-300) / n) : fabs(m2);
+    snprintf(label, sizeof(label), "%s mean %.6g var %.6g", what, m, m2);
+    check(meanZ < MAX_Z && varianceZ < MAX_Z, label);
+}
+
+int main(int argc, char **argv)
+{
+    int binomNs[] = {10, 1000, 3000, 5000, 100000, 1000000000};
+    double binomPs[] = {0.3, 0.3, 0.3, 0.3, 0.5, 0.999};
+    double gammaAs[] = {0.3, 1, 2.5, 100};
+    double poissonMeans[] = {0.5, 3, 50, 10000};
+    double covar[] = {2, 0.5, -0.3, 0.5, 1, 0.2, -0.3, 0.2, 1.5}, scale[] = {2, 0.5, 0.5, 1};
+    double *x, *y, *sample, mean, e[4];
+    uint32_t out[4];
+    int i, j, k, ok, *perms, *counts, label[16];
+    char what[128];
+    RAN_STREAM s, t;
+
+    FRALLOC(x, SAMPLE_NO, double);
+    FRALLOC(y, SAMPLE_NO, double);
+    FRALLOC(sample, 3*SAMPLE_NO, double);
+
+    for (i=0; i<sizeof(kats)/sizeof(PHILOX_KAT); i++)
+    {
+        philox4x32(kats[i].counter, kats[i].key, out);
+        snprintf(what, sizeof(what), "philox4x32 known answer %d", i + 1);
+        check(memcmp(out, kats[i].out, sizeof(out)) == 0, what);
+    }
+
+    /* bulk draws do not depend on the threads, and match the stream drawn word by word */
+    ranuniforms(7, 3, x, SAMPLE_NO, 1);
+    ranuniforms(7, 3, y, SAMPLE_NO, 4);
+    check(memcmp(x, y, SAMPLE_NO*sizeof(double)) == 0, "ranuniforms with 1 and 4 threads");
+    ranstreaminit(&s, 7, 3);
+    for (i=0, ok=1; i<SAMPLE_NO; i++)
+    {
+        ok &= ranstreamdouble(&s) == x[i];
+    }
+    check(ok, "ranuniforms against ranstreamdouble");
+
+    rangaussians(7, 3, x, SAMPLE_NO, 1);
+    rangaussians(7, 3, y, SAMPLE_NO, 3);
+    check(memcmp(x, y, SAMPLE_NO*sizeof(double)) == 0, "rangaussians with 1 and 3 threads");
+    ranstreaminit(&s, 7, 3);
+    ranstreamgaussa(&s, y, 5);
+    ranstreamgaussa(&s, y + 5, SAMPLE_NO - 5);
+    check(memcmp(x, y, SAMPLE_NO*sizeof(double)) == 0, "rangaussians against ranstreamgaussa");
+
+    FRALLOC(perms, 2*8*100, int);
+    ranpermutations(7, 3, perms, 100, 8, 1);
+    ranpermutations(7, 3, perms + 800, 100, 8, 4);
+    check(memcmp(perms, perms + 800, 800*sizeof(int)) == 0, "ranpermutations with 1 and 4 threads");
+    free(perms);
+
+    ranstreaminit(&s, 7, 3);
+    ranstreaminit(&t, 7, 3);
+    for (i=0; i<1001; i++)
+    {
+        ranstreamword(&s);
+    }
+    ranstreamseek(&t, 1001);
+    check(ranstreamword(&s) == ranstreamword(&t), "ranstreamseek");
+
+    ranstreaminit(&s, 11, 0);
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        x[i] = ranstreamdouble(&s);
+    }
+    checkmoments(x, SAMPLE_NO, 0.5, 1.0/12, "ranstreamdouble");
+
+    ranstreamgaussa(&s, x, SAMPLE_NO);
+    checkmoments(x, SAMPLE_NO, 0, 1, "ranstreamgaussa");
+
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        x[i] = ranstreamexp(&s);
+    }
+    checkmoments(x, SAMPLE_NO, 1, 1, "ranstreamexp");
+
+    /* the inversion and the beta splits of large n */
+    for (j=0; j<sizeof(binomNs)/sizeof(int); j++)
+    {
+        for (i=0; i<SAMPLE_NO; i++)
+        {
+            x[i] = ranstreambinom(&s, binomNs[j], binomPs[j]);
+        }
+        snprintf(what, sizeof(what), "binom n %d p %g", binomNs[j], binomPs[j]);
+        checkmoments(x, SAMPLE_NO, binomNs[j] * binomPs[j], binomNs[j] * binomPs[j] * (1 - binomPs[j]), what);
+    }
+
+    for (j=0; j<sizeof(gammaAs)/sizeof(double); j++)
+    {
+        for (i=0; i<SAMPLE_NO; i++)
+        {
+            x[i] = ranstreamgam(&s, gammaAs[j]);
+        }
+        snprintf(what, sizeof(what), "gam a %g", gammaAs[j]);
+        checkmoments(x, SAMPLE_NO, gammaAs[j], gammaAs[j], what);
+    }
+
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        x[i] = ranstreambeta(&s, 2, 5);
+    }
+    checkmoments(x, SAMPLE_NO, 2.0/7, 10.0/(49*8), "beta a 2 b 5");
+
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        x[i] = ranstreamchi(&s, 7);
+    }
+    checkmoments(x, SAMPLE_NO, 7, 14, "chi d 7");
+
+    for (j=0; j<sizeof(poissonMeans)/sizeof(double); j++)
+    {
+        for (i=0; i<SAMPLE_NO; i++)
+        {
+            x[i] = ranstreampoiss(&s, poissonMeans[j]);
+        }
+        snprintf(what, sizeof(what), "poiss mean %g", poissonMeans[j]);
+        checkmoments(x, SAMPLE_NO, poissonMeans[j], poissonMeans[j], what);
+    }
+
+    /* E[X | X > 0] = m / (1 - e^-m), E[X^2 | X > 0] = (m + m^2) / (1 - e^-m) */
+    for (j=0; j<2; j++)
+    {
+        for (i=0; i<SAMPLE_NO; i++)
+        {
+            x[i] = ranstreampoissx(&s, poissonMeans[j]);
+        }
+        mean = poissonMeans[j] / -expm1(-poissonMeans[j]);
+        snprintf(what, sizeof(what), "poissx mean %g", poissonMeans[j]);
+        checkmoments(x, SAMPLE_NO, mean, mean * (1 + poissonMeans[j]) - mean * mean, what);
+    }
+
+    /* a multinomial count is binomial */
+    FRALLOC(counts, 4, int);
+    e[0] = 0.1; e[1] = 0.2; e[2] = 0.3; e[3] = 0.4;
+    for (i=0, ok=1; i<SAMPLE_NO; i++)
+    {
+        ranstreammultinom(&s, counts, 1000, e, 4);
+        ok &= counts[0] + counts[1] + counts[2] + counts[3] == 1000;
+        x[i] = counts[2];
+    }
+    check(ok, "multinom counts sum to n");
+    checkmoments(x, SAMPLE_NO, 300, 1000 * 0.3 * 0.7, "multinom n 1000 p 0.3");
+    free(counts);
+
+    /* the expected number of classes is sum theta / (theta + i) */
+    for (i=0, ok=1; i<SAMPLE_NO; i++)
+    {
+        ranstreamewens(&s, label, 16, 2.0);
+        for (j=0, k=0; j<16; j++)
+        {
+            ok &= label[j] >= 1 && label[j] <= k + 1;
+            k = MAX(k, label[j]);
+        }
+        x[i] = k;
+    }
+    for (j=0, mean=0, e[0]=0; j<16; j++)
+    {
+        mean += 2.0 / (2.0 + j);
+        e[0] += 2.0 * j / ((2.0 + j) * (2.0 + j));
+    }
+    check(ok, "ewens classes numbered in order");
+    checkmoments(x, SAMPLE_NO, mean, e[0], "ewens n 16 theta 2 classes");
+
+    /* products of the correlated normals have the covariances as means */
+    ranstreammultgauss(&s, sample, SAMPLE_NO, 3, covar);
+    for (j=0; j<3; j++)
+    {
+        for (k=0; k<=j; k++)
+        {
+            for (i=0; i<SAMPLE_NO; i++)
+            {
+                x[i] = sample[3*i+j] * sample[3*i+k];
+            }
+            snprintf(what, sizeof(what), "multgauss covariance %d %d", j, k);
+            checkmoments(x, SAMPLE_NO, covar[3*j+k], covar[3*j+j] * covar[3*k+k] + covar[3*j+k] * covar[3*j+k], what);
+        }
+    }
+
+    /* a Wishart element W_jk has mean t S_jk and variance t (S_jk^2 + S_jj S_kk) */
+    for (i=0; i<SAMPLE_NO; i++)
+    {
+        ranstreaminvwis(&s, e, 5, 2, scale);
+        x[i] = e[0];
+        y[i] = e[1];
+    }
+    checkmoments(x, SAMPLE_NO, 5 * scale[0], 5 * 2 * scale[0] * scale[0], "invwis t 5 element 0 0");
+    checkmoments(y, SAMPLE_NO, 5 * scale[1], 5 * (scale[1] * scale[1] + scale[0] * scale[3]), "invwis t 5 element 0 1");
+
+    free(x);
+    free(y);
+    free(sample);
+
+    if (failures)
+    {
+        fprintf(stderr, "%d checks failed\n", failures);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include "filesubs.h"
+#include "strand.h"
+
+const unsigned char iupacClass[256] =
+{
+    ['A'] = 1, ['C'] = 2, ['G'] = 4, ['T'] = 8,
+    ['M'] = 3, ['R'] = 5, ['W'] = 9, ['S'] = 6, ['Y'] = 10, ['K'] = 12,
+    ['V'] = 7, ['H'] = 11, ['D'] = 13, ['B'] = 14, ['N'] = 15, ['X'] = 15,
+    ['a'] = 1, ['c'] = 2, ['g'] = 4, ['t'] = 8,
+    ['m'] = 3, ['r'] = 5, ['w'] = 9, ['s'] = 6, ['y'] = 10, ['k'] = 12,
+    ['v'] = 7, ['h'] = 11, ['d'] = 13, ['b'] = 14, ['n'] = 15, ['x'] = 15
+};
+
+const char baseComplement[256] =
+{
+    ['A'] = 'T', ['C'] = 'G', ['G'] = 'C', ['T'] = 'A',
+    ['M'] = 'K', ['R'] = 'Y', ['W'] = 'S', ['S'] = 'W', ['Y'] = 'R', ['K'] = 'M',
+    ['V'] = 'B', ['H'] = 'D', ['D'] = 'H', ['B'] = 'V', ['N'] = 'N', ['X'] = 'X',
+    ['-'] = '-'
+};
+
+/* the perfect hash of affyexception.c */
+extern const uint32_t affyExceptionBucketNo;
+extern const uint32_t affyExceptionSlotNo;
+extern const uint16_t affyExceptionDisplacements[];
+extern const char *affyExceptionSlots[];
+
+int reversecomplement(char *s, int n, char *out)
+{
+    int i;
+
+    for (i=0; i<n; i++)
+    {
+        if ((out[n-1-i] = baseComplement[(unsigned char) s[i]]) == 0)
+        {
+            return (unsigned char) s[i];
+        }
+    }
+    out[n] = '\0';
+
+    return 0;
+}
+
+static inline int isallele(char c)
+{
+    c = toupper(c);
+
+    return c == 'A' || c == 'C' || c == 'G' || c == 'T';
+}
+
+/* the next [X/Y] of single base alleles from s, NULL if there is none */
+static char *findalleles(char *s)
+{
+    for (; (s = strchr(s, '[')) != NULL; s++)
+    {
+        if (isallele(s[1]) && s[2] == '/' && isallele(s[3]) && s[4] == ']')
+        {
+            return s;
+        }
+    }
+
+    return NULL;
+}
+
+/* the lengths of the IUPAC runs flanking the alleles at b */
+static void flanklengths(char *flanks, char *b, int *fiveLength, int *threeLength)
+{
+    char *s;
+
+    for (s=b; s>flanks && iupacClass[(unsigned char) s[-1]]; s--);
+    *fiveLength = b - s;
+    for (s=b+5; iupacClass[(unsigned char) *s]; s++);
+    *threeLength = s - (b+5);
+}
+
+/* walks out from the alleles of an A/T or C/G SNP to the first unambiguous pair of bases */
+int topbotstrand(char *flanks)
+{
+    char *b, a1, a2, f, t;
+    int fiveLength, threeLength, i;
+
+    if ((b = findalleles(flanks)) == NULL)
+    {
+        return STRAND_UNDEFINED;
+    }
+
+    a1 = toupper(b[1]);
+    a2 = toupper(b[3]);
+    if (a1 == a2)
+    {
+        fatal("Alleles are the same: %c %c\n", a1, a2);
+    }
+
+    if (baseComplement[(unsigned char) a1] != a2)
+    {
+        return a1 == 'A' || a2 == 'A' ? STRAND_TOP : STRAND_BOT;
+    }
+
+    flanklengths(flanks, b, &fiveLength, &threeLength);
+    for (i=0; i<MIN(fiveLength, threeLength); i++)
+    {
+        f = toupper(b[-(i+1)]);
+        t = toupper(b[5+i]);
+        if (ISAMBIGUOUS(f) || ISAMBIGUOUS(t))
+        {
+            /* polymorphic SNP in the flanks, the top/bot annotation is unstable */
+            return STRAND_UNDEFINED;
+        }
+        else if (f != t && baseComplement[(unsigned char) f] != t)
+        {
+            return f == 'A' || f == 'T' ? STRAND_TOP : STRAND_BOT;
+        }
+    }
+
+    return STRAND_UNDEFINED;
+}
+
+/* walks out from the alleles to the first pair of bases that are not complementary */
+int affyrefstrand(char *flanks)
+{
+    char *b, f, t;
+    int fiveLength = 0, threeLength = 0, i;
+
+    for (b=flanks; (b = findalleles(b)) != NULL; b++)
+    {
+        flanklengths(flanks, b, &fiveLength, &threeLength);
+        if (fiveLength > 0 && threeLength > 0)
+        {
+            break;
+        }
+    }
+    if (b == NULL)
+    {
+        return STRAND_UNDEFINED;
+    }
+
+    for (i=0; i<MIN(fiveLength, threeLength); i++)
+    {
+        f = toupper(b[-(i+1)]);
+        t = toupper(b[5+i]);
+        if (ISAMBIGUOUS(f) || ISAMBIGUOUS(t))
+        {
+            /* polymorphic SNP in the flanks, the reference strand is unstable */
+            return STRAND_UNDEFINED;
+        }
+        else if (baseComplement[(unsigned char) f] == t)
+        {
+            continue;
+        }
+        else if (f == 'A' || t == 'A')
+        {
+            return STRAND_AFFYREF;
+        }
+        else if (f == 'T' || t == 'T')
+        {
+            return STRAND_AFFYOPP;
+        }
+        else
+        {
+            return f == 'C' ? STRAND_AFFYREF : STRAND_AFFYOPP;
+        }
+    }
+
+    return STRAND_UNDEFINED;
+}
+
+/* 32 bit FNV-1a seeded through the offset basis, as affyexception.pl hashes */
+static uint32_t fnv32(char *s, uint32_t seed)
+{
+    uint32_t h = 2166136261U ^ seed;
+
+    for (; *s; s++)
+    {
+        h ^= (unsigned char) *s;
+        h *= 16777619U;
+    }
+
+    return h;
+}
+
+int isaffymetrixexception(char *snp)
+{
+    uint16_t d = affyExceptionDisplacements[fnv32(snp, 0) % affyExceptionBucketNo];
+    const char *key;
+
+    if (d == 0)
+    {
+        return 0;
+    }
+    key = affyExceptionSlots[fnv32(snp, d) % affyExceptionSlotNo];
+
+    return key != NULL && strcmp(key, snp) == 0;
+}
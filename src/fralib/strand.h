@@ -0,0 +1,23 @@
+#include <stdint.h>
+
+/* strands fralib's getTopBotStrandFromFlanks and getAffyRefOppStrandFromFlanks return */
+#define STRAND_UNDEFINED 0
+#define STRAND_TOP       1
+#define STRAND_BOT       2
+#define STRAND_AFFYREF   3
+#define STRAND_AFFYOPP   4
+
+/* IUPAC codes as sets of A=1, C=2, G=4 and T=8, 0 for other characters */
+extern const unsigned char iupacClass[256];
+
+/* complements of the bases complementBase accepts, 0 for other characters */
+extern const char baseComplement[256];
+
+#define ISAMBIGUOUS(c) (iupacClass[(unsigned char) (c)] && (iupacClass[(unsigned char) (c)] & (iupacClass[(unsigned char) (c)] - 1)))
+
+/* reverse complements n bases of s into out, returns the first invalid base or 0 */
+int reversecomplement(char *s, int n, char *out) ;
+
+int topbotstrand(char *flanks) ;
+int affyrefstrand(char *flanks) ;
+int isaffymetrixexception(char *snp) ;
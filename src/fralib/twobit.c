@@ -0,0 +1,408 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "filesubs.h"
+#include "twobit.h"
+
+/* 4 bases per byte, most significant bits first, T C A G */
+static char baseTable[256][4];
+static int baseTableReady = 0;
+
+static void initbasetable()
+{
+    static const char bases[] = "TCAG";
+    int b, i;
+
+    for (b=0; b<256; b++)
+    {
+        for (i=0; i<4; i++)
+        {
+            baseTable[b][i] = bases[(b >> (6-2*i)) & 3];
+        }
+    }
+
+    baseTableReady = 1;
+}
+
+static uint32_t getword(TWOBIT *tb, size_t offset)
+{
+    uint32_t value;
+
+    if (offset + 4 > tb->size)
+    {
+        fatal("%s is truncated\n", tb->file);
+    }
+
+    memcpy(&value, tb->data + offset, 4);
+
+    return tb->swapped ? __builtin_bswap32(value) : value;
+}
+
+/* the fraTools label of a sequence, as fratbi names NC_ accessions */
+static char *getchromosome(char *name)
+{
+    char label[16];
+    char *s;
+    int n;
+
+    if ((s = strstr(name, "NC_0")) != NULL)
+    {
+        n = atoi(s+3);
+        if (n >= 1 && n <= 22)
+        {
+            snprintf(label, sizeof(label), "%d", n);
+        }
+        else if (n == 23)
+        {
+            strcpy(label, "X");
+        }
+        else if (n == 24)
+        {
+            strcpy(label, "Y");
+        }
+        else if (n == 1807)
+        {
+            strcpy(label, "M");
+        }
+        else
+        {
+            fatal("Unidentified chromosome: %d\n", n);
+        }
+
+        return strdup(label);
+    }
+
+    if (strncmp(name, "chr", 3) == 0)
+    {
+        return strdup(name+3);
+    }
+
+    return strdup(name);
+}
+
+TWOBIT *twobitopen(char *file)
+{
+    TWOBIT *tb;
+    struct stat st;
+    size_t offset;
+    uint32_t i;
+    int fd, nameLength;
+
+    if (!baseTableReady)
+    {
+        initbasetable();
+    }
+
+    FRALLOC(tb, 1, TWOBIT);
+    tb->file = strdup(file);
+
+    if ((fd = open(file, O_RDONLY)) == -1 || fstat(fd, &st) == -1)
+    {
+        fatal("Cannot open %s\n", file);
+    }
+
+    tb->size = st.st_size;
+    if (tb->size < 16 ||
+        (tb->data = (unsigned char *) mmap(NULL, tb->size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+    {
+        fatal("Cannot map %s\n", file);
+    }
+    close(fd);
+
+    tb->signature = getword(tb, 0);
+    if (tb->signature != TWOBIT_SIGNATURE)
+    {
+        tb->swapped = 1;
+        if ((tb->signature = getword(tb, 0)) != TWOBIT_SIGNATURE)
+        {
+            fatal("%s not a 2bit file\n", file);
+        }
+    }
+    tb->version = getword(tb, 4);
+    tb->sequenceNo = getword(tb, 8);
+    tb->reserved = getword(tb, 12);
+
+    FRALLOC(tb->sequences, MAX(tb->sequenceNo, 1), TWOBIT_SEQUENCE);
+    offset = 16;
+    for (i=0; i<tb->sequenceNo; i++)
+    {
+        if (offset >= tb->size)
+        {
+            fatal("%s is truncated\n", file);
+        }
+        nameLength = tb->data[offset++];
+        if (offset + nameLength > tb->size)
+        {
+            fatal("%s is truncated\n", file);
+        }
+        tb->sequences[i].name = strndup((char *) tb->data + offset, nameLength);
+        tb->sequences[i].chromosome = getchromosome(tb->sequences[i].name);
+        offset += nameLength;
+
+        tb->sequences[i].offset = getword(tb, offset);
+        offset += 4;
+        if (tb->version == 1)
+        {
+            tb->sequences[i].offset |= ((uint64_t) getword(tb, offset)) << 32;
+            offset += 4;
+        }
+    }
+
+    return tb;
+}
+
+void twobitclose(TWOBIT *tb)
+{
+    uint32_t i;
+
+    for (i=0; i<tb->sequenceNo; i++)
+    {
+        free(tb->sequences[i].name);
+        free(tb->sequences[i].chromosome);
+        free(tb->sequences[i].nBlockStarts);
+        free(tb->sequences[i].maskBlockStarts);
+    }
+
+    munmap(tb->data, tb->size);
+    free(tb->sequences);
+    free(tb->file);
+    free(tb);
+}
+
+static uint32_t *getwords(TWOBIT *tb, size_t offset, uint32_t n)
+{
+    uint32_t *words;
+    uint32_t i;
+
+    FRALLOC(words, 2*n + 1, uint32_t);
+    for (i=0; i<2*n; i++)
+    {
+        words[i] = getword(tb, offset + 4*i);
+    }
+
+    return words;
+}
+
+void twobitload(TWOBIT *tb, int sequence)
+{
+    TWOBIT_SEQUENCE *seq = &tb->sequences[sequence];
+    size_t offset = seq->offset;
+
+    if (seq->loaded)
+    {
+        return;
+    }
+
+    seq->dnaSize = getword(tb, offset);
+    seq->nBlockNo = getword(tb, offset+4);
+    seq->nBlockStarts = getwords(tb, offset+8, seq->nBlockNo);
+    seq->nBlockSizes = seq->nBlockStarts + seq->nBlockNo;
+    offset += 8 + 8*((size_t)seq->nBlockNo);
+
+    seq->maskBlockNo = getword(tb, offset);
+    seq->maskBlockStarts = getwords(tb, offset+4, seq->maskBlockNo);
+    seq->maskBlockSizes = seq->maskBlockStarts + seq->maskBlockNo;
+    offset += 4 + 8*((size_t)seq->maskBlockNo);
+
+    /* reserved word */
+    offset += 4;
+
+    if (offset + (seq->dnaSize+3)/4 > tb->size)
+    {
+        fatal("%s is truncated in %s\n", tb->file, seq->name);
+    }
+    seq->packedDNA = tb->data + offset;
+    seq->loaded = 1;
+}
+
+int twobitfind(TWOBIT *tb, char *chromosome)
+{
+    uint32_t i;
+
+    if (strcmp(chromosome, "MT") == 0)
+    {
+        chromosome = "M";
+    }
+
+    for (i=0; i<tb->sequenceNo; i++)
+    {
+        if (strcmp(tb->sequences[i].chromosome, chromosome) == 0)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+/* index of the first block ending after start, block lists are sorted by start */
+static uint32_t firstblock(uint32_t *starts, uint32_t *sizes, uint32_t n, uint32_t start)
+{
+    uint32_t lo = 0, hi = n, mid;
+
+    while (lo < hi)
+    {
+        mid = lo + (hi - lo)/2;
+        if (starts[mid] <= start)
+        {
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if (lo > 0 && starts[lo-1] + sizes[lo-1] > start)
+    {
+        --lo;
+    }
+
+    return lo;
+}
+
+void twobitgetsequence(TWOBIT *tb, int sequence, uint32_t start, uint32_t end, char *out, int softMask)
+{
+    TWOBIT_SEQUENCE *seq = &tb->sequences[sequence];
+    uint32_t pos, b, blockStart, blockEnd;
+    unsigned char *packed;
+    char *s = out;
+
+    twobitload(tb, sequence);
+    end = MIN(end, seq->dnaSize);
+    if (start >= end)
+    {
+        out[0] = '\0';
+        return;
+    }
+
+    /* partial leading byte, whole bytes through the table, partial trailing byte */
+    packed = seq->packedDNA + start/4;
+    pos = start;
+    if (pos % 4)
+    {
+        for (; pos % 4 && pos < end; pos++)
+        {
+            *s++ = baseTable[*packed][pos % 4];
+        }
+        ++packed;
+    }
+    for (; pos + 4 <= end; pos += 4)
+    {
+        memcpy(s, baseTable[*packed++], 4);
+        s += 4;
+    }
+    for (; pos < end; pos++)
+    {
+        *s++ = baseTable[*packed][pos % 4];
+    }
+    *s = '\0';
+
+    for (b=firstblock(seq->nBlockStarts, seq->nBlockSizes, seq->nBlockNo, start);
+         b<seq->nBlockNo && seq->nBlockStarts[b]<end; b++)
+    {
+        blockStart = MAX(seq->nBlockStarts[b], start);
+        blockEnd = MIN(seq->nBlockStarts[b] + seq->nBlockSizes[b], end);
+        if (blockStart < blockEnd)
+        {
+            memset(out + (blockStart - start), 'N', blockEnd - blockStart);
+        }
+    }
+
+    if (softMask)
+    {
+        for (b=firstblock(seq->maskBlockStarts, seq->maskBlockSizes, seq->maskBlockNo, start);
+             b<seq->maskBlockNo && seq->maskBlockStarts[b]<end; b++)
+        {
+            blockStart = MAX(seq->maskBlockStarts[b], start);
+            blockEnd = MIN(seq->maskBlockStarts[b] + seq->maskBlockSizes[b], end);
+            for (pos=blockStart; pos<blockEnd; pos++)
+            {
+                out[pos - start] = tolower(out[pos - start]);
+            }
+        }
+    }
+}
+
+static FLANK_QUERY *sortQueries;
+
+static int comparequeries(const void *a, const void *b)
+{
+    FLANK_QUERY *q1 = &sortQueries[*(int *)a];
+    FLANK_QUERY *q2 = &sortQueries[*(int *)b];
+
+    if (q1->sequence != q2->sequence)
+    {
+        return q1->sequence < q2->sequence ? -1 : 1;
+    }
+    if (q1->position != q2->position)
+    {
+        return q1->position < q2->position ? -1 : 1;
+    }
+
+    return *(int *)a - *(int *)b;
+}
+
+void twobitgetflanks(TWOBIT *tb, FLANK_QUERY *queries, int queryNo, int softMask)
+{
+    FLANK_QUERY *q;
+    int *order;
+    int i, fivePrimeLength, length;
+    uint32_t start, end;
+    char *sequence = NULL;
+    size_t cap = 0;
+
+    /* visit the queries in file order so the mapping is read front to back */
+    FRALLOC(order, MAX(queryNo, 1), int);
+    for (i=0; i<queryNo; i++)
+    {
+        order[i] = i;
+    }
+    sortQueries = queries;
+    qsort(order, queryNo, sizeof(int), comparequeries);
+    madvise(tb->data, tb->size, MADV_SEQUENTIAL);
+
+    for (i=0; i<queryNo; i++)
+    {
+        q = &queries[order[i]];
+        q->flanks = NULL;
+
+        if (q->sequence < 0 || q->position == 0)
+        {
+            continue;
+        }
+
+        twobitload(tb, q->sequence);
+        if (q->position > tb->sequences[q->sequence].dnaSize)
+        {
+            continue;
+        }
+
+        /* the 5' arm is shortened at the start of a sequence */
+        fivePrimeLength = MIN((uint32_t) q->fivePrimeLength, q->position - 1);
+        start = q->position - 1 - fivePrimeLength;
+        end = q->position + q->threePrimeLength;
+        length = end - start;
+
+        if (cap < (size_t) length + 1)
+        {
+            cap = length + 1;
+            sequence = (char *) xrealloc(sequence, cap);
+        }
+        twobitgetsequence(tb, q->sequence, start, end, sequence, softMask);
+        length = strlen(sequence);
+
+        q->flanks = (char *) xrealloc(NULL, length + 5);
+        memcpy(q->flanks, sequence, fivePrimeLength);
+        sprintf(q->flanks + fivePrimeLength, "[%c/ ]%s", sequence[fivePrimeLength], sequence + fivePrimeLength + 1);
+    }
+
+    free(sequence);
+    free(order);
+}
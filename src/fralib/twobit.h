@@ -0,0 +1,59 @@
+#include <stdint.h>
+#include <stddef.h>
+
+#define TWOBIT_SIGNATURE 0x1A412743
+
+/* a sequence record, its block lists are read on first use */
+typedef struct
+{
+    char *name;
+    char *chromosome;
+    uint64_t offset;
+    uint32_t dnaSize;
+    uint32_t nBlockNo;
+    uint32_t *nBlockStarts;
+    uint32_t *nBlockSizes;
+    uint32_t maskBlockNo;
+    uint32_t *maskBlockStarts;
+    uint32_t *maskBlockSizes;
+    unsigned char *packedDNA;
+    int loaded;
+} TWOBIT_SEQUENCE;
+
+typedef struct
+{
+    char *file;
+    unsigned char *data;
+    size_t size;
+    int swapped;
+    uint32_t signature;
+    uint32_t version;
+    uint32_t sequenceNo;
+    uint32_t reserved;
+    TWOBIT_SEQUENCE *sequences;
+} TWOBIT;
+
+/*
+ * a flank extraction request, position is 1-based.  flanks is set to
+ * 5'[X/ ]3' as fratbi::getSequence prints it, or NULL when the sequence
+ * is not in the 2bit file or the position is off its end.
+ */
+typedef struct
+{
+    int sequence;
+    uint32_t position;
+    int fivePrimeLength;
+    int threePrimeLength;
+    char *flanks;
+} FLANK_QUERY;
+
+TWOBIT *twobitopen(char *file) ;
+void twobitclose(TWOBIT *tb) ;
+void twobitload(TWOBIT *tb, int sequence) ;
+int twobitfind(TWOBIT *tb, char *chromosome) ;
+
+/* 0-based [start, end), N blocks are filled with N and masked blocks lowercased if softMask */
+void twobitgetsequence(TWOBIT *tb, int sequence, uint32_t start, uint32_t end, char *out, int softMask) ;
+
+/* answers all queries in one sweep through the file in (sequence, position) order */
+void twobitgetflanks(TWOBIT *tb, FLANK_QUERY *queries, int queryNo, int softMask) ;
@@ -0,0 +1,515 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fralib.h>
+
+#define BLOCK_SIZE (16*1024*1024)
+
+#define RECODE_TOP            0
+#define RECODE_BOT            1
+#define RECODE_AFFYREF        2
+#define RECODE_FORWARD        3
+#define RECODE_FORWARD_TOPBOT 4
+
+static char *recodings[] = {"top", "bot", "affyref", "forward", "forward-topbot"};
+static char *recodingWarnings[] = {"topbotifiable", "topbotifiable", "affyrefable", "forwardable", "forward-topbotifiable"};
+
+static inline int isflankallele(char c)
+{
+    return c == 'A' || c == 'C' || c == 'G' || c == 'T' || c == '-';
+}
+
+/* the alleles of the first [X/Y] of the flanks, X and Y runs of ACGT- */
+static int flankalleles(char *flanks, char **a, int *aLength, char **b, int *bLength)
+{
+    char *s, *t;
+
+    for (s=flanks; (s = strchr(s, '[')) != NULL; s++)
+    {
+        for (t=s+1; isflankallele(*t); t++);
+        if (t == s+1 || *t != '/')
+        {
+            continue;
+        }
+        *a = s+1;
+        *aLength = t - *a;
+
+        for (s=t++; isflankallele(*t); t++);
+        if (t == s+1 || *t != ']')
+        {
+            continue;
+        }
+        *b = s+1;
+        *bLength = t - *b;
+
+        return 1;
+    }
+
+    return 0;
+}
+
+/* alleles in the X/Y format, X and Y runs of ACGT- */
+static int splitalleles(char *alleles, char **a, int *aLength, char **b, int *bLength)
+{
+    char *s;
+
+    for (s=alleles; isflankallele(*s); s++);
+    if (s == alleles || *s != '/')
+    {
+        return 0;
+    }
+    *a = alleles;
+    *aLength = s - alleles;
+
+    for (*b=++s; isflankallele(*s); s++);
+    *bLength = s - *b;
+
+    return *bLength > 0 && *s == '\0';
+}
+
+/* reverse complement as fralib's reverseComplement, dies on an invalid base */
+static char *xreversecomplement(char *s, int n)
+{
+    char *out;
+    int c;
+
+    FRALLOC(out, n+1, char);
+    if ((c = reversecomplement(s, n, out)) != 0)
+    {
+        fatal("Invalid base: %c\n", c);
+    }
+
+    return out;
+}
+
+static int sameallele(char *a, int aLength, char *b, int bLength)
+{
+    return aLength == bLength && strncmp(a, b, aLength) == 0;
+}
+
+/* the alleles of the mk file have to agree with the flanks on their alleles-strand */
+static void checkalleles(char *snp, char *alleles, char *allelesStrand, char *flanks)
+{
+    char *fa, *fb, *a, *b, *ra, *rb;
+    int faLength, fbLength, aLength, bLength;
+
+    if (flankalleles(flanks, &fa, &faLength, &fb, &fbLength) && !(faLength == 1 && *fa == '-' && fbLength == 1 && *fb == '-'))
+    {
+        if (strcmp(allelesStrand, "ref") != 0 && strcmp(allelesStrand, "opp") != 0)
+        {
+            fatal("%s: %s not recognised\n", snp, allelesStrand);
+        }
+        if (!splitalleles(alleles, &a, &aLength, &b, &bLength))
+        {
+            fatal("%s: %s not in correct format\n", snp, alleles);
+        }
+
+        if (strcmp(allelesStrand, "opp") == 0)
+        {
+            ra = xreversecomplement(a, aLength);
+            rb = xreversecomplement(b, bLength);
+            a = ra;
+            b = rb;
+        }
+
+        if (!(sameallele(fa, faLength, a, aLength) && sameallele(fb, fbLength, b, bLength)) &&
+            !(sameallele(fa, faLength, b, bLength) && sameallele(fb, fbLength, a, aLength)))
+        {
+            fatal("%s: %s conflict with %s\n", snp, alleles, flanks);
+        }
+
+        if (strcmp(allelesStrand, "opp") == 0)
+        {
+            free(a);
+            free(b);
+        }
+    }
+    else if (strcmp(flanks, "n/a") != 0 || strcmp(alleles, "n/a") != 0 || strcmp(allelesStrand, "n/a") != 0)
+    {
+        fatal("%s: %s not in correct flanks format\n", snp, flanks);
+    }
+}
+
+/*
+ * recodes the alleles of a marker as frecode does, appending the recoded
+ * alleles and alleles-strand to out, returns 1 if the genotypes are swapped
+ */
+static int recodemarker(int recoding, char *snp, char *alleles, char *allelesStrand, char *flanks, char *strand, BUFFER *out)
+{
+    char *copy, *allele[2], *recoded[2], *s;
+    int i, orientation = STRAND_UNDEFINED, ref = 0, complement, alleleOrder, desiredOrder = -1, swap, alleleNo;
+
+    checkalleles(snp, alleles, allelesStrand, flanks);
+
+    if (recoding == RECODE_TOP || recoding == RECODE_BOT)
+    {
+        orientation = topbotstrand(flanks);
+        ref = orientation == (recoding == RECODE_TOP ? STRAND_TOP : STRAND_BOT);
+        desiredOrder = recoding == RECODE_TOP ? -1 : 1;
+    }
+    else if (recoding == RECODE_AFFYREF)
+    {
+        /* exception class SNPs have their reference strand the other way */
+        orientation = affyrefstrand(flanks);
+        if (orientation != STRAND_UNDEFINED && isaffymetrixexception(snp))
+        {
+            orientation = orientation == STRAND_AFFYREF ? STRAND_AFFYOPP : STRAND_AFFYREF;
+        }
+        ref = orientation == STRAND_AFFYREF;
+    }
+    else if (recoding == RECODE_FORWARD)
+    {
+        if (strcmp(strand, "n/a") == 0)
+        {
+            orientation = STRAND_UNDEFINED;
+        }
+        else if (strcmp(strand, "+") == 0 || strcmp(strand, "-") == 0)
+        {
+            /* any defined orientation, the forward strand is the reference */
+            orientation = STRAND_TOP;
+            ref = *strand == '+';
+        }
+        else
+        {
+            fatal("invalid strand: %s\n", strand);
+        }
+    }
+    else
+    {
+        orientation = topbotstrand(flanks);
+        if (strcmp(strand, "n/a") == 0 || orientation == STRAND_UNDEFINED)
+        {
+            orientation = STRAND_UNDEFINED;
+        }
+        else if (strcmp(strand, "+") == 0 || strcmp(strand, "-") == 0)
+        {
+            ref = *strand == '+';
+        }
+        else
+        {
+            fatal("invalid strand: %s\n", strand);
+        }
+    }
+
+    if (orientation == STRAND_UNDEFINED)
+    {
+        fprintf(stderr, "%s is not %s, original encoding retained\n", snp, recodingWarnings[recoding]);
+        bufferappend(out, alleles, strlen(alleles));
+        bufferappendchar(out, '\t');
+        bufferappend(out, allelesStrand, strlen(allelesStrand));
+        return 0;
+    }
+
+    copy = strdup(alleles);
+    alleleNo = splitline(copy, allele, 2, '/');
+    if (alleleNo == 1)
+    {
+        allele[1] = "";
+    }
+
+    complement = strcmp(ref ? "ref" : "opp", allelesStrand) != 0;
+    if (complement)
+    {
+        for (i=0; i<alleleNo; i++)
+        {
+            recoded[i] = xreversecomplement(allele[i], strlen(allele[i]));
+        }
+    }
+    else
+    {
+        recoded[0] = allele[0];
+        recoded[1] = allele[1];
+    }
+
+    /* the order of the alleles after complementing, -1 for ordered and 1 for reverse ordered */
+    if (recoding == RECODE_FORWARD || recoding == RECODE_FORWARD_TOPBOT)
+    {
+        alleleOrder = strcmp(recoded[0], recoded[1]) < 0 ? -1 : 1;
+        if (recoding == RECODE_FORWARD_TOPBOT)
+        {
+            desiredOrder = (orientation == STRAND_TOP) ^ complement ? -1 : 1;
+        }
+    }
+    else
+    {
+        alleleOrder = strcmp(allele[0], allele[1]) < 0 ? -1 : 1;
+        alleleOrder = complement ? -alleleOrder : alleleOrder;
+    }
+    swap = alleleOrder != desiredOrder;
+
+    if (alleleNo == 1)
+    {
+        bufferappend(out, recoded[0], strlen(recoded[0]));
+    }
+    else
+    {
+        if (swap)
+        {
+            s = recoded[0];
+            recoded[0] = recoded[1];
+            recoded[1] = s;
+        }
+        bufferappend(out, recoded[0], strlen(recoded[0]));
+        bufferappendchar(out, '/');
+        bufferappend(out, recoded[1], strlen(recoded[1]));
+    }
+    bufferappendchar(out, '\t');
+    bufferappend(out, ref ? "ref" : "opp", 3);
+
+    if (complement)
+    {
+        for (i=0; i<alleleNo; i++)
+        {
+            free(recoded[i]);
+        }
+    }
+    free(copy);
+
+    return swap;
+}
+
+int main(int argc, char **argv)
+{
+    int i, recoding = -1, colNo, n, snpCol, allelesCol, allelesStrandCol, flanksCol, strandCol;
+    char *MKFILE = NULL, *STRAND = NULL, *TGFILE, *recodedMkFile, *recodedTgFile;
+    char *line = NULL, **fields, *next, *end, *run, *g, *f, *s;
+    char *none = "";
+    size_t cap = 0, swapCap = 0, used, m;
+    long length, k, unknownNo = 0;
+    int eof = 0;
+    uint8_t *swaps = NULL;
+    KEY_TABLE markers;
+    BUFFER out = {NULL, 0, 0}, block = {NULL, 0, 0};
+    FILE *fp, *ofp;
+
+    if(argc==1)
+    {
+        printf("usage: frecoder [options] -m <mk-file> -s <strand> <tg-file>\n");
+        printf("\n");
+        printf("       -m       mk file\n");
+        printf("                a)snp-id\n");
+        printf("                b)alleles\n");
+        printf("                c)alleles-strand\n");
+        printf("                d)flanks\n");
+        printf("                e)strand (required only for forward and forward-topbot)\n");
+        printf("       -s       top, bot, affyref, forward or forward-topbot\n");
+        printf("       tg-file  tg file, .gz files are read through gunzip\n");
+        printf("\n");
+        printf("       example: frecoder -m pscalare.mk -s top pscalare.tg\n");
+        printf("\n");
+        printf("       The recoding engine of frecode.  Writes recoded-<mk-file> and\n");
+        printf("       recoded-<tg-file>.  The mk file is recoded first, the genotypes\n");
+        printf("       of the swapped SNPs are then rewritten in the blocks of the tg\n");
+        printf("       file as they are read.  Strands are worked out from the flanks\n");
+        printf("       with tables of complements and IUPAC codes, and the Affymetrix\n");
+        printf("       exception class is a perfect hash built into fralib.  Genotypes of\n");
+        printf("       SNPs that are not in the mk file are copied as they are.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"m:s:")) != -1)
+    {
+        switch(i)
+        {
+            case 'm':
+                MKFILE = optarg;
+                break;
+            case 's':
+                STRAND = optarg;
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (optind != argc-1 || MKFILE == NULL || STRAND == NULL)
+    {
+        fprintf(stderr, "An mk file, a strand and 1 tg file expected\n");
+        exit(1);
+    }
+    for (i=0; i<5; i++)
+    {
+        if (strcmp(STRAND, recodings[i]) == 0)
+        {
+            recoding = i;
+        }
+    }
+    if (recoding == -1)
+    {
+        fatal("%s not a strand, top, bot, affyref, forward or forward-topbot expected\n", STRAND);
+    }
+    TGFILE = argv[optind];
+
+    /* recode the mk file */
+    fp = zopen(MKFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", MKFILE);
+    }
+    colNo = countfields(line, '\t');
+    FRALLOC(fields, colNo, char *);
+    splitline(line, fields, colNo, '\t');
+    snpCol = getlabel(fields, colNo, "snp-id", MKFILE);
+    allelesCol = getlabel(fields, colNo, "alleles", MKFILE);
+    allelesStrandCol = getlabel(fields, colNo, "alleles-strand", MKFILE);
+    flanksCol = getlabel(fields, colNo, "flanks", MKFILE);
+    if (recoding == RECODE_FORWARD || recoding == RECODE_FORWARD_TOPBOT)
+    {
+        strandCol = getlabel(fields, colNo, "strand", MKFILE);
+    }
+    else
+    {
+        strandCol = findlabel(fields, colNo, "strand");
+    }
+
+    recodedMkFile = (char *) xrealloc(NULL, strlen(MKFILE) + 16);
+    sprintf(recodedMkFile, "recoded-%s.mk", fileprefix(MKFILE));
+    ofp = xopen(recodedMkFile, "w");
+    for (i=0; i<colNo; i++)
+    {
+        if (i != allelesCol && i != allelesStrandCol && i != flanksCol)
+        {
+            fprintf(ofp, "%s\t", fields[i]);
+        }
+    }
+    fprintf(ofp, "alleles\talleles-strand\tflanks\n");
+
+    /* the last row of a SNP decides its recoding, as in frecode */
+    memset(&markers, 0, sizeof(KEY_TABLE));
+    while ((length = readline(fp, &line, &cap)) != -1)
+    {
+        n = splitline(line, fields, colNo, '\t');
+        for (i=n; i<colNo; i++)
+        {
+            fields[i] = none;
+        }
+
+        out.size = 0;
+        for (i=0; i<n; i++)
+        {
+            if (i != allelesCol && i != allelesStrandCol && i != flanksCol)
+            {
+                bufferappend(&out, fields[i], strlen(fields[i]));
+                bufferappendchar(&out, '\t');
+            }
+        }
+
+        k = keytableget(&markers, fields[snpCol], strlen(fields[snpCol]));
+        if (markers.n > swapCap)
+        {
+            swapCap = 2*markers.n;
+            swaps = (uint8_t *) xrealloc(swaps, swapCap);
+        }
+        swaps[k] = recodemarker(recoding, fields[snpCol], fields[allelesCol], fields[allelesStrandCol],
+                                fields[flanksCol], strandCol == -1 ? none : fields[strandCol], &out);
+
+        bufferappendchar(&out, '\t');
+        bufferappend(&out, fields[flanksCol], strlen(fields[flanksCol]));
+        bufferappendchar(&out, '\n');
+        fwrite(out.data, 1, out.size, ofp);
+    }
+    zclose(fp, MKFILE);
+    fclose(ofp);
+
+    /* rewrite the genotypes of swapped SNPs in place, rows are copied out as runs */
+    fp = zopen(TGFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", TGFILE);
+    }
+    m = (s = strchr(line, '\t')) == NULL ? strlen(line) : (size_t) (s - line);
+    if (!(m == 6 && strncmp(line, "snp-id", 6) == 0) && !(m == 9 && strncmp(line, "marker-id", 9) == 0))
+    {
+        fatal("%s not a tg file\n", TGFILE);
+    }
+
+    recodedTgFile = (char *) xrealloc(NULL, strlen(TGFILE) + 16);
+    sprintf(recodedTgFile, "recoded-%s.tg", fileprefix(TGFILE));
+    ofp = xopen(recodedTgFile, "w");
+    fprintf(ofp, "%s\n", line);
+
+    while (!eof)
+    {
+        if (block.cap - block.size < BLOCK_SIZE/2)
+        {
+            block.cap = block.size + BLOCK_SIZE;
+            block.data = (char *) xrealloc(block.data, block.cap);
+        }
+
+        m = fread(block.data + block.size, 1, block.cap - block.size - 1, fp);
+        eof = m < block.cap - block.size - 1;
+        block.size += m;
+        if (eof && block.size && block.data[block.size-1] != '\n')
+        {
+            block.data[block.size++] = '\n';
+        }
+
+        for (end=block.data + block.size; end>block.data && end[-1]!='\n'; --end);
+        if (end == block.data)
+        {
+            continue;
+        }
+        used = end - block.data;
+
+        for (run=line=block.data; line<block.data + used; line=next+1)
+        {
+            next = memchr(line, '\n', block.data + used - line);
+            end = next > line && next[-1] == '\r' ? next - 1 : next;
+
+            m = (s = memchr(line, '\t', end - line)) == NULL ? (size_t) (end - line) : (size_t) (s - line);
+            if ((k = keytablefind(&markers, line, m, hashbytes(line, m))) == -1)
+            {
+                fprintf(stderr, "%.*s: not in %s, genotypes copied as they are\n", (int) m, line, MKFILE);
+            }
+            else
+            {
+                for (g=line+m; g<end; g=f)
+                {
+                    ++g;
+                    if ((f = memchr(g, '\t', end - g)) == NULL)
+                    {
+                        f = end;
+                    }
+                    if (f - g == 1 && *g >= '0' && *g <= '2')
+                    {
+                        if (swaps[k])
+                        {
+                            *g = '0' + '2' - *g;
+                        }
+                    }
+                    else if (f - g != 2 || g[0] != '-' || g[1] != '1')
+                    {
+                        fprintf(stderr, "%.*s: Unrecognised genotype: %.*s\n", (int) m, line, (int) (f - g), g);
+                        ++unknownNo;
+                    }
+                }
+            }
+
+            /* \r\n line ends are written as \n */
+            if (end != next)
+            {
+                fwrite(run, 1, end - run, ofp);
+                fputc('\n', ofp);
+                run = next + 1;
+            }
+        }
+        fwrite(run, 1, block.data + used - run, ofp);
+
+        memmove(block.data, block.data + used, block.size - used);
+        block.size -= used;
+    }
+    zclose(fp, TGFILE);
+    fclose(ofp);
+
+    if (unknownNo)
+    {
+        fprintf(stderr, "%ld unrecognised genotypes copied as they are\n", unknownNo);
+    }
+
+    return 0;
+}
@@ -0,0 +1,474 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <fralib.h>
+
+#define BLOCK_SIZE (16*1024*1024)
+
+/*
+ * rows kept with -p are held until the end, in memory up to a limit and
+ * then in a temporary file, and printed in the order of the row sieve
+ */
+typedef struct
+{
+    BUFFER memory;
+    size_t limit;
+    FILE *spill;
+    long spillSize;
+    int64_t *offsets;
+    uint32_t *lengths;
+} REORDER_BUFFER;
+
+static void readsieve(char *file, KEY_TABLE *sieve)
+{
+    FILE *fp;
+    char *line = NULL, *s;
+    size_t cap = 0;
+    long length, lineNo = 0, duplicateNo = 0;
+    uint32_t n;
+
+    fp = zopen(file);
+    while ((length = readline(fp, &line, &cap)) != -1)
+    {
+        n = (s = memchr(line, '\t', length)) == NULL ? length : s - line;
+
+        /* a sample-id or snp-id header only gives the orientation of the sieve */
+        if (++lineNo == 1)
+        {
+            fprintf(stderr, "Sieve Column Label    : %.*s\n", n, line);
+            if ((n == 9 && strncmp(line, "sample-id", 9) == 0) || (n == 6 && strncmp(line, "snp-id", 6) == 0))
+            {
+                continue;
+            }
+            fprintf(stderr, "Label not snp-id or sample-id, added to sieve list\n");
+        }
+
+        if (keytablefind(sieve, line, n, hashbytes(line, n)) == -1)
+        {
+            keytableadd(sieve, line, n, hashbytes(line, n));
+        }
+        else
+        {
+            ++duplicateNo;
+        }
+    }
+    zclose(fp, file);
+    free(line);
+
+    if (lineNo == 0)
+    {
+        fatal("%s is empty\n", file);
+    }
+    if (duplicateNo)
+    {
+        fprintf(stderr, "Duplicate values found in %s\n", file);
+    }
+}
+
+static void reorderstore(REORDER_BUFFER *rb, uint32_t rank, char *line, uint32_t n)
+{
+    if (rb->offsets[rank] != -1)
+    {
+        return;
+    }
+
+    rb->lengths[rank] = n;
+    if (rb->memory.size + n <= rb->limit)
+    {
+        rb->offsets[rank] = rb->memory.size;
+        bufferappend(&rb->memory, line, n);
+        return;
+    }
+
+    if (rb->spill == NULL && (rb->spill = tmpfile()) == NULL)
+    {
+        fatal("Cannot open a temporary file\n");
+    }
+    rb->offsets[rank] = -(rb->spillSize + 2);
+    if (fwrite(line, 1, n, rb->spill) != n)
+    {
+        fatal("Cannot write to a temporary file\n");
+    }
+    rb->spillSize += n;
+}
+
+static void reorderflush(REORDER_BUFFER *rb, uint32_t rankNo, FILE *out)
+{
+    char *line = NULL;
+    size_t cap = 0;
+    uint32_t rank;
+
+    if (rb->spill != NULL)
+    {
+        fflush(rb->spill);
+    }
+
+    for (rank=0; rank<rankNo; rank++)
+    {
+        if (rb->offsets[rank] >= 0)
+        {
+            fwrite(rb->memory.data + rb->offsets[rank], 1, rb->lengths[rank], out);
+        }
+        else if (rb->offsets[rank] < -1)
+        {
+            if (cap < rb->lengths[rank])
+            {
+                cap = rb->lengths[rank];
+                line = (char *) xrealloc(line, cap);
+            }
+            if (fseek(rb->spill, -rb->offsets[rank] - 2, SEEK_SET) == -1 ||
+                fread(line, 1, rb->lengths[rank], rb->spill) != rb->lengths[rank])
+            {
+                fatal("Cannot read a temporary file\n");
+            }
+            fwrite(line, 1, rb->lengths[rank], out);
+        }
+    }
+
+    free(line);
+}
+
+int main(int argc, char **argv)
+{
+    int i, j, colNo = 0, maxCol = 0, selectedNo = 0, runNo = 0;
+    int minusRows = 0, minusCols = 0, preserveRows = 0, preserveCols = 0, bufferSize = 256;
+    char *ROWSIEVEFILE = NULL, *COLSIEVEFILE = NULL, *OUTFILE = "-", *INFILE;
+    char *header = NULL, **labels, *line, *next, *end, *run, *s;
+    char **starts = NULL;
+    int *cols = NULL, *runStarts = NULL, *runEnds = NULL, *colOf;
+    size_t cap = 0, n, used;
+    long k, rowNo = 0, sievedRowNo = 0;
+    int eof = 0;
+    KEY_TABLE rowSieve, colSieve;
+    REORDER_BUFFER rb;
+    BUFFER block = {NULL, 0, 0}, out = {NULL, 0, 0};
+    FILE *fp, *ofp;
+
+    if(argc==1)
+    {
+        printf("usage: fsift [options] <file>\n");
+        printf("\n");
+        printf("       -r       row sieve, the first column lists the rows to extract\n");
+        printf("       -c       column sieve, the first column lists the columns to extract\n");
+        printf("                (a sample-id or snp-id header of a sieve is ignored)\n");
+        printf("       -m       extract all but the rows in the row sieve\n");
+        printf("       -M       extract all but the columns in the column sieve\n");
+        printf("       -p       preserve the order of the row sieve\n");
+        printf("       -P       preserve the order of the column sieve\n");
+        printf("       -b       MB of rows held in memory for -p (256 default), the rest\n");
+        printf("                are held in a temporary file\n");
+        printf("       -o       output file (default standard output)\n");
+        printf("       file     tab delimited file, .gz files are read through gunzip\n");
+        printf("\n");
+        printf("       example: fsift -r paltum.mk -c paltum.sa -o sieved-pscalare.tg pscalare.tg\n");
+        printf("\n");
+        printf("       The sieving engine of fsieve.  Rows and columns are sieved in one pass,\n");
+        printf("       on the label in the first column and on the header.  Rows are copied\n");
+        printf("       from the input buffer as is and columns are gathered as runs of\n");
+        printf("       adjacent columns.  The first column and the header are always kept.\n");
+        printf("       -p and -P are ignored with -m and -M and keep the first row of a label.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"r:c:mMpPb:o:")) != -1)
+    {
+        switch(i)
+        {
+            case 'r':
+                ROWSIEVEFILE = optarg;
+                break;
+            case 'c':
+                COLSIEVEFILE = optarg;
+                break;
+            case 'm':
+                minusRows = 1;
+                break;
+            case 'M':
+                minusCols = 1;
+                break;
+            case 'p':
+                preserveRows = 1;
+                break;
+            case 'P':
+                preserveCols = 1;
+                break;
+            case 'b':
+                bufferSize = atoi(optarg);
+                break;
+            case 'o':
+                OUTFILE = optarg;
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (optind != argc-1 || (ROWSIEVEFILE == NULL && COLSIEVEFILE == NULL) || bufferSize < 1)
+    {
+        fprintf(stderr, "A row or column sieve and 1 file expected\n");
+        exit(1);
+    }
+
+    INFILE = argv[optind];
+    preserveRows = preserveRows && !minusRows && ROWSIEVEFILE != NULL;
+    preserveCols = preserveCols && !minusCols;
+
+    memset(&rowSieve, 0, sizeof(KEY_TABLE));
+    memset(&colSieve, 0, sizeof(KEY_TABLE));
+    if (ROWSIEVEFILE != NULL)
+    {
+        readsieve(ROWSIEVEFILE, &rowSieve);
+    }
+    if (COLSIEVEFILE != NULL)
+    {
+        readsieve(COLSIEVEFILE, &colSieve);
+    }
+
+    fp = zopen(INFILE);
+    ofp = xopen(OUTFILE, "w");
+    if (readline(fp, &header, &cap) == -1)
+    {
+        fatal("%s is empty\n", INFILE);
+    }
+
+    if (COLSIEVEFILE != NULL)
+    {
+        colNo = countfields(header, '\t');
+        FRALLOC(labels, colNo, char *);
+        FRALLOC(cols, colNo, int);
+        FRALLOC(colOf, MAX(colSieve.n, 1), int);
+        splitline(header, labels, colNo, '\t');
+
+        if (preserveCols)
+        {
+            /* the last column of a label, in the order of the sieve */
+            for (k=0; k<colSieve.n; k++)
+            {
+                colOf[k] = -1;
+            }
+            for (i=1; i<colNo; i++)
+            {
+                if ((k = keytablefind(&colSieve, labels[i], strlen(labels[i]), hashbytes(labels[i], strlen(labels[i])))) != -1)
+                {
+                    colOf[k] = i;
+                }
+            }
+            for (k=0; k<colSieve.n; k++)
+            {
+                if (colOf[k] != -1)
+                {
+                    cols[selectedNo++] = colOf[k];
+                }
+            }
+        }
+        else
+        {
+            for (i=1; i<colNo; i++)
+            {
+                if (minusCols ^ (keytablefind(&colSieve, labels[i], strlen(labels[i]), hashbytes(labels[i], strlen(labels[i]))) != -1))
+                {
+                    cols[selectedNo++] = i;
+                }
+            }
+        }
+
+        /* adjacent selected columns are copied together */
+        FRALLOC(runStarts, MAX(selectedNo, 1), int);
+        FRALLOC(runEnds, MAX(selectedNo, 1), int);
+        for (i=0; i<selectedNo; i++)
+        {
+            if (runNo && cols[i] == runEnds[runNo-1] + 1)
+            {
+                runEnds[runNo-1] = cols[i];
+            }
+            else
+            {
+                runStarts[runNo] = runEnds[runNo] = cols[i];
+                ++runNo;
+            }
+            maxCol = MAX(maxCol, cols[i]);
+        }
+
+        fprintf(ofp, "%s", labels[0]);
+        for (i=0; i<selectedNo; i++)
+        {
+            fprintf(ofp, "\t%s", labels[cols[i]]);
+        }
+        fprintf(ofp, "\n");
+        FRALLOC(starts, maxCol + 2, char *);
+        free(colOf);
+        free(labels);
+    }
+    else
+    {
+        fprintf(ofp, "%s\n", header);
+    }
+
+    if (preserveRows)
+    {
+        memset(&rb, 0, sizeof(REORDER_BUFFER));
+        rb.limit = (size_t) bufferSize*1024*1024;
+        FRALLOC(rb.offsets, MAX(rowSieve.n, 1), int64_t);
+        FRALLOC(rb.lengths, MAX(rowSieve.n, 1), uint32_t);
+        for (k=0; k<rowSieve.n; k++)
+        {
+            rb.offsets[k] = -1;
+        }
+    }
+
+    while (!eof)
+    {
+        if (block.cap - block.size < BLOCK_SIZE/2)
+        {
+            block.cap = block.size + BLOCK_SIZE;
+            block.data = (char *) xrealloc(block.data, block.cap);
+        }
+
+        n = fread(block.data + block.size, 1, block.cap - block.size - 1, fp);
+        eof = n < block.cap - block.size - 1;
+        block.size += n;
+        if (eof && block.size && block.data[block.size-1] != '\n')
+        {
+            block.data[block.size++] = '\n';
+        }
+
+        for (end=block.data + block.size; end>block.data && end[-1]!='\n'; --end);
+        if (end == block.data)
+        {
+            continue;
+        }
+        used = end - block.data;
+
+        /* run is the start of the rows not yet written, copied as is */
+        run = NULL;
+        for (line=block.data; line<block.data + used; line=next+1)
+        {
+            next = memchr(line, '\n', block.data + used - line);
+            end = next > line && next[-1] == '\r' ? next - 1 : next;
+            ++rowNo;
+
+            k = -1;
+            if (ROWSIEVEFILE != NULL)
+            {
+                s = memchr(line, '\t', end - line);
+                n = s == NULL ? (size_t) (end - line) : (size_t) (s - line);
+                k = keytablefind(&rowSieve, line, n, hashbytes(line, n));
+                if (!(minusRows ^ (k != -1)))
+                {
+                    if (run != NULL)
+                    {
+                        fwrite(run, 1, line - run, ofp);
+                        run = NULL;
+                    }
+                    continue;
+                }
+            }
+            ++sievedRowNo;
+
+            if (COLSIEVEFILE == NULL)
+            {
+                if (preserveRows)
+                {
+                    *end = '\n';
+                    reorderstore(&rb, k, line, end - line + 1);
+                }
+                else if (end == next)
+                {
+                    run = run == NULL ? line : run;
+                }
+                else
+                {
+                    if (run != NULL)
+                    {
+                        fwrite(run, 1, line - run, ofp);
+                        run = NULL;
+                    }
+                    fwrite(line, 1, end - line, ofp);
+                    fputc('\n', ofp);
+                }
+                continue;
+            }
+
+            /* gather the runs of selected columns */
+            for (i=0, s=line; i<=maxCol; i++)
+            {
+                starts[i] = s;
+                if (i == colNo - 1 || (s = memchr(s, '\t', end - s)) == NULL)
+                {
+                    s = end + 1;
+                    ++i;
+                    break;
+                }
+                ++s;
+            }
+            starts[i] = s;
+            if (i <= maxCol)
+            {
+                *end = '\0';
+                fatal("%s: fewer than %d columns in %s\n", INFILE, maxCol + 1, line);
+            }
+
+            out.size = 0;
+            bufferappend(&out, starts[0], starts[1] - 1 - starts[0]);
+            for (j=0; j<runNo; j++)
+            {
+                bufferappendchar(&out, '\t');
+                bufferappend(&out, starts[runStarts[j]], starts[runEnds[j]+1] - 1 - starts[runStarts[j]]);
+            }
+            bufferappendchar(&out, '\n');
+
+            if (preserveRows)
+            {
+                reorderstore(&rb, k, out.data, out.size);
+            }
+            else
+            {
+                fwrite(out.data, 1, out.size, ofp);
+            }
+        }
+
+        if (run != NULL)
+        {
+            fwrite(run, 1, block.data + used - run, ofp);
+        }
+
+        memmove(block.data, block.data + used, block.size - used);
+        block.size -= used;
+    }
+
+    if (preserveRows)
+    {
+        reorderflush(&rb, rowSieve.n, ofp);
+        for (sievedRowNo=0, k=0; k<rowSieve.n; k++)
+        {
+            sievedRowNo += rb.offsets[k] != -1;
+        }
+    }
+
+    if (ROWSIEVEFILE != NULL)
+    {
+        fprintf(stderr, "Sieve File Element No : %u\n", rowSieve.n);
+        fprintf(stderr, "File Element No       : %ld\n", rowNo);
+        fprintf(stderr, "Sieved Element No     : %ld\n", sievedRowNo);
+    }
+    if (COLSIEVEFILE != NULL)
+    {
+        fprintf(stderr, "Sieve File Element No : %u\n", colSieve.n);
+        fprintf(stderr, "File Element No       : %d\n", colNo - 1);
+        fprintf(stderr, "Sieved Element No     : %d\n", selectedNo);
+    }
+    fprintf(stderr, "Sieved File Name      : %s\n", OUTFILE);
+
+    zclose(fp, INFILE);
+    if (ofp != stdout)
+    {
+        fclose(ofp);
+    }
+
+    return 0;
+}
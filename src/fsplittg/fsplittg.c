@@ -0,0 +1,532 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <fralib.h>
+
+#define BLOCK_SIZE (16*1024*1024)
+
+/* a SNP of the mk file, offset is -1 until its row is read from the tg file */
+typedef struct
+{
+    int32_t chromosome;
+    int64_t position;
+    int64_t offset;
+    uint32_t length;
+} SPLIT_SNP;
+
+/* an output file, the present SNPs order[first, last) of a chromosome */
+typedef struct
+{
+    uint32_t chromosome;
+    int chunk;
+    uint32_t first;
+    uint32_t last;
+} SPLIT_JOB;
+
+typedef struct
+{
+    SPLIT_SNP *snps;
+    uint32_t *order;
+    SPLIT_JOB *jobs;
+    int jobNo;
+    int nextJob;
+    pthread_mutex_t lock;
+    KEY_TABLE *chromosomes;
+    char *header;
+    char *name;
+    char *ext;
+    int chunked;
+
+    /* rows are read back from the tg file or its spill, the rows from memoryBase on are in memory */
+    int fd;
+    BUFFER memory;
+    int64_t memoryBase;
+} SPLIT;
+
+static SPLIT_SNP *sortsnps;
+static KEY_TABLE *sortchromosomes;
+
+/* chromosomes as fsplitchrom sorts them, numerically if both are numbers */
+static int comparechromosomes(const void *a, const void *b)
+{
+    char *s1 = keytablekey(sortchromosomes, *(uint32_t *) a);
+    char *s2 = keytablekey(sortchromosomes, *(uint32_t *) b);
+    char *s;
+    long n1, n2;
+
+    for (s=s1; isdigit(*s); s++);
+    if (*s == '\0' && s != s1)
+    {
+        for (s=s2; isdigit(*s); s++);
+        if (*s == '\0' && s != s2)
+        {
+            n1 = atol(s1);
+            n2 = atol(s2);
+            return n1 < n2 ? -1 : (n1 > n2);
+        }
+    }
+
+    return strcmp(s1, s2);
+}
+
+/* by chromosome rank, then position, then mk file order */
+static int comparesnps(const void *a, const void *b)
+{
+    SPLIT_SNP *s1 = &sortsnps[*(uint32_t *) a];
+    SPLIT_SNP *s2 = &sortsnps[*(uint32_t *) b];
+
+    if (s1->chromosome != s2->chromosome)
+    {
+        return s1->chromosome < s2->chromosome ? -1 : 1;
+    }
+    if (s1->position != s2->position)
+    {
+        return s1->position < s2->position ? -1 : 1;
+    }
+
+    return *(uint32_t *) a < *(uint32_t *) b ? -1 : 1;
+}
+
+/* reads rows back, coalescing rows that are adjacent in the tg file */
+static void writerows(SPLIT *sp, SPLIT_JOB *job, FILE *fp, BUFFER *rows)
+{
+    SPLIT_SNP *snp;
+    int64_t start = 0, end = 0;
+    uint32_t i;
+
+    for (i=job->first; i<=job->last; i++)
+    {
+        snp = i < job->last ? &sp->snps[sp->order[i]] : NULL;
+        if (snp != NULL && snp->offset == end && end != start && snp->offset < sp->memoryBase)
+        {
+            end += snp->length;
+            continue;
+        }
+
+        if (end != start)
+        {
+            if ((size_t) (end - start) > rows->cap)
+            {
+                rows->cap = end - start;
+                rows->data = (char *) xrealloc(rows->data, rows->cap);
+            }
+            if (pread(sp->fd, rows->data, end - start, start) != end - start)
+            {
+                fatal("Cannot read rows back\n");
+            }
+            fwrite(rows->data, 1, end - start, fp);
+        }
+        start = end = 0;
+
+        if (snp == NULL)
+        {
+            break;
+        }
+        else if (snp->offset >= sp->memoryBase)
+        {
+            fwrite(sp->memory.data + (snp->offset - sp->memoryBase), 1, snp->length, fp);
+        }
+        else
+        {
+            start = snp->offset;
+            end = start + snp->length;
+        }
+    }
+}
+
+static void *splitworker(void *arg)
+{
+    SPLIT *sp = (SPLIT *) arg;
+    SPLIT_JOB *job;
+    BUFFER rows = {NULL, 0, 0};
+    char file[4096];
+    FILE *fp;
+    int j;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&sp->lock);
+        j = sp->nextJob++;
+        pthread_mutex_unlock(&sp->lock);
+        if (j >= sp->jobNo)
+        {
+            break;
+        }
+
+        job = &sp->jobs[j];
+        if (sp->chunked)
+        {
+            snprintf(file, sizeof(file), "chr%s-%d-%s%s", keytablekey(sp->chromosomes, job->chromosome), job->chunk, sp->name, sp->ext);
+        }
+        else
+        {
+            snprintf(file, sizeof(file), "chr%s-%s%s", keytablekey(sp->chromosomes, job->chromosome), sp->name, sp->ext);
+        }
+
+        fp = xopen(file, "w");
+        fprintf(fp, "%s\n", sp->header);
+        writerows(sp, job, fp, &rows);
+        fclose(fp);
+    }
+
+    free(rows.data);
+
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    int i, n, fieldNo, snpIDCol, chromosomeCol, positionCol, threadNo = 0, bufferSize = 1024, maxSNP = 0, eof = 0;
+    char *MKFILE = NULL, *TGFILE, *line = NULL, **fields, *next, *s, *base;
+    size_t cap = 0, used;
+    long length, lineNo = 0;
+    uint32_t snpNo = 0, snpCap = 0, orderNo = 0, k, c, first, *ranks, *chromosomeOrder, *present;
+    long mappedNo = 0, unmappedNo = 0, tgNo = 0, sharedNo = 0, sharedLocusNo = 0, droppedNo = 0;
+    int64_t blockOffset = 0, spillSize = 0;
+    int seekable;
+    KEY_TABLE snpIDs, chromosomes;
+    SPLIT sp;
+    SPLIT_SNP *snp;
+    BUFFER block = {NULL, 0, 0};
+    pthread_t *threads;
+    struct stat st;
+    FILE *fp, *spill = NULL;
+
+    if(argc==1)
+    {
+        printf("usage: fsplittg [options] -m <mk-file> <tg-file>\n");
+        printf("\n");
+        printf("       -m       mk file\n");
+        printf("                a)snp-id\n");
+        printf("                b)chromosome\n");
+        printf("                c)position\n");
+        printf("       -n       maximum number of SNPs in 1 file\n");
+        printf("       -t       number of threads writing files (default: number of processors)\n");
+        printf("       -b       MB of rows held in memory when the tg file cannot be read back\n");
+        printf("                (1024 default), the rest are held in a temporary file\n");
+        printf("       tg-file  tg file, .gz files are read through gunzip\n");
+        printf("\n");
+        printf("       example: fsplittg -n 100 -m pscalare.mk pscalare.tg\n");
+        printf("\n");
+        printf("       The splitter of fsplitchrom.  Writes chr<chromosome>[-<n>]-<tg-file>,\n");
+        printf("       the rows of each chromosome ordered by position.  The tg file is read\n");
+        printf("       once and its rows are indexed; rows of a compressed file are held in\n");
+        printf("       memory and spilled to a temporary file.  The files are written by\n");
+        printf("       the threads from the index, each holding 1 file open at a time.\n");
+        printf("       Unmapped SNPs are dropped.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"m:n:t:b:")) != -1)
+    {
+        switch(i)
+        {
+            case 'm':
+                MKFILE = optarg;
+                break;
+            case 'n':
+                maxSNP = atoi(optarg);
+                break;
+            case 't':
+                threadNo = atoi(optarg);
+                break;
+            case 'b':
+                bufferSize = atoi(optarg);
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (MKFILE == NULL || optind != argc-1 || maxSNP < 0 || bufferSize < 1)
+    {
+        fprintf(stderr, "mk file and 1 tg file expected\n");
+        exit(1);
+    }
+
+    TGFILE = argv[optind];
+    threadNo = threadNo > 0 ? threadNo : getcpuno();
+    memset(&snpIDs, 0, sizeof(KEY_TABLE));
+    memset(&chromosomes, 0, sizeof(KEY_TABLE));
+    memset(&sp, 0, sizeof(SPLIT));
+
+    fprintf(stderr, "Reading %s\n", MKFILE);
+    fp = zopen(MKFILE);
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", MKFILE);
+    }
+    fieldNo = countfields(line, '\t');
+    FRALLOC(fields, fieldNo, char *);
+    splitline(line, fields, fieldNo, '\t');
+    snpIDCol = getlabel(fields, fieldNo, "snp-id", MKFILE);
+    chromosomeCol = getlabel(fields, fieldNo, "chromosome", MKFILE);
+    positionCol = getlabel(fields, fieldNo, "position", MKFILE);
+
+    while (readline(fp, &line, &cap) != -1)
+    {
+        if (splitline(line, fields, fieldNo, '\t') != fieldNo)
+        {
+            fatal("%s: row %ld does not have %d columns\n", MKFILE, lineNo+2, fieldNo);
+        }
+        ++lineNo;
+
+        if (keytablefind(&snpIDs, fields[snpIDCol], strlen(fields[snpIDCol]), hashbytes(fields[snpIDCol], strlen(fields[snpIDCol]))) != -1)
+        {
+            fatal("%s occurs twice in %s!\n", fields[snpIDCol], MKFILE);
+        }
+        keytableadd(&snpIDs, fields[snpIDCol], strlen(fields[snpIDCol]), hashbytes(fields[snpIDCol], strlen(fields[snpIDCol])));
+
+        if (snpNo == snpCap)
+        {
+            snpCap = snpCap ? 2*snpCap : 65536;
+            sp.snps = (SPLIT_SNP *) xrealloc(sp.snps, snpCap*sizeof(SPLIT_SNP));
+        }
+        snp = &sp.snps[snpNo++];
+        snp->offset = -1;
+        snp->length = 0;
+        if (strcmp(fields[chromosomeCol], "n/a") != 0 && strcmp(fields[positionCol], "n/a") != 0)
+        {
+            snp->chromosome = keytableget(&chromosomes, fields[chromosomeCol], strlen(fields[chromosomeCol]));
+            snp->position = atoll(fields[positionCol]);
+            ++mappedNo;
+        }
+        else
+        {
+            snp->chromosome = -1;
+            ++unmappedNo;
+        }
+    }
+    zclose(fp, MKFILE);
+
+    /* stream the tg file once, indexing where each row can be read back */
+    fprintf(stderr, "Scanning %s\n", TGFILE);
+    seekable = !hasextension(TGFILE, "gz") && stat(TGFILE, &st) == 0 && S_ISREG(st.st_mode);
+    fp = zopen(TGFILE);
+    if ((length = readline(fp, &sp.header, &cap)) == -1)
+    {
+        fatal("%s is empty\n", TGFILE);
+    }
+    blockOffset = ftello(fp);
+    sp.memoryBase = seekable ? INT64_MAX : 0;
+
+    while (!eof)
+    {
+        if (block.cap - block.size < BLOCK_SIZE/2)
+        {
+            block.cap = block.size + BLOCK_SIZE;
+            block.data = (char *) xrealloc(block.data, block.cap);
+        }
+
+        used = fread(block.data + block.size, 1, block.cap - block.size - 1, fp);
+        eof = used < block.cap - block.size - 1;
+        block.size += used;
+        if (eof && block.size && block.data[block.size-1] != '\n')
+        {
+            block.data[block.size++] = '\n';
+        }
+
+        for (s=block.data + block.size; s>block.data && s[-1]!='\n'; --s);
+        if (s == block.data)
+        {
+            continue;
+        }
+        used = s - block.data;
+
+        for (line=block.data; line<block.data + used; line=next+1)
+        {
+            next = memchr(line, '\n', block.data + used - line);
+            s = memchr(line, '\t', next - line);
+            n = s == NULL ? next - line - (next > line && next[-1] == '\r') : s - line;
+
+            if ((length = keytablefind(&snpIDs, line, n, hashbytes(line, n))) == -1)
+            {
+                fatal("%.*s occurs in %s but not in %s!\n", n, line, TGFILE, MKFILE);
+            }
+
+            snp = &sp.snps[length];
+            if (snp->chromosome == -1)
+            {
+                ++droppedNo;
+                continue;
+            }
+
+            tgNo += snp->offset == -1;
+            snp->length = next + 1 - line;
+            if (seekable)
+            {
+                snp->offset = blockOffset + (line - block.data);
+                continue;
+            }
+
+            /* the memory buffer is written to the spill when it is full */
+            if (sp.memory.size + snp->length > (size_t) bufferSize*1024*1024)
+            {
+                if (spill == NULL && (spill = tmpfile()) == NULL)
+                {
+                    fatal("Cannot open a temporary file\n");
+                }
+                if (fwrite(sp.memory.data, 1, sp.memory.size, spill) != sp.memory.size)
+                {
+                    fatal("Cannot write to a temporary file\n");
+                }
+                spillSize += sp.memory.size;
+                sp.memoryBase = spillSize;
+                sp.memory.size = 0;
+            }
+            snp->offset = sp.memoryBase + sp.memory.size;
+            bufferappend(&sp.memory, line, snp->length);
+        }
+
+        blockOffset += used;
+        memmove(block.data, block.data + used, block.size - used);
+        block.size -= used;
+    }
+    zclose(fp, TGFILE);
+    free(block.data);
+
+    if (seekable)
+    {
+        sp.fd = open(TGFILE, O_RDONLY);
+    }
+    else if (spill != NULL)
+    {
+        fflush(spill);
+        sp.fd = fileno(spill);
+    }
+    if (sp.fd == -1)
+    {
+        fatal("Cannot open %s\n", TGFILE);
+    }
+
+    /* order the mapped SNPs by chromosome and position */
+    FRALLOC(chromosomeOrder, MAX(chromosomes.n, 1), uint32_t);
+    FRALLOC(ranks, MAX(chromosomes.n, 1), uint32_t);
+    for (c=0; c<chromosomes.n; c++)
+    {
+        chromosomeOrder[c] = c;
+    }
+    sortchromosomes = &chromosomes;
+    qsort(chromosomeOrder, chromosomes.n, sizeof(uint32_t), comparechromosomes);
+    for (c=0; c<chromosomes.n; c++)
+    {
+        ranks[chromosomeOrder[c]] = c;
+    }
+
+    FRALLOC(sp.order, MAX(mappedNo, 1), uint32_t);
+    for (k=0; k<snpNo; k++)
+    {
+        if (sp.snps[k].chromosome != -1)
+        {
+            sp.snps[k].chromosome = ranks[sp.snps[k].chromosome];
+            sp.order[orderNo++] = k;
+        }
+    }
+    sortsnps = sp.snps;
+    qsort(sp.order, orderNo, sizeof(uint32_t), comparesnps);
+
+    /* SNPs sharing a location */
+    for (first=0, k=1; k<=orderNo; k++)
+    {
+        if (k == orderNo || sp.snps[sp.order[k]].chromosome != sp.snps[sp.order[first]].chromosome ||
+            sp.snps[sp.order[k]].position != sp.snps[sp.order[first]].position)
+        {
+            if (k - first > 1)
+            {
+                sharedNo += k - first - 1;
+                sharedLocusNo += k - first;
+            }
+            first = k;
+        }
+    }
+
+    /* cut the present SNPs of each chromosome into files, every chromosome gets 1 */
+    FRALLOC(present, MAX(chromosomes.n, 1), uint32_t);
+    FRALLOC(sp.jobs, MAX(mappedNo, 1) + chromosomes.n, SPLIT_JOB);
+    for (first=0, c=0, k=0; k<orderNo; k++)
+    {
+        if (sp.snps[sp.order[k]].offset != -1)
+        {
+            sp.order[first++] = sp.order[k];
+        }
+        if (k == orderNo - 1 || sp.snps[sp.order[k+1]].chromosome != sp.snps[sp.order[k]].chromosome)
+        {
+            c = sp.snps[sp.order[k]].chromosome;
+            present[c] = first;
+        }
+    }
+    for (c=0, first=0; c<chromosomes.n; c++)
+    {
+        i = 1;
+        do
+        {
+            sp.jobs[sp.jobNo].chromosome = chromosomeOrder[c];
+            sp.jobs[sp.jobNo].chunk = i++;
+            sp.jobs[sp.jobNo].first = first;
+            first = maxSNP ? MIN(first + maxSNP, present[c]) : present[c];
+            sp.jobs[sp.jobNo++].last = first;
+        }
+        while (first < present[c]);
+    }
+
+    fprintf(stderr, "Splitting %s\n", TGFILE);
+    base = strrchr(TGFILE, '/') == NULL ? TGFILE : strrchr(TGFILE, '/') + 1;
+    sp.name = strdup(base);
+    sp.ext = (s = strchr(sp.name, '.')) == NULL ? "" : strdup(s);
+    if (s != NULL)
+    {
+        *s = '\0';
+    }
+    if (hasextension(sp.ext, "gz"))
+    {
+        sp.ext[strlen(sp.ext) - 3] = '\0';
+    }
+    sp.chromosomes = &chromosomes;
+    sp.chunked = maxSNP > 0;
+    pthread_mutex_init(&sp.lock, NULL);
+
+    threadNo = MAX(1, MIN(threadNo, sp.jobNo));
+    FRALLOC(threads, threadNo, pthread_t);
+    for (i=0; i<threadNo; i++)
+    {
+        if (pthread_create(&threads[i], NULL, splitworker, &sp))
+        {
+            fatal("Cannot create thread\n");
+        }
+    }
+    for (i=0; i<threadNo; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_mutex_destroy(&sp.lock);
+
+    for (c=0, first=0; c<chromosomes.n; c++)
+    {
+        fprintf(stderr, "chr%s SNPs: %u\n", keytablekey(&chromosomes, chromosomeOrder[c]), present[c] - first);
+        first = present[c];
+    }
+    fprintf(stderr, "SNPs in mk-file: %ld\n", mappedNo);
+    fprintf(stderr, "SNPs in tg-file (subset of mk-file) : %ld\n", tgNo);
+    fprintf(stderr, "Unmapped SNPs (dropped): %ld\n", unmappedNo);
+    fprintf(stderr, "No.of SNPs sharing locations (retained): %ld (%ld loci)\n", sharedNo, sharedLocusNo);
+
+    if (spill != NULL)
+    {
+        fclose(spill);
+    }
+    else if (seekable)
+    {
+        close(sp.fd);
+    }
+
+    return 0;
+}
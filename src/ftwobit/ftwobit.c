@@ -0,0 +1,296 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <fralib.h>
+
+static TWOBIT *tb;
+
+/* chromosomes sort numerically when both are numbers, as the fraTools scripts do */
+static int comparechromosomes(const void *a, const void *b)
+{
+    char *c1 = tb->sequences[*(int *)a].chromosome;
+    char *c2 = tb->sequences[*(int *)b].chromosome;
+    char *s;
+
+    for (s=c1; *s && isdigit(*s); s++);
+    if (*s == '\0' && *c1)
+    {
+        for (s=c2; *s && isdigit(*s); s++);
+        if (*s == '\0' && *c2)
+        {
+            return atoi(c1) - atoi(c2);
+        }
+    }
+
+    return strcmp(c1, c2);
+}
+
+static void printsummary(char *chr, int detailed, int combined)
+{
+    TWOBIT_SEQUENCE *seq;
+    int *order;
+    uint32_t i, j, k, n;
+
+    printf("Summary for %s\n\n", tb->file);
+    printf("Signature: %x\n", tb->signature);
+    printf("Version: %d\n", tb->version);
+    printf("Sequence Count: %d\n", tb->sequenceNo);
+    printf("Reserved: %d\n\n", tb->reserved);
+
+    FRALLOC(order, MAX(tb->sequenceNo, 1), int);
+    for (i=0; i<tb->sequenceNo; i++)
+    {
+        order[i] = i;
+    }
+    qsort(order, tb->sequenceNo, sizeof(int), comparechromosomes);
+
+    for (k=0; k<tb->sequenceNo; k++)
+    {
+        seq = &tb->sequences[order[k]];
+        if (chr != NULL && strcmp(chr, seq->chromosome) != 0)
+        {
+            continue;
+        }
+
+        twobitload(tb, order[k]);
+        printf("=============\n");
+        printf("Chromosome %s\n", seq->chromosome);
+        printf("=============\n");
+        printf("Name:   %s\n", seq->name);
+        printf("Offset: %lu\n", (unsigned long) seq->offset);
+        printf("Size:   %u\n", seq->dnaSize);
+        printf("\t\n");
+
+        if (!detailed)
+        {
+            continue;
+        }
+
+        printf("Unknown Blocks (%u)\n", seq->nBlockNo);
+        if (!combined)
+        {
+            for (i=0; i<seq->nBlockNo; i++)
+            {
+                printf("%2d) %9u %9u\n", i+1, seq->nBlockStarts[i], seq->nBlockSizes[i]);
+            }
+            printf("\nMasked Blocks (%u)\n", seq->maskBlockNo);
+            for (i=0; i<seq->maskBlockNo; i++)
+            {
+                printf("%2d) %9u %9u\n", i+1, seq->maskBlockStarts[i], seq->maskBlockSizes[i]);
+            }
+        }
+        else
+        {
+            printf("Masked Blocks (%u)\n", seq->maskBlockNo);
+            printf("Combined Blocks (%u)\n", seq->nBlockNo + seq->maskBlockNo);
+
+            /* merge the two sorted block lists */
+            for (i=0, j=0, n=1; i<seq->nBlockNo || j<seq->maskBlockNo; n++)
+            {
+                if (j == seq->maskBlockNo || (i < seq->nBlockNo && seq->nBlockStarts[i] <= seq->maskBlockStarts[j]))
+                {
+                    printf("%2d) %9u %9u\n", n, seq->nBlockStarts[i], seq->nBlockSizes[i]);
+                    ++i;
+                }
+                else
+                {
+                    printf("%2d) %9u %9u\n", n, seq->maskBlockStarts[j], seq->maskBlockSizes[j]);
+                    ++j;
+                }
+            }
+        }
+    }
+
+    free(order);
+}
+
+static int isiupac(char c)
+{
+    return c != '\0' && strchr("ACGTMRWSYKVHDBNXacgtmrwsykvhdbnx", c) != NULL;
+}
+
+/* arm length needed to compare against the flanks in the mk file */
+static int getarmlength(char *flanks)
+{
+    char *open, *close, *s;
+    int fivePrimeLength = 0, threePrimeLength = 0;
+
+    if ((open = strchr(flanks, '[')) == NULL || (close = strrchr(flanks, ']')) == NULL || close < open)
+    {
+        return -1;
+    }
+
+    for (s=open-1; s>=flanks && isiupac(*s); s--)
+    {
+        ++fivePrimeLength;
+    }
+    for (s=close+1; isiupac(*s); s++)
+    {
+        ++threePrimeLength;
+    }
+
+    return MAX(fivePrimeLength, threePrimeLength);
+}
+
+int main(int argc, char **argv)
+{
+    int i, n, fieldNo, snpIDCol, chromosomeCol, positionCol, flanksCol, armLength;
+    int defaultArmLength = 60;
+    int printSummary = 0, printDetailedSummary = 0, combined = 0, softMask = 0;
+    int queryNo = 0, queryCap = 0;
+    char *TWOBITFILE = NULL;
+    char *MKFILE = NULL;
+    char *chr = NULL;
+    char *line = NULL;
+    char **fields, **snpIDs = NULL, **chromosomes = NULL, **positions = NULL;
+    size_t cap = 0;
+    FLANK_QUERY *queries = NULL;
+    FILE *fp;
+
+    if(argc==1)
+    {
+        printf("usage: ftwobit [options] -g <2bit-file> [mk-file]\n");
+        printf("\n");
+        printf("       -g       2bit encoding of a genome\n");
+        printf("       -p       print summary of 2bit file\n");
+        printf("       -P       print detailed summary of 2bit file\n");
+        printf("       -c       combine unknown and masked blocks in the detailed summary\n");
+        printf("       -s       restrict the summary to a chromosome\n");
+        printf("       -l       flank length on each side when the mk file has no flanks (default 60)\n");
+        printf("       -m       print masked bases in lower case\n");
+        printf("       mk-file  mk file\n");
+        printf("                a)snp-id\n");
+        printf("                b)chromosome\n");
+        printf("                c)position\n");
+        printf("                d)flanks (optional)\n");
+        printf("\n");
+        printf("       example: ftwobit -g homo-sapiens-35.1.2bit pscalare.mk\n");
+        printf("\n");
+        printf("       Extracts the reference flanks of every SNP in the mk file, in one sweep of\n");
+        printf("       the memory mapped 2bit file, and prints them in mk file order as\n");
+        printf("       snp-id, chromosome, position and xflanks.  When the mk file has flanks,\n");
+        printf("       the longer of their arms is extracted on both sides as in fannotatestrands.\n");
+        printf("       Unknown bases are printed as N.\n");
+        printf("\n");
+        exit(1);
+    }
+
+    /* process flags */
+    while((i = getopt(argc,argv,"g:pPcs:l:m")) != -1)
+    {
+        switch(i)
+        {
+            case 'g':
+                TWOBITFILE = optarg;
+                break;
+            case 'p':
+                printSummary = 1;
+                break;
+            case 'P':
+                printDetailedSummary = 1;
+                break;
+            case 'c':
+                combined = 1;
+                break;
+            case 's':
+                chr = optarg;
+                break;
+            case 'l':
+                defaultArmLength = atoi(optarg);
+                break;
+            case 'm':
+                softMask = 1;
+                break;
+            case '?':
+                fprintf(stderr, "Unrecognized option: -%c\n", optopt);
+                exit(1);
+        }
+    }
+
+    if (TWOBITFILE == NULL || optind < argc-1 || defaultArmLength < 0)
+    {
+        fprintf(stderr, "2bit file and at most 1 mk file expected\n");
+        exit(1);
+    }
+
+    tb = twobitopen(TWOBITFILE);
+
+    if (printSummary || printDetailedSummary)
+    {
+        printsummary(chr, printDetailedSummary, combined);
+    }
+
+    if (optind == argc)
+    {
+        twobitclose(tb);
+        return 0;
+    }
+
+    MKFILE = argv[optind];
+    fp = xopen(MKFILE, "r");
+    if (readline(fp, &line, &cap) == -1)
+    {
+        fatal("%s is empty\n", MKFILE);
+    }
+
+    fieldNo = countfields(line, '\t');
+    FRALLOC(fields, fieldNo, char *);
+    splitline(line, fields, fieldNo, '\t');
+    snpIDCol = getlabel(fields, fieldNo, "snp-id", MKFILE);
+    chromosomeCol = getlabel(fields, fieldNo, "chromosome", MKFILE);
+    positionCol = getlabel(fields, fieldNo, "position", MKFILE);
+    flanksCol = findlabel(fields, fieldNo, "flanks");
+
+    while (readline(fp, &line, &cap) != -1)
+    {
+        if ((n = splitline(line, fields, fieldNo, '\t')) != fieldNo)
+        {
+            fatal("%s: row %d does not have %d columns\n", MKFILE, queryNo+2, fieldNo);
+        }
+
+        if (queryNo == queryCap)
+        {
+            queryCap = queryCap ? 2*queryCap : 65536;
+            queries = (FLANK_QUERY *) xrealloc(queries, queryCap*sizeof(FLANK_QUERY));
+            snpIDs = (char **) xrealloc(snpIDs, queryCap*sizeof(char *));
+            chromosomes = (char **) xrealloc(chromosomes, queryCap*sizeof(char *));
+            positions = (char **) xrealloc(positions, queryCap*sizeof(char *));
+        }
+
+        armLength = flanksCol == -1 ? defaultArmLength : getarmlength(fields[flanksCol]);
+        snpIDs[queryNo] = strdup(fields[snpIDCol]);
+        chromosomes[queryNo] = strdup(fields[chromosomeCol]);
+        positions[queryNo] = strdup(fields[positionCol]);
+        queries[queryNo].sequence = armLength < 0 ? -1 : twobitfind(tb, fields[chromosomeCol]);
+        queries[queryNo].position = isdigit(fields[positionCol][0]) ? strtoul(fields[positionCol], NULL, 10) : 0;
+        queries[queryNo].fivePrimeLength = armLength;
+        queries[queryNo].threePrimeLength = armLength;
+        ++queryNo;
+    }
+    fclose(fp);
+
+    twobitgetflanks(tb, queries, queryNo, softMask);
+
+    printf("snp-id\tchromosome\tposition\txflanks\n");
+    for (i=0; i<queryNo; i++)
+    {
+        printf("%s\t%s\t%s\t%s\n", snpIDs[i], chromosomes[i], positions[i],
+               queries[i].flanks == NULL ? "n/a" : queries[i].flanks);
+        free(queries[i].flanks);
+        free(snpIDs[i]);
+        free(chromosomes[i]);
+        free(positions[i]);
+    }
+
+    free(queries);
+    free(snpIDs);
+    free(chromosomes);
+    free(positions);
+    free(fields);
+    free(line);
+    twobitclose(tb);
+
+    return 0;
+}